@@ -0,0 +1,85 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ServiceConfiguration.hpp
+ */
+
+#ifndef _DDSROUTERCORE_CONFIGURATION_SERVICECONFIGURATION_HPP_
+#define _DDSROUTERCORE_CONFIGURATION_SERVICECONFIGURATION_HPP_
+
+#include <chrono>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/BaseConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/topic/rpc/RPCRoutingPolicy.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+/**
+ * This data struct contains the values to configure how the requests of a service are routed to servers
+ * and how those pending of reply are tracked:
+ * - Routing policy
+ * - Maximum number of pending requests
+ * - Time after which a pending request expires
+ */
+struct ServiceConfiguration : public BaseConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI ServiceConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Policy to choose the participants through which each request is forwarded
+    types::RPCRoutingPolicy routing_policy = types::RPCRoutingPolicy::broadcast;
+
+    /**
+     * @brief Maximum number of requests pending of reply stored for each participant.
+     *
+     * When it is reached, the oldest request is evicted and its reply will not be forwarded.
+     */
+    unsigned int max_pending_requests = 5000;
+
+    /**
+     * @brief Time after which a request pending of reply expires and its reply will not be forwarded.
+     *
+     * @note Value 0 means that requests never expire.
+     */
+    std::chrono::milliseconds request_timeout{0};
+};
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_CONFIGURATION_SERVICECONFIGURATION_HPP_ */
@@ -19,12 +19,16 @@
 #ifndef _DDSROUTERCORE_CONFIGURATION_SPECSCONFIGURATION_HPP_
 #define _DDSROUTERCORE_CONFIGURATION_SPECSCONFIGURATION_HPP_
 
+#include <map>
 #include <memory>
 #include <set>
+#include <string>
 
 #include <cpp_utils/Formatter.hpp>
 
 #include <ddsrouter_core/configuration/BaseConfiguration.hpp>
+#include <ddsrouter_core/configuration/ServiceConfiguration.hpp>
+#include <ddsrouter_core/configuration/StatisticsConfiguration.hpp>
 #include <ddsrouter_core/library/library_dll.h>
 #include <ddsrouter_core/types/dds/TopicQoS.hpp>
 
@@ -36,7 +40,11 @@ namespace configuration {
 /**
  * This data struct contains the values for advance configuration of the DDS Router such as:
  * - Number of threads to Thread Pool
+ * - Number of threads to construct Bridges
  * - Default maximum history depth
+ * - Routing and tracking of service requests
+ * - Publication of statistics
+ * - Profiling of the transmissions with hardware performance counters
  */
 struct SpecsConfiguration : public BaseConfiguration
 {
@@ -54,18 +62,42 @@ struct SpecsConfiguration : public BaseConfiguration
     DDSROUTER_CORE_DllAPI bool is_valid(
             utils::Formatter& error_msg) const noexcept override;
 
+    //! Configuration for service \c service_name (specific one if set, default otherwise)
+    DDSROUTER_CORE_DllAPI ServiceConfiguration service_configuration(
+            const std::string& service_name) const noexcept;
+
     /////////////////////////
     // VARIABLES
     /////////////////////////
 
     unsigned int number_of_threads = 12;
 
+    //! Number of threads that construct the Bridges of new topics in parallel
+    unsigned int bridge_construction_threads = 4;
+
     /**
      * @brief Maximum of History depth by default in those topics where it is not specified.
      *
      * @note Default value is 5000 as in Fast DDS.
      */
     types::HistoryDepthType max_history_depth = 5000;
+
+    //! Configuration for services without a specific one
+    ServiceConfiguration default_service;
+
+    //! Specific service configurations by service name
+    std::map<std::string, ServiceConfiguration> services;
+
+    //! Publication of the DDS Router statistics in a DDS topic
+    StatisticsConfiguration statistics;
+
+    /**
+     * @brief Whether every transmission of every Track is profiled with hardware performance counters.
+     *
+     * The counters are read twice per transmission task, so it adds a few system calls per task.
+     * They are reported in the statistics of each Track.
+     */
+    bool profiling = false;
 };
 
 } /* namespace configuration */
@@ -0,0 +1,91 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsConfiguration.hpp
+ */
+
+#ifndef _DDSROUTERCORE_CONFIGURATION_STATISTICSCONFIGURATION_HPP_
+#define _DDSROUTERCORE_CONFIGURATION_STATISTICSCONFIGURATION_HPP_
+
+#include <chrono>
+#include <string>
+
+#include <cpp_utils/Formatter.hpp>
+
+#include <ddsrouter_core/configuration/BaseConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/dds/DomainId.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+/**
+ * This data struct contains the values to configure the publication of the DDS Router statistics in a DDS topic:
+ * - Whether statistics are published
+ * - Domain and topic where they are published
+ * - Publication period
+ * - Frequency of full snapshots
+ */
+struct StatisticsConfiguration : public BaseConfiguration
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI StatisticsConfiguration() = default;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Whether statistics are published
+    bool enabled = false;
+
+    //! Domain of the participant that publishes the statistics
+    types::DomainId domain;
+
+    //! Name of the topic where statistics are published
+    std::string topic_name = "ddsrouter/statistics";
+
+    //! Time between two consecutive publications
+    std::chrono::milliseconds period{1000};
+
+    /**
+     * @brief Number of publications between two full snapshots.
+     *
+     * Every publication only contains the topics and participants with activity since the previous one,
+     * except full snapshots, that contain all of them.
+     *
+     * @note Value 0 means that only the first publication is a full snapshot.
+     */
+    unsigned int full_snapshot_period = 10;
+};
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_CONFIGURATION_STATISTICSCONFIGURATION_HPP_ */
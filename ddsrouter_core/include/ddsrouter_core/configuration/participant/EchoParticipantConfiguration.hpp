@@ -47,6 +47,10 @@ struct EchoParticipantConfiguration : public ParticipantConfiguration
     bool echo_discovery = true;
     //! Whether this Participant should echo verbose information
     bool verbose = false;
+    //! Whether this Participant should only aggregate statistics of the data received instead of echoing each sample
+    bool statistics = false;
+    //! Milliseconds between summaries of the statistics of the data received
+    unsigned int statistics_period = 1000;
 };
 
 } /* namespace configuration */
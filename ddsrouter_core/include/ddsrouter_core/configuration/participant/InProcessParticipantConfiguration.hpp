@@ -0,0 +1,73 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessParticipantConfiguration.hpp
+ */
+
+#ifndef _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_INPROCESSPARTICIPANTCONFIGURATION_HPP_
+#define _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_INPROCESSPARTICIPANTCONFIGURATION_HPP_
+
+#include <memory>
+
+#include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/InProcessConnector.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+/**
+ * This data struct represents a configuration for an InProcessParticipant
+ *
+ * The host application keeps a reference to \c connector to communicate with the participant.
+ */
+struct InProcessParticipantConfiguration : public ParticipantConfiguration
+{
+public:
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+    DDSROUTER_CORE_DllAPI InProcessParticipantConfiguration() = default;
+
+    DDSROUTER_CORE_DllAPI InProcessParticipantConfiguration(
+            const types::ParticipantId& id,
+            const types::ParticipantKind& kind,
+            const bool is_repeater,
+            std::shared_ptr<InProcessConnector> connector) noexcept;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Connector the application uses to write and receive data. A new one is created by default.
+    std::shared_ptr<InProcessConnector> connector = std::make_shared<InProcessConnector>();
+};
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_INPROCESSPARTICIPANTCONFIGURATION_HPP_ */
@@ -0,0 +1,124 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadGeneratorParticipantConfiguration.hpp
+ */
+
+#ifndef _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_LOADGENERATORPARTICIPANTCONFIGURATION_HPP_
+#define _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_LOADGENERATORPARTICIPANTCONFIGURATION_HPP_
+
+#include <string>
+
+#include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/participant/LoadSizeDistribution.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+/**
+ * This data struct represents a configuration for a LoadGeneratorParticipant
+ */
+struct LoadGeneratorParticipantConfiguration : public ParticipantConfiguration
+{
+public:
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+    DDSROUTER_CORE_DllAPI LoadGeneratorParticipantConfiguration() = default;
+
+    DDSROUTER_CORE_DllAPI LoadGeneratorParticipantConfiguration(
+            const types::ParticipantId& id,
+            const types::ParticipantKind& kind,
+            const bool is_repeater) noexcept;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /**
+     * @brief Equal comparator
+     *
+     * @param [in] other: LoadGeneratorParticipantConfiguration to compare.
+     * @return True if both configurations are the same, False otherwise.
+     */
+    DDSROUTER_CORE_DllAPI bool operator ==(
+            const LoadGeneratorParticipantConfiguration& other) const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Number of topics where samples are generated. 0 to only measure the samples received.
+    unsigned int topic_count = 1;
+
+    //! Topics generated are named \c topic_prefix followed by \c _ and their index
+    std::string topic_prefix = DEFAULT_TOPIC_PREFIX;
+
+    //! Type name of the topics generated
+    std::string type_name = DEFAULT_TYPE_NAME;
+
+    //! Samples generated per second in each topic. 0 generates samples as fast as possible.
+    double rate = 100;
+
+    //! Samples generated together in each topic, keeping the average \c rate
+    unsigned int burst = 1;
+
+    //! Minimum size in bytes of the samples generated
+    unsigned int min_size = MIN_SAMPLE_SIZE;
+
+    //! Maximum size in bytes of the samples generated
+    unsigned int max_size = MIN_SAMPLE_SIZE;
+
+    //! Distribution of the sizes between \c min_size and \c max_size
+    types::LoadSizeDistribution size_distribution = types::LoadSizeDistribution::uniform;
+
+    //! Number of different keys of the samples generated. 0 makes the topics not keyed.
+    unsigned int keys = 0;
+
+    //! Whether the topics generated are reliable
+    bool reliable = false;
+
+    //! Whether the topics generated are transient local
+    bool transient_local = false;
+
+    //! Milliseconds between reports of the samples generated and received. 0 to only report when destroyed.
+    unsigned int report_period = DEFAULT_REPORT_PERIOD;
+
+    //! Default \c topic_prefix
+    DDSROUTER_CORE_DllAPI static const char* DEFAULT_TOPIC_PREFIX;
+
+    //! Default \c type_name
+    DDSROUTER_CORE_DllAPI static const char* DEFAULT_TYPE_NAME;
+
+    //! Minimum size of a sample, that holds its key and sequence number
+    DDSROUTER_CORE_DllAPI static const unsigned int MIN_SAMPLE_SIZE;
+
+    //! Default \c report_period
+    DDSROUTER_CORE_DllAPI static const unsigned int DEFAULT_REPORT_PERIOD;
+};
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_LOADGENERATORPARTICIPANTCONFIGURATION_HPP_ */
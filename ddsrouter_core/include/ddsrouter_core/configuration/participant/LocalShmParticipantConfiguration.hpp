@@ -0,0 +1,93 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LocalShmParticipantConfiguration.hpp
+ */
+
+#ifndef _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_LOCALSHMPARTICIPANTCONFIGURATION_HPP_
+#define _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_LOCALSHMPARTICIPANTCONFIGURATION_HPP_
+
+#include <cstdint>
+
+#include <ddsrouter_core/configuration/participant/SimpleParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+/**
+ * This data struct represents a configuration for a LocalShmParticipant
+ *
+ * Values set to 0 use the Fast DDS default ones.
+ */
+struct LocalShmParticipantConfiguration : public SimpleParticipantConfiguration
+{
+public:
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+    DDSROUTER_CORE_DllAPI LocalShmParticipantConfiguration() = default;
+
+    DDSROUTER_CORE_DllAPI LocalShmParticipantConfiguration(
+            const types::ParticipantId& id,
+            const types::ParticipantKind& kind,
+            const bool is_repeater,
+            const types::DomainId& domain_id,
+            const uint32_t segment_size = 0,
+            const uint32_t port_queue_capacity = 0) noexcept;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /**
+     * @brief Equal comparator
+     *
+     * @param [in] other: LocalShmParticipantConfiguration to compare.
+     * @return True if both configurations are the same, False otherwise.
+     */
+    DDSROUTER_CORE_DllAPI bool operator ==(
+            const LocalShmParticipantConfiguration& other) const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    /**
+     * Size in bytes of the shared memory segment where the participant writes its messages.
+     *
+     * It also limits the size of the messages sent, so samples bigger than it are fragmented.
+     */
+    uint32_t segment_size = 0;
+
+    //! Number of messages that fit in the shared memory port of the participant before new ones are discarded
+    uint32_t port_queue_capacity = 0;
+
+    //! Minimum size of the shared memory segment accepted
+    DDSROUTER_CORE_DllAPI static const uint32_t MIN_SEGMENT_SIZE;
+};
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_LOCALSHMPARTICIPANTCONFIGURATION_HPP_ */
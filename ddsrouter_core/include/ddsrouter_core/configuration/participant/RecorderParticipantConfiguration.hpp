@@ -0,0 +1,94 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderParticipantConfiguration.hpp
+ */
+
+#ifndef _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_RECORDERPARTICIPANTCONFIGURATION_HPP_
+#define _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_RECORDERPARTICIPANTCONFIGURATION_HPP_
+
+#include <cstdint>
+#include <string>
+
+#include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+/**
+ * This data struct represents a configuration for a RecorderParticipant
+ */
+struct RecorderParticipantConfiguration : public ParticipantConfiguration
+{
+public:
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+    DDSROUTER_CORE_DllAPI RecorderParticipantConfiguration() = default;
+
+    DDSROUTER_CORE_DllAPI RecorderParticipantConfiguration(
+            const types::ParticipantId& id,
+            const types::ParticipantKind& kind,
+            const bool is_repeater,
+            const std::string& file_path,
+            const uint64_t chunk_size = DEFAULT_CHUNK_SIZE,
+            const uint64_t max_pending_bytes = DEFAULT_MAX_PENDING_BYTES) noexcept;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /**
+     * @brief Equal comparator
+     *
+     * @param [in] other: RecorderParticipantConfiguration to compare.
+     * @return True if both configurations are the same, False otherwise.
+     */
+    DDSROUTER_CORE_DllAPI bool operator ==(
+            const RecorderParticipantConfiguration& other) const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Path of the capture file to write. It is overwritten if it already exists.
+    std::string file_path;
+
+    //! Size of the blocks of the file that are preallocated and mapped in memory at once
+    uint64_t chunk_size = DEFAULT_CHUNK_SIZE;
+
+    //! Maximum size of the samples waiting to be written in the file before new ones are dropped
+    uint64_t max_pending_bytes = DEFAULT_MAX_PENDING_BYTES;
+
+    //! Default \c chunk_size (16 MB)
+    DDSROUTER_CORE_DllAPI static const uint64_t DEFAULT_CHUNK_SIZE;
+
+    //! Default \c max_pending_bytes (256 MB)
+    DDSROUTER_CORE_DllAPI static const uint64_t DEFAULT_MAX_PENDING_BYTES;
+};
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_RECORDERPARTICIPANTCONFIGURATION_HPP_ */
@@ -0,0 +1,95 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReplayerParticipantConfiguration.hpp
+ */
+
+#ifndef _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_REPLAYERPARTICIPANTCONFIGURATION_HPP_
+#define _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_REPLAYERPARTICIPANTCONFIGURATION_HPP_
+
+#include <string>
+
+#include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+/**
+ * This data struct represents a configuration for a ReplayerParticipant
+ */
+struct ReplayerParticipantConfiguration : public ParticipantConfiguration
+{
+public:
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+    DDSROUTER_CORE_DllAPI ReplayerParticipantConfiguration() = default;
+
+    DDSROUTER_CORE_DllAPI ReplayerParticipantConfiguration(
+            const types::ParticipantId& id,
+            const types::ParticipantKind& kind,
+            const bool is_repeater,
+            const std::string& file_path,
+            const double speed = 1.0,
+            const unsigned int start_delay = DEFAULT_START_DELAY) noexcept;
+
+    /////////////////////////
+    // METHODS
+    /////////////////////////
+
+    DDSROUTER_CORE_DllAPI virtual bool is_valid(
+            utils::Formatter& error_msg) const noexcept override;
+
+    /**
+     * @brief Equal comparator
+     *
+     * @param [in] other: ReplayerParticipantConfiguration to compare.
+     * @return True if both configurations are the same, False otherwise.
+     */
+    DDSROUTER_CORE_DllAPI bool operator ==(
+            const ReplayerParticipantConfiguration& other) const noexcept;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Path of the capture file to replay
+    std::string file_path;
+
+    /**
+     * Speed of the replay regarding the original timing of the samples.
+     *
+     * 1 replays the samples with the original time between them, 2 twice as fast, 0.5 twice as slow, etc.
+     * 0 replays the samples as fast as possible.
+     */
+    double speed = 1.0;
+
+    //! Milliseconds to wait since the router starts until the replay starts, so every bridge is created
+    unsigned int start_delay = DEFAULT_START_DELAY;
+
+    //! Default \c start_delay
+    DDSROUTER_CORE_DllAPI static const unsigned int DEFAULT_START_DELAY;
+};
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_CONFIGURATION_PARTICIPANT_REPLAYERPARTICIPANTCONFIGURATION_HPP_ */
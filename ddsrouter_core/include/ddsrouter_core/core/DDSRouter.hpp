@@ -19,13 +19,17 @@
 #ifndef _DDSROUTERCORE_CORE_DDSROUTERCORE_HPP_
 #define _DDSROUTERCORE_CORE_DDSROUTERCORE_HPP_
 
+#include <map>
 #include <memory>
+#include <string>
 
 #include <cpp_utils/ReturnCode.hpp>
 
 #include <ddsrouter_core/configuration/DDSRouterConfiguration.hpp>
 #include <ddsrouter_core/configuration/DDSRouterReloadConfiguration.hpp>
 #include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+#include <ddsrouter_core/types/statistics/ServiceStatistics.hpp>
 
 
 namespace eprosima {
@@ -103,6 +107,63 @@ public:
      */
     DDSROUTER_CORE_DllAPI utils::ReturnCode stop() noexcept;
 
+    // STATISTICS
+    /**
+     * @brief Statistics of the requests forwarded by each service
+     *
+     * For each service, the requests are accounted by participant through which they have been forwarded to the
+     * servers: number of requests, replies, orphan replies, requests pending of reply, timeouts and the histogram
+     * of the request to reply round trip time.
+     *
+     * @return statistics indexed by service name
+     */
+    DDSROUTER_CORE_DllAPI std::map<std::string, types::ServiceStatistics> services_statistics() noexcept;
+
+    /**
+     * @brief Statistics of the data forwarded in each topic
+     *
+     * For each topic, the data is accounted by the Track of each participant (samples and bytes taken and
+     * written, take and write errors, samples not written in any Writer, and latency from the source timestamp
+     * until written in every Writer) and by the Writer of each participant (samples and bytes written, write
+     * errors and latency from the source timestamp until written).
+     *
+     * Values are accumulated since the Bridge of the topic was created, so the rate of a topic is obtained by
+     * comparing two consecutive snapshots.
+     * It does not block the router while discovering or reloading, so it can be called periodically.
+     *
+     * The memory held by the Readers and Writers of each topic is only computed if \c memory is set.
+     * That requires locking every endpoint while iterating its history, so it is meant for reports on request.
+     *
+     * @param memory whether the memory held by each topic is also computed
+     *
+     * @return statistics of every topic with a Bridge, and usage of the payload pool and thread pool
+     */
+    DDSROUTER_CORE_DllAPI types::RouterStatistics statistics(
+            bool memory = false) noexcept;
+
+    // TRACING
+    /**
+     * @brief Whether the stages of every sample forwarded are traced
+     *
+     * Tracing is only compiled in with CMake option \c DDSROUTER_TRACE .
+     */
+    DDSROUTER_CORE_DllAPI static bool tracing_enabled() noexcept;
+
+    /**
+     * @brief Write the stages traced in every thread of the process (the latest ones of each thread)
+     *
+     * The file is in Chrome trace event JSON format, that can be loaded in Perfetto UI or chrome://tracing .
+     * It can be called at any moment, while the routers keep forwarding data.
+     *
+     * @param [in] file_path : file to write, replaced if it exists
+     *
+     * @return \c RETCODE_OK if the file has been written
+     * @return \c RETCODE_NOT_ENABLED if tracing is not compiled in
+     * @return \c RETCODE_ERROR if the file could not be written
+     */
+    DDSROUTER_CORE_DllAPI static utils::ReturnCode dump_trace(
+            const std::string& file_path) noexcept;
+
 protected:
 
     std::unique_ptr<DDSRouterImpl> ddsrouter_impl_;
@@ -0,0 +1,211 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessConnector.hpp
+ */
+
+#ifndef _DDSROUTERCORE_CORE_INPROCESSCONNECTOR_HPP_
+#define _DDSROUTERCORE_CORE_INPROCESSCONNECTOR_HPP_
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/dds/Data.hpp>
+#include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+class InProcessParticipant;
+class PayloadPool;
+
+/**
+ * Entry point of the host application to an \c in-process Participant of a DDS Router running in the same process.
+ *
+ * The application creates a connector, sets it in the \c InProcessParticipantConfiguration of the participant
+ * and uses it to exchange serialized samples with the router without any RTPS traffic:
+ * - Samples written with \c write are moved into the router as if a Reader of the participant had received them.
+ * - Samples that the router forwards to the participant are given to the callback set with \c set_data_callback .
+ *
+ * Payloads live in the router \c PayloadPool and are shared by reference count, so no data is copied when
+ * writing a loaned payload, nor when delivering a sample to the application.
+ *
+ * @note Payloads loaned or retained must be given back to the router with \c write or \c release_payload .
+ *
+ * Thread safe.
+ */
+class InProcessConnector
+{
+public:
+
+    /**
+     * @brief Callback to receive the samples the router forwards to the application
+     *
+     * The payload of \c data is only valid during the callback. Use \c retain_payload to keep it afterwards.
+     *
+     * @warning It is called from router threads, so it must not block, nor call \c set_data_callback .
+     */
+    using DataCallback = std::function<void (const types::DdsTopic& topic, const types::DataReceived& data)>;
+
+    //! Create a connector not attached to any participant yet
+    DDSROUTER_CORE_DllAPI InProcessConnector() = default;
+
+    //! Whether a participant of a running router is attached to this connector
+    DDSROUTER_CORE_DllAPI bool connected() const noexcept;
+
+    /////
+    // DISCOVERY
+
+    /**
+     * @brief Announce to the router that the application publishes in \c topic
+     *
+     * Samples written in this topic are set with the guid of this publication as source.
+     *
+     * @return \c RETCODE_OK if the publication has been announced
+     * @return \c RETCODE_NOT_ENABLED if the connector is not attached to a participant
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode announce_publication(
+            const types::DdsTopic& topic) noexcept;
+
+    /**
+     * @brief Announce to the router that the application subscribes to \c topic
+     *
+     * As with any other discovered subscription, the router starts forwarding data of this topic.
+     *
+     * @return \c RETCODE_OK if the subscription has been announced
+     * @return \c RETCODE_NOT_ENABLED if the connector is not attached to a participant
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode announce_subscription(
+            const types::DdsTopic& topic) noexcept;
+
+    /////
+    // APPLICATION TO ROUTER
+
+    /**
+     * @brief Reserve a payload of \c size bytes in the router \c PayloadPool
+     *
+     * The application serializes its sample directly in \c payload and then passes it to \c write ,
+     * so the sample is never copied.
+     *
+     * @return \c RETCODE_OK if the payload has been reserved
+     * @return \c RETCODE_NOT_ENABLED if the connector has never been attached to a participant
+     * @return \c RETCODE_ERROR if the pool could not reserve the payload
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode loan_payload(
+            uint32_t size,
+            types::Payload& payload) noexcept;
+
+    /**
+     * @brief Write a payload loaned with \c loan_payload in \c topic
+     *
+     * The payload is moved to the router, so \c payload is left empty whatever the result.
+     *
+     * @return \c RETCODE_OK if the sample has been given to the router
+     * @return \c RETCODE_NOT_ENABLED if the connector is not attached to a participant
+     * @return \c RETCODE_PRECONDITION_NOT_MET if the router does not forward \c topic (yet)
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            const types::DdsTopic& topic,
+            types::Payload& payload) noexcept;
+
+    /**
+     * @brief Write a sample serialized in a buffer of the application in \c topic
+     *
+     * The sample is copied once into the router \c PayloadPool .
+     *
+     * @return same values as \c write with a loaned payload
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode write(
+            const types::DdsTopic& topic,
+            const types::PayloadUnit* data,
+            uint32_t size) noexcept;
+
+    /////
+    // ROUTER TO APPLICATION
+
+    //! Set the callback that receives the samples forwarded to the application. Replaces the previous one.
+    DDSROUTER_CORE_DllAPI void set_data_callback(
+            DataCallback callback) noexcept;
+
+    /**
+     * @brief Keep a reference to a payload received in the data callback after the callback returns
+     *
+     * \c target shares the data of \c src (no copy is done) until it is released with \c release_payload .
+     *
+     * @return \c RETCODE_OK if the payload has been retained
+     * @return \c RETCODE_NOT_ENABLED if the connector has never been attached to a participant
+     */
+    DDSROUTER_CORE_DllAPI utils::ReturnCode retain_payload(
+            const types::Payload& src,
+            types::Payload& target) noexcept;
+
+    //! Release a payload loaned or retained and not written
+    DDSROUTER_CORE_DllAPI utils::ReturnCode release_payload(
+            types::Payload& payload) noexcept;
+
+protected:
+
+    /**
+     * @brief Attach the participant that serves this connector
+     *
+     * @return false if another participant is already attached
+     */
+    bool attach_(
+            InProcessParticipant* participant,
+            std::shared_ptr<PayloadPool> payload_pool) noexcept;
+
+    //! Detach the participant. The payload pool is kept so payloads still held by the application can be released.
+    void detach_() noexcept;
+
+    //! Give \c data forwarded by the router in \c topic to the application callback
+    void on_data_(
+            const types::DdsTopic& topic,
+            const types::DataReceived& data) noexcept;
+
+    //! Participant attached. Nullptr if not attached
+    InProcessParticipant* participant_ = nullptr;
+
+    //! Router Payload Pool. Set when the first participant is attached
+    std::shared_ptr<PayloadPool> payload_pool_;
+
+    //! Guid of the publication announced for each topic
+    std::map<types::DdsTopic, types::Guid> publications_;
+
+    //! Guard \c participant_ , \c payload_pool_ and \c publications_
+    mutable std::mutex participant_mutex_;
+
+    //! Callback to give data to the application
+    DataCallback callback_;
+
+    //! Guard \c callback_
+    std::mutex callback_mutex_;
+
+    // Participant and writers are the ones that attach and call the connector
+    friend class InProcessParticipant;
+    friend class InProcessWriter;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_CORE_INPROCESSCONNECTOR_HPP_ */
@@ -65,6 +65,14 @@ public:
             const ParticipantId& discoverer_participant_id = ParticipantId(),
             const SpecificEndpointQoS& specific_qos = SpecificEndpointQoS()) noexcept;
 
+    //! Copy constructor
+    DDSROUTER_CORE_DllAPI Endpoint(
+            const Endpoint& other) = default;
+
+    //! Move constructor (allows queuing discovered endpoints without copying them)
+    DDSROUTER_CORE_DllAPI Endpoint(
+            Endpoint&& other) = default;
+
     //! Endpoint kind getter
     DDSROUTER_CORE_DllAPI EndpointKind kind() const noexcept;
 
@@ -0,0 +1,53 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadSizeDistribution.hpp
+ */
+
+#ifndef _DDSROUTERCORE_TYPES_PARTICIPANT_LOADSIZEDISTRIBUTION_HPP_
+#define _DDSROUTERCORE_TYPES_PARTICIPANT_LOADSIZEDISTRIBUTION_HPP_
+
+#include <iostream>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Distribution of the sizes of the samples produced by a load generator Participant, between a minimum and a
+ * maximum size.
+ */
+enum class LoadSizeDistribution
+{
+    uniform,        //! Every size between minimum and maximum is equally likely
+    exponential,    //! Sizes close to the minimum are more likely, with mean a quarter of the way to the maximum
+};
+
+/**
+ * @brief \c LoadSizeDistribution to stream serialization
+ */
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const LoadSizeDistribution& distribution);
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_TYPES_PARTICIPANT_LOADSIZEDISTRIBUTION_HPP_ */
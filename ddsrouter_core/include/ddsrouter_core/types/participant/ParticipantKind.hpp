@@ -41,9 +41,14 @@ enum class ParticipantKind : ParticipantKindType
     local_discovery_server,     //! Discovery Server RTPS Participant Kind
     wan_discovery_server,       //! Discovery Server Inter Router Participant Kind
     wan_initial_peers,          //! Initial Peers Inter Router Participant Kind
+    local_shm,                  //! Shared Memory RTPS Participant Kind
+    in_process,                 //! In-process application Participant Kind
+    recorder,                   //! Capture file recorder Participant Kind
+    replayer,                   //! Capture file replayer Participant Kind
+    load_generator,             //! Synthetic load generator and sink Participant Kind
 };
 
-static constexpr unsigned PARTICIPANT_KIND_COUNT = 8;
+static constexpr unsigned PARTICIPANT_KIND_COUNT = 13;
 
 /**
  * @brief All ParticipantKind enum values as a std::array.
@@ -57,6 +62,11 @@ constexpr std::array<ParticipantKind, PARTICIPANT_KIND_COUNT> ALL_PARTICIPANT_KI
     ParticipantKind::local_discovery_server,
     ParticipantKind::wan_discovery_server,
     ParticipantKind::wan_initial_peers,
+    ParticipantKind::local_shm,
+    ParticipantKind::in_process,
+    ParticipantKind::recorder,
+    ParticipantKind::replayer,
+    ParticipantKind::load_generator,
 };
 
 /**
@@ -71,6 +81,11 @@ constexpr std::array<ParticipantKind, PARTICIPANT_KIND_COUNT - 1> ALL_VALID_PART
     ParticipantKind::local_discovery_server,
     ParticipantKind::wan_discovery_server,
     ParticipantKind::wan_initial_peers,
+    ParticipantKind::local_shm,
+    ParticipantKind::in_process,
+    ParticipantKind::recorder,
+    ParticipantKind::replayer,
+    ParticipantKind::load_generator,
 };
 
 constexpr std::array<const char*, PARTICIPANT_KIND_COUNT> PARTICIPANT_KIND_STRINGS = {
@@ -82,6 +97,11 @@ constexpr std::array<const char*, PARTICIPANT_KIND_COUNT> PARTICIPANT_KIND_STRIN
     "local-discovery-server",
     "wan-ds",
     "wan-initial-peers",
+    "local-shm",
+    "in-process",
+    "recorder",
+    "replayer",
+    "load-generator",
 };
 
 static constexpr unsigned MAX_PARTICIPANT_KIND_ALIASES = 4;
@@ -100,6 +120,11 @@ constexpr std::array<ParticipantKindAliasesType, PARTICIPANT_KIND_COUNT> PARTICI
     ParticipantKindAliasesType({"discovery-server", "ds", "local-ds", "local-discovery-server"}),
     ParticipantKindAliasesType({"wan-ds", "wan-discovery-server", "", ""}),
     ParticipantKindAliasesType({"wan", "router", "initial-peers", ""}),
+    ParticipantKindAliasesType({"local-shm", "shm", "shared-memory", ""}),
+    ParticipantKindAliasesType({"in-process", "application", "", ""}),
+    ParticipantKindAliasesType({"recorder", "record", "", ""}),
+    ParticipantKindAliasesType({"replayer", "replay", "", ""}),
+    ParticipantKindAliasesType({"load-generator", "load", "generator", ""}),
 };
 
 DDSROUTER_CORE_DllAPI std::ostream& operator <<(
@@ -0,0 +1,106 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyHistogram.hpp
+ */
+
+#ifndef _DDSROUTERCORE_TYPES_STATISTICS_LATENCYHISTOGRAM_HPP_
+#define _DDSROUTERCORE_TYPES_STATISTICS_LATENCYHISTOGRAM_HPP_
+
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Histogram of latencies with logarithmic buckets.
+ *
+ * Bucket \c i counts the latencies in nanoseconds in range [2^i, 2^(i+1)), except the first one, that also counts
+ * latencies lower than 1 ns, and the last one, that counts every latency over its lower limit.
+ * Percentiles are therefore approximated by the upper limit of the bucket they fall in.
+ *
+ * @warning This class is not thread safe.
+ */
+struct LatencyHistogram
+{
+    //! Unit of the latencies stored
+    using Duration = std::chrono::nanoseconds;
+
+    //! Number of buckets of the histogram (the last one holds latencies over 2^47 ns ~ 39 hours)
+    static constexpr std::size_t NUMBER_OF_BUCKETS = 48;
+
+    //! Add a new latency
+    DDSROUTER_CORE_DllAPI void add(
+            const Duration& latency) noexcept;
+
+    //! Add every latency stored in \c other
+    DDSROUTER_CORE_DllAPI void merge(
+            const LatencyHistogram& other) noexcept;
+
+    //! Mean of the latencies stored (0 if empty)
+    DDSROUTER_CORE_DllAPI Duration mean() const noexcept;
+
+    /**
+     * @brief Approximate percentile of the latencies stored
+     *
+     * @param [in] percentile: value in range [0, 1] (e.g. 0.99 for the 99th percentile)
+     *
+     * @return upper limit of the bucket where the percentile falls, bounded by \c min and \c max (0 if empty)
+     */
+    DDSROUTER_CORE_DllAPI Duration percentile(
+            double percentile) const noexcept;
+
+    //! Bucket where \c latency is counted
+    DDSROUTER_CORE_DllAPI static std::size_t bucket_index(
+            const Duration& latency) noexcept;
+
+    //! Upper limit (excluded) of the latencies counted in bucket \c index
+    DDSROUTER_CORE_DllAPI static Duration bucket_upper_limit(
+            std::size_t index) noexcept;
+
+    //! Number of latencies counted in each bucket
+    std::array<uint64_t, NUMBER_OF_BUCKETS> buckets {};
+
+    //! Number of latencies stored
+    uint64_t count = 0;
+
+    //! Sum of the latencies stored
+    Duration total = Duration::zero();
+
+    //! Minimum latency stored
+    Duration min = Duration::max();
+
+    //! Maximum latency stored
+    Duration max = Duration::zero();
+};
+
+//! \c LatencyHistogram to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const LatencyHistogram& histogram);
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_TYPES_STATISTICS_LATENCYHISTOGRAM_HPP_ */
@@ -0,0 +1,270 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RouterStatistics.hpp
+ */
+
+#ifndef _DDSROUTERCORE_TYPES_STATISTICS_ROUTERSTATISTICS_HPP_
+#define _DDSROUTERCORE_TYPES_STATISTICS_ROUTERSTATISTICS_HPP_
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <map>
+#include <utility>
+#include <vector>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/statistics/LatencyHistogram.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Statistics of the data forwarded by a Track: the data taken from the Reader of a participant and written in
+ * the Writers of the rest of participants of a topic.
+ */
+struct TrackStatistics
+{
+    //! Add the values of \c other to these ones
+    DDSROUTER_CORE_DllAPI void merge(
+            const TrackStatistics& other) noexcept;
+
+    //! Number of samples taken from the Reader
+    uint64_t samples_in = 0;
+
+    //! Bytes of payload taken from the Reader
+    uint64_t bytes_in = 0;
+
+    //! Number of times taking a sample from the Reader failed
+    uint64_t take_errors = 0;
+
+    //! Number of samples written, adding up every Writer
+    uint64_t samples_out = 0;
+
+    //! Bytes of payload written, adding up every Writer
+    uint64_t bytes_out = 0;
+
+    //! Number of times writing a sample in a Writer failed
+    uint64_t write_errors = 0;
+
+    //! Number of samples taken that could not be written in any Writer
+    uint64_t dropped = 0;
+
+    //! Time from the source timestamp of each sample until it has been written in every Writer
+    LatencyHistogram latency;
+
+    //! Number of transmission tasks of the Track profiled (0 unless profiling is enabled in the specs)
+    uint64_t profiled_transmissions = 0;
+
+    //! CPU cycles spent in user space by the transmission tasks profiled
+    uint64_t cycles = 0;
+
+    //! Instructions retired in user space by the transmission tasks profiled
+    uint64_t instructions = 0;
+
+    //! Last level cache misses in user space of the transmission tasks profiled
+    uint64_t cache_misses = 0;
+
+    //! Context switches of the threads while running the transmission tasks profiled
+    uint64_t context_switches = 0;
+};
+
+/**
+ * Statistics of the data written in the Writer of a participant in a topic, from every Track of the topic.
+ */
+struct WriterStatistics
+{
+    //! Add the values of \c other to these ones
+    DDSROUTER_CORE_DllAPI void merge(
+            const WriterStatistics& other) noexcept;
+
+    //! Number of samples written
+    uint64_t samples = 0;
+
+    //! Bytes of payload written
+    uint64_t bytes = 0;
+
+    //! Number of times writing a sample failed
+    uint64_t write_errors = 0;
+
+    //! Time from the source timestamp of each sample until it has been written
+    LatencyHistogram latency;
+};
+
+/**
+ * Memory held by the endpoints of a topic: the cache changes in their histories and the payloads they reference.
+ *
+ * Payloads are shared between histories (a sample forwarded to several Writers is referenced by all of them).
+ * The bytes referenced by each kind of history add up a shared payload once per history that references it, while
+ * \c payload_bytes counts every distinct payload once, so it is the memory actually held.
+ * Payload sizes are the length of their data, without the overhead of the payload pool.
+ */
+struct MemoryStatistics
+{
+    //! Add the values of \c other to these ones (the payloads of different topics are always different)
+    DDSROUTER_CORE_DllAPI void merge(
+            const MemoryStatistics& other) noexcept;
+
+    //! Estimation of the bytes held: distinct payloads and cache changes allocated
+    DDSROUTER_CORE_DllAPI uint64_t bytes() const noexcept;
+
+    //! Number of cache changes in the histories of the Readers
+    uint64_t reader_history_changes = 0;
+
+    //! Bytes of payload referenced by the histories of the Readers
+    uint64_t reader_history_bytes = 0;
+
+    //! Number of cache changes in the histories of the Writers
+    uint64_t writer_history_changes = 0;
+
+    //! Bytes of payload referenced by the histories of the Writers
+    uint64_t writer_history_bytes = 0;
+
+    //! Number of distinct payloads referenced by any history
+    uint64_t payloads = 0;
+
+    //! Bytes of the distinct payloads referenced by any history, each counted once
+    uint64_t payload_bytes = 0;
+
+    //! Number of cache changes allocated by the CacheChangePools of the Writers (only repeater Writers have one)
+    uint64_t cache_change_pool_elements = 0;
+
+    //! Number of cache changes of the CacheChangePools currently reserved
+    uint64_t cache_change_pool_reserved = 0;
+
+    //! Bytes of the cache changes in the histories and of those allocated in the pools and not reserved
+    uint64_t cache_change_bytes = 0;
+};
+
+/**
+ * Statistics of the data forwarded in a topic.
+ */
+struct TopicStatistics
+{
+    //! Statistics of all Tracks added up
+    DDSROUTER_CORE_DllAPI TrackStatistics total() const noexcept;
+
+    //! Statistics of the Track of each participant, indexed by the participant that receives the data
+    std::map<ParticipantId, TrackStatistics> tracks;
+
+    //! Statistics of the Writer of each participant, indexed by the participant that writes the data
+    std::map<ParticipantId, WriterStatistics> writers;
+
+    //! Memory held by the Readers and Writers of every participant (only filled when explicitly requested)
+    MemoryStatistics memory;
+
+    //! Time since the Bridge of the topic was requested until it forwarded its first data (0 if none yet)
+    std::chrono::nanoseconds time_to_first_forward{0};
+};
+
+/**
+ * Usage of the payload pool shared by every endpoint of a DDS Router.
+ */
+struct PayloadPoolStatistics
+{
+    //! Number of payloads currently reserved and not released
+    DDSROUTER_CORE_DllAPI uint64_t in_use() const noexcept;
+
+    //! Number of payloads reserved since the pool was created
+    uint64_t reserved = 0;
+
+    //! Number of payloads released since the pool was created
+    uint64_t released = 0;
+};
+
+/**
+ * Usage of the thread pool that runs the Tracks of a DDS Router.
+ */
+struct ThreadPoolStatistics
+{
+    //! Number of threads of the pool
+    uint64_t threads = 0;
+
+    //! Number of Tracks transmitting or waiting for a thread to transmit
+    uint64_t busy_tracks = 0;
+};
+
+/**
+ * Statistics of the data forwarded by a DDS Router, by topic, and of the resources it uses to forward it.
+ */
+struct RouterStatistics
+{
+    //! Statistics of every topic added up
+    DDSROUTER_CORE_DllAPI TrackStatistics total() const noexcept;
+
+    /**
+     * @brief Topics that hold more memory, in decreasing order of \c MemoryStatistics::bytes .
+     *
+     * @param [in] n maximum number of topics returned
+     */
+    DDSROUTER_CORE_DllAPI std::vector<std::pair<DdsTopic, MemoryStatistics>> top_memory_topics(
+            std::size_t n) const;
+
+    //! Statistics of each topic with a Bridge
+    std::map<DdsTopic, TopicStatistics> topics;
+
+    //! Usage of the payload pool
+    PayloadPoolStatistics payload_pool;
+
+    //! Usage of the thread pool
+    ThreadPoolStatistics thread_pool;
+};
+
+//! \c TrackStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const TrackStatistics& statistics);
+
+//! \c WriterStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const WriterStatistics& statistics);
+
+//! \c MemoryStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const MemoryStatistics& statistics);
+
+//! \c TopicStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const TopicStatistics& statistics);
+
+//! \c PayloadPoolStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const PayloadPoolStatistics& statistics);
+
+//! \c ThreadPoolStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const ThreadPoolStatistics& statistics);
+
+//! \c RouterStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const RouterStatistics& statistics);
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_TYPES_STATISTICS_ROUTERSTATISTICS_HPP_ */
@@ -0,0 +1,93 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ServiceStatistics.hpp
+ */
+
+#ifndef _DDSROUTERCORE_TYPES_STATISTICS_SERVICESTATISTICS_HPP_
+#define _DDSROUTERCORE_TYPES_STATISTICS_SERVICESTATISTICS_HPP_
+
+#include <cstdint>
+#include <iostream>
+#include <map>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/statistics/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Statistics of the requests of a service forwarded through a participant to the servers reachable through it.
+ */
+struct ServiceParticipantStatistics
+{
+    //! Add the values of \c other to these ones
+    DDSROUTER_CORE_DllAPI void merge(
+            const ServiceParticipantStatistics& other) noexcept;
+
+    //! Number of requests forwarded to the servers
+    uint64_t requests = 0;
+
+    //! Number of replies received for a request pending of reply
+    uint64_t replies = 0;
+
+    //! Number of replies received that did not match any request pending of reply (already replied, expired or evicted)
+    uint64_t orphan_replies = 0;
+
+    //! Number of requests pending of reply
+    uint64_t outstanding_requests = 0;
+
+    //! Number of requests that expired before their reply arrived
+    uint64_t timeouts = 0;
+
+    //! Number of requests discarded before their reply arrived because too many requests were pending
+    uint64_t evictions = 0;
+
+    //! Time from the request being forwarded until its first reply arrives
+    LatencyHistogram round_trip_time;
+};
+
+/**
+ * Statistics of a service, by participant through which its requests are forwarded.
+ */
+struct ServiceStatistics
+{
+    //! Statistics of all participants added up
+    DDSROUTER_CORE_DllAPI ServiceParticipantStatistics total() const noexcept;
+
+    //! Statistics of each participant with servers of the service
+    std::map<ParticipantId, ServiceParticipantStatistics> participants;
+};
+
+//! \c ServiceParticipantStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const ServiceParticipantStatistics& statistics);
+
+//! \c ServiceStatistics to stream serialization
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const ServiceStatistics& statistics);
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_TYPES_STATISTICS_SERVICESTATISTICS_HPP_ */
@@ -0,0 +1,125 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RegexDdsFilterTopic.hpp
+ */
+
+#ifndef _DDSROUTERCORE_TYPES_TOPIC_FILTER_REGEXDDSFILTERTOPIC_HPP_
+#define _DDSROUTERCORE_TYPES_TOPIC_FILTER_REGEXDDSFILTERTOPIC_HPP_
+
+#include <iostream>
+#include <regex>
+#include <string>
+
+#include <ddsrouter_core/library/library_dll.h>
+#include <ddsrouter_core/types/topic/filter/DdsFilterTopic.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Data struct that uses ECMAScript regular expressions to filter a DDS Topic.
+ *
+ * Regular expressions must match the whole topic name (and type name if set).
+ * They are compiled once when the object is constructed, so they cannot be modified afterwards.
+ */
+struct RegexDdsFilterTopic : public DdsFilterTopic
+{
+
+    /////////////////////////
+    // CONSTRUCTORS
+    /////////////////////////
+
+    /**
+     * @brief Construct and compile a regex filter.
+     *
+     * @param [in] topic_name regular expression for topic name
+     * @param [in] type_name regular expression for type name. If not set matches with all.
+     *
+     * @throw \c InitializationException if any of the regular expressions is not valid
+     */
+    DDSROUTER_CORE_DllAPI RegexDdsFilterTopic(
+            const std::string& topic_name,
+            const utils::Fuzzy<std::string>& type_name = utils::Fuzzy<std::string>());
+
+    /////////////////////////
+    // FILTER METHODS
+    /////////////////////////
+
+    /**
+     * @brief Implement \c contains parent method.
+     *
+     * Containment between regular expressions is not computed, so a regex filter only contains
+     * filters equal to itself.
+     */
+    DDSROUTER_CORE_DllAPI virtual bool contains(
+            const DdsFilterTopic& other) const;
+
+    //! Implement \c matches parent method.
+    DDSROUTER_CORE_DllAPI virtual bool matches(
+            const DdsTopic& real_topic) const;
+
+    //! Whether \c real_topic matches the type name and key filters, without checking the topic name
+    DDSROUTER_CORE_DllAPI bool matches_type_and_key(
+            const DdsTopic& real_topic) const;
+
+    /////////////////////////
+    // SERIALIZATION METHODS
+    /////////////////////////
+
+    //! Override parent \c serialize method.
+    DDSROUTER_CORE_DllAPI virtual std::ostream& serialize(
+            std::ostream& os) const override;
+
+    /////////////////////////
+    // VARIABLES
+    /////////////////////////
+
+    //! Topic name regular expression
+    const std::string topic_name;
+
+    //! Type name regular expression. If not set matches with all.
+    const utils::Fuzzy<std::string> type_name;
+
+    //! Whether the topic has key or not
+    utils::Fuzzy<bool> keyed;
+
+    //! Flags used to compile every regular expression of a filter
+    DDSROUTER_CORE_DllAPI static const std::regex::flag_type REGEX_FLAGS;
+
+protected:
+
+    //! Compiled \c topic_name
+    std::regex topic_name_regex_;
+
+    //! Compiled \c type_name (only valid if \c type_name is set)
+    std::regex type_name_regex_;
+};
+
+/**
+ * Serialization method for \c RegexDdsFilterTopic object.
+ */
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const RegexDdsFilterTopic& t);
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_TYPES_TOPIC_FILTER_REGEXDDSFILTERTOPIC_HPP_ */
@@ -0,0 +1,57 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RPCRoutingPolicy.hpp
+ */
+
+#ifndef _DDSROUTERCORE_TYPES_TOPIC_RPC_RPCROUTINGPOLICY_HPP_
+#define _DDSROUTERCORE_TYPES_TOPIC_RPC_RPCROUTINGPOLICY_HPP_
+
+#include <iostream>
+
+#include <ddsrouter_core/library/library_dll.h>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+/**
+ * Policy to choose the participants through which a service request is forwarded to servers.
+ *
+ * Only participants with servers available (and different from the one that received the request, unless repeater)
+ * are candidates.
+ */
+enum class RPCRoutingPolicy
+{
+    broadcast,          //! Forward every request through every candidate
+    round_robin,        //! Forward each request through the next candidate
+    least_outstanding,  //! Forward each request through the candidate with fewer requests pending of reply
+    hash_by_client,     //! Forward every request of the same client through the same candidate
+};
+
+/**
+ * @brief \c RPCRoutingPolicy to stream serialization
+ */
+DDSROUTER_CORE_DllAPI std::ostream& operator <<(
+        std::ostream& os,
+        const RPCRoutingPolicy& policy);
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* _DDSROUTERCORE_TYPES_TOPIC_RPC_RPCROUTINGPOLICY_HPP_ */
@@ -0,0 +1,217 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CaptureFormat.hpp
+ *
+ * Layout of the capture files written by the recorder participant.
+ *
+ * A capture file is made of:
+ * - A \c CaptureFileHeader at offset 0, in a block of \c CAPTURE_FILE_HEADER_SIZE bytes.
+ * - Consecutive chunks, each one starting with a \c CaptureChunkHeader followed by records.
+ *   Chunks are aligned to \c CAPTURE_ALIGNMENT so each one can be mapped in memory independently.
+ * - Records, each one a \c CaptureRecordHeader followed by its payload, padded to \c CAPTURE_RECORD_ALIGNMENT .
+ *   A \c topic record (written before any data of its topic) holds topic name and type name, each one followed
+ *   by a null character, and a byte of \c CAPTURE_TOPIC_* flags. A \c data record holds the serialized payload
+ *   of a sample, that is empty for a dispose or unregister of a keyed topic.
+ * - The index, written when the file is closed: a \c CaptureIndexHeader and, for each topic,
+ *   a \c CaptureTopicIndexHeader followed by one \c CaptureIndexEntry per chunk with data of the topic.
+ *
+ * Every value is stored in the byte order of the host that writes the file.
+ * Times are nanoseconds since epoch.
+ */
+
+#ifndef __SRC_DDSROUTERCORE_CAPTURE_CAPTUREFORMAT_HPP_
+#define __SRC_DDSROUTERCORE_CAPTURE_CAPTUREFORMAT_HPP_
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+//! Identifier at the beginning of every capture file
+constexpr const char CAPTURE_MAGIC[8] = {'D', 'D', 'S', 'R', 'C', 'A', 'P', '\0'};
+
+//! Version of the format
+constexpr uint32_t CAPTURE_VERSION = 1;
+
+//! Alignment of chunks in file. Multiple of the page size of every usual platform, so chunks can be mapped.
+constexpr uint64_t CAPTURE_ALIGNMENT = 64 * 1024;
+
+//! Size reserved for the file header, so first chunk is aligned
+constexpr uint64_t CAPTURE_FILE_HEADER_SIZE = CAPTURE_ALIGNMENT;
+
+//! Alignment of every record inside a chunk
+constexpr uint64_t CAPTURE_RECORD_ALIGNMENT = 8;
+
+//! Identifier at the beginning of every chunk ("CHNK")
+constexpr uint32_t CAPTURE_CHUNK_MAGIC = 0x4B4E4843;
+
+//! Identifier at the beginning of the index ("INDX")
+constexpr uint32_t CAPTURE_INDEX_MAGIC = 0x58444E49;
+
+//! Topic flag: the topic has key
+constexpr uint8_t CAPTURE_TOPIC_KEYED = 0x01;
+
+//! Topic flag: the topic is reliable
+constexpr uint8_t CAPTURE_TOPIC_RELIABLE = 0x02;
+
+//! Topic flag: the topic is transient local
+constexpr uint8_t CAPTURE_TOPIC_TRANSIENT_LOCAL = 0x04;
+
+//! Header of a capture file
+struct CaptureFileHeader
+{
+    //! Must be \c CAPTURE_MAGIC
+    char magic[8];
+
+    //! Must be \c CAPTURE_VERSION
+    uint32_t version;
+
+    //! Number of topics recorded
+    uint32_t topic_count;
+
+    //! Nominal size of the chunks (a chunk is bigger if a single record does not fit in it)
+    uint64_t chunk_size;
+
+    //! Number of chunks in the file
+    uint64_t chunk_count;
+
+    //! Offset of the index. 0 if the file was not closed correctly, so it has no index
+    uint64_t index_offset;
+
+    //! Size of the index
+    uint64_t index_size;
+
+    //! Time when the recording started
+    int64_t start_time;
+
+    //! Time when the recording finished
+    int64_t end_time;
+};
+
+//! Header of each chunk
+struct CaptureChunkHeader
+{
+    //! Must be \c CAPTURE_CHUNK_MAGIC
+    uint32_t magic;
+
+    //! Number of records in the chunk
+    uint32_t record_count;
+
+    //! Size of the chunk in the file, header included
+    uint64_t size;
+
+    //! Bytes of the chunk used by the header and the records
+    uint64_t used;
+
+    //! Reception time of the first data record in the chunk
+    int64_t first_time;
+
+    //! Reception time of the last data record in the chunk
+    int64_t last_time;
+};
+
+//! Kind of a record
+enum class CaptureRecordKind : uint16_t
+{
+    topic = 1,  //! Topic definition
+    data = 2,   //! Sample received
+};
+
+//! Header of each record
+struct CaptureRecordHeader
+{
+    //! Size of the record, header and padding included
+    uint32_t size;
+
+    //! \c CaptureRecordKind of the record
+    uint16_t kind;
+
+    //! Change kind of a data record (\c ChangeKind_t of the sample). 0 (ALIVE) in topic records
+    uint16_t change_kind;
+
+    //! Id of the topic of the record, given in order of appearance
+    uint32_t topic_id;
+
+    //! Length of the payload following the header
+    uint32_t payload_length;
+
+    //! Time when the router forwarded the sample to the recorder
+    int64_t reception_time;
+
+    //! Source timestamp of the sample
+    int64_t source_time;
+
+    //! Sequence number of the sample in its original writer
+    uint64_t sequence_number;
+
+    //! Guid of the original writer (12 bytes of prefix and 4 of entity id)
+    uint8_t source_guid[16];
+};
+
+//! Header of the index
+struct CaptureIndexHeader
+{
+    //! Must be \c CAPTURE_INDEX_MAGIC
+    uint32_t magic;
+
+    //! Number of topics indexed
+    uint32_t topic_count;
+};
+
+//! Header of the index of each topic
+struct CaptureTopicIndexHeader
+{
+    //! Id of the topic
+    uint32_t topic_id;
+
+    //! Number of \c CaptureIndexEntry that follow
+    uint32_t entry_count;
+
+    //! Number of data records of the topic
+    uint64_t sample_count;
+};
+
+//! Time index entry: first data record of a topic in a chunk
+struct CaptureIndexEntry
+{
+    //! Reception time of the record
+    int64_t time;
+
+    //! Offset of the record in the file
+    uint64_t offset;
+};
+
+static_assert(sizeof(CaptureFileHeader) == 64, "Unexpected padding in CaptureFileHeader");
+static_assert(sizeof(CaptureChunkHeader) == 40, "Unexpected padding in CaptureChunkHeader");
+static_assert(sizeof(CaptureRecordHeader) == 56, "Unexpected padding in CaptureRecordHeader");
+static_assert(sizeof(CaptureIndexEntry) == 16, "Unexpected padding in CaptureIndexEntry");
+
+//! Round \c value up to a multiple of \c alignment
+constexpr uint64_t capture_align(
+        uint64_t value,
+        uint64_t alignment)
+{
+    return (value + alignment - 1) / alignment * alignment;
+}
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_CAPTURE_CAPTUREFORMAT_HPP_ */
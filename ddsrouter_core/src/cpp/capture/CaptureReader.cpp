@@ -0,0 +1,227 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CaptureReader.cpp
+ */
+
+#include <algorithm>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <capture/CaptureReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+using namespace eprosima::ddsrouter::core::types;
+
+CaptureReader::CaptureReader(
+        const std::string& path)
+    : file_(std::make_unique<MappedFile>(path, false))
+    , header_{}
+    , chunks_end_(0)
+    , sample_count_(0)
+    , first_time_(0)
+    , chunk_offset_(CAPTURE_FILE_HEADER_SIZE)
+    , record_offset_(0)
+{
+    uint64_t size = file_->size();
+    if (size < sizeof(CaptureFileHeader))
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "File " << path << " is not a capture file: too small.");
+    }
+
+    region_ = file_->map(0, size);
+    region_->advise_sequential();
+
+    std::memcpy(&header_, region_->data(), sizeof(header_));
+    if (std::memcmp(header_.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)) != 0)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "File " << path << " is not a capture file.");
+    }
+    if (header_.version != CAPTURE_VERSION)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Capture file " << path << " has version " << header_.version <<
+                      ", only version " << CAPTURE_VERSION << " is supported.");
+    }
+
+    if (header_.index_offset != 0 && header_.index_offset <= size)
+    {
+        chunks_end_ = header_.index_offset;
+    }
+    else
+    {
+        logWarning(DDSROUTER_CAPTURE, "Capture file " << path << " was not closed correctly, it may be incomplete.");
+        chunks_end_ = size;
+    }
+
+    // Read every record header once to know the topics before replaying them
+    rewind();
+    while (const CaptureRecordHeader* record = next_record_())
+    {
+        if (record->kind == static_cast<uint16_t>(CaptureRecordKind::topic))
+        {
+            add_topic_(record);
+        }
+        else if (record->kind == static_cast<uint16_t>(CaptureRecordKind::data))
+        {
+            if (sample_count_ == 0)
+            {
+                first_time_ = record->reception_time;
+            }
+            ++sample_count_;
+        }
+    }
+    rewind();
+
+    logInfo(DDSROUTER_CAPTURE,
+            "Capture file " << path << " opened with " << topics_.size() << " topics and " << sample_count_ <<
+            " samples.");
+}
+
+const CaptureFileHeader& CaptureReader::header() const noexcept
+{
+    return header_;
+}
+
+const std::vector<DdsTopic>& CaptureReader::topics() const noexcept
+{
+    return topics_;
+}
+
+uint64_t CaptureReader::sample_count() const noexcept
+{
+    return sample_count_;
+}
+
+int64_t CaptureReader::first_time() const noexcept
+{
+    return first_time_;
+}
+
+bool CaptureReader::next(
+        CaptureSample& sample) noexcept
+{
+    while (const CaptureRecordHeader* record = next_record_())
+    {
+        // Samples of unknown topics are skipped
+        if (record->kind == static_cast<uint16_t>(CaptureRecordKind::data) &&
+                record->topic_id < topics_.size() && !topics_[record->topic_id].topic_name.empty())
+        {
+            sample.header = record;
+            sample.payload = reinterpret_cast<const uint8_t*>(record) + sizeof(CaptureRecordHeader);
+            return true;
+        }
+    }
+    return false;
+}
+
+void CaptureReader::rewind() noexcept
+{
+    chunk_offset_ = CAPTURE_FILE_HEADER_SIZE;
+    record_offset_ = chunk_offset_ + capture_align(sizeof(CaptureChunkHeader), CAPTURE_RECORD_ALIGNMENT);
+}
+
+const CaptureRecordHeader* CaptureReader::next_record_() noexcept
+{
+    const uint8_t* data = region_->data();
+
+    while (chunk_offset_ + sizeof(CaptureChunkHeader) <= chunks_end_)
+    {
+        CaptureChunkHeader chunk;
+        std::memcpy(&chunk, data + chunk_offset_, sizeof(chunk));
+
+        if (chunk.magic != CAPTURE_CHUNK_MAGIC || chunk.size == 0 || chunk.used > chunk.size)
+        {
+            logWarning(DDSROUTER_CAPTURE, "Corrupt chunk in capture file at offset " << chunk_offset_ << ".");
+            chunk_offset_ = chunks_end_;
+            return nullptr;
+        }
+
+        uint64_t chunk_end = std::min(chunk_offset_ + chunk.used, chunks_end_);
+        if (record_offset_ + sizeof(CaptureRecordHeader) <= chunk_end)
+        {
+            // Records are aligned to 8 bytes inside a page aligned mapping, so they can be accessed in place
+            const CaptureRecordHeader* record = reinterpret_cast<const CaptureRecordHeader*>(data + record_offset_);
+
+            if (record->size < sizeof(CaptureRecordHeader) + record->payload_length ||
+                    record_offset_ + record->size > chunk_end)
+            {
+                logWarning(DDSROUTER_CAPTURE, "Corrupt record in capture file at offset " << record_offset_ << ".");
+                chunk_offset_ = chunks_end_;
+                return nullptr;
+            }
+
+            record_offset_ += record->size;
+            return record;
+        }
+
+        // Next chunk
+        chunk_offset_ += chunk.size;
+        record_offset_ = chunk_offset_ + capture_align(sizeof(CaptureChunkHeader), CAPTURE_RECORD_ALIGNMENT);
+    }
+
+    return nullptr;
+}
+
+void CaptureReader::add_topic_(
+        const CaptureRecordHeader* record)
+{
+    const char* content = reinterpret_cast<const char*>(record) + sizeof(CaptureRecordHeader);
+    uint32_t length = record->payload_length;
+
+    // Topic name and type name end with a null character, then a byte of flags
+    std::size_t name_length = strnlen(content, length);
+    std::size_t type_length = (name_length < length) ? strnlen(content + name_length + 1, length - name_length - 1) : 0;
+    if (name_length + type_length + 3 > length)
+    {
+        logWarning(DDSROUTER_CAPTURE, "Corrupt topic record with id " << record->topic_id << " in capture file.");
+        return;
+    }
+    uint8_t flags = static_cast<uint8_t>(content[name_length + type_length + 2]);
+
+    TopicQoS qos;
+    if (flags & CAPTURE_TOPIC_RELIABLE)
+    {
+        qos.reliability_qos = ReliabilityKind::RELIABLE;
+    }
+    if (flags & CAPTURE_TOPIC_TRANSIENT_LOCAL)
+    {
+        qos.durability_qos = DurabilityKind::TRANSIENT_LOCAL;
+    }
+
+    if (record->topic_id >= topics_.size())
+    {
+        topics_.resize(record->topic_id + 1);
+    }
+    topics_[record->topic_id] = DdsTopic(
+        std::string(content, name_length),
+        std::string(content + name_length + 1, type_length),
+        (flags & CAPTURE_TOPIC_KEYED) != 0,
+        qos);
+}
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
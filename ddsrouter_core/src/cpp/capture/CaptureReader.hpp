@@ -0,0 +1,141 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CaptureReader.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_CAPTURE_CAPTUREREADER_HPP_
+#define __SRC_DDSROUTERCORE_CAPTURE_CAPTUREREADER_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+#include <capture/CaptureFormat.hpp>
+#include <capture/MappedFile.hpp>
+#include <capture/MappedRegion.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+//! Data record read from a capture file. Pointers refer to the memory mapped file.
+struct CaptureSample
+{
+    //! Header of the record, with the properties of the sample
+    const CaptureRecordHeader* header = nullptr;
+
+    //! Serialized payload of the sample, \c header->payload_length bytes
+    const uint8_t* payload = nullptr;
+};
+
+/**
+ * Reads a capture file written by \c CaptureWriter .
+ *
+ * The whole file is mapped in memory, so samples are read without copying them.
+ * Files that were not closed correctly (with no index) can also be read, although samples of the last chunk
+ * may be missing.
+ */
+class CaptureReader
+{
+public:
+
+    /**
+     * @brief Open and map a capture file, and read its topics
+     *
+     * @param path path of the file
+     *
+     * @throw \c InitializationException if the file could not be opened or is not a valid capture file
+     */
+    CaptureReader(
+            const std::string& path);
+
+    //! Header of the file
+    const CaptureFileHeader& header() const noexcept;
+
+    //! Topics of the file. The position of each topic in the vector is its id.
+    const std::vector<types::DdsTopic>& topics() const noexcept;
+
+    //! Number of samples in the file
+    uint64_t sample_count() const noexcept;
+
+    //! Reception time of the first sample. 0 if there are no samples.
+    int64_t first_time() const noexcept;
+
+    /**
+     * @brief Read the next sample, in the order they were recorded
+     *
+     * @param [out] sample next sample
+     *
+     * @return true if a sample has been read
+     * @return false if there are no more samples
+     */
+    bool next(
+            CaptureSample& sample) noexcept;
+
+    //! Go back to the first sample
+    void rewind() noexcept;
+
+protected:
+
+    /**
+     * @brief Next record of the file, of any kind
+     *
+     * @return header of the record, or nullptr if there are no more records or the file is corrupt
+     */
+    const CaptureRecordHeader* next_record_() noexcept;
+
+    //! Add the topic described by a topic record
+    void add_topic_(
+            const CaptureRecordHeader* record);
+
+    //! File
+    std::unique_ptr<MappedFile> file_;
+
+    //! Whole file mapped in memory
+    std::unique_ptr<MappedRegion> region_;
+
+    //! Header of the file
+    CaptureFileHeader header_;
+
+    //! End of the chunks (beginning of the index, or end of the file if there is no index)
+    uint64_t chunks_end_;
+
+    //! Topics by id
+    std::vector<types::DdsTopic> topics_;
+
+    //! Number of samples
+    uint64_t sample_count_;
+
+    //! Reception time of the first sample
+    int64_t first_time_;
+
+    //! Offset of the current chunk
+    uint64_t chunk_offset_;
+
+    //! Offset of the next record to read
+    uint64_t record_offset_;
+};
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_CAPTURE_CAPTUREREADER_HPP_ */
@@ -0,0 +1,467 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CaptureWriter.cpp
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+#include <cpp_utils/exception/Exception.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <capture/CaptureWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+using namespace eprosima::ddsrouter::core::types;
+
+CaptureWriter::CaptureWriter(
+        const std::string& path,
+        uint64_t chunk_size,
+        uint64_t max_pending_bytes,
+        std::shared_ptr<PayloadPool> payload_pool)
+    : file_(std::make_unique<MappedFile>(path, true))
+    , payload_pool_(payload_pool)
+    , chunk_size_(capture_align(std::max(chunk_size, CAPTURE_ALIGNMENT), CAPTURE_ALIGNMENT))
+    , max_pending_bytes_(max_pending_bytes)
+    , file_header_{}
+    , pending_bytes_(0)
+    , next_topic_id_(0)
+    , closed_(false)
+    , chunk_header_{}
+    , next_chunk_offset_(CAPTURE_FILE_HEADER_SIZE)
+    , failed_(false)
+    , samples_written_(0)
+    , samples_dropped_(0)
+{
+    std::memcpy(file_header_.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC));
+    file_header_.version = CAPTURE_VERSION;
+    file_header_.chunk_size = chunk_size_;
+    file_header_.start_time = now_();
+
+    // Header without index, so the file can be recognized even if it is never closed
+    file_->reserve(CAPTURE_FILE_HEADER_SIZE);
+    file_->write_at(0, &file_header_, sizeof(file_header_));
+
+    thread_ = std::thread(&CaptureWriter::thread_routine_, this);
+
+    logInfo(DDSROUTER_CAPTURE, "Capture file " << path << " created with chunks of " << chunk_size_ << " bytes.");
+}
+
+CaptureWriter::~CaptureWriter()
+{
+    close();
+}
+
+uint32_t CaptureWriter::register_topic(
+        const DdsTopic& topic) noexcept
+{
+    PendingRecord record;
+
+    record.content.insert(record.content.end(), topic.topic_name.begin(), topic.topic_name.end());
+    record.content.push_back('\0');
+    record.content.insert(record.content.end(), topic.type_name.begin(), topic.type_name.end());
+    record.content.push_back('\0');
+
+    uint8_t flags = 0;
+    if (topic.keyed)
+    {
+        flags |= CAPTURE_TOPIC_KEYED;
+    }
+    if (topic.topic_qos.get_reference().is_reliable())
+    {
+        flags |= CAPTURE_TOPIC_RELIABLE;
+    }
+    if (topic.topic_qos.get_reference().is_transient_local())
+    {
+        flags |= CAPTURE_TOPIC_TRANSIENT_LOCAL;
+    }
+    record.content.push_back(flags);
+
+    record.header = CaptureRecordHeader{};
+    record.header.kind = static_cast<uint16_t>(CaptureRecordKind::topic);
+    record.header.payload_length = static_cast<uint32_t>(record.content.size());
+    record.header.size = static_cast<uint32_t>(
+        capture_align(sizeof(CaptureRecordHeader) + record.content.size(), CAPTURE_RECORD_ALIGNMENT));
+    record.header.reception_time = now_();
+
+    uint32_t topic_id;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        topic_id = next_topic_id_++;
+        record.header.topic_id = topic_id;
+
+        // Topic records are never dropped, otherwise the data of the topic could not be read
+        if (!closed_)
+        {
+            pending_bytes_ += record.header.size;
+            queue_.push_back(std::move(record));
+        }
+    }
+    queue_cv_.notify_one();
+
+    logDebug(DDSROUTER_CAPTURE, "Topic " << topic << " registered in capture file with id " << topic_id << ".");
+
+    return topic_id;
+}
+
+bool CaptureWriter::write_data(
+        uint32_t topic_id,
+        const DataReceived& data) noexcept
+{
+    PendingRecord record;
+
+    record.header = CaptureRecordHeader{};
+    record.header.kind = static_cast<uint16_t>(CaptureRecordKind::data);
+    record.header.change_kind = static_cast<uint16_t>(data.properties.kind);
+    record.header.topic_id = topic_id;
+    record.header.payload_length = data.payload.length;
+    record.header.size = static_cast<uint32_t>(
+        capture_align(sizeof(CaptureRecordHeader) + data.payload.length, CAPTURE_RECORD_ALIGNMENT));
+    record.header.reception_time = now_();
+    record.header.source_time = data.properties.source_timestamp.to_ns();
+    record.header.sequence_number =
+            (static_cast<uint64_t>(data.properties.origin_sequence_number.high) << 32) |
+            static_cast<uint64_t>(data.properties.origin_sequence_number.low);
+    std::memcpy(
+        record.header.source_guid,
+        data.properties.source_guid.guidPrefix.value,
+        fastrtps::rtps::GuidPrefix_t::size);
+    std::memcpy(
+        record.header.source_guid + fastrtps::rtps::GuidPrefix_t::size,
+        data.properties.source_guid.entityId.value,
+        fastrtps::rtps::EntityId_t::size);
+
+    // The payload belongs to the pool, so the pool only increases its reference count.
+    // Disposes and unregisters of keyed topics have no payload, so only the header is recorded
+    if (data.payload.length > 0)
+    {
+        record.payload = std::make_unique<Payload>();
+        eprosima::fastrtps::rtps::IPayloadPool* owner = payload_pool_.get();
+        if (!payload_pool_->get_payload(data.payload, owner, *record.payload))
+        {
+            logDevError(DDSROUTER_CAPTURE, "Error retaining payload of sample to capture.");
+            ++samples_dropped_;
+            return false;
+        }
+    }
+
+    bool queued = false;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (!closed_ && pending_bytes_ + record.header.size <= max_pending_bytes_)
+        {
+            pending_bytes_ += record.header.size;
+            queue_.push_back(std::move(record));
+            queued = true;
+        }
+    }
+
+    if (!queued)
+    {
+        // Not moved to the queue
+        release_(record);
+        ++samples_dropped_;
+        logDebug(DDSROUTER_CAPTURE, "Sample of topic with id " << topic_id << " dropped from capture.");
+        return false;
+    }
+
+    queue_cv_.notify_one();
+    return true;
+}
+
+void CaptureWriter::close() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (closed_)
+        {
+            return;
+        }
+        closed_ = true;
+    }
+    queue_cv_.notify_one();
+
+    // The thread writes every record queued before finishing
+    thread_.join();
+
+    try
+    {
+        if (!failed_)
+        {
+            write_index_();
+        }
+    }
+    catch (const utils::Exception& e)
+    {
+        logError(DDSROUTER_CAPTURE, "Error closing capture file " << file_->path() << ": " << e.what() << ".");
+    }
+
+    logInfo(DDSROUTER_CAPTURE,
+            "Capture file " << file_->path() << " closed with " << samples_written_ << " samples written and " <<
+            samples_dropped_ << " dropped.");
+}
+
+uint64_t CaptureWriter::samples_written() const noexcept
+{
+    return samples_written_;
+}
+
+uint64_t CaptureWriter::samples_dropped() const noexcept
+{
+    return samples_dropped_;
+}
+
+void CaptureWriter::thread_routine_() noexcept
+{
+    while (true)
+    {
+        std::deque<PendingRecord> batch;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            queue_cv_.wait(
+                lock,
+                [&]
+                {
+                    return !queue_.empty() || closed_;
+                });
+
+            if (queue_.empty())
+            {
+                // Closed and nothing left to write
+                break;
+            }
+
+            batch.swap(queue_);
+        }
+
+        // Write without holding the mutex, so callers are never blocked by the file
+        uint64_t batch_bytes = 0;
+        for (PendingRecord& record : batch)
+        {
+            batch_bytes += record.header.size;
+
+            if (!failed_)
+            {
+                try
+                {
+                    store_(record);
+                }
+                catch (const utils::Exception& e)
+                {
+                    logError(DDSROUTER_CAPTURE,
+                            "Error writing capture file " << file_->path() << ": " << e.what() <<
+                            ". Next samples will be discarded.");
+                    failed_ = true;
+                }
+            }
+
+            if (failed_ && record.header.kind == static_cast<uint16_t>(CaptureRecordKind::data))
+            {
+                ++samples_dropped_;
+            }
+
+            release_(record);
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            pending_bytes_ -= batch_bytes;
+        }
+    }
+
+    close_chunk_();
+}
+
+void CaptureWriter::store_(
+        PendingRecord& record)
+{
+    const CaptureRecordHeader& header = record.header;
+
+    if (!chunk_ || chunk_header_.used + header.size > chunk_->size())
+    {
+        close_chunk_();
+        open_chunk_(header.size);
+    }
+
+    uint64_t record_offset = chunk_header_.used;
+    uint8_t* destination = chunk_->data() + record_offset;
+
+    // This is the only copy of the payload from the reception until the disk
+    std::memcpy(destination, &header, sizeof(header));
+    if (header.payload_length > 0)
+    {
+        const uint8_t* content = record.payload ? record.payload->data : record.content.data();
+        std::memcpy(destination + sizeof(header), content, header.payload_length);
+    }
+    std::memset(
+        destination + sizeof(header) + header.payload_length,
+        0,
+        header.size - sizeof(header) - header.payload_length);
+
+    chunk_header_.used += header.size;
+    ++chunk_header_.record_count;
+
+    if (header.topic_id >= topic_index_.size())
+    {
+        topic_index_.resize(header.topic_id + 1);
+    }
+
+    if (header.kind == static_cast<uint16_t>(CaptureRecordKind::data))
+    {
+        if (chunk_header_.first_time == 0)
+        {
+            chunk_header_.first_time = header.reception_time;
+        }
+        chunk_header_.last_time = header.reception_time;
+
+        // Index the first record of the topic in each chunk
+        TopicIndex& index = topic_index_[header.topic_id];
+        if (index.entries.empty() || index.last_chunk != file_header_.chunk_count)
+        {
+            index.entries.push_back({header.reception_time, chunk_->offset() + record_offset});
+            index.last_chunk = file_header_.chunk_count;
+        }
+        ++index.sample_count;
+
+        ++samples_written_;
+    }
+}
+
+void CaptureWriter::open_chunk_(
+        uint64_t record_size)
+{
+    uint64_t size = std::max(chunk_size_, capture_align(sizeof(CaptureChunkHeader) + record_size, CAPTURE_ALIGNMENT));
+    uint64_t offset = next_chunk_offset_;
+
+    // Allocate the space in disk beforehand, so writing in the mapped memory cannot fail for lack of space
+    file_->reserve(offset + size);
+    chunk_ = file_->map(offset, size);
+
+    next_chunk_offset_ += size;
+    ++file_header_.chunk_count;
+
+    chunk_header_ = CaptureChunkHeader{};
+    chunk_header_.magic = CAPTURE_CHUNK_MAGIC;
+    chunk_header_.size = size;
+    chunk_header_.used = capture_align(sizeof(CaptureChunkHeader), CAPTURE_RECORD_ALIGNMENT);
+    write_chunk_header_();
+
+    logDebug(DDSROUTER_CAPTURE, "New capture chunk of " << size << " bytes at offset " << offset << ".");
+}
+
+void CaptureWriter::close_chunk_() noexcept
+{
+    if (!chunk_)
+    {
+        return;
+    }
+
+    write_chunk_header_();
+    chunk_->flush_async();
+}
+
+void CaptureWriter::write_chunk_header_() noexcept
+{
+    std::memcpy(chunk_->data(), &chunk_header_, sizeof(chunk_header_));
+}
+
+void CaptureWriter::write_index_()
+{
+    // The last chunk is cut to the space used, so the index goes right after its last record
+    uint64_t index_offset = CAPTURE_FILE_HEADER_SIZE;
+    if (chunk_)
+    {
+        chunk_header_.size = chunk_header_.used;
+        write_chunk_header_();
+        chunk_->flush_sync();
+        index_offset = chunk_->offset() + chunk_header_.used;
+        chunk_.reset();
+    }
+    file_->truncate(index_offset);
+
+    std::vector<uint8_t> index;
+    auto append = [&index](const void* value, std::size_t size)
+            {
+                const uint8_t* bytes = static_cast<const uint8_t*>(value);
+                index.insert(index.end(), bytes, bytes + size);
+            };
+
+    // Every registered topic is indexed, even if no data was written for it
+    uint32_t topic_count;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        topic_count = next_topic_id_;
+    }
+    topic_index_.resize(std::max<std::size_t>(topic_index_.size(), topic_count));
+
+    CaptureIndexHeader index_header{CAPTURE_INDEX_MAGIC, static_cast<uint32_t>(topic_index_.size())};
+    append(&index_header, sizeof(index_header));
+
+    for (uint32_t topic_id = 0; topic_id < topic_index_.size(); ++topic_id)
+    {
+        const TopicIndex& topic_index = topic_index_[topic_id];
+
+        CaptureTopicIndexHeader topic_header{
+            topic_id,
+            static_cast<uint32_t>(topic_index.entries.size()),
+            topic_index.sample_count};
+        append(&topic_header, sizeof(topic_header));
+
+        if (!topic_index.entries.empty())
+        {
+            append(topic_index.entries.data(), topic_index.entries.size() * sizeof(CaptureIndexEntry));
+        }
+    }
+
+    file_->write_at(index_offset, index.data(), index.size());
+
+    file_header_.topic_count = static_cast<uint32_t>(topic_index_.size());
+    file_header_.index_offset = index_offset;
+    file_header_.index_size = index.size();
+    file_header_.end_time = now_();
+    file_->write_at(0, &file_header_, sizeof(file_header_));
+
+    file_->sync();
+}
+
+void CaptureWriter::release_(
+        PendingRecord& record) noexcept
+{
+    if (record.payload)
+    {
+        payload_pool_->release_payload(*record.payload);
+        record.payload.reset();
+    }
+}
+
+int64_t CaptureWriter::now_() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+}
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
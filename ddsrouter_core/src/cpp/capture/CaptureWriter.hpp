@@ -0,0 +1,243 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CaptureWriter.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_CAPTURE_CAPTUREWRITER_HPP_
+#define __SRC_DDSROUTERCORE_CAPTURE_CAPTUREWRITER_HPP_
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddsrouter_core/types/dds/Data.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+#include <capture/CaptureFormat.hpp>
+#include <capture/MappedFile.hpp>
+#include <capture/MappedRegion.hpp>
+#include <efficiency/payload/PayloadPool.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+/**
+ * Writes samples in a capture file with the format described in \c CaptureFormat.hpp .
+ *
+ * Samples are not copied by the threads that call \c write_data : the payload is retained in the
+ * \c PayloadPool (only its reference count increases) and queued. An internal thread copies the queued
+ * records to the current chunk of the file, that is preallocated and mapped in memory, releases the payloads
+ * and asks the system to flush each chunk once it is full, without waiting for it.
+ * If the internal thread cannot keep up and the queued records exceed a maximum size, new samples are dropped
+ * instead of blocking the caller.
+ *
+ * The index of the file is written by \c close .
+ */
+class CaptureWriter
+{
+public:
+
+    /**
+     * @brief Create the capture file and start the internal thread
+     *
+     * @param path path of the file to create. It is truncated if it already exists
+     * @param chunk_size size of each chunk of the file. Rounded up to \c CAPTURE_ALIGNMENT
+     * @param max_pending_bytes maximum size of the records waiting to be written before dropping new samples
+     * @param payload_pool pool the payloads of the samples belong to
+     *
+     * @throw \c InitializationException if the file could not be created
+     */
+    CaptureWriter(
+            const std::string& path,
+            uint64_t chunk_size,
+            uint64_t max_pending_bytes,
+            std::shared_ptr<PayloadPool> payload_pool);
+
+    //! Call \c close
+    ~CaptureWriter();
+
+    /**
+     * @brief Add a new topic to the file
+     *
+     * @return id of the topic, to be used in \c write_data
+     */
+    uint32_t register_topic(
+            const types::DdsTopic& topic) noexcept;
+
+    /**
+     * @brief Queue a sample to be written in the file
+     *
+     * The payload of \c data is retained, so the caller can release it right after this call.
+     *
+     * @param topic_id id given by \c register_topic to the topic of the sample
+     * @param data sample to write
+     *
+     * @return true if the sample has been queued
+     * @return false if the sample has been dropped
+     */
+    bool write_data(
+            uint32_t topic_id,
+            const types::DataReceived& data) noexcept;
+
+    /**
+     * @brief Write every queued record, the index and the final file header, and stop the internal thread
+     *
+     * Samples written after this call are dropped. Calling it more than once has no effect.
+     */
+    void close() noexcept;
+
+    //! Number of samples written in the file
+    uint64_t samples_written() const noexcept;
+
+    //! Number of samples dropped
+    uint64_t samples_dropped() const noexcept;
+
+protected:
+
+    //! Record waiting to be written
+    struct PendingRecord
+    {
+        //! Header of the record, already filled
+        CaptureRecordHeader header;
+
+        //! Payload retained from the pool (data records)
+        std::unique_ptr<types::Payload> payload;
+
+        //! Content of the record (topic records)
+        std::vector<uint8_t> content;
+    };
+
+    //! Index of a topic, built while records are written
+    struct TopicIndex
+    {
+        //! First data record of the topic in each chunk
+        std::vector<CaptureIndexEntry> entries;
+
+        //! Number of data records of the topic
+        uint64_t sample_count = 0;
+
+        //! Number of the last chunk with an entry
+        uint64_t last_chunk = 0;
+    };
+
+    //! Routine of the internal thread
+    void thread_routine_() noexcept;
+
+    //! Copy \c record to the current chunk, opening a new one if it does not fit
+    void store_(
+            PendingRecord& record);
+
+    //! Preallocate and map a new chunk with space for a record of \c record_size bytes at least
+    void open_chunk_(
+            uint64_t record_size);
+
+    //! Write the header of the current chunk and flush it asynchronously. It is unmapped when the next one is opened
+    void close_chunk_() noexcept;
+
+    //! Write the header of the current chunk in its mapped memory
+    void write_chunk_header_() noexcept;
+
+    //! Write the index and the final file header
+    void write_index_();
+
+    //! Release the payload of \c record if any
+    void release_(
+            PendingRecord& record) noexcept;
+
+    //! Current time in nanoseconds since epoch
+    static int64_t now_() noexcept;
+
+    //! File being written
+    std::unique_ptr<MappedFile> file_;
+
+    //! Pool the payloads belong to
+    std::shared_ptr<PayloadPool> payload_pool_;
+
+    //! Nominal size of the chunks
+    uint64_t chunk_size_;
+
+    //! Maximum size of \c queue_
+    uint64_t max_pending_bytes_;
+
+    //! Header of the file
+    CaptureFileHeader file_header_;
+
+    /////
+    // Variables shared with the callers, guarded by mutex_
+
+    //! Records waiting to be written
+    std::deque<PendingRecord> queue_;
+
+    //! Size of the records in \c queue_ and in the batch being written
+    uint64_t pending_bytes_;
+
+    //! Id for the next topic registered
+    uint32_t next_topic_id_;
+
+    //! Whether \c close has been called
+    bool closed_;
+
+    //! Guards the variables shared with the callers
+    std::mutex mutex_;
+
+    //! Awake the internal thread when there are new records or the writer is closed
+    std::condition_variable queue_cv_;
+
+    /////
+    // Variables only used by the internal thread (and by close once the thread has finished)
+
+    //! Current chunk mapped in memory
+    std::unique_ptr<MappedRegion> chunk_;
+
+    //! Header of the current chunk
+    CaptureChunkHeader chunk_header_;
+
+    //! Offset of the next chunk to open
+    uint64_t next_chunk_offset_;
+
+    //! Index of every topic by id
+    std::vector<TopicIndex> topic_index_;
+
+    //! Whether the file could not be written and every record must be discarded
+    bool failed_;
+
+    //! Internal thread
+    std::thread thread_;
+
+    /////
+    // Statistics
+
+    //! Number of data records written
+    std::atomic<uint64_t> samples_written_;
+
+    //! Number of samples dropped
+    std::atomic<uint64_t> samples_dropped_;
+};
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_CAPTURE_CAPTUREWRITER_HPP_ */
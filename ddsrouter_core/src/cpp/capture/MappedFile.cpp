@@ -0,0 +1,196 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MappedFile.cpp
+ */
+
+#if !defined(_WIN32)
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif // if !defined(_WIN32)
+
+#include <cerrno>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/UnsupportedException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <capture/MappedFile.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+#if !defined(_WIN32)
+
+MappedFile::MappedFile(
+        const std::string& path,
+        bool writable)
+    : path_(path)
+    , writable_(writable)
+    , fd_(-1)
+{
+    int flags = writable_ ? (O_RDWR | O_CREAT | O_TRUNC) : O_RDONLY;
+
+    fd_ = open(path_.c_str(), flags, 0644);
+    if (fd_ < 0)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error opening file " << path_ << ": " << std::strerror(errno));
+    }
+}
+
+MappedFile::~MappedFile()
+{
+    close(fd_);
+}
+
+uint64_t MappedFile::size() const
+{
+    struct stat file_stat;
+    if (fstat(fd_, &file_stat) != 0)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error getting size of file " << path_ << ": " << std::strerror(errno));
+    }
+    return static_cast<uint64_t>(file_stat.st_size);
+}
+
+void MappedFile::reserve(
+        uint64_t size)
+{
+#if defined(__APPLE__)
+    // No posix_fallocate, the file is extended (sparse) instead
+    int ret = (ftruncate(fd_, static_cast<off_t>(size)) == 0) ? 0 : errno;
+#else
+    int ret = posix_fallocate(fd_, 0, static_cast<off_t>(size));
+#endif // if defined(__APPLE__)
+
+    if (ret != 0)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error reserving " << size << " bytes for file " << path_ << ": " <<
+                      std::strerror(ret));
+    }
+}
+
+void MappedFile::truncate(
+        uint64_t size)
+{
+    if (ftruncate(fd_, static_cast<off_t>(size)) != 0)
+    {
+        logWarning(DDSROUTER_CAPTURE, "Error truncating file " << path_ << ": " << std::strerror(errno) << ".");
+    }
+}
+
+void MappedFile::write_at(
+        uint64_t offset,
+        const void* data,
+        uint64_t size)
+{
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    while (size > 0)
+    {
+        ssize_t written = pwrite(fd_, bytes, size, static_cast<off_t>(offset));
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            throw utils::InitializationException(
+                      utils::Formatter() << "Error writing file " << path_ << ": " << std::strerror(errno));
+        }
+
+        bytes += written;
+        offset += static_cast<uint64_t>(written);
+        size -= static_cast<uint64_t>(written);
+    }
+}
+
+void MappedFile::sync() noexcept
+{
+    if (fsync(fd_) != 0)
+    {
+        logWarning(DDSROUTER_CAPTURE, "Error syncing file " << path_ << ": " << std::strerror(errno) << ".");
+    }
+}
+
+#else
+
+MappedFile::MappedFile(
+        const std::string& path,
+        bool writable)
+    : path_(path)
+    , writable_(writable)
+    , fd_(-1)
+{
+    throw utils::UnsupportedException(
+              utils::Formatter() << "Memory mapped capture files are not supported in this platform.");
+}
+
+MappedFile::~MappedFile()
+{
+}
+
+uint64_t MappedFile::size() const
+{
+    return 0;
+}
+
+void MappedFile::reserve(
+        uint64_t)
+{
+}
+
+void MappedFile::truncate(
+        uint64_t)
+{
+}
+
+void MappedFile::write_at(
+        uint64_t,
+        const void*,
+        uint64_t)
+{
+}
+
+void MappedFile::sync() noexcept
+{
+}
+
+#endif // if !defined(_WIN32)
+
+const std::string& MappedFile::path() const noexcept
+{
+    return path_;
+}
+
+std::unique_ptr<MappedRegion> MappedFile::map(
+        uint64_t offset,
+        uint64_t size) const
+{
+    return std::make_unique<MappedRegion>(fd_, offset, size, writable_);
+}
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,122 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MappedFile.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_CAPTURE_MAPPEDFILE_HPP_
+#define __SRC_DDSROUTERCORE_CAPTURE_MAPPEDFILE_HPP_
+
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include <capture/MappedRegion.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+/**
+ * File whose content is accessed through memory mapped regions.
+ *
+ * It wraps the few system calls needed to write and read capture files.
+ * Only supported in POSIX platforms.
+ */
+class MappedFile
+{
+public:
+
+    /**
+     * @brief Open a file
+     *
+     * @param path path of the file
+     * @param writable whether to create (or truncate) the file to write it, or to open it read only
+     *
+     * @throw \c InitializationException if the file could not be opened
+     * @throw \c UnsupportedException if the platform does not support memory mapped files
+     */
+    MappedFile(
+            const std::string& path,
+            bool writable);
+
+    //! Close the file
+    ~MappedFile();
+
+    MappedFile(
+            const MappedFile&) = delete;
+
+    MappedFile& operator =(
+            const MappedFile&) = delete;
+
+    //! Path of the file
+    const std::string& path() const noexcept;
+
+    //! Current size of the file
+    uint64_t size() const;
+
+    /**
+     * @brief Allocate disk space so the file has at least \c size bytes
+     *
+     * @throw \c InitializationException if the space could not be allocated
+     */
+    void reserve(
+            uint64_t size);
+
+    //! Cut the file to \c size bytes
+    void truncate(
+            uint64_t size);
+
+    /**
+     * @brief Write \c size bytes from \c data at \c offset of the file
+     *
+     * @throw \c InitializationException if the data could not be written
+     */
+    void write_at(
+            uint64_t offset,
+            const void* data,
+            uint64_t size);
+
+    //! Write to disk every modified data of the file and wait until it is written
+    void sync() noexcept;
+
+    /**
+     * @brief Map \c size bytes of the file starting at \c offset
+     *
+     * @throw \c InitializationException if the region could not be mapped
+     */
+    std::unique_ptr<MappedRegion> map(
+            uint64_t offset,
+            uint64_t size) const;
+
+protected:
+
+    //! Path of the file
+    std::string path_;
+
+    //! Whether the file is opened to write
+    bool writable_;
+
+    //! File descriptor
+    int fd_;
+};
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_CAPTURE_MAPPEDFILE_HPP_ */
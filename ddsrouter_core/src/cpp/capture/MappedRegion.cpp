@@ -0,0 +1,140 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MappedRegion.cpp
+ */
+
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#endif // if !defined(_WIN32)
+
+#include <cerrno>
+#include <cstring>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/exception/UnsupportedException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <capture/MappedRegion.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+#if !defined(_WIN32)
+
+MappedRegion::MappedRegion(
+        int fd,
+        uint64_t offset,
+        uint64_t size,
+        bool writable)
+    : data_(nullptr)
+    , size_(size)
+    , offset_(offset)
+{
+    int protection = writable ? (PROT_READ | PROT_WRITE) : PROT_READ;
+
+    void* address = mmap(nullptr, size_, protection, MAP_SHARED, fd, static_cast<off_t>(offset_));
+    if (address == MAP_FAILED)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error mapping " << size_ << " bytes of file at offset " << offset_ <<
+                      ": " << std::strerror(errno));
+    }
+
+    data_ = static_cast<uint8_t*>(address);
+}
+
+MappedRegion::~MappedRegion()
+{
+    munmap(data_, size_);
+}
+
+void MappedRegion::flush_async() noexcept
+{
+    if (msync(data_, size_, MS_ASYNC) != 0)
+    {
+        logWarning(DDSROUTER_CAPTURE, "Error flushing mapped region: " << std::strerror(errno) << ".");
+    }
+}
+
+void MappedRegion::flush_sync() noexcept
+{
+    if (msync(data_, size_, MS_SYNC) != 0)
+    {
+        logWarning(DDSROUTER_CAPTURE, "Error flushing mapped region: " << std::strerror(errno) << ".");
+    }
+}
+
+void MappedRegion::advise_sequential() const noexcept
+{
+    // Only a hint for the read ahead of the system, so errors are not relevant
+    posix_madvise(data_, size_, POSIX_MADV_SEQUENTIAL);
+}
+
+#else
+
+MappedRegion::MappedRegion(
+        int,
+        uint64_t,
+        uint64_t,
+        bool)
+    : data_(nullptr)
+    , size_(0)
+    , offset_(0)
+{
+    throw utils::UnsupportedException(
+              utils::Formatter() << "Memory mapped capture files are not supported in this platform.");
+}
+
+MappedRegion::~MappedRegion()
+{
+}
+
+void MappedRegion::flush_async() noexcept
+{
+}
+
+void MappedRegion::flush_sync() noexcept
+{
+}
+
+void MappedRegion::advise_sequential() const noexcept
+{
+}
+
+#endif // if !defined(_WIN32)
+
+uint8_t* MappedRegion::data() const noexcept
+{
+    return data_;
+}
+
+uint64_t MappedRegion::size() const noexcept
+{
+    return size_;
+}
+
+uint64_t MappedRegion::offset() const noexcept
+{
+    return offset_;
+}
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,95 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MappedRegion.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_CAPTURE_MAPPEDREGION_HPP_
+#define __SRC_DDSROUTERCORE_CAPTURE_MAPPEDREGION_HPP_
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace capture {
+
+/**
+ * Region of a file mapped in memory. It is unmapped when destroyed.
+ *
+ * Regions are created by \c MappedFile::map .
+ */
+class MappedRegion
+{
+public:
+
+    /**
+     * @brief Map \c size bytes of file \c fd starting at \c offset
+     *
+     * @param offset must be a multiple of the page size
+     *
+     * @throw \c InitializationException if the region could not be mapped
+     */
+    MappedRegion(
+            int fd,
+            uint64_t offset,
+            uint64_t size,
+            bool writable);
+
+    //! Unmap the region
+    ~MappedRegion();
+
+    MappedRegion(
+            const MappedRegion&) = delete;
+
+    MappedRegion& operator =(
+            const MappedRegion&) = delete;
+
+    //! First byte of the region
+    uint8_t* data() const noexcept;
+
+    //! Size of the region
+    uint64_t size() const noexcept;
+
+    //! Offset of the region in the file
+    uint64_t offset() const noexcept;
+
+    //! Schedule the write to disk of the modified pages of the region, without waiting for it
+    void flush_async() noexcept;
+
+    //! Write to disk the modified pages of the region and wait until they are written
+    void flush_sync() noexcept;
+
+    //! Tell the system that the region will be read in order, so it reads ahead from disk
+    void advise_sequential() const noexcept;
+
+protected:
+
+    //! Mapped memory
+    uint8_t* data_;
+
+    //! Size of the region
+    uint64_t size_;
+
+    //! Offset of the region in the file
+    uint64_t offset_;
+};
+
+} /* namespace capture */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_CAPTURE_MAPPEDREGION_HPP_ */
@@ -17,6 +17,8 @@
  *
  */
 
+#include <unordered_set>
+
 #include <communication/DDSBridge.hpp>
 
 #include <cpp_utils/exception/UnsupportedException.hpp>
@@ -34,7 +36,8 @@ DDSBridge::DDSBridge(
         std::shared_ptr<ParticipantsDatabase> participants_database,
         std::shared_ptr<PayloadPool> payload_pool,
         std::shared_ptr<utils::SlotThreadPool> thread_pool,
-        bool enable /* = false */)
+        bool enable /* = false */,
+        bool profiling /* = false */)
     : Bridge(participants_database, payload_pool, thread_pool)
     , topic_(topic)
 {
@@ -78,7 +81,8 @@ DDSBridge::DDSBridge(
             readers_[id], std::move(writers_except_one),
             payload_pool_,
             thread_pool,
-            false);
+            false,
+            profiling);
     }
 
     if (enable)
@@ -158,6 +162,75 @@ void DDSBridge::disable() noexcept
     }
 }
 
+std::chrono::steady_clock::time_point DDSBridge::first_forward_time() const noexcept
+{
+    std::chrono::steady_clock::time_point first_forward;
+
+    // Tracks are only modified in construction and destruction, so no mutex is required
+    for (const auto& track_it : tracks_)
+    {
+        std::chrono::steady_clock::time_point track_first_forward = track_it.second->first_forward_time();
+        if (track_first_forward.time_since_epoch().count() != 0 &&
+                (first_forward.time_since_epoch().count() == 0 || track_first_forward < first_forward))
+        {
+            first_forward = track_first_forward;
+        }
+    }
+
+    return first_forward;
+}
+
+TopicStatistics DDSBridge::statistics() const noexcept
+{
+    TopicStatistics result;
+
+    // Tracks are only modified in construction and destruction, so no mutex is required
+    for (const auto& track_it : tracks_)
+    {
+        result.tracks[track_it.first] = track_it.second->statistics();
+
+        for (const auto& writer_it : track_it.second->writers_statistics())
+        {
+            result.writers[writer_it.first].merge(writer_it.second);
+        }
+    }
+
+    return result;
+}
+
+MemoryStatistics DDSBridge::memory_statistics() const noexcept
+{
+    MemoryStatistics result;
+
+    // Data of the payloads already counted, shared by the histories of the Reader and the Writers
+    std::unordered_set<const void*> counted_payloads;
+
+    // Readers and Writers are only modified in construction and destruction, so no mutex is required
+    for (const auto& reader_it : readers_)
+    {
+        reader_it.second->add_memory_statistics(result, counted_payloads);
+    }
+    for (const auto& writer_it : writers_)
+    {
+        writer_it.second->add_memory_statistics(result, counted_payloads);
+    }
+
+    return result;
+}
+
+unsigned int DDSBridge::busy_tracks() const noexcept
+{
+    unsigned int result = 0;
+    for (const auto& track_it : tracks_)
+    {
+        if (track_it.second->busy())
+        {
+            ++result;
+        }
+    }
+    return result;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const DDSBridge& bridge)
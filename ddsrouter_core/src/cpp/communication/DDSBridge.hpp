@@ -19,11 +19,13 @@
 #ifndef __SRC_DDSROUTERCORE_COMMUNICATION_DDSBRIDGE_HPP_
 #define __SRC_DDSROUTERCORE_COMMUNICATION_DDSBRIDGE_HPP_
 
+#include <chrono>
 #include <mutex>
 
 #include <communication/Bridge.hpp>
 
 #include <communication/Track.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
 #include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
 
 namespace eprosima {
@@ -53,6 +55,7 @@ public:
      * @param payload_pool: Payload Pool that handles the reservation/release of payloads throughout the DDS Router
      * @param thread_pool: Shared pool of threads in charge of data transmission.
      * @param enable: Whether the Bridge should be initialized as enabled
+     * @param profiling: Whether the transmissions of its Tracks are profiled with hardware counters
      *
      * @throw InitializationException in case \c IWriters or \c IReaders creation fails.
      */
@@ -61,7 +64,8 @@ public:
             std::shared_ptr<ParticipantsDatabase> participants_database,
             std::shared_ptr<PayloadPool> payload_pool,
             std::shared_ptr<utils::SlotThreadPool> thread_pool,
-            bool enable = false);
+            bool enable = false,
+            bool profiling = false);
 
     /**
      * @brief Destructor
@@ -97,6 +101,39 @@ public:
      */
     void disable() noexcept override;
 
+    /**
+     * @brief Time when any Track of this Bridge forwarded its first data
+     *
+     * @return earliest first forward time of its Tracks, or default \c time_point if none has forwarded data yet
+     */
+    std::chrono::steady_clock::time_point first_forward_time() const noexcept;
+
+    /**
+     * @brief Statistics of the data forwarded in this Bridge by each of its Tracks and Writers
+     *
+     * The statistics of each Writer add up every Track that writes in it.
+     * Lock free, as Tracks are only modified in construction and destruction.
+     * The memory held is not included, see \c memory_statistics .
+     */
+    types::TopicStatistics statistics() const noexcept;
+
+    /**
+     * @brief Memory held by the Readers and Writers of this Bridge
+     *
+     * Every payload is counted once, although it is shared by the Reader that received it and the Writers that
+     * forward it.
+     * The memory of each Reader and Writer is read locking their RTPS endpoint while iterating its history, so this
+     * is meant for reports on request and not for periodic snapshots.
+     */
+    types::MemoryStatistics memory_statistics() const noexcept;
+
+    /**
+     * @brief Number of Tracks of this Bridge transmitting data or waiting for a thread to transmit it
+     *
+     * Lock free, as Tracks are only modified in construction and destruction.
+     */
+    unsigned int busy_tracks() const noexcept;
+
 protected:
 
     /**
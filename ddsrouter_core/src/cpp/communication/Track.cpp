@@ -23,6 +23,9 @@
 #include <cpp_utils/thread_pool/task/TaskId.hpp>
 
 #include <communication/Track.hpp>
+#include <profiling/HardwareCounters.hpp>
+#include <trace/TraceRecorder.hpp>
+#include <trace/Tracepoints.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -39,7 +42,8 @@ Track::Track(
         std::map<ParticipantId, std::shared_ptr<IWriter>>&& writers,
         std::shared_ptr<PayloadPool> payload_pool,
         std::shared_ptr<utils::SlotThreadPool> thread_pool,
-        bool enable /* = false */) noexcept
+        bool enable /* = false */,
+        bool profiling /* = false */) noexcept
     : reader_participant_id_(reader_participant_id)
     , topic_(topic)
     , reader_(reader)
@@ -48,11 +52,20 @@ Track::Track(
     , enabled_(false)
     , exit_(false)
     , data_available_status_(DataAvailableStatus::no_more_data)
+    , first_forward_time_(0)
+    , counters_(std::make_unique<TrackCounters>())
     , transmit_task_id_(utils::new_unique_task_id())
     , thread_pool_(thread_pool)
+    , trace_name_(DDSROUTER_TRACE_NAME(topic.topic_name))
+    , profiling_(profiling)
 {
     logDebug(DDSROUTER_TRACK, "Creating Track " << *this << ".");
 
+    for (const auto& writer_it : writers_)
+    {
+        writer_counters_[writer_it.first] = std::make_unique<WriterCounters>();
+    }
+
     // Set this track to on_data_available lambda call
     reader_->set_on_data_available_callback(std::bind(&Track::data_available_, this));
 
@@ -136,6 +149,31 @@ void Track::disable() noexcept
     }
 }
 
+std::chrono::steady_clock::time_point Track::first_forward_time() const noexcept
+{
+    return std::chrono::steady_clock::time_point(std::chrono::steady_clock::duration(first_forward_time_.load()));
+}
+
+TrackStatistics Track::statistics() const noexcept
+{
+    return counters_->statistics();
+}
+
+std::map<ParticipantId, WriterStatistics> Track::writers_statistics() const noexcept
+{
+    std::map<ParticipantId, WriterStatistics> result;
+    for (const auto& counters_it : writer_counters_)
+    {
+        result[counters_it.first] = counters_it.second->statistics();
+    }
+    return result;
+}
+
+bool Track::busy() const noexcept
+{
+    return data_available_status_.load() != DataAvailableStatus::no_more_data;
+}
+
 bool Track::should_transmit_() noexcept
 {
     return !exit_ && enabled_;
@@ -151,6 +189,11 @@ void Track::data_available_() noexcept
         // Get previous status and set current one to >=2 (it it was already >=2 it will keep being >2)
         unsigned int previous_status = data_available_status_.fetch_add(DataAvailableStatus::new_data_arrived);
 
+        DDSROUTER_TRACE_INSTANT(track_data_available, trace_name_,
+                previous_status == DataAvailableStatus::no_more_data);
+        DDSROUTER_TRACEPOINT(track_data_available, topic_.topic_name.c_str(),
+                previous_status == DataAvailableStatus::no_more_data);
+
         if (previous_status == DataAvailableStatus::no_more_data)
         {
             // no_more_data was set as current status, so no thread was running
@@ -163,6 +206,10 @@ void Track::data_available_() noexcept
 
 void Track::transmit_() noexcept
 {
+    DDSROUTER_TRACE_SCOPE(transmit_trace, track_transmit, trace_name_);
+    DDSROUTER_TRACEPOINT(track_transmit_start, topic_.topic_name.c_str(), counters_->samples_in.load(),
+            counters_->samples_out.load());
+
     // Loop that ends if it should stop transmitting (should_transmit_nts_).
     // Called inside the loop so it is protected by a mutex that is freed in every iteration.
 
@@ -171,9 +218,18 @@ void Track::transmit_() noexcept
     // enabled_ will be set to false before taking the mutex, so the track will finish after current iteration
     std::unique_lock<std::mutex> lock(on_transmission_mutex_);
 
+    // Counters of this thread when the transmission starts, to attribute their increase to this Track
+    HardwareCountersValues initial_hardware_counters;
+    if (profiling_)
+    {
+        initial_hardware_counters = HardwareCounters::read();
+    }
+
     // TODO: Count the times it loops to break it at some point if needed
     while (should_transmit_())
     {
+        DDSROUTER_TRACE_SCOPE(forward_trace, track_forward, trace_name_);
+
         // It starts transmitting, so it sets the data available status as transmitting
         // This will erase every previous value added in on_data_available and set 1
         data_available_status_.store(DataAvailableStatus::transmitting_data);
@@ -203,6 +259,7 @@ void Track::transmit_() noexcept
         else if (!ret)
         {
             // Error reading data
+            counters_->take_errors.add(1);
             logWarning(DDSROUTER_TRACK, "Error taking data in Track " << topic_ << ". Error code " << ret
                                                                       << ". Skipping data and continue.");
             continue;
@@ -212,9 +269,25 @@ void Track::transmit_() noexcept
                 "Track " << reader_participant_id_ << " for topic " << topic_ <<
                 " transmitting data from remote endpoint " << data->properties.source_guid << ".");
 
+        // Values needed for statistics, taken before writing as writers receive the data by reference
+        const uint64_t length = data->payload.length;
+        const int64_t source_timestamp = data->properties.source_timestamp.to_ns();
+        counters_->samples_in.add(1);
+        counters_->bytes_in.add(length);
+        DDSROUTER_TRACE_SCOPE_VALUE(forward_trace, length);
+
+        // Time when the last write finished, used for the latency of each Writer and of the whole Track
+        DataTime write_completion;
+        uint64_t writes_done = 0;
+
+        // Counters of each writer (both maps have the same keys, so they are iterated in the same order)
+        auto writer_counters_it = writer_counters_.begin();
+
         // Send data through writers
         for (auto& writer_it : writers_)
         {
+            WriterCounters& writer_counters = *(writer_counters_it++)->second;
+
             logDebug(
                 DDSROUTER_TRACK,
                 "Forwarding data to writer " << writer_it.first << ".");
@@ -223,11 +296,47 @@ void Track::transmit_() noexcept
 
             if (!ret)
             {
+                writer_counters.write_errors.add(1);
+                counters_->write_errors.add(1);
                 logWarning(DDSROUTER_TRACK, "Error writting data in Track " << topic_ << ". Error code "
                                                                             << ret <<
                         ". Skipping data for this writer and continue.");
                 continue;
             }
+
+            ++writes_done;
+            writer_counters.samples.add(1);
+            writer_counters.bytes.add(length);
+            counters_->samples_out.add(1);
+            counters_->bytes_out.add(length);
+
+            // Samples without source timestamp do not have latency
+            if (source_timestamp != 0)
+            {
+                DataTime::now(write_completion);
+                writer_counters.latency.add(std::chrono::nanoseconds(write_completion.to_ns() - source_timestamp));
+            }
+        }
+
+        DDSROUTER_TRACEPOINT(track_forward, topic_.topic_name.c_str(), length, writes_done);
+
+        if (writes_done == 0)
+        {
+            counters_->dropped.add(1);
+        }
+        else
+        {
+            if (source_timestamp != 0)
+            {
+                counters_->latency.add(std::chrono::nanoseconds(write_completion.to_ns() - source_timestamp));
+            }
+
+            // Store first forward time (only first data written by any Writer arrives here with value 0)
+            if (first_forward_time_.load(std::memory_order_relaxed) == 0)
+            {
+                first_forward_time_.store(std::chrono::steady_clock::now().time_since_epoch().count());
+                logInfo(DDSROUTER_TRACK, "Track " << *this << " forwarded its first data.");
+            }
         }
 
         // Release payload in case it has length
@@ -236,6 +345,20 @@ void Track::transmit_() noexcept
             payload_pool_->release_payload(data->payload);
         }
     }
+
+    if (profiling_)
+    {
+        HardwareCountersValues transmission = HardwareCounters::read().since(initial_hardware_counters);
+        counters_->profiled_transmissions.add(1);
+        counters_->cycles.add(transmission.cycles);
+        counters_->instructions.add(transmission.instructions);
+        counters_->cache_misses.add(transmission.cache_misses);
+        counters_->context_switches.add(transmission.context_switches);
+    }
+
+    // Counters are only increased by this task, so their increase since track_transmit_start is this transmission
+    DDSROUTER_TRACEPOINT(track_transmit_end, topic_.topic_name.c_str(), counters_->samples_in.load(),
+            counters_->samples_out.load());
 }
 
 std::ostream& operator <<(
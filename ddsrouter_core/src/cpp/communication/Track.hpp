@@ -20,8 +20,14 @@
 #define __SRC_DDSROUTERCORE_COMMUNICATION_TRACK_HPP_
 
 #include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
 #include <mutex>
 
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+#include <communication/TrackCounters.hpp>
 #include <participant/IParticipant.hpp>
 #include <reader/IReader.hpp>
 #include <writer/IWriter.hpp>
@@ -48,6 +54,7 @@ public:
      * @param reader:   Reader that will receive the remote data
      * @param writers:  Map of Writers that will send the data received by \c source indexed by Participant id
      * @param enable:   Whether the \c Track should be initialized as enabled. False by default
+     * @param profiling: Whether each transmission is profiled with hardware counters. False by default
      */
     Track(
             const types::DdsTopic& topic,
@@ -56,7 +63,8 @@ public:
             std::map<types::ParticipantId, std::shared_ptr<IWriter>>&& writers,
             std::shared_ptr<PayloadPool> payload_pool,
             std::shared_ptr<utils::SlotThreadPool> thread_pool,
-            bool enable = false) noexcept;
+            bool enable = false,
+            bool profiling = false) noexcept;
 
     /**
      * @brief Destructor
@@ -94,6 +102,36 @@ public:
      */
     void disable() noexcept;
 
+    /**
+     * @brief Time when this Track forwarded its first data
+     *
+     * @return time of first data forwarded, or default \c time_point (clock epoch) if no data has been forwarded yet
+     */
+    std::chrono::steady_clock::time_point first_forward_time() const noexcept;
+
+    /**
+     * @brief Statistics of the data forwarded by this Track since it was created
+     *
+     * Lock free. It can be called from any thread while the Track is transmitting.
+     */
+    types::TrackStatistics statistics() const noexcept;
+
+    /**
+     * @brief Statistics of the data written by this Track in each of its Writers since it was created
+     *
+     * Lock free. It can be called from any thread while the Track is transmitting.
+     *
+     * @return statistics indexed by the Participant of the Writer
+     */
+    std::map<types::ParticipantId, types::WriterStatistics> writers_statistics() const noexcept;
+
+    /**
+     * @brief Whether this Track is transmitting data or waiting for a thread of the pool to transmit it
+     *
+     * Lock free. It can be called from any thread.
+     */
+    bool busy() const noexcept;
+
 protected:
 
     /*
@@ -206,10 +244,34 @@ protected:
      */
     std::mutex on_transmission_mutex_;
 
+    /**
+     * Time (\c steady_clock ticks) when the first data was forwarded.
+     * 0 while no data has been forwarded.
+     */
+    std::atomic<std::chrono::steady_clock::rep> first_forward_time_;
+
+    /**
+     * Counters of the data forwarded.
+     * Only updated in \c transmit_ , that runs in one thread at a time as it holds \c on_transmission_mutex_ .
+     */
+    std::unique_ptr<TrackCounters> counters_;
+
+    /**
+     * Counters of the data written in each Writer, indexed as \c writers_ .
+     * Only updated in \c transmit_ . The map is not modified after construction.
+     */
+    std::map<types::ParticipantId, std::unique_ptr<WriterCounters>> writer_counters_;
+
     utils::TaskId transmit_task_id_;
 
     std::shared_ptr<utils::SlotThreadPool> thread_pool_;
 
+    //! Identifier of the topic in trace events (only used if tracing is compiled in)
+    uint32_t trace_name_;
+
+    //! Whether each transmission is profiled with hardware counters
+    bool profiling_;
+
     static const unsigned int MAX_MESSAGES_TRANSMIT_LOOP_;
 
     // Allow operator << to use private variables
@@ -0,0 +1,129 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TrackCounters.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <communication/TrackCounters.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+void SingleWriterCounter::add(
+        uint64_t value) noexcept
+{
+    value_.store(value_.load(std::memory_order_relaxed) + value, std::memory_order_relaxed);
+}
+
+void SingleWriterCounter::minimize(
+        uint64_t value) noexcept
+{
+    if (value < value_.load(std::memory_order_relaxed))
+    {
+        value_.store(value, std::memory_order_relaxed);
+    }
+}
+
+void SingleWriterCounter::maximize(
+        uint64_t value) noexcept
+{
+    if (value > value_.load(std::memory_order_relaxed))
+    {
+        value_.store(value, std::memory_order_relaxed);
+    }
+}
+
+uint64_t SingleWriterCounter::load() const noexcept
+{
+    return value_.load(std::memory_order_relaxed);
+}
+
+void SingleWriterCounter::store(
+        uint64_t value) noexcept
+{
+    value_.store(value, std::memory_order_relaxed);
+}
+
+LatencyCounters::LatencyCounters() noexcept
+{
+    min_.store(static_cast<uint64_t>(LatencyHistogram::Duration::max().count()));
+}
+
+void LatencyCounters::add(
+        const LatencyHistogram::Duration& latency) noexcept
+{
+    // Negative latencies (e.g. clocks not synchronized) are counted as 0, as in LatencyHistogram
+    LatencyHistogram::Duration value = std::max(latency, LatencyHistogram::Duration::zero());
+    uint64_t nanoseconds = static_cast<uint64_t>(value.count());
+
+    buckets_[LatencyHistogram::bucket_index(value)].add(1);
+    count_.add(1);
+    total_.add(nanoseconds);
+    min_.minimize(nanoseconds);
+    max_.maximize(nanoseconds);
+}
+
+LatencyHistogram LatencyCounters::histogram() const noexcept
+{
+    LatencyHistogram result;
+    for (std::size_t i = 0; i < LatencyHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        result.buckets[i] = buckets_[i].load();
+    }
+    result.count = count_.load();
+    result.total = LatencyHistogram::Duration(static_cast<LatencyHistogram::Duration::rep>(total_.load()));
+    result.min = LatencyHistogram::Duration(static_cast<LatencyHistogram::Duration::rep>(min_.load()));
+    result.max = LatencyHistogram::Duration(static_cast<LatencyHistogram::Duration::rep>(max_.load()));
+    return result;
+}
+
+TrackStatistics TrackCounters::statistics() const noexcept
+{
+    TrackStatistics result;
+    result.samples_in = samples_in.load();
+    result.bytes_in = bytes_in.load();
+    result.take_errors = take_errors.load();
+    result.samples_out = samples_out.load();
+    result.bytes_out = bytes_out.load();
+    result.write_errors = write_errors.load();
+    result.dropped = dropped.load();
+    result.latency = latency.histogram();
+    result.profiled_transmissions = profiled_transmissions.load();
+    result.cycles = cycles.load();
+    result.instructions = instructions.load();
+    result.cache_misses = cache_misses.load();
+    result.context_switches = context_switches.load();
+    return result;
+}
+
+WriterStatistics WriterCounters::statistics() const noexcept
+{
+    WriterStatistics result;
+    result.samples = samples.load();
+    result.bytes = bytes.load();
+    result.write_errors = write_errors.load();
+    result.latency = latency.histogram();
+    return result;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
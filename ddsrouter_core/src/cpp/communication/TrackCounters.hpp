@@ -0,0 +1,154 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TrackCounters.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_COMMUNICATION_TRACKCOUNTERS_HPP_
+#define __SRC_DDSROUTERCORE_COMMUNICATION_TRACKCOUNTERS_HPP_
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+
+#include <ddsrouter_core/types/statistics/LatencyHistogram.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Counter that is only modified by one thread at a time and read by any thread.
+ *
+ * As there is a single writer, increments are a relaxed load and store instead of an atomic read-modify-write,
+ * so counting does not need any locked instruction.
+ */
+class SingleWriterCounter
+{
+public:
+
+    //! Add \c value to the counter. Only one thread at a time may call this method.
+    void add(
+            uint64_t value) noexcept;
+
+    //! Set the counter to \c value if it is lower. Only one thread at a time may call this method.
+    void minimize(
+            uint64_t value) noexcept;
+
+    //! Set the counter to \c value if it is higher. Only one thread at a time may call this method.
+    void maximize(
+            uint64_t value) noexcept;
+
+    //! Current value of the counter
+    uint64_t load() const noexcept;
+
+    //! Reset the counter to \c value . Only one thread at a time may call this method.
+    void store(
+            uint64_t value) noexcept;
+
+protected:
+
+    std::atomic<uint64_t> value_{0};
+};
+
+/**
+ * Lock-free version of \c LatencyHistogram , for a single writer thread and any reader thread.
+ *
+ * A snapshot read while the histogram is being updated may be slightly inconsistent (e.g. a latency counted in
+ * \c count but not in its bucket yet), but every counter is always valid by itself.
+ */
+class LatencyCounters
+{
+public:
+
+    LatencyCounters() noexcept;
+
+    //! Add a new latency. Only one thread at a time may call this method.
+    void add(
+            const types::LatencyHistogram::Duration& latency) noexcept;
+
+    //! Copy of the current values as a \c LatencyHistogram
+    types::LatencyHistogram histogram() const noexcept;
+
+protected:
+
+    std::array<SingleWriterCounter, types::LatencyHistogram::NUMBER_OF_BUCKETS> buckets_;
+    SingleWriterCounter count_;
+    SingleWriterCounter total_;
+    SingleWriterCounter min_;
+    SingleWriterCounter max_;
+};
+
+//! Size of the padding that keeps counters of different threads in different cache lines
+constexpr std::size_t COUNTERS_CACHE_LINE_SIZE = 64;
+
+/**
+ * Counters of the data forwarded by a Track, updated only by the thread transmitting in the Track.
+ *
+ * The counters are padded so they do not share a cache line with counters updated by other threads.
+ */
+struct TrackCounters
+{
+    //! Copy of the current values
+    types::TrackStatistics statistics() const noexcept;
+
+    char padding_front_[COUNTERS_CACHE_LINE_SIZE];
+
+    SingleWriterCounter samples_in;
+    SingleWriterCounter bytes_in;
+    SingleWriterCounter take_errors;
+    SingleWriterCounter samples_out;
+    SingleWriterCounter bytes_out;
+    SingleWriterCounter write_errors;
+    SingleWriterCounter dropped;
+    LatencyCounters latency;
+
+    // Hardware counters, only updated if the Track is profiled
+    SingleWriterCounter profiled_transmissions;
+    SingleWriterCounter cycles;
+    SingleWriterCounter instructions;
+    SingleWriterCounter cache_misses;
+    SingleWriterCounter context_switches;
+
+    char padding_back_[COUNTERS_CACHE_LINE_SIZE];
+};
+
+/**
+ * Counters of the data written by a Track in one of its Writers, updated only by the thread transmitting in
+ * the Track.
+ *
+ * The counters are padded so they do not share a cache line with counters updated by other threads.
+ */
+struct WriterCounters
+{
+    //! Copy of the current values
+    types::WriterStatistics statistics() const noexcept;
+
+    char padding_front_[COUNTERS_CACHE_LINE_SIZE];
+
+    SingleWriterCounter samples;
+    SingleWriterCounter bytes;
+    SingleWriterCounter write_errors;
+    LatencyCounters latency;
+
+    char padding_back_[COUNTERS_CACHE_LINE_SIZE];
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_COMMUNICATION_TRACKCOUNTERS_HPP_ */
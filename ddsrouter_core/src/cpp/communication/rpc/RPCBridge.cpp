@@ -18,8 +18,11 @@
  */
 
 #include <functional>
+#include <map>
+#include <vector>
 
 #include <communication/rpc/RPCBridge.hpp>
+#include <trace/TraceRecorder.hpp>
 
 #include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/Log.hpp>
@@ -31,16 +34,24 @@ namespace core {
 
 using namespace eprosima::ddsrouter::core::types;
 
+const std::size_t RPCBridge::MAX_TRANSMISSION_BATCH_ = 64;
+
 RPCBridge::RPCBridge(
         const RPCTopic& topic,
         std::shared_ptr<ParticipantsDatabase> participants_database,
         std::shared_ptr<PayloadPool> payload_pool,
-        std::shared_ptr<utils::SlotThreadPool> thread_pool)
+        std::shared_ptr<utils::SlotThreadPool> thread_pool,
+        const configuration::ServiceConfiguration& service_configuration
+        /* = configuration::ServiceConfiguration() */)
     : Bridge(participants_database, payload_pool, thread_pool)
     , topic_(topic)
+    , service_configuration_(service_configuration)
+    , request_router_(service_configuration.routing_policy)
     , init_(false)
+    , trace_name_(DDSROUTER_TRACE_NAME(topic.service_name()))
 {
-    logDebug(DDSROUTER_RPCBRIDGE, "Creating RPCBridge " << *this << ".");
+    logDebug(DDSROUTER_RPCBRIDGE,
+            "Creating RPCBridge " << *this << " with routing policy " << service_configuration.routing_policy << ".");
 
     logDebug(DDSROUTER_RPCBRIDGE, "RPCBridge " << *this << " created.");
 }
@@ -143,7 +154,8 @@ void RPCBridge::create_proxy_client_nts_(
     create_slot_(reply_readers_[participant_id]);
 
     // Create service registry associated to this proxy client
-    service_registries_[participant_id] = std::make_shared<ServiceRegistry>(topic_, participant_id);
+    service_registries_[participant_id] =
+            std::make_shared<ServiceRegistry>(topic_, participant_id, service_configuration_);
 }
 
 void RPCBridge::enable() noexcept
@@ -280,6 +292,8 @@ void RPCBridge::data_available_(
         // Protected by internal RTPS Reader mutex, as called within \c onNewCacheChangeAdded callback
         // This method is also called from Reader's \c enable_ , so Reader's mutex must also be taken there beforehand
         std::pair<bool, utils::TaskId>& task = tasks_map_[reader_guid];
+        DDSROUTER_TRACE_INSTANT(rpc_data_available, trace_name_, !task.first);
+
         if (!task.first)
         {
             task.first = true;
@@ -299,11 +313,22 @@ void RPCBridge::transmit_(
         std::shared_ptr<rtps::CommonReader> reader) noexcept
 {
     // Avoid being disabled while transmitting
+    DDSROUTER_TRACE_SCOPE(transmit_trace, rpc_transmit, trace_name_);
     std::shared_lock<std::shared_timed_mutex> lock(on_transmission_mutex_);
 
     logDebug(DDSROUTER_RPCBRIDGE, "RPCBridge " << *this <<
             " transmitting for reader " << reader->guid() << " .");
 
+    bool is_request_reader = RPCTopic::is_request_topic(reader->topic());
+    if (!is_request_reader && !RPCTopic::is_reply_topic(reader->topic()))
+    {
+        utils::tsnh(
+            utils::Formatter() << "Data to be transmitted in RPCBridge is not in RPCTopic.");
+    }
+
+    std::vector<std::unique_ptr<DataReceived>> batch;
+    batch.reserve(MAX_TRANSMISSION_BATCH_);
+
     while (true)
     {
         {
@@ -329,9 +354,9 @@ void RPCBridge::transmit_(
             }
         }
 
-        // Get data received
-        std::unique_ptr<DataReceived> data = std::make_unique<DataReceived>();
-        utils::ReturnCode ret = reader->take(data);
+        // Get every data received up to the batch size, locking the reader only once
+        batch.clear();
+        utils::ReturnCode ret = reader->take_batch(batch, MAX_TRANSMISSION_BATCH_);
 
         // Will never return \c RETCODE_NO_DATA, otherwise would have finished before
         if (!ret)
@@ -344,66 +369,145 @@ void RPCBridge::transmit_(
             continue;
         }
 
-        if (RPCTopic::is_request_topic(reader->topic()))
+        if (is_request_reader)
         {
-            logDebug(DDSROUTER_RPCBRIDGE,
-                    "RPCBridge for service " << topic_ <<
-                    " transmitting request from remote endpoint " << data->properties.source_guid << ".");
+            transmit_requests_(batch);
+        }
+        else
+        {
+            transmit_replies_(reader, batch);
+        }
+
+        for (std::unique_ptr<DataReceived>& data : batch)
+        {
+            payload_pool_->release_payload(data->payload);
+        }
+    }
+}
+
+void RPCBridge::transmit_requests_(
+        std::vector<std::unique_ptr<DataReceived>>& requests) noexcept
+{
+    DDSROUTER_TRACE_SCOPE(requests_trace, rpc_requests, trace_name_);
+    DDSROUTER_TRACE_SCOPE_VALUE(requests_trace, requests.size());
+
+    // Index in the batch of the requests to send through each participant (in reception order),
+    // with the identity their replies must carry
+    std::map<ParticipantId, std::vector<std::pair<std::size_t, SampleIdentity>>> requests_by_target;
+
+    // Requests are added to the registries after the whole batch is routed, so the requests already routed in this
+    // batch are counted apart as outstanding
+    std::map<ParticipantId, std::size_t> routed_in_batch;
 
-            SampleIdentity reply_related_sample_identity =
-                    data->properties.write_params.get_reference().sample_identity();
-            reply_related_sample_identity.sequence_number(data->properties.origin_sequence_number);
+    for (std::size_t i = 0; i < requests.size(); ++i)
+    {
+        std::unique_ptr<DataReceived>& data = requests[i];
+
+        logDebug(DDSROUTER_RPCBRIDGE,
+                "RPCBridge for service " << topic_ <<
+                " transmitting request from remote endpoint " << data->properties.source_guid << ".");
+
+        SampleIdentity reply_related_sample_identity =
+                data->properties.write_params.get_reference().sample_identity();
+        reply_related_sample_identity.sequence_number(data->properties.origin_sequence_number);
 
-            if (reply_related_sample_identity == SampleIdentity::unknown())
+        if (reply_related_sample_identity == SampleIdentity::unknown())
+        {
+            logWarning(DDSROUTER_RPCBRIDGE,
+                    "RPCBridge for service " << topic_ <<
+                    " received ill-formed request from remote endpoint " << data->properties.source_guid <<
+                    ". Ignoring...");
+            continue;
+        }
+
+        // Participants with servers that could process this request
+        std::vector<ParticipantId> candidates;
+        for (auto& service_registry : service_registries_)
+        {
+            // Do not send request through same participant who received it (unless repeater), or if there are no servers to process it
+            if ((data->properties.participant_receiver == service_registry.first &&
+                    !participants_->get_participant(service_registry.first)->is_repeater()) ||
+                    !service_registry.second->enabled())
             {
-                logWarning(DDSROUTER_RPCBRIDGE,
-                        "RPCBridge for service " << topic_ <<
-                        " received ill-formed request from remote endpoint " << data->properties.source_guid <<
-                        ". Ignoring...");
+                continue;
             }
-            else
+            candidates.push_back(service_registry.first);
+        }
+
+        std::vector<ParticipantId> targets = request_router_.route(
+            candidates,
+            reply_related_sample_identity.writer_guid(),
+            [this, &routed_in_batch](const ParticipantId& participant_id)
             {
-                for (auto& service_registry : service_registries_)
-                {
-                    // Do not send request through same participant who received it (unless repeater), or if there are no servers to process it
-                    if ((data->properties.participant_receiver == service_registry.first &&
-                            !participants_->get_participant(service_registry.first)->is_repeater()) ||
-                            !service_registry.second->enabled())
-                    {
-                        continue;
-                    }
-
-                    // Perform write + add entry to registry atomically -> avoid reply processed before entry added to registry
-                    std::lock_guard<std::recursive_mutex> lock(service_registry.second->get_mutex());
-
-                    // Set write params so writer set in related sample identity the correct value
-                    // Set it so writer use it
-                    data->properties.write_params.set_level();
-                    // Attach the information the server needs in order to reply to the appropiate proxy client.
-                    data->properties.write_params.get_reference().related_sample_identity().writer_guid(
-                        reply_readers_[service_registry.first]->guid());
-
-                    ret = request_writers_[service_registry.first]->write(data);
-
-                    if (!ret)
-                    {
-                        logWarning(DDSROUTER_RPCBRIDGE, "Error writting request in RPCBridge for service "
-                                << topic_ << ". Error code " << ret << ". Skipping data for this writer and continue.");
-                        continue;
-                    }
-
-                    eprosima::fastrtps::rtps::SequenceNumber_t sequence_number =
-                            data->sent_sequence_number;
-                    // Add entry to registry associated to the transmission of this request through this proxy client.
-                    service_registry.second->add(
-                        sequence_number,
-                        {data->properties.participant_receiver, reply_related_sample_identity});
+                return service_registries_[participant_id]->size() + routed_in_batch[participant_id];
+            });
 
-                }
+        for (const ParticipantId& target : targets)
+        {
+            requests_by_target[target].emplace_back(i, reply_related_sample_identity);
+            routed_in_batch[target]++;
+        }
+    }
+
+    for (auto& target_requests : requests_by_target)
+    {
+        const ParticipantId& target = target_requests.first;
+        std::shared_ptr<ServiceRegistry>& service_registry = service_registries_[target];
+        std::shared_ptr<IWriter>& request_writer = request_writers_[target];
+        Guid reply_reader_guid = reply_readers_[target]->guid();
+
+        // Perform writes + add entries to registry atomically -> avoid reply processed before entry added to registry
+        // Registry is locked once for every request of the batch sent through this participant
+        std::lock_guard<std::recursive_mutex> lock(service_registry->get_mutex());
+
+        for (auto& request : target_requests.second)
+        {
+            std::unique_ptr<DataReceived>& data = requests[request.first];
+
+            // Set write params so writer set in related sample identity the correct value
+            // Set it so writer use it
+            data->properties.write_params.set_level();
+            // Attach the information the server needs in order to reply to the appropiate proxy client.
+            data->properties.write_params.get_reference().related_sample_identity().writer_guid(reply_reader_guid);
+
+            utils::ReturnCode ret = request_writer->write(data);
+
+            if (!ret)
+            {
+                logWarning(DDSROUTER_RPCBRIDGE, "Error writting request in RPCBridge for service "
+                        << topic_ << ". Error code " << ret << ". Skipping data for this writer and continue.");
+                continue;
             }
+
+            // Add entry to registry associated to the transmission of this request through this proxy client.
+            service_registry->add(
+                data->sent_sequence_number,
+                {data->properties.participant_receiver, request.second});
         }
-        else if (RPCTopic::is_reply_topic(reader->topic()))
+    }
+}
+
+void RPCBridge::transmit_replies_(
+        std::shared_ptr<rtps::CommonReader> reader,
+        std::vector<std::unique_ptr<DataReceived>>& replies) noexcept
+{
+    DDSROUTER_TRACE_SCOPE(replies_trace, rpc_replies, trace_name_);
+    DDSROUTER_TRACE_SCOPE_VALUE(replies_trace, replies.size());
+
+    std::shared_ptr<ServiceRegistry>& service_registry = service_registries_[reader->participant_id()];
+
+    // Entry of the registry for each reply, not valid if the reply must not be forwarded
+    std::vector<std::pair<ParticipantId, SampleIdentity>> registry_entries(replies.size());
+
+    {
+        // Wait for request transmission to be finished (entry added to registry)
+        // Registry is locked once for every reply of the batch
+        std::lock_guard<std::recursive_mutex> lock(service_registry->get_mutex());
+
+        for (std::size_t i = 0; i < replies.size(); ++i)
         {
+            std::unique_ptr<DataReceived>& data = replies[i];
+
             logDebug(DDSROUTER_RPCBRIDGE,
                     "RPCBridge for service " << topic_ <<
                     " transmitting reply from remote endpoint " << data->properties.source_guid << ".");
@@ -416,51 +520,66 @@ void RPCBridge::transmit_(
                         "RPCBridge for service " << *this << " from reader " << reader->guid() <<
                         " received response meant for other client: " <<
                         data->properties.write_params.get_reference().sample_identity().writer_guid());
+                continue;
             }
-            else
-            {
-                std::pair<ParticipantId, SampleIdentity> registry_entry;
-                {
-                    // Wait for request transmission to be finished (entry added to registry)
-                    std::lock_guard<std::recursive_mutex> lock(
-                        service_registries_[reader->participant_id()]->get_mutex());
 
-                    // Fetch information required for transmission; which proxy server should send it and with what parameters
-                    registry_entry = service_registries_[reader->participant_id()]->get(
-                        data->properties.write_params.get_reference().sample_identity().sequence_number());
-                }
+            // Fetch information required for transmission; which proxy server should send it and with what parameters
+            // The entry is taken while the registry is locked, so other replies to the same request (in this batch
+            // or in a later one) are not forwarded while this one is
+            registry_entries[i] = service_registry->take(
+                data->properties.write_params.get_reference().sample_identity().sequence_number());
+        }
+    }
 
-                // Not valid means:
-                //   Case 1: (SimpleParticipant) Request already replied by another server connected to the same participant as this one.
-                //   Case 2: (WAN Participant repeater) Request already replied by another PROXY server connected to the same participant as this one.
-                if (registry_entry.first.is_valid())
-                {
-                    data->properties.write_params.set_level();
-                    data->properties.write_params.get_reference().related_sample_identity(registry_entry.second);
-
-                    ret = reply_writers_[registry_entry.first]->write(data);
-
-                    if (!ret)
-                    {
-                        logWarning(DDSROUTER_RPCBRIDGE, "Error writting reply in RPCBridge for service "
-                                << topic_ << ". Error code " << ret << ".");
-                    }
-                    else
-                    {
-                        service_registries_[reader->participant_id()]->erase(
-                            data->properties.write_params.get_reference().sample_identity().sequence_number());
-                    }
-                }
-            }
+    for (std::size_t i = 0; i < replies.size(); ++i)
+    {
+        std::unique_ptr<DataReceived>& data = replies[i];
+        std::pair<ParticipantId, SampleIdentity>& registry_entry = registry_entries[i];
+
+        // Not valid means:
+        //   Case 0: Reply meant for other client.
+        //   Case 1: (SimpleParticipant) Request already replied by another server connected to the same participant as this one
+        //           (maybe in this same batch).
+        //   Case 2: (WAN Participant repeater) Request already replied by another PROXY server connected to the same participant as this one.
+        if (!registry_entry.first.is_valid())
+        {
+            continue;
+        }
+
+        SequenceNumber request_sequence_number =
+                data->properties.write_params.get_reference().sample_identity().sequence_number();
+
+        data->properties.write_params.set_level();
+        data->properties.write_params.get_reference().related_sample_identity(registry_entry.second);
+
+        utils::ReturnCode ret = reply_writers_[registry_entry.first]->write(data);
+
+        if (!ret)
+        {
+            logWarning(DDSROUTER_RPCBRIDGE, "Error writting reply in RPCBridge for service "
+                    << topic_ << ". Error code " << ret << ".");
+
+            // Let a later reply from another server be forwarded
+            service_registry->restore(request_sequence_number);
         }
         else
         {
-            utils::tsnh(
-                utils::Formatter() << "Data to be transmitted in RPCBridge is not in RPCTopic.");
+            service_registry->erase(request_sequence_number);
         }
+    }
+}
 
-        payload_pool_->release_payload(data->payload);
+ServiceStatistics RPCBridge::statistics() noexcept
+{
+    // Registries are created when the bridge is first enabled
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    ServiceStatistics result;
+    for (auto& service_registry : service_registries_)
+    {
+        result.participants[service_registry.first] = service_registry.second->statistics();
     }
+    return result;
 }
 
 void RPCBridge::create_slot_(
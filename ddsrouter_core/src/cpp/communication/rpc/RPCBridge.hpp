@@ -24,11 +24,14 @@
 #include <mutex>
 #include <set>
 #include <shared_mutex>
+#include <vector>
 
 #include <communication/Bridge.hpp>
 
+#include <communication/rpc/RPCRequestRouter.hpp>
 #include <communication/rpc/ServiceRegistry.hpp>
 #include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/statistics/ServiceStatistics.hpp>
 #include <ddsrouter_core/types/topic/rpc/RPCTopic.hpp>
 #include <reader/implementations/rtps/CommonReader.hpp>
 #include <writer/IWriter.hpp>
@@ -61,6 +64,7 @@ public:
      * @param participant_database: Collection of Participants to manage communication
      * @param payload_pool: Payload Pool that handles the reservation/release of payloads throughout the DDS Router
      * @param thread_pool: Shared pool of threads in charge of data transmission.
+     * @param service_configuration: Routing policy and service registries configuration of this service
      *
      * @note Always created disabled, manual enable required. First enable creates all endpoints.
      */
@@ -68,7 +72,9 @@ public:
             const types::RPCTopic& topic,
             std::shared_ptr<ParticipantsDatabase> participants_database,
             std::shared_ptr<PayloadPool> payload_pool,
-            std::shared_ptr<utils::SlotThreadPool> thread_pool);
+            std::shared_ptr<utils::SlotThreadPool> thread_pool,
+            const configuration::ServiceConfiguration& service_configuration =
+            configuration::ServiceConfiguration());
 
     /**
      * @brief Destructor
@@ -104,6 +110,13 @@ public:
             const types::ParticipantId& server_participant_id,
             const types::GuidPrefix& server_guid_prefix) noexcept;
 
+    /**
+     * @brief Statistics of the requests forwarded, by participant through which they have been forwarded
+     *
+     * Thread safe
+     */
+    types::ServiceStatistics statistics() noexcept;
+
 protected:
 
     /**
@@ -145,24 +158,49 @@ protected:
             const types::Guid& reader_guid) noexcept;
 
     /**
-     * REQUEST: Take data from request \c reader and send this data through all proxy clients which are in contact
-     * with actual servers (service registry enabled).
+     * REQUEST: Take data from request \c reader and send this data through the proxy clients which are in contact
+     * with actual servers (service registry enabled), chosen by the routing policy.
      *
      * REPLY: Take data from reply \c reader and send it through the proxy server which originally received the request
      * (information present in service registry).
      *
+     * Data is taken in batches of up to \c MAX_TRANSMISSION_BATCH_ samples, locking the reader only once per batch.
+     *
      * Finish execution when no more data is available, or bridge has been disabled (due to servers unavailability or
      * topic being blocked).
      */
     void transmit_(
             std::shared_ptr<rtps::CommonReader> reader) noexcept;
 
+    /**
+     * @brief Send a batch of requests through the proxy clients chosen for each of them.
+     *
+     * The registry of each proxy client is locked once for all the requests of the batch sent through it.
+     */
+    void transmit_requests_(
+            std::vector<std::unique_ptr<types::DataReceived>>& requests) noexcept;
+
+    /**
+     * @brief Send a batch of replies received in \c reader through the proxy servers that received their requests.
+     *
+     * The registry of the participant of \c reader is locked once to fetch the entries of every reply of the batch.
+     */
+    void transmit_replies_(
+            std::shared_ptr<rtps::CommonReader> reader,
+            std::vector<std::unique_ptr<types::DataReceived>>& replies) noexcept;
+
     //! Whether there are any servers in the database
     bool servers_available_() const noexcept;
 
     //! RPCTopic (service) that this bridge manages communication
     const types::RPCTopic topic_;
 
+    //! Routing policy and configuration of the service registries created for this service
+    const configuration::ServiceConfiguration service_configuration_;
+
+    //! Chooses the proxy clients each request is forwarded through, following the service routing policy
+    RPCRequestRouter request_router_;
+
     //! Flag set to true when proxy clients and servers are created, so it can only be done once
     bool init_;
 
@@ -191,11 +229,17 @@ protected:
     //! Mutex to prevent simultaneous calls to enable and/or disable
     std::mutex mutex_;
 
+    //! Maximum number of samples taken from a reader and transmitted at once
+    static const std::size_t MAX_TRANSMISSION_BATCH_;
+
     /**
      * Mutex to guard while the RPCBridge is sending a message so it could not be disabled.
      */
     std::shared_timed_mutex on_transmission_mutex_;
 
+    //! Identifier of the service in trace events (only used if tracing is compiled in)
+    uint32_t trace_name_;
+
     // Allow operator << to use private variables
     friend std::ostream& operator <<(
             std::ostream&,
@@ -0,0 +1,110 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RPCRequestRouter.cpp
+ *
+ */
+
+#include <communication/rpc/RPCRequestRouter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+RPCRequestRouter::RPCRequestRouter(
+        RPCRoutingPolicy policy)
+    : policy_(policy)
+    , requests_routed_(0)
+{
+}
+
+std::vector<ParticipantId> RPCRequestRouter::route(
+        const std::vector<ParticipantId>& candidates,
+        const Guid& client,
+        const OutstandingRequestsFunction& outstanding_requests) noexcept
+{
+    if (candidates.empty())
+    {
+        return {};
+    }
+
+    uint64_t request_index = requests_routed_++;
+
+    switch (policy_)
+    {
+        case RPCRoutingPolicy::round_robin:
+            return {candidates[request_index % candidates.size()]};
+
+        case RPCRoutingPolicy::least_outstanding:
+        {
+            // Start looking from a rotating position so ties are shared among candidates
+            std::size_t first = request_index % candidates.size();
+            std::size_t chosen = first;
+            std::size_t chosen_outstanding = outstanding_requests(candidates[first]);
+
+            for (std::size_t i = 1; i < candidates.size() && chosen_outstanding > 0; ++i)
+            {
+                std::size_t index = (first + i) % candidates.size();
+                std::size_t outstanding = outstanding_requests(candidates[index]);
+                if (outstanding < chosen_outstanding)
+                {
+                    chosen = index;
+                    chosen_outstanding = outstanding;
+                }
+            }
+
+            return {candidates[chosen]};
+        }
+
+        case RPCRoutingPolicy::hash_by_client:
+            return {candidates[hash_guid_(client) % candidates.size()]};
+
+        case RPCRoutingPolicy::broadcast:
+        default:
+            return candidates;
+    }
+}
+
+RPCRoutingPolicy RPCRequestRouter::policy() const noexcept
+{
+    return policy_;
+}
+
+uint64_t RPCRequestRouter::hash_guid_(
+        const Guid& guid) noexcept
+{
+    // FNV-1a over the guid bytes
+    uint64_t hash = 14695981039346656037ull;
+
+    for (auto byte : guid.guidPrefix.value)
+    {
+        hash ^= static_cast<uint8_t>(byte);
+        hash *= 1099511628211ull;
+    }
+
+    for (auto byte : guid.entityId.value)
+    {
+        hash ^= static_cast<uint8_t>(byte);
+        hash *= 1099511628211ull;
+    }
+
+    return hash;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
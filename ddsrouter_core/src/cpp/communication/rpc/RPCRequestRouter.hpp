@@ -0,0 +1,90 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RPCRequestRouter.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_COMMUNICATION_RPC_RPCREQUESTROUTER_HPP_
+#define __SRC_DDSROUTERCORE_COMMUNICATION_RPC_RPCREQUESTROUTER_HPP_
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/topic/rpc/RPCRoutingPolicy.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Class that chooses, following a \c RPCRoutingPolicy , the participants through which a service request is forwarded.
+ *
+ * Routing is done by participant: all servers reachable through a chosen participant receive the request.
+ */
+class RPCRequestRouter
+{
+public:
+
+    //! Function that returns the number of requests pending of reply forwarded through a participant
+    using OutstandingRequestsFunction = std::function<std::size_t(const types::ParticipantId&)>;
+
+    /**
+     * RPCRequestRouter constructor by required values
+     *
+     * @param policy: Policy to route requests
+     */
+    RPCRequestRouter(
+            types::RPCRoutingPolicy policy);
+
+    /**
+     * @brief Choose the participants to forward a request through.
+     *
+     * @param [in] candidates: participants with servers available that can forward the request (in a stable order)
+     * @param [in] client: Guid of the client that sent the request
+     * @param [in] outstanding_requests: number of requests pending of reply of each candidate
+     * (only called with \c least_outstanding policy)
+     *
+     * @return participants chosen (empty only if there are no candidates)
+     */
+    std::vector<types::ParticipantId> route(
+            const std::vector<types::ParticipantId>& candidates,
+            const types::Guid& client,
+            const OutstandingRequestsFunction& outstanding_requests) noexcept;
+
+    //! Routing policy getter
+    types::RPCRoutingPolicy policy() const noexcept;
+
+protected:
+
+    //! Hash of a Guid, stable among executions
+    static uint64_t hash_guid_(
+            const types::Guid& guid) noexcept;
+
+    //! Policy to route requests
+    const types::RPCRoutingPolicy policy_;
+
+    //! Number of requests routed, used to rotate among candidates
+    std::atomic<uint64_t> requests_routed_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_COMMUNICATION_RPC_RPCREQUESTROUTER_HPP_ */
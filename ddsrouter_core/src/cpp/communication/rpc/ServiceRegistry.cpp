@@ -17,7 +17,7 @@
  *
  */
 
-#include <regex>
+#include <algorithm>
 #include <string>
 
 #include <cpp_utils/Log.hpp>
@@ -30,18 +30,30 @@ namespace core {
 
 using namespace eprosima::ddsrouter::core::types;
 
-const unsigned int ServiceRegistry::DEFAULT_MAX_ENTRIES_ = 5000;
+const std::size_t ServiceRegistry::INITIAL_CAPACITY_ = 64;
 
 ServiceRegistry::ServiceRegistry(
         const RPCTopic& topic,
-        const ParticipantId& participant_id)
+        const ParticipantId& participant_id,
+        const configuration::ServiceConfiguration& configuration /* = ServiceConfiguration() */)
     : topic_(topic)
     , participant_id_(participant_id)
     , enabled_(false)
+    , max_capacity_(std::max(configuration.max_pending_requests, 1u))
+    , registry_(std::min(max_capacity_, INITIAL_CAPACITY_))
+    , size_(0)
+    , oldest_sequence_number_(0)
+    , newest_sequence_number_(0)
+    , timeout_(configuration.request_timeout)
+    , expired_count_(0)
+    , evicted_count_(0)
+    , requests_count_(0)
+    , replies_count_(0)
+    , orphan_replies_count_(0)
 {
     logDebug(DDSROUTER_SERVICEREGISTRY,
             "ServiceRegistry created for service " << topic <<
-            " in participant " << participant_id << ".");
+            " in participant " << participant_id << " with capacity " << max_capacity_ << ".");
 }
 
 void ServiceRegistry::enable() noexcept
@@ -65,41 +77,129 @@ void ServiceRegistry::add(
 {
     std::lock_guard<std::recursive_mutex> lock(mutex_);
 
-    if (registry_.count(idx))
+    uint64_t sequence_number = idx.to64long();
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    // Grow the ring while the slot is taken by a live entry and maximum capacity has not been reached
+    while (slot_nts_(sequence_number).valid &&
+            slot_nts_(sequence_number).sequence_number != sequence_number &&
+            !is_expired_nts_(slot_nts_(sequence_number), now) &&
+            registry_.size() < max_capacity_)
     {
-        // Should never occur as each sequence number associated to a write operation is unique
-        logWarning(DDSROUTER_SERVICEREGISTRY,
-                "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
-                " attempting to add entry with already present SequenceNumber.");
-        return;
+        grow_nts_();
     }
 
-    registry_[idx] = new_entry;
+    RegistryEntry& entry = slot_nts_(sequence_number);
+
+    if (entry.valid)
+    {
+        if (entry.sequence_number == sequence_number)
+        {
+            // Should never occur as each sequence number associated to a write operation is unique
+            logWarning(DDSROUTER_SERVICEREGISTRY,
+                    "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
+                    " attempting to add entry with already present SequenceNumber.");
+            return;
+        }
+
+        // Remove older entry stored in the same slot
+        if (is_expired_nts_(entry, now))
+        {
+            expired_count_++;
+        }
+        else
+        {
+            evicted_count_++;
+            logDebug(DDSROUTER_SERVICEREGISTRY,
+                    "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
+                    " full, evicting request " << entry.sequence_number << ".");
+        }
+        invalidate_nts_(entry);
+    }
 
-    // Remove oldest entry if registry full
-    // TMP: Use configuration specs value when available
-    if (registry_.size() == DEFAULT_MAX_ENTRIES_)
+    if (size_ == 0 || sequence_number < oldest_sequence_number_)
     {
-        registry_.erase(registry_.begin());
+        oldest_sequence_number_ = sequence_number;
     }
+    newest_sequence_number_ = std::max(newest_sequence_number_, sequence_number);
+
+    entry.valid = true;
+    entry.sequence_number = sequence_number;
+    entry.value = std::move(new_entry);
+    entry.added_time = now;
+    entry.replied = false;
+    entry.taken = false;
+    size_++;
+    requests_count_++;
+
+    remove_expired_nts_(now);
 }
 
 std::pair<ParticipantId, SampleIdentity> ServiceRegistry::get(
-        SequenceNumber idx) const noexcept
+        SequenceNumber idx) noexcept
 {
     std::lock_guard<std::recursive_mutex> lock(mutex_);
 
-    std::pair<ParticipantId, SampleIdentity> ret;
-    if (registry_.count(idx))
+    uint64_t sequence_number = idx.to64long();
+    RegistryEntry& entry = slot_nts_(sequence_number);
+    std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+
+    if (entry.valid && entry.sequence_number == sequence_number)
     {
-        ret = registry_.at(idx);
+        if (!is_expired_nts_(entry, now))
+        {
+            if (!entry.replied)
+            {
+                entry.replied = true;
+                replies_count_++;
+                round_trip_time_.add(now - entry.added_time);
+            }
+            return entry.value;
+        }
+
+        expired_count_++;
+        invalidate_nts_(entry);
     }
-    else
+
+    orphan_replies_count_++;
+    return {ParticipantId(), SampleIdentity()};
+}
+
+std::pair<ParticipantId, SampleIdentity> ServiceRegistry::take(
+        SequenceNumber idx) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    uint64_t sequence_number = idx.to64long();
+    RegistryEntry& entry = slot_nts_(sequence_number);
+
+    if (entry.valid && entry.sequence_number == sequence_number && entry.taken)
     {
-        ret = {ParticipantId(), SampleIdentity()};
+        // Another reply to the same request is being forwarded
+        orphan_replies_count_++;
+        return {ParticipantId(), SampleIdentity()};
     }
 
-    return ret;
+    std::pair<ParticipantId, SampleIdentity> value = get(idx);
+    if (value.first.is_valid())
+    {
+        slot_nts_(sequence_number).taken = true;
+    }
+    return value;
+}
+
+void ServiceRegistry::restore(
+        SequenceNumber idx) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    uint64_t sequence_number = idx.to64long();
+    RegistryEntry& entry = slot_nts_(sequence_number);
+
+    if (entry.valid && entry.sequence_number == sequence_number)
+    {
+        entry.taken = false;
+    }
 }
 
 void ServiceRegistry::erase(
@@ -107,12 +207,55 @@ void ServiceRegistry::erase(
 {
     std::lock_guard<std::recursive_mutex> lock(mutex_);
 
-    if (registry_.count(idx))
+    uint64_t sequence_number = idx.to64long();
+    RegistryEntry& entry = slot_nts_(sequence_number);
+
+    if (entry.valid && entry.sequence_number == sequence_number)
     {
-        registry_.erase(idx);
+        invalidate_nts_(entry);
     }
 }
 
+std::size_t ServiceRegistry::size() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    remove_expired_nts_(std::chrono::steady_clock::now());
+    return size_;
+}
+
+std::size_t ServiceRegistry::capacity() const noexcept
+{
+    return max_capacity_;
+}
+
+uint64_t ServiceRegistry::expired_count() const noexcept
+{
+    return expired_count_;
+}
+
+uint64_t ServiceRegistry::evicted_count() const noexcept
+{
+    return evicted_count_;
+}
+
+ServiceParticipantStatistics ServiceRegistry::statistics() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    remove_expired_nts_(std::chrono::steady_clock::now());
+
+    ServiceParticipantStatistics result;
+    result.requests = requests_count_;
+    result.replies = replies_count_;
+    result.orphan_replies = orphan_replies_count_;
+    result.outstanding_requests = size_;
+    result.timeouts = expired_count_;
+    result.evictions = evicted_count_;
+    result.round_trip_time = round_trip_time_;
+    return result;
+}
+
 RPCTopic ServiceRegistry::topic() const noexcept
 {
     return topic_;
@@ -123,6 +266,95 @@ std::recursive_mutex& ServiceRegistry::get_mutex() noexcept
     return mutex_;
 }
 
+ServiceRegistry::RegistryEntry& ServiceRegistry::slot_nts_(
+        uint64_t sequence_number) noexcept
+{
+    return registry_[sequence_number % registry_.size()];
+}
+
+bool ServiceRegistry::is_expired_nts_(
+        const RegistryEntry& entry,
+        const std::chrono::steady_clock::time_point& now) const noexcept
+{
+    return timeout_.count() > 0 && (now - entry.added_time) > timeout_;
+}
+
+void ServiceRegistry::invalidate_nts_(
+        RegistryEntry& entry) noexcept
+{
+    entry.valid = false;
+    size_--;
+}
+
+void ServiceRegistry::grow_nts_() noexcept
+{
+    std::vector<RegistryEntry> old_registry(std::min(max_capacity_, registry_.size() * 2));
+    old_registry.swap(registry_);
+
+    size_ = 0;
+    for (RegistryEntry& old_entry : old_registry)
+    {
+        if (!old_entry.valid)
+        {
+            continue;
+        }
+
+        // If the new size is not a multiple of the old one, two entries may collide. Keep the newest one.
+        RegistryEntry& entry = slot_nts_(old_entry.sequence_number);
+        if (entry.valid)
+        {
+            if (entry.sequence_number > old_entry.sequence_number)
+            {
+                evicted_count_++;
+                continue;
+            }
+            evicted_count_++;
+            invalidate_nts_(entry);
+        }
+
+        entry = std::move(old_entry);
+        size_++;
+    }
+
+    logDebug(DDSROUTER_SERVICEREGISTRY,
+            "ServiceRegistry for service " << topic_ << " in participant " << participant_id_ <<
+            " grown to " << registry_.size() << " entries.");
+}
+
+void ServiceRegistry::remove_expired_nts_(
+        const std::chrono::steady_clock::time_point& now) noexcept
+{
+    if (timeout_.count() <= 0)
+    {
+        return;
+    }
+
+    // Entries older than the ring capacity have already been overwritten
+    if (newest_sequence_number_ - oldest_sequence_number_ >= registry_.size())
+    {
+        oldest_sequence_number_ = newest_sequence_number_ - registry_.size() + 1;
+    }
+
+    while (size_ > 0 && oldest_sequence_number_ <= newest_sequence_number_)
+    {
+        RegistryEntry& entry = slot_nts_(oldest_sequence_number_);
+
+        if (entry.valid && entry.sequence_number == oldest_sequence_number_)
+        {
+            if (!is_expired_nts_(entry, now))
+            {
+                // Newer entries have not expired either
+                return;
+            }
+
+            expired_count_++;
+            invalidate_nts_(entry);
+        }
+
+        oldest_sequence_number_++;
+    }
+}
+
 } /* namespace core */
 } /* namespace ddsrouter */
 } /* namespace eprosima */
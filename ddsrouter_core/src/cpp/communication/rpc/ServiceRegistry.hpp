@@ -20,13 +20,17 @@
 #define _DDSROUTERCORE_TYPES_DDS_SERVICEREGISTRY_HPP_
 
 #include <atomic>
-#include <map>
+#include <chrono>
+#include <cstdint>
 #include <mutex>
+#include <vector>
 
 #include <fastdds/rtps/common/SampleIdentity.h>
 
+#include <ddsrouter_core/configuration/ServiceConfiguration.hpp>
 #include <ddsrouter_core/types/dds/Guid.hpp>
 #include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/statistics/ServiceStatistics.hpp>
 #include <ddsrouter_core/types/topic/rpc/RPCTopic.hpp>
 
 namespace eprosima {
@@ -41,8 +45,16 @@ using SequenceNumber = eprosima::fastrtps::rtps::SequenceNumber_t;
  * Class used to store the information associated to a service request, so its reply can be forwarded through the
  * appropiate proxy server with the proper write parameters.
  *
- * This information is stored in a map, whose insertions and deletions are protected with a mutex.
- * Insertions are performed every time a request is sent, and deletions after a reply has been received and forwarded.
+ * This information is stored in a fixed capacity ring indexed by the sequence number with which the request was
+ * sent, whose insertions and deletions are protected with a mutex.
+ * Insertions are performed every time a request is sent, and deletions when the first reply to it is received.
+ *
+ * As sequence numbers of a writer are consecutive, a new entry only overwrites an entry whose request is older than
+ * the capacity of the ring (evicted). The ring grows on demand up to its maximum capacity.
+ * Entries older than the configured timeout are expired, so their replies are not forwarded anymore.
+ *
+ * The registry also keeps the statistics of the requests forwarded through its participant: the round trip time
+ * of each request is measured from its insertion until it is first fetched.
  *
  * There exists a service registry per router participant.
  *
@@ -56,12 +68,15 @@ public:
      *
      * @param topic: Topic (service) of which this ServiceRegistry manages communication
      * @param participant_id: Id of participant for which this registry is created
+     * @param configuration: Capacity and expiration time of the entries
      *
      * @note Always created disabled. It is first enabled when a server is discovered.
      */
     ServiceRegistry(
             const types::RPCTopic& topic,
-            const types::ParticipantId& participant_id);
+            const types::ParticipantId& participant_id,
+            const configuration::ServiceConfiguration& configuration =
+            configuration::ServiceConfiguration());
 
     //! Enable registry
     void enable() noexcept;
@@ -79,14 +94,52 @@ public:
             SequenceNumber idx,
             std::pair<types::ParticipantId, SampleIdentity> new_entry) noexcept;
 
-    //! Fetch entry from the registry. Returns dummy item if not present.
+    /**
+     * @brief Fetch entry from the registry, once a reply has been received for it.
+     *
+     * The first fetch of an entry records the round trip time of its request.
+     * A fetch that finds no entry is counted as an orphan reply.
+     *
+     * @return entry for \c idx , or dummy item if not present or expired.
+     */
     std::pair<types::ParticipantId, SampleIdentity> get(
-            SequenceNumber idx) const noexcept;
+            SequenceNumber idx) noexcept;
+
+    /**
+     * @brief Fetch entry from the registry and mark it as taken, so any other reply to the same request finds nothing.
+     *
+     * Same as \c get , but a taken entry is not returned again (it counts as an orphan reply) until it is restored.
+     * Once the reply has been forwarded, the entry must be removed with \c erase ; if it could not be forwarded, it
+     * must be made available again with \c restore so a later reply to the same request can be forwarded.
+     *
+     * @return entry for \c idx , or dummy item if not present, expired or already taken.
+     */
+    std::pair<types::ParticipantId, SampleIdentity> take(
+            SequenceNumber idx) noexcept;
+
+    //! Make an entry taken with \c take available again (if still present)
+    void restore(
+            SequenceNumber idx) noexcept;
 
     //! Remove entry from the registry (if present)
     void erase(
             SequenceNumber idx) noexcept;
 
+    //! Number of entries stored (expired entries are removed first)
+    std::size_t size() noexcept;
+
+    //! Maximum number of entries stored
+    std::size_t capacity() const noexcept;
+
+    //! Number of entries removed because they expired before their reply arrived
+    uint64_t expired_count() const noexcept;
+
+    //! Number of entries overwritten by newer ones before their reply arrived
+    uint64_t evicted_count() const noexcept;
+
+    //! Statistics of the requests registered
+    types::ServiceParticipantStatistics statistics() noexcept;
+
     //! RPCTopic getter
     types::RPCTopic topic() const noexcept;
 
@@ -95,6 +148,57 @@ public:
 
 protected:
 
+    //! Slot of the ring that stores an entry
+    struct RegistryEntry
+    {
+        //! Whether the slot holds an entry
+        bool valid = false;
+
+        //! Sequence number of the entry stored
+        uint64_t sequence_number = 0;
+
+        //! Information required to forward the reply
+        std::pair<types::ParticipantId, SampleIdentity> value;
+
+        //! Time when the entry was added
+        std::chrono::steady_clock::time_point added_time;
+
+        //! Whether the entry has already been fetched (a reply has been received)
+        bool replied = false;
+
+        //! Whether the entry has been taken by a reply that is being forwarded
+        bool taken = false;
+    };
+
+    //! Slot of the ring where the entry for \c sequence_number is stored
+    RegistryEntry& slot_nts_(
+            uint64_t sequence_number) noexcept;
+
+    //! Whether \c entry has expired at time \c now
+    bool is_expired_nts_(
+            const RegistryEntry& entry,
+            const std::chrono::steady_clock::time_point& now) const noexcept;
+
+    /**
+     * @brief Increase the size of the ring (double it, up to maximum capacity), relocating valid entries.
+     *
+     * The ring starts small, so memory is only used by services with many requests pending of reply at once.
+     */
+    void grow_nts_() noexcept;
+
+    //! Remove \c entry from the ring
+    void invalidate_nts_(
+            RegistryEntry& entry) noexcept;
+
+    /**
+     * @brief Remove expired entries, from oldest to newest, until a non expired one is found.
+     *
+     * As entries are added in sequence number order, they are also in time order.
+     * Each sequence number is visited only once, so the cost is amortized among the insertions.
+     */
+    void remove_expired_nts_(
+            const std::chrono::steady_clock::time_point& now) noexcept;
+
     //! RPCTopic (service) that this ServiceRegistry manages communication
     types::RPCTopic topic_;
 
@@ -104,11 +208,44 @@ protected:
     //! Whether the registry is activated
     std::atomic<bool> enabled_;
 
-    //! Database with an entry per received request, and the information required for forwarding replies
-    std::map<SequenceNumber, std::pair<types::ParticipantId, SampleIdentity>> registry_;
+    //! Maximum number of entries stored
+    const std::size_t max_capacity_;
+
+    //! Ring with an entry per request sent, and the information required for forwarding replies
+    std::vector<RegistryEntry> registry_;
+
+    //! Number of valid entries in \c registry_
+    std::size_t size_;
+
+    //! Lowest sequence number that could still be stored
+    uint64_t oldest_sequence_number_;
+
+    //! Highest sequence number ever stored
+    uint64_t newest_sequence_number_;
+
+    //! Time after which entries expire (0 for no expiration)
+    std::chrono::milliseconds timeout_;
+
+    //! Number of entries expired
+    std::atomic<uint64_t> expired_count_;
+
+    //! Number of entries evicted
+    std::atomic<uint64_t> evicted_count_;
+
+    //! Number of entries added
+    uint64_t requests_count_;
+
+    //! Number of entries fetched for the first time
+    uint64_t replies_count_;
+
+    //! Number of fetches that did not find an entry
+    uint64_t orphan_replies_count_;
+
+    //! Time from insertion to first fetch of every entry
+    types::LatencyHistogram round_trip_time_;
 
-    //! Default maximum number of entries stored by \c registry_ map
-    static const unsigned int DEFAULT_MAX_ENTRIES_;
+    //! Initial size of \c registry_
+    static const std::size_t INITIAL_CAPACITY_;
 
     //! Mutex to protect concurrent access to \c registry_
     mutable std::recursive_mutex mutex_;
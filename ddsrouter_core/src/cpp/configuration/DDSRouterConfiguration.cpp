@@ -20,8 +20,13 @@
 #include <ddsrouter_core/configuration/DDSRouterConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/DiscoveryServerParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/EchoParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/InProcessParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/InitialPeersParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/LoadGeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/LocalShmParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/ReplayerParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/SimpleParticipantConfiguration.hpp>
 #include <cpp_utils/Log.hpp>
 #include <ddsrouter_core/types/participant/ParticipantKind.hpp>
@@ -56,6 +61,12 @@ bool DDSRouterConfiguration::is_valid(
         return false;
     }
 
+    // Check advanced options
+    if (!advanced_options.is_valid(error_msg))
+    {
+        return false;
+    }
+
     // Check there are at least two participants
     if (participants_configurations.size() < 1)
     {
@@ -127,6 +138,9 @@ bool DDSRouterConfiguration::check_correct_configuration_object_(
         case ParticipantKind::simple_rtps:
             return check_correct_configuration_object_by_type_<SimpleParticipantConfiguration>(configuration);
 
+        case ParticipantKind::local_shm:
+            return check_correct_configuration_object_by_type_<LocalShmParticipantConfiguration>(configuration);
+
         case ParticipantKind::local_discovery_server:
         case ParticipantKind::wan_discovery_server:
             return check_correct_configuration_object_by_type_<DiscoveryServerParticipantConfiguration>(configuration);
@@ -137,6 +151,18 @@ bool DDSRouterConfiguration::check_correct_configuration_object_(
         case ParticipantKind::echo:
             return check_correct_configuration_object_by_type_<EchoParticipantConfiguration>(configuration);
 
+        case ParticipantKind::in_process:
+            return check_correct_configuration_object_by_type_<InProcessParticipantConfiguration>(configuration);
+
+        case ParticipantKind::recorder:
+            return check_correct_configuration_object_by_type_<RecorderParticipantConfiguration>(configuration);
+
+        case ParticipantKind::replayer:
+            return check_correct_configuration_object_by_type_<ReplayerParticipantConfiguration>(configuration);
+
+        case ParticipantKind::load_generator:
+            return check_correct_configuration_object_by_type_<LoadGeneratorParticipantConfiguration>(configuration);
+
         default:
             return check_correct_configuration_object_by_type_<ParticipantConfiguration>(configuration);
     }
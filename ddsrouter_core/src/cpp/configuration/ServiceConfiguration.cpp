@@ -0,0 +1,48 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ServiceConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/ServiceConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+bool ServiceConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (max_pending_requests < 1)
+    {
+        error_msg << "Maximum number of pending requests must be at least 1.";
+        return false;
+    }
+
+    if (request_timeout.count() < 0)
+    {
+        error_msg << "Request timeout cannot be negative.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -33,14 +33,50 @@ bool SpecsConfiguration::is_valid(
         return false;
     }
 
+    if (bridge_construction_threads < 1)
+    {
+        error_msg << "Number of Bridge construction Threads must be at least 1.";
+        return false;
+    }
+
     if (max_history_depth == 0)
     {
         logWarning(DDSROUTER_SPECS, "Using non limited histories could lead to memory exhaustion in long executions.");
     }
 
+    if (!default_service.is_valid(error_msg))
+    {
+        return false;
+    }
+
+    for (const auto& service : services)
+    {
+        if (!service.second.is_valid(error_msg))
+        {
+            error_msg << " Error in service " << service.first << ".";
+            return false;
+        }
+    }
+
+    if (!statistics.is_valid(error_msg))
+    {
+        return false;
+    }
+
     return true;
 }
 
+ServiceConfiguration SpecsConfiguration::service_configuration(
+        const std::string& service_name) const noexcept
+{
+    auto it = services.find(service_name);
+    if (it != services.end())
+    {
+        return it->second;
+    }
+    return default_service;
+}
+
 } /* namespace configuration */
 } /* namespace core */
 } /* namespace ddsrouter */
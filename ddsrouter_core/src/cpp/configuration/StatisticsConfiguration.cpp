@@ -0,0 +1,59 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsConfiguration.cpp
+ *
+ */
+
+#include <ddsrouter_core/configuration/StatisticsConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+bool StatisticsConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!enabled)
+    {
+        return true;
+    }
+
+    if (!domain.is_valid())
+    {
+        error_msg << "Non valid domain " << domain << " for statistics publication.";
+        return false;
+    }
+
+    if (topic_name.empty())
+    {
+        error_msg << "Statistics topic name cannot be empty.";
+        return false;
+    }
+
+    if (period.count() <= 0)
+    {
+        error_msg << "Statistics publication period must be positive.";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
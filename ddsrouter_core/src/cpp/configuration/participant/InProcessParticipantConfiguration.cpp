@@ -0,0 +1,58 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessParticipantConfiguration.cpp
+ */
+
+#include <ddsrouter_core/configuration/participant/InProcessParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+using namespace eprosima::ddsrouter::core::types;
+
+InProcessParticipantConfiguration::InProcessParticipantConfiguration(
+        const ParticipantId& id,
+        const ParticipantKind& kind,
+        const bool is_repeater,
+        std::shared_ptr<InProcessConnector> connector) noexcept
+    : ParticipantConfiguration(id, kind, is_repeater)
+    , connector(connector)
+{
+}
+
+bool InProcessParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (!connector)
+    {
+        error_msg << "In-process participant " << id << " requires a connector. ";
+        return false;
+    }
+
+    return true;
+}
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,106 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadGeneratorParticipantConfiguration.cpp
+ */
+
+#include <ddsrouter_core/configuration/participant/LoadGeneratorParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+using namespace eprosima::ddsrouter::core::types;
+
+const char* LoadGeneratorParticipantConfiguration::DEFAULT_TOPIC_PREFIX = "load";
+const char* LoadGeneratorParticipantConfiguration::DEFAULT_TYPE_NAME = "LoadGeneratorSample";
+const unsigned int LoadGeneratorParticipantConfiguration::MIN_SAMPLE_SIZE = 20;
+const unsigned int LoadGeneratorParticipantConfiguration::DEFAULT_REPORT_PERIOD = 1000;
+
+LoadGeneratorParticipantConfiguration::LoadGeneratorParticipantConfiguration(
+        const ParticipantId& id,
+        const ParticipantKind& kind,
+        const bool is_repeater) noexcept
+    : ParticipantConfiguration(id, kind, is_repeater)
+{
+}
+
+bool LoadGeneratorParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (topic_count > 0 && topic_prefix.empty())
+    {
+        error_msg << "Load generator participant " << id << " requires a topic prefix. ";
+        return false;
+    }
+
+    if (!(rate >= 0))
+    {
+        error_msg << "Load generator participant " << id << " rate " << rate << " must not be negative. ";
+        return false;
+    }
+
+    if (burst == 0)
+    {
+        error_msg << "Load generator participant " << id << " burst must be at least 1. ";
+        return false;
+    }
+
+    if (min_size < MIN_SAMPLE_SIZE)
+    {
+        error_msg << "Load generator participant " << id << " minimum size must be at least " << MIN_SAMPLE_SIZE <<
+            " bytes. ";
+        return false;
+    }
+
+    if (max_size < min_size)
+    {
+        error_msg << "Load generator participant " << id << " maximum size " << max_size <<
+            " is lower than minimum size " << min_size << ". ";
+        return false;
+    }
+
+    return true;
+}
+
+bool LoadGeneratorParticipantConfiguration::operator ==(
+        const LoadGeneratorParticipantConfiguration& other) const noexcept
+{
+    return ParticipantConfiguration::operator ==(
+        other) &&
+           this->topic_count == other.topic_count &&
+           this->topic_prefix == other.topic_prefix &&
+           this->type_name == other.type_name &&
+           this->rate == other.rate &&
+           this->burst == other.burst &&
+           this->min_size == other.min_size &&
+           this->max_size == other.max_size &&
+           this->size_distribution == other.size_distribution &&
+           this->keys == other.keys &&
+           this->reliable == other.reliable &&
+           this->transient_local == other.transient_local &&
+           this->report_period == other.report_period;
+}
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
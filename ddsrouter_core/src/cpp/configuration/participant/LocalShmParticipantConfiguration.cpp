@@ -0,0 +1,75 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LocalShmParticipantConfiguration.cpp
+ */
+
+#include <ddsrouter_core/configuration/participant/LocalShmParticipantConfiguration.hpp>
+#include <cpp_utils/Log.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+using namespace eprosima::ddsrouter::core::types;
+
+// An RTPS message must at least fit an RTPS header and a data submessage
+const uint32_t LocalShmParticipantConfiguration::MIN_SEGMENT_SIZE = 1024;
+
+LocalShmParticipantConfiguration::LocalShmParticipantConfiguration(
+        const ParticipantId& id,
+        const ParticipantKind& kind,
+        const bool is_repeater,
+        const DomainId& domain_id,
+        const uint32_t segment_size /* = 0 */,
+        const uint32_t port_queue_capacity /* = 0 */) noexcept
+    : SimpleParticipantConfiguration(id, kind, is_repeater, domain_id)
+    , segment_size(segment_size)
+    , port_queue_capacity(port_queue_capacity)
+{
+}
+
+bool LocalShmParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!SimpleParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (segment_size != 0 && segment_size < MIN_SEGMENT_SIZE)
+    {
+        error_msg << "Shared memory segment size " << segment_size << " lower than minimum " << MIN_SEGMENT_SIZE <<
+            ". ";
+        return false;
+    }
+
+    return true;
+}
+
+bool LocalShmParticipantConfiguration::operator ==(
+        const LocalShmParticipantConfiguration& other) const noexcept
+{
+    return SimpleParticipantConfiguration::operator ==(
+        other) &&
+           this->segment_size == other.segment_size &&
+           this->port_queue_capacity == other.port_queue_capacity;
+}
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,87 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderParticipantConfiguration.cpp
+ */
+
+#include <ddsrouter_core/configuration/participant/RecorderParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+using namespace eprosima::ddsrouter::core::types;
+
+const uint64_t RecorderParticipantConfiguration::DEFAULT_CHUNK_SIZE = 16 * 1024 * 1024;
+const uint64_t RecorderParticipantConfiguration::DEFAULT_MAX_PENDING_BYTES = 256 * 1024 * 1024;
+
+RecorderParticipantConfiguration::RecorderParticipantConfiguration(
+        const ParticipantId& id,
+        const ParticipantKind& kind,
+        const bool is_repeater,
+        const std::string& file_path,
+        const uint64_t chunk_size /* = DEFAULT_CHUNK_SIZE */,
+        const uint64_t max_pending_bytes /* = DEFAULT_MAX_PENDING_BYTES */) noexcept
+    : ParticipantConfiguration(id, kind, is_repeater)
+    , file_path(file_path)
+    , chunk_size(chunk_size)
+    , max_pending_bytes(max_pending_bytes)
+{
+}
+
+bool RecorderParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (file_path.empty())
+    {
+        error_msg << "Recorder participant " << id << " requires a file path. ";
+        return false;
+    }
+
+    if (chunk_size == 0)
+    {
+        error_msg << "Recorder participant " << id << " chunk size must be greater than 0. ";
+        return false;
+    }
+
+    if (max_pending_bytes == 0)
+    {
+        error_msg << "Recorder participant " << id << " buffer size must be greater than 0. ";
+        return false;
+    }
+
+    return true;
+}
+
+bool RecorderParticipantConfiguration::operator ==(
+        const RecorderParticipantConfiguration& other) const noexcept
+{
+    return ParticipantConfiguration::operator ==(
+        other) &&
+           this->file_path == other.file_path &&
+           this->chunk_size == other.chunk_size &&
+           this->max_pending_bytes == other.max_pending_bytes;
+}
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
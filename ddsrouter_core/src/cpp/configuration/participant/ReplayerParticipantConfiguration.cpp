@@ -0,0 +1,80 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReplayerParticipantConfiguration.cpp
+ */
+
+#include <ddsrouter_core/configuration/participant/ReplayerParticipantConfiguration.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace configuration {
+
+using namespace eprosima::ddsrouter::core::types;
+
+const unsigned int ReplayerParticipantConfiguration::DEFAULT_START_DELAY = 1000;
+
+ReplayerParticipantConfiguration::ReplayerParticipantConfiguration(
+        const ParticipantId& id,
+        const ParticipantKind& kind,
+        const bool is_repeater,
+        const std::string& file_path,
+        const double speed /* = 1.0 */,
+        const unsigned int start_delay /* = DEFAULT_START_DELAY */) noexcept
+    : ParticipantConfiguration(id, kind, is_repeater)
+    , file_path(file_path)
+    , speed(speed)
+    , start_delay(start_delay)
+{
+}
+
+bool ReplayerParticipantConfiguration::is_valid(
+        utils::Formatter& error_msg) const noexcept
+{
+    if (!ParticipantConfiguration::is_valid(error_msg))
+    {
+        return false;
+    }
+
+    if (file_path.empty())
+    {
+        error_msg << "Replayer participant " << id << " requires a file path. ";
+        return false;
+    }
+
+    if (!(speed >= 0))
+    {
+        error_msg << "Replayer participant " << id << " speed " << speed << " must not be negative. ";
+        return false;
+    }
+
+    return true;
+}
+
+bool ReplayerParticipantConfiguration::operator ==(
+        const ReplayerParticipantConfiguration& other) const noexcept
+{
+    return ParticipantConfiguration::operator ==(
+        other) &&
+           this->file_path == other.file_path &&
+           this->speed == other.speed &&
+           this->start_delay == other.start_delay;
+}
+
+} /* namespace configuration */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,119 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BridgeConstructionPool.cpp
+ *
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <core/BridgeConstructionPool.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+BridgeConstructionPool::BridgeConstructionPool(
+        unsigned int number_of_threads)
+    : exit_(false)
+{
+    if (number_of_threads < 1)
+    {
+        number_of_threads = 1;
+    }
+
+    logDebug(DDSROUTER_BRIDGE_CONSTRUCTION, "Creating " << number_of_threads << " Bridge construction threads.");
+
+    for (unsigned int i = 0; i < number_of_threads; ++i)
+    {
+        threads_.emplace_back(&BridgeConstructionPool::thread_routine_, this);
+    }
+}
+
+BridgeConstructionPool::~BridgeConstructionPool()
+{
+    stop();
+}
+
+void BridgeConstructionPool::emit(
+        ConstructionTask task) noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (exit_)
+        {
+            logDebug(DDSROUTER_BRIDGE_CONSTRUCTION, "Discarding Bridge construction task in stopped pool.");
+            return;
+        }
+
+        tasks_.push_back(std::move(task));
+    }
+    tasks_cv_.notify_one();
+}
+
+void BridgeConstructionPool::stop() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (exit_)
+        {
+            return;
+        }
+
+        exit_ = true;
+        tasks_.clear();
+    }
+    tasks_cv_.notify_all();
+
+    for (std::thread& thread : threads_)
+    {
+        thread.join();
+    }
+    threads_.clear();
+}
+
+void BridgeConstructionPool::thread_routine_() noexcept
+{
+    while (true)
+    {
+        ConstructionTask task;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            tasks_cv_.wait(
+                lock,
+                [&]
+                {
+                    return !tasks_.empty() || exit_;
+                });
+
+            if (exit_)
+            {
+                break;
+            }
+
+            task = std::move(tasks_.front());
+            tasks_.pop_front();
+        }
+
+        // Execute without holding the mutex so the rest of threads can take new tasks
+        task();
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
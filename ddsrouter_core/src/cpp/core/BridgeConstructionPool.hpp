@@ -0,0 +1,107 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BridgeConstructionPool.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_CORE_BRIDGECONSTRUCTIONPOOL_HPP_
+#define __SRC_DDSROUTERCORE_CORE_BRIDGECONSTRUCTIONPOOL_HPP_
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Pool of threads dedicated to construct Bridges.
+ *
+ * Creating a Bridge requires to create a Writer and a Reader in every Participant, what may take a long time for
+ * RTPS Participants. This pool allows to create the Bridges of different topics concurrently and out of the
+ * \c DDSRouterImpl mutex, so discovery is not blocked while endpoints are being created.
+ *
+ * It is not a generic thread pool: tasks are executed once and in no specific order.
+ */
+class BridgeConstructionPool
+{
+public:
+
+    //! Task to execute in the pool
+    using ConstructionTask = std::function<void()>;
+
+    /**
+     * @brief Construct a new BridgeConstructionPool and start its threads
+     *
+     * @param [in] number_of_threads : number of threads constructing Bridges (at least 1 is created)
+     */
+    BridgeConstructionPool(
+            unsigned int number_of_threads);
+
+    /**
+     * @brief Destroy the BridgeConstructionPool
+     *
+     * Calls \c stop .
+     */
+    ~BridgeConstructionPool();
+
+    /**
+     * @brief Add a new task to be executed by any thread of the pool
+     *
+     * If the pool has been stopped, the task is discarded.
+     *
+     * @param [in] task : task to execute
+     */
+    void emit(
+            ConstructionTask task) noexcept;
+
+    /**
+     * @brief Stop every thread of the pool
+     *
+     * Tasks being executed are finished, tasks not started yet are discarded.
+     * This method waits for every thread to finish.
+     */
+    void stop() noexcept;
+
+protected:
+
+    //! Routine executed by every thread of the pool
+    void thread_routine_() noexcept;
+
+    //! Tasks waiting to be executed
+    std::deque<ConstructionTask> tasks_;
+
+    //! Threads of the pool
+    std::vector<std::thread> threads_;
+
+    //! Whether the threads must finish
+    bool exit_;
+
+    //! Guards \c tasks_ and \c exit_
+    std::mutex mutex_;
+
+    //! Awake threads when new tasks arrive or the pool stops
+    std::condition_variable tasks_cv_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_CORE_BRIDGECONSTRUCTIONPOOL_HPP_ */
@@ -19,6 +19,7 @@
 
 #include <ddsrouter_core/core/DDSRouter.hpp>
 #include <core/DDSRouterImpl.hpp>
+#include <trace/TraceRecorder.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -52,6 +53,38 @@ utils::ReturnCode DDSRouter::stop() noexcept
     return ddsrouter_impl_->stop();
 }
 
+std::map<std::string, types::ServiceStatistics> DDSRouter::services_statistics() noexcept
+{
+    return ddsrouter_impl_->services_statistics();
+}
+
+types::RouterStatistics DDSRouter::statistics(
+        bool memory /* = false */) noexcept
+{
+    return ddsrouter_impl_->statistics(memory);
+}
+
+bool DDSRouter::tracing_enabled() noexcept
+{
+    return trace::TraceRecorder::enabled();
+}
+
+utils::ReturnCode DDSRouter::dump_trace(
+        const std::string& file_path) noexcept
+{
+    if (!trace::TraceRecorder::enabled())
+    {
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    if (!trace::TraceRecorder::instance().dump(file_path))
+    {
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
 } /* namespace core */
 } /* namespace ddsrouter */
 } /* namespace eprosima */
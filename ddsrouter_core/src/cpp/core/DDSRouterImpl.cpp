@@ -29,6 +29,7 @@
 
 #include <core/DDSRouterImpl.hpp>
 #include <efficiency/payload/FastPayloadPool.hpp>
+#include <trace/Tracepoints.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -46,6 +47,9 @@ DDSRouterImpl::DDSRouterImpl(
     , configuration_(configuration)
     , enabled_(false)
     , thread_pool_(std::make_shared<utils::SlotThreadPool>(configuration_.advanced_options.number_of_threads))
+    , pending_bridge_constructions_(0)
+    , bridge_construction_pool_(std::make_unique<BridgeConstructionPool>(
+                configuration_.advanced_options.bridge_construction_threads))
 {
     logDebug(DDSROUTER, "Creating DDS Router.");
 
@@ -62,12 +66,8 @@ DDSRouterImpl::DDSRouterImpl(
     types::TopicQoS::default_history_depth.store(
         configuration_.advanced_options.max_history_depth);
 
-    // Add callback to be called by the discovery database when an Endpoint is discovered
-    discovery_database_->add_endpoint_discovered_callback(std::bind(&DDSRouterImpl::discovered_endpoint_, this,
-            std::placeholders::_1));
-
-    // Add callback to be called by the discovery database when an Endpoint is removed/dropped
-    discovery_database_->add_endpoint_erased_callback(std::bind(&DDSRouterImpl::removed_endpoint_, this,
+    // Add callback to be called by the discovery database when a batch of Endpoints is discovered/removed/dropped
+    discovery_database_->add_batch_processed_callback(std::bind(&DDSRouterImpl::discovery_batch_processed_, this,
             std::placeholders::_1));
 
     // Init topic allowed
@@ -82,6 +82,16 @@ DDSRouterImpl::DDSRouterImpl(
     // than the one specified in the yaml configuration file.
     discovery_database_->start();
 
+    // Start publishing statistics, independently of the Participants of the router
+    if (configuration_.advanced_options.statistics.enabled)
+    {
+        statistics_publisher_ = std::make_unique<StatisticsPublisher>(
+            configuration_.advanced_options.statistics,
+            [this]()
+            {
+                return this->statistics();
+            });
+    }
 
     logDebug(DDSROUTER, "DDS Router created.");
 }
@@ -90,13 +100,23 @@ DDSRouterImpl::~DDSRouterImpl()
 {
     logDebug(DDSROUTER, "Destroying DDS Router.");
 
+    // Stop publishing statistics before destroying the Bridges it reads them from
+    statistics_publisher_.reset();
+
     // Stop Discovery Database
     discovery_database_->stop();
 
+    // Wait for Bridges being constructed and discard those not started
+    bridge_construction_pool_->stop();
+
     // Stop all communications
     stop_();
 
     // Destroy Bridges, so Writers and Readers are destroyed before the Databases
+    {
+        std::lock_guard<std::mutex> statistics_lock(statistics_mutex_);
+        statistics_bridges_.clear();
+    }
     bridges_.clear();
 
     // Destroy RPCBridges, so Writers and Readers are destroyed before the Databases
@@ -211,6 +231,9 @@ utils::ReturnCode DDSRouterImpl::reload_configuration(
 
         configuration_.reload(new_configuration);
 
+        // Bridges of newly allowed topics are constructed in parallel, wait for them
+        wait_bridges_constructed_();
+
         return utils::ReturnCode::RETCODE_OK;
     }
     else
@@ -264,6 +287,9 @@ utils::ReturnCode DDSRouterImpl::start_() noexcept
 
         activate_all_topics_();
 
+        // Bridges of every active topic are constructed in parallel, wait for them so Router starts ready
+        wait_bridges_constructed_();
+
         // Enable services discovered while router disabled
         for (auto it : current_services_)
         {
@@ -486,18 +512,67 @@ void DDSRouterImpl::removed_endpoint_(
     }
 }
 
-void DDSRouterImpl::create_new_bridge(
-        const DdsTopic& topic,
-        bool enabled /*= false*/) noexcept
+void DDSRouterImpl::discovery_batch_processed_(
+        const std::vector<DatabaseOperationItem>& operations) noexcept
 {
+    logDebug(DDSROUTER, "Processing batch of " << operations.size() << " discovery operations.");
+
+    // Take the mutex once for the whole batch, so a discovery burst does not contend for it per endpoint
     std::lock_guard<std::recursive_mutex> lock(mutex_);
 
+    for (const DatabaseOperationItem& operation : operations)
+    {
+        if (std::get<0>(operation) == DatabaseOperation::add)
+        {
+            discovered_endpoint_(std::get<1>(operation));
+        }
+        else if (std::get<0>(operation) == DatabaseOperation::erase)
+        {
+            removed_endpoint_(std::get<1>(operation));
+        }
+        // Updates do not modify the topics or services of the router
+    }
+}
+
+void DDSRouterImpl::create_new_bridge(
+        const DdsTopic& topic) noexcept
+{
+    std::lock_guard<std::mutex> lock(bridges_construction_mutex_);
+
+    BridgeConstructionStatus& status = bridges_construction_status_[topic];
+    if (status.under_construction)
+    {
+        logDebug(DDSROUTER, "Bridge for topic " << topic << " already under construction.");
+        return;
+    }
+
+    logInfo(DDSROUTER, "Requesting Bridge construction for topic: " << topic << ".");
+
+    status.under_construction = true;
+    status.requested_time = std::chrono::steady_clock::now();
+    ++pending_bridge_constructions_;
+
+    DDSROUTER_TRACEPOINT(bridge_requested, topic.topic_name.c_str(), topic.type_name.c_str(),
+            pending_bridge_constructions_);
+
+    bridge_construction_pool_->emit(
+        [this, topic]()
+        {
+            construct_bridge_(topic);
+        });
+}
+
+void DDSRouterImpl::construct_bridge_(
+        const DdsTopic& topic) noexcept
+{
     logInfo(DDSROUTER, "Creating Bridge for topic: " << topic << ".");
 
+    // Always created disabled, it is enabled when installed if the topic is still active
+    std::unique_ptr<DDSBridge> new_bridge;
     try
     {
-        bridges_[topic] = std::make_unique<DDSBridge>(topic, participants_database_, payload_pool_, thread_pool_,
-                        enabled);
+        new_bridge = std::make_unique<DDSBridge>(topic, participants_database_, payload_pool_, thread_pool_, false,
+                configuration_.advanced_options.profiling);
     }
     catch (const utils::InitializationException& e)
     {
@@ -505,6 +580,148 @@ void DDSRouterImpl::create_new_bridge(
                 "Error creating Bridge for topic " << topic <<
                 ". Error code:" << e.what() << ".");
     }
+
+    {
+        std::lock_guard<std::mutex> lock(bridges_construction_mutex_);
+
+        BridgeConstructionStatus& status = bridges_construction_status_[topic];
+        status.constructed_time = std::chrono::steady_clock::now();
+
+        DDSROUTER_TRACEPOINT(bridge_constructed, topic.topic_name.c_str(), topic.type_name.c_str(),
+                static_cast<bool>(new_bridge),
+                std::chrono::duration_cast<std::chrono::nanoseconds>(
+                    status.constructed_time - status.requested_time).count());
+
+        if (new_bridge)
+        {
+            logInfo(DDSROUTER,
+                    "Bridge for topic " << topic << " constructed in " <<
+                    std::chrono::duration_cast<std::chrono::milliseconds>(
+                        status.constructed_time - status.requested_time).count() << " ms.");
+
+            // It keeps under construction until installed, so the topic is not requested again meanwhile
+            constructed_bridges_.emplace_back(topic, std::move(new_bridge));
+        }
+        else
+        {
+            status.under_construction = false;
+        }
+
+        --pending_bridge_constructions_;
+    }
+    bridges_construction_cv_.notify_all();
+
+    install_constructed_bridges_();
+}
+
+void DDSRouterImpl::install_constructed_bridges_() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    std::vector<std::pair<DdsTopic, std::unique_ptr<DDSBridge>>> bridges_to_install;
+    std::vector<std::chrono::steady_clock::time_point> requested_times;
+    {
+        std::lock_guard<std::mutex> construction_lock(bridges_construction_mutex_);
+        bridges_to_install.swap(constructed_bridges_);
+
+        for (const auto& bridge_it : bridges_to_install)
+        {
+            requested_times.push_back(bridges_construction_status_[bridge_it.first].requested_time);
+        }
+    }
+
+    for (std::size_t i = 0; i < bridges_to_install.size(); ++i)
+    {
+        auto& bridge_it = bridges_to_install[i];
+
+        // The topic could have been deactivated (or the Router stopped) while constructing
+        auto topic_it = current_topics_.find(bridge_it.first);
+        if (enabled_.load() && topic_it != current_topics_.end() && topic_it->second)
+        {
+            bridge_it.second->enable();
+        }
+
+        {
+            // Replace it in statistics before any previous Bridge of the topic is destroyed
+            std::lock_guard<std::mutex> statistics_lock(statistics_mutex_);
+            statistics_bridges_[bridge_it.first] = {bridge_it.second.get(), requested_times[i]};
+        }
+
+        bridges_[bridge_it.first] = std::move(bridge_it.second);
+    }
+
+    // mutex_ is still taken, so no topic can be activated before its Bridge is in bridges_
+    {
+        std::lock_guard<std::mutex> construction_lock(bridges_construction_mutex_);
+        for (const auto& bridge_it : bridges_to_install)
+        {
+            bridges_construction_status_[bridge_it.first].under_construction = false;
+        }
+    }
+}
+
+void DDSRouterImpl::wait_bridges_constructed_() noexcept
+{
+    {
+        std::unique_lock<std::mutex> lock(bridges_construction_mutex_);
+        bridges_construction_cv_.wait(
+            lock,
+            [this]
+            {
+                return pending_bridge_constructions_ == 0;
+            });
+    }
+
+    install_constructed_bridges_();
+}
+
+std::map<std::string, ServiceStatistics> DDSRouterImpl::services_statistics() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    std::map<std::string, ServiceStatistics> result;
+    for (const auto& rpc_bridge_it : rpc_bridges_)
+    {
+        result[rpc_bridge_it.first.service_name()] = rpc_bridge_it.second->statistics();
+    }
+
+    return result;
+}
+
+RouterStatistics DDSRouterImpl::statistics(
+        bool memory /* = false */) noexcept
+{
+    // mutex_ is not taken, so collecting statistics never waits for (nor delays) discovery or reloads
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+
+    RouterStatistics result;
+    for (const auto& bridge_it : statistics_bridges_)
+    {
+        const DDSBridge* bridge = bridge_it.second.bridge;
+        TopicStatistics& topic_statistics = result.topics[bridge_it.first];
+        topic_statistics = bridge->statistics();
+
+        std::chrono::steady_clock::time_point first_forward = bridge->first_forward_time();
+        if (first_forward.time_since_epoch().count() != 0)
+        {
+            topic_statistics.time_to_first_forward = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                first_forward - bridge_it.second.requested_time);
+        }
+
+        if (memory)
+        {
+            topic_statistics.memory = bridge->memory_statistics();
+        }
+
+        result.thread_pool.busy_tracks += bridge->busy_tracks();
+    }
+
+    result.thread_pool.threads = configuration_.advanced_options.number_of_threads;
+
+    result.payload_pool.reserved = payload_pool_->reserved_payloads();
+    result.payload_pool.released = payload_pool_->released_payloads();
+
+    return result;
 }
 
 void DDSRouterImpl::create_new_service(
@@ -515,7 +732,12 @@ void DDSRouterImpl::create_new_service(
     logInfo(DDSROUTER, "Creating Service: " << topic << ".");
 
     // Endpoints not created until enabled for the first time, so no exception can be thrown
-    rpc_bridges_[topic] = std::make_unique<RPCBridge>(topic, participants_database_, payload_pool_, thread_pool_);
+    rpc_bridges_[topic] = std::make_unique<RPCBridge>(
+        topic,
+        participants_database_,
+        payload_pool_,
+        thread_pool_,
+        configuration_.advanced_options.service_configuration(topic.service_name()));
 }
 
 void DDSRouterImpl::activate_topic_(
@@ -533,8 +755,8 @@ void DDSRouterImpl::activate_topic_(
 
     if (it_bridge == bridges_.end())
     {
-        // The Bridge did not exist
-        create_new_bridge(topic, true);
+        // The Bridge did not exist, request its construction (it will be enabled when constructed)
+        create_new_bridge(topic);
     }
     else
     {
@@ -20,13 +20,18 @@
 #define __SRC__SRC_DDSROUTERCORE_CORE_DDSROUTERIMPL_HPP_
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <map>
 #include <mutex>
+#include <string>
+#include <vector>
 
 #include <cpp_utils/ReturnCode.hpp>
 #include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
 
 #include <communication/DDSBridge.hpp>
+#include <core/BridgeConstructionPool.hpp>
 #include <communication/rpc/RPCBridge.hpp>
 #include <dynamic/AllowedTopicList.hpp>
 #include <dynamic/DiscoveryDatabase.hpp>
@@ -34,9 +39,12 @@
 #include <participant/IParticipant.hpp>
 #include <core/ParticipantsDatabase.hpp>
 #include <core/ParticipantFactory.hpp>
+#include <statistics/StatisticsPublisher.hpp>
 #include <ddsrouter_core/configuration/DDSRouterConfiguration.hpp>
 #include <ddsrouter_core/configuration/DDSRouterReloadConfiguration.hpp>
 #include <ddsrouter_core/types/endpoint/Endpoint.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+#include <ddsrouter_core/types/statistics/ServiceStatistics.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -111,8 +119,52 @@ public:
      */
     utils::ReturnCode stop() noexcept;
 
+    /**
+     * @brief Statistics of the requests forwarded by each service
+     *
+     * @return statistics indexed by service name
+     */
+    std::map<std::string, types::ServiceStatistics> services_statistics() noexcept;
+
+    /**
+     * @brief Statistics of the data forwarded in each topic
+     *
+     * It does not take \c mutex_ , so it can be called periodically without interfering with the router.
+     *
+     * The time to first forward of each topic is measured from the request of the construction of its Bridge.
+     *
+     * @param memory whether the memory held by each topic is also computed (see \c DDSBridge::memory_statistics )
+     *
+     * @return statistics of every topic with a Bridge, and usage of the payload pool and thread pool
+     */
+    types::RouterStatistics statistics(
+            bool memory = false) noexcept;
+
 protected:
 
+    //! Construction status of the Bridge of a topic
+    struct BridgeConstructionStatus
+    {
+        //! Whether the Bridge is being constructed or waiting to be installed in \c bridges_
+        bool under_construction = false;
+
+        //! Time when the construction of the Bridge was requested
+        std::chrono::steady_clock::time_point requested_time{};
+
+        //! Time when the construction of the Bridge finished
+        std::chrono::steady_clock::time_point constructed_time{};
+    };
+
+    //! Bridge of \c bridges_ read by \c statistics , and the time its construction was requested
+    struct StatisticsBridge
+    {
+        //! Bridge installed in \c bridges_
+        const DDSBridge* bridge = nullptr;
+
+        //! Time when the construction of the Bridge was requested
+        std::chrono::steady_clock::time_point requested_time{};
+    };
+
     /**
      * @brief Internal Start method
      *
@@ -226,15 +278,48 @@ protected:
             const types::Endpoint& endpoint) noexcept;
 
     /**
-     * @brief Create a new \c DDSBridge object
+     * @brief Method called every time the discovery database has processed a batch of operations
+     *
+     * Every operation is handled as \c discovered_endpoint_ (add) or \c removed_endpoint_ (erase),
+     * with \c mutex_ taken only once for the whole batch.
+     *
+     * @param [in] operations : operations applied in the discovery database, in order
+     */
+    void discovery_batch_processed_(
+            const std::vector<DatabaseOperationItem>& operations) noexcept;
+
+    /**
+     * @brief Request the construction of a new \c DDSBridge object
      *
-     * It is created enabled if the DDSRouterImpl is enabled.
+     * The Bridge is constructed asynchronously in \c bridge_construction_pool_ , so Bridges of different topics
+     * are constructed in parallel and without holding \c mutex_ .
+     * Once constructed, it is added to \c bridges_ and enabled if the topic is active and the router enabled.
+     * If a construction for this topic is already in progress, nothing is done.
      *
      * @param [in] topic : new topic
      */
     void create_new_bridge(
-            const types::DdsTopic& topic,
-            bool enabled = false) noexcept;
+            const types::DdsTopic& topic) noexcept;
+
+    /**
+     * @brief Construct the \c DDSBridge of a topic
+     *
+     * Executed by a thread of \c bridge_construction_pool_ . It does not take \c mutex_ while constructing.
+     *
+     * @param [in] topic : topic of the new Bridge
+     */
+    void construct_bridge_(
+            const types::DdsTopic& topic) noexcept;
+
+    /**
+     * @brief Move every Bridge already constructed to \c bridges_ , enabling it if its topic is active
+     */
+    void install_constructed_bridges_() noexcept;
+
+    /**
+     * @brief Wait until every Bridge construction requested has finished and install them
+     */
+    void wait_bridges_constructed_() noexcept;
 
     /**
      * @brief Create a new \c RPCBridge object
@@ -249,7 +334,7 @@ protected:
     /**
      * @brief Enable a specific topic
      *
-     * If the topic did not exist before, the Bridge is created.
+     * If the topic did not exist before, the Bridge construction is requested.
      *
      * @param [in] topic : Topic to be enabled
      */
@@ -343,6 +428,47 @@ protected:
     std::recursive_mutex mutex_;
 
     std::shared_ptr<utils::SlotThreadPool> thread_pool_;
+
+    /////
+    // BRIDGE CONSTRUCTION
+
+    //! Construction status of the Bridge of every topic that has been requested
+    std::map<types::DdsTopic, BridgeConstructionStatus> bridges_construction_status_;
+
+    //! Bridges already constructed waiting to be added to \c bridges_
+    std::vector<std::pair<types::DdsTopic, std::unique_ptr<DDSBridge>>> constructed_bridges_;
+
+    //! Number of Bridge constructions requested and not finished yet
+    unsigned int pending_bridge_constructions_;
+
+    /**
+     * Guards \c bridges_construction_status_ , \c constructed_bridges_ and \c pending_bridge_constructions_ .
+     *
+     * @note If \c mutex_ is also required, it must be taken before this one.
+     */
+    std::mutex bridges_construction_mutex_;
+
+    //! Notified every time a Bridge construction finishes
+    std::condition_variable bridges_construction_cv_;
+
+    //! Threads in charge of constructing Bridges
+    std::unique_ptr<BridgeConstructionPool> bridge_construction_pool_;
+
+    /////
+    // STATISTICS
+
+    //! Publisher of the statistics in a DDS topic (only if enabled in configuration)
+    std::unique_ptr<StatisticsPublisher> statistics_publisher_;
+
+    //! Bridges of \c bridges_ read by \c statistics , so it does not need \c mutex_
+    std::map<types::DdsTopic, StatisticsBridge> statistics_bridges_;
+
+    /**
+     * Guards \c statistics_bridges_ .
+     *
+     * @note If \c mutex_ is also required, it must be taken before this one.
+     */
+    std::mutex statistics_mutex_;
 };
 
 } /* namespace core */
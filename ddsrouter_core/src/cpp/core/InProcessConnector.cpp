@@ -0,0 +1,229 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessConnector.cpp
+ */
+
+#include <cstring>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/core/InProcessConnector.hpp>
+
+#include <efficiency/payload/PayloadPool.hpp>
+#include <participant/implementations/auxiliar/InProcessParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+bool InProcessConnector::connected() const noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+    return participant_ != nullptr;
+}
+
+utils::ReturnCode InProcessConnector::announce_publication(
+        const DdsTopic& topic) noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+
+    if (!participant_)
+    {
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    publications_[topic] = participant_->announce_endpoint(topic, EndpointKind::writer);
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+utils::ReturnCode InProcessConnector::announce_subscription(
+        const DdsTopic& topic) noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+
+    if (!participant_)
+    {
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    participant_->announce_endpoint(topic, EndpointKind::reader);
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+utils::ReturnCode InProcessConnector::loan_payload(
+        uint32_t size,
+        Payload& payload) noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+
+    if (!payload_pool_)
+    {
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    if (!payload_pool_->get_payload(size, payload))
+    {
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+utils::ReturnCode InProcessConnector::write(
+        const DdsTopic& topic,
+        Payload& payload) noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+
+    if (!participant_)
+    {
+        // The payload must be given back even if it could not be written
+        if (payload_pool_ && payload.data != nullptr)
+        {
+            payload_pool_->release_payload(payload);
+        }
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    std::unique_ptr<DataReceived> data = std::make_unique<DataReceived>();
+
+    // Move the payload reference, so the data is not copied nor released by the destructor of payload
+    data->payload.data = payload.data;
+    data->payload.length = payload.length;
+    data->payload.max_size = payload.max_size;
+    data->payload.encapsulation = payload.encapsulation;
+    payload.data = nullptr;
+    payload.length = 0;
+    payload.max_size = 0;
+
+    data->properties.kind = eprosima::fastrtps::rtps::ALIVE;
+    eprosima::fastrtps::rtps::Time_t::now(data->properties.source_timestamp);
+
+    auto publication_it = publications_.find(topic);
+    if (publication_it != publications_.end())
+    {
+        data->properties.source_guid = publication_it->second;
+    }
+
+    return participant_->receive_data(topic, std::move(data));
+}
+
+utils::ReturnCode InProcessConnector::write(
+        const DdsTopic& topic,
+        const PayloadUnit* data,
+        uint32_t size) noexcept
+{
+    Payload payload;
+    utils::ReturnCode ret = loan_payload(size, payload);
+    if (!ret)
+    {
+        return ret;
+    }
+
+    // Only copy of the sample, from the application buffer to the PayloadPool
+    std::memcpy(payload.data, data, size);
+    payload.length = size;
+
+    return write(topic, payload);
+}
+
+void InProcessConnector::set_data_callback(
+        DataCallback callback) noexcept
+{
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+    callback_ = std::move(callback);
+}
+
+utils::ReturnCode InProcessConnector::retain_payload(
+        const Payload& src,
+        Payload& target) noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+
+    if (!payload_pool_)
+    {
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    // The payload belongs to the pool, so the pool only increases its reference count
+    eprosima::fastrtps::rtps::IPayloadPool* owner = payload_pool_.get();
+    if (!payload_pool_->get_payload(src, owner, target))
+    {
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+utils::ReturnCode InProcessConnector::release_payload(
+        Payload& payload) noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+
+    if (!payload_pool_)
+    {
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    if (!payload_pool_->release_payload(payload))
+    {
+        return utils::ReturnCode::RETCODE_ERROR;
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+bool InProcessConnector::attach_(
+        InProcessParticipant* participant,
+        std::shared_ptr<PayloadPool> payload_pool) noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+
+    if (participant_)
+    {
+        return false;
+    }
+
+    participant_ = participant;
+    payload_pool_ = payload_pool;
+    publications_.clear();
+
+    return true;
+}
+
+void InProcessConnector::detach_() noexcept
+{
+    std::lock_guard<std::mutex> lock(participant_mutex_);
+    participant_ = nullptr;
+}
+
+void InProcessConnector::on_data_(
+        const DdsTopic& topic,
+        const DataReceived& data) noexcept
+{
+    std::lock_guard<std::mutex> lock(callback_mutex_);
+
+    if (callback_)
+    {
+        callback_(topic, data);
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
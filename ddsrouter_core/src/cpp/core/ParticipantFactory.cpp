@@ -23,15 +23,25 @@
 
 #include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/EchoParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/LoadGeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/LocalShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/ReplayerParticipantConfiguration.hpp>
 #include <cpp_utils/utils.hpp>
 
 #include <core/ParticipantFactory.hpp>
 #include <participant/implementations/auxiliar/DummyParticipant.hpp>
 #include <participant/implementations/auxiliar/EchoParticipant.hpp>
 #include <participant/implementations/auxiliar/BlankParticipant.hpp>
+#include <participant/implementations/auxiliar/InProcessParticipant.hpp>
+#include <participant/implementations/auxiliar/LoadGeneratorParticipant.hpp>
+#include <participant/implementations/auxiliar/RecorderParticipant.hpp>
+#include <participant/implementations/auxiliar/ReplayerParticipant.hpp>
 #include <participant/implementations/rtps/SimpleParticipant.hpp>
 #include <participant/implementations/rtps/InitialPeersParticipant.hpp>
 #include <participant/implementations/rtps/DiscoveryServerParticipant.hpp>
+#include <participant/implementations/rtps/LocalShmParticipant.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -74,6 +84,82 @@ std::shared_ptr<IParticipant> ParticipantFactory::create_participant(
                 discovery_database);
         }
 
+        case ParticipantKind::in_process:
+            // In Process Participant
+        {
+            std::shared_ptr<configuration::InProcessParticipantConfiguration> conf_ =
+                    std::dynamic_pointer_cast<configuration::InProcessParticipantConfiguration>(
+                participant_configuration);
+            if (!conf_)
+            {
+                throw utils::ConfigurationException(
+                          utils::Formatter() << "Configuration from Participant: " << participant_configuration->id <<
+                              " is not for Participant Kind: " << participant_configuration->kind);
+            }
+
+            return std::make_shared<InProcessParticipant> (
+                conf_,
+                payload_pool,
+                discovery_database);
+        }
+
+        case ParticipantKind::recorder:
+            // Recorder Participant
+        {
+            std::shared_ptr<configuration::RecorderParticipantConfiguration> conf_ =
+                    std::dynamic_pointer_cast<configuration::RecorderParticipantConfiguration>(
+                participant_configuration);
+            if (!conf_)
+            {
+                throw utils::ConfigurationException(
+                          utils::Formatter() << "Configuration from Participant: " << participant_configuration->id <<
+                              " is not for Participant Kind: " << participant_configuration->kind);
+            }
+
+            return std::make_shared<RecorderParticipant> (
+                conf_,
+                payload_pool,
+                discovery_database);
+        }
+
+        case ParticipantKind::replayer:
+            // Replayer Participant
+        {
+            std::shared_ptr<configuration::ReplayerParticipantConfiguration> conf_ =
+                    std::dynamic_pointer_cast<configuration::ReplayerParticipantConfiguration>(
+                participant_configuration);
+            if (!conf_)
+            {
+                throw utils::ConfigurationException(
+                          utils::Formatter() << "Configuration from Participant: " << participant_configuration->id <<
+                              " is not for Participant Kind: " << participant_configuration->kind);
+            }
+
+            return std::make_shared<ReplayerParticipant> (
+                conf_,
+                payload_pool,
+                discovery_database);
+        }
+
+        case ParticipantKind::load_generator:
+            // Load Generator Participant
+        {
+            std::shared_ptr<configuration::LoadGeneratorParticipantConfiguration> conf_ =
+                    std::dynamic_pointer_cast<configuration::LoadGeneratorParticipantConfiguration>(
+                participant_configuration);
+            if (!conf_)
+            {
+                throw utils::ConfigurationException(
+                          utils::Formatter() << "Configuration from Participant: " << participant_configuration->id <<
+                              " is not for Participant Kind: " << participant_configuration->kind);
+            }
+
+            return std::make_shared<LoadGeneratorParticipant> (
+                conf_,
+                payload_pool,
+                discovery_database);
+        }
+
         case ParticipantKind::simple_rtps:
             // Simple RTPS Participant
         {
@@ -98,6 +184,30 @@ std::shared_ptr<IParticipant> ParticipantFactory::create_participant(
             return participant;
         }
 
+        case ParticipantKind::local_shm:
+            // Shared Memory RTPS Participant
+        {
+            std::shared_ptr<configuration::LocalShmParticipantConfiguration> conf_ =
+                    std::dynamic_pointer_cast<configuration::LocalShmParticipantConfiguration>(
+                participant_configuration);
+            if (!conf_)
+            {
+                throw utils::ConfigurationException(
+                          utils::Formatter() << "Configuration from Participant: " << participant_configuration->id <<
+                              " is not for Participant Kind: " << participant_configuration->kind);
+            }
+
+            auto participant = std::make_shared<rtps::LocalShmParticipant> (
+                conf_,
+                payload_pool,
+                discovery_database);
+
+            // Initialize Participant (this is needed as Participant is not RAII because of Listener)
+            participant->init();
+
+            return participant;
+        }
+
         case ParticipantKind::local_discovery_server:
         case ParticipantKind::wan_discovery_server:
             // Discovery Server RTPS Participant
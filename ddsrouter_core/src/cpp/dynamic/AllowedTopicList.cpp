@@ -29,6 +29,8 @@ namespace core {
 
 using namespace eprosima::ddsrouter::core::types;
 
+const std::size_t AllowedTopicList::MAX_CACHED_DECISIONS_ = 100000;
+
 // TODO: Add logs
 AllowedTopicList::AllowedTopicList(
         const std::set<std::shared_ptr<DdsFilterTopic>>& allowlist,
@@ -37,6 +39,8 @@ AllowedTopicList::AllowedTopicList(
     allowlist_ = AllowedTopicList::get_topic_list_without_repetition_(allowlist);
     blocklist_ = AllowedTopicList::get_topic_list_without_repetition_(blocklist);
 
+    compile_lists_nts_();
+
     logDebug(DDSROUTER_ALLOWEDTOPICLIST, "New Allowed topic list created:");
     logDebug(DDSROUTER_ALLOWEDTOPICLIST, "New Allowed topic list created: " << *this << ".");
 }
@@ -44,9 +48,13 @@ AllowedTopicList::AllowedTopicList(
 AllowedTopicList& AllowedTopicList::operator =(
         const AllowedTopicList& other)
 {
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
     this->allowlist_ = other.allowlist_;
     this->blocklist_ = other.blocklist_;
 
+    compile_lists_nts_();
+
     return *this;
 }
 
@@ -62,6 +70,8 @@ void AllowedTopicList::clear() noexcept
 
     blocklist_.clear();
     allowlist_.clear();
+
+    compile_lists_nts_();
 }
 
 bool AllowedTopicList::is_topic_allowed(
@@ -69,36 +79,23 @@ bool AllowedTopicList::is_topic_allowed(
 {
     std::lock_guard<std::recursive_mutex> lock(mutex_);
 
-    // It is accepted by default if allowlist is empty, if not it should pass the allowlist filter
-    bool accepted = allowlist_.empty();
+    std::string key = topic_cache_key_(topic);
 
-    // Check if allowlist filter it (this will do anything if empty and accepted will be true)
-    for (std::shared_ptr<DdsFilterTopic> filter : allowlist_)
+    auto it = decisions_cache_.find(key);
+    if (it != decisions_cache_.end())
     {
-        if (filter->matches(topic))
-        {
-            accepted = true;
-            break;
-        }
+        return it->second;
     }
 
-    // Check if it has not passed the allowlist so blocklist is skipped
-    if (!accepted)
-    {
-        return false;
-    }
+    bool allowed = is_topic_allowed_nts_(topic);
 
-    // Allowlist passed, check blocklist
-    for (std::shared_ptr<DdsFilterTopic> filter : blocklist_)
+    if (decisions_cache_.size() >= MAX_CACHED_DECISIONS_)
     {
-        if (filter->matches(topic))
-        {
-            return false;
-        }
+        decisions_cache_.clear();
     }
+    decisions_cache_.emplace(std::move(key), allowed);
 
-    // Blocklist passed, the topic is allowed
-    return true;
+    return allowed;
 }
 
 bool AllowedTopicList::is_service_allowed(
@@ -161,6 +158,40 @@ std::set<std::shared_ptr<DdsFilterTopic>> AllowedTopicList::get_topic_list_witho
     return non_repeated_list;
 }
 
+void AllowedTopicList::compile_lists_nts_() noexcept
+{
+    compiled_allowlist_ = CompiledTopicFilter(allowlist_);
+    compiled_blocklist_ = CompiledTopicFilter(blocklist_);
+    decisions_cache_.clear();
+}
+
+bool AllowedTopicList::is_topic_allowed_nts_(
+        const DdsTopic& topic) const noexcept
+{
+    // It is accepted by default if allowlist is empty, if not it should pass the allowlist filter
+    if (!compiled_allowlist_.empty() && !compiled_allowlist_.matches(topic))
+    {
+        return false;
+    }
+
+    // Allowlist passed, check blocklist
+    return !compiled_blocklist_.matches(topic);
+}
+
+std::string AllowedTopicList::topic_cache_key_(
+        const DdsTopic& topic) noexcept
+{
+    // Topic and type names cannot contain '\0', so it could not be ambiguous
+    std::string key;
+    key.reserve(topic.topic_name.size() + topic.type_name.size() + 3);
+    key.append(topic.topic_name);
+    key.push_back('\0');
+    key.append(topic.type_name);
+    key.push_back('\0');
+    key.push_back(topic.keyed ? '1' : '0');
+    return key;
+}
+
 std::ostream& operator <<(
         std::ostream& os,
         const AllowedTopicList& atl)
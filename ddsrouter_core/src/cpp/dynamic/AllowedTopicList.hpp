@@ -24,12 +24,15 @@
 #include <mutex>
 #include <string>
 #include <set>
+#include <unordered_map>
 
 #include <ddsrouter_core/types/topic/Topic.hpp>
 #include <ddsrouter_core/types/topic/rpc/RPCTopic.hpp>
 #include <ddsrouter_core/types/topic/filter/DdsFilterTopic.hpp>
 #include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
 
+#include <dynamic/CompiledTopicFilter.hpp>
+
 namespace eprosima {
 namespace ddsrouter {
 namespace core {
@@ -41,6 +44,9 @@ namespace core {
  *
  * In case of an empty allowlist, every topic is allowed except those in blocklist.
  * In case of both lists empty, every topic is allowed.
+ *
+ * Lists are compiled in \c CompiledTopicFilter objects so each topic is only checked against the filters
+ * that could match it, and the decision for each topic is cached until the lists change.
  */
 class AllowedTopicList
 {
@@ -119,12 +125,35 @@ protected:
     static std::set<std::shared_ptr<types::DdsFilterTopic>> get_topic_list_without_repetition_(
             const std::set<std::shared_ptr<types::DdsFilterTopic>>& list) noexcept;
 
+    //! Compile current lists and reset decisions cache
+    void compile_lists_nts_() noexcept;
+
+    //! Check \c topic against compiled lists without using the cache
+    bool is_topic_allowed_nts_(
+            const types::DdsTopic& topic) const noexcept;
+
+    //! Key that identifies a topic regarding filtering (name, type and key)
+    static std::string topic_cache_key_(
+            const types::DdsTopic& topic) noexcept;
+
     //! List of topics that are not allowed
     std::set<std::shared_ptr<types::DdsFilterTopic>> blocklist_;
 
     //! List of topics that are allowed
     std::set<std::shared_ptr<types::DdsFilterTopic>> allowlist_;
 
+    //! Compiled \c blocklist_
+    CompiledTopicFilter compiled_blocklist_;
+
+    //! Compiled \c allowlist_
+    CompiledTopicFilter compiled_allowlist_;
+
+    //! Decision already taken for each topic checked
+    mutable std::unordered_map<std::string, bool> decisions_cache_;
+
+    //! Maximum number of decisions cached. When reached, cache is reset.
+    static const std::size_t MAX_CACHED_DECISIONS_;
+
     //! Mutex to restrict access to the class
     mutable std::recursive_mutex mutex_;
 
@@ -0,0 +1,268 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CompiledTopicFilter.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <dynamic/CompiledTopicFilter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+const char* CompiledTopicFilter::WILDCARD_CHARACTERS_ = "*?[\\";
+const std::size_t CompiledTopicFilter::MAX_REGEX_PER_GROUP_ = 256;
+
+CompiledTopicFilter::CompiledTopicFilter()
+    : prefix_nodes_(1)
+    , size_(0)
+{
+}
+
+CompiledTopicFilter::CompiledTopicFilter(
+        const std::set<std::shared_ptr<DdsFilterTopic>>& filters) noexcept
+    : CompiledTopicFilter()
+{
+    std::vector<std::shared_ptr<RegexDdsFilterTopic>> regex_filters;
+
+    for (const auto& filter : filters)
+    {
+        std::shared_ptr<RegexDdsFilterTopic> regex_filter = std::dynamic_pointer_cast<RegexDdsFilterTopic>(filter);
+        if (regex_filter)
+        {
+            ++size_;
+            regex_filters.push_back(regex_filter);
+        }
+        else
+        {
+            add_filter_(filter);
+        }
+    }
+
+    compile_regex_groups_(regex_filters);
+}
+
+bool CompiledTopicFilter::empty() const noexcept
+{
+    return size_ == 0;
+}
+
+std::size_t CompiledTopicFilter::size() const noexcept
+{
+    return size_;
+}
+
+bool CompiledTopicFilter::matches(
+        const DdsTopic& topic) const noexcept
+{
+    // Filters that are always checked
+    if (any_matches_(generic_filters_, topic))
+    {
+        return true;
+    }
+
+    // Combined regex filters
+    for (const auto& group : regex_groups_)
+    {
+        if (group.representative->matches_type_and_key(topic) &&
+                std::regex_match(topic.topic_name, group.topic_name_regex))
+        {
+            return true;
+        }
+    }
+
+    // Filters with exactly this topic name
+    auto exact_it = exact_filters_.find(topic.topic_name);
+    if (exact_it != exact_filters_.end() && any_matches_(exact_it->second, topic))
+    {
+        return true;
+    }
+
+    // Filters whose literal prefix is a prefix of the topic name
+    std::size_t node = 0;
+    for (std::size_t i = 0;; ++i)
+    {
+        if (any_matches_(prefix_nodes_[node].filters, topic))
+        {
+            return true;
+        }
+
+        if (i == topic.topic_name.size())
+        {
+            break;
+        }
+
+        auto child_it = prefix_nodes_[node].children.find(topic.topic_name[i]);
+        if (child_it == prefix_nodes_[node].children.end())
+        {
+            break;
+        }
+        node = child_it->second;
+    }
+
+    return false;
+}
+
+void CompiledTopicFilter::add_filter_(
+        const std::shared_ptr<DdsFilterTopic>& filter) noexcept
+{
+    ++size_;
+
+    std::shared_ptr<WildcardDdsFilterTopic> wildcard_filter = std::dynamic_pointer_cast<WildcardDdsFilterTopic>(filter);
+    if (!wildcard_filter)
+    {
+        generic_filters_.push_back(filter);
+        return;
+    }
+
+    const std::string& topic_name = wildcard_filter->topic_name;
+    std::size_t wildcard_position = topic_name.find_first_of(WILDCARD_CHARACTERS_);
+
+    if (wildcard_position == std::string::npos)
+    {
+        exact_filters_[topic_name].push_back(filter);
+    }
+    else
+    {
+        add_prefix_filter_(topic_name.substr(0, wildcard_position), filter);
+    }
+}
+
+void CompiledTopicFilter::add_prefix_filter_(
+        const std::string& prefix,
+        const std::shared_ptr<DdsFilterTopic>& filter) noexcept
+{
+    std::size_t node = 0;
+    for (char c : prefix)
+    {
+        auto child_it = prefix_nodes_[node].children.find(c);
+        if (child_it != prefix_nodes_[node].children.end())
+        {
+            node = child_it->second;
+        }
+        else
+        {
+            // Index must be taken before push_back, as it may invalidate references to the nodes
+            std::size_t new_node = prefix_nodes_.size();
+            prefix_nodes_.emplace_back();
+            prefix_nodes_[node].children[c] = new_node;
+            node = new_node;
+        }
+    }
+
+    prefix_nodes_[node].filters.push_back(filter);
+}
+
+void CompiledTopicFilter::compile_regex_groups_(
+        const std::vector<std::shared_ptr<RegexDdsFilterTopic>>& regex_filters) noexcept
+{
+    std::map<RegexGroupKey, std::vector<std::shared_ptr<RegexDdsFilterTopic>>> groups;
+
+    for (const auto& filter : regex_filters)
+    {
+        if (!is_combinable_regex_(filter->topic_name))
+        {
+            generic_filters_.push_back(filter);
+            continue;
+        }
+
+        groups[RegexGroupKey(
+                    filter->type_name.is_set(),
+                    filter->type_name.is_set() ? filter->type_name.get_reference() : "",
+                    filter->keyed.is_set(),
+                    filter->keyed.is_set() && filter->keyed.get_reference())].push_back(filter);
+    }
+
+    for (const auto& group : groups)
+    {
+        const auto& filters = group.second;
+
+        for (std::size_t begin = 0; begin < filters.size(); begin += MAX_REGEX_PER_GROUP_)
+        {
+            std::size_t end = std::min(begin + MAX_REGEX_PER_GROUP_, filters.size());
+
+            std::string combined;
+            for (std::size_t i = begin; i < end; ++i)
+            {
+                if (i != begin)
+                {
+                    combined += "|";
+                }
+                combined += "(?:" + filters[i]->topic_name + ")";
+            }
+
+            try
+            {
+                regex_groups_.push_back({std::regex(combined, RegexDdsFilterTopic::REGEX_FLAGS), filters[begin]});
+            }
+            catch (const std::regex_error& e)
+            {
+                // Each regex is valid by itself, so this should not happen. Check them one by one.
+                logDevError(DDSROUTER_COMPILEDTOPICFILTER, "Error combining regex topic filters: " << e.what() << ".");
+
+                generic_filters_.insert(generic_filters_.end(), filters.begin() + begin, filters.begin() + end);
+            }
+        }
+    }
+
+    logDebug(DDSROUTER_COMPILEDTOPICFILTER,
+            regex_filters.size() << " regex topic filters compiled in " << regex_groups_.size() << " groups.");
+}
+
+bool CompiledTopicFilter::is_combinable_regex_(
+        const std::string& regex) noexcept
+{
+    // Backreferences (\1 - \9) would refer to other groups once combined
+    for (std::size_t i = 0; i + 1 < regex.size(); ++i)
+    {
+        if (regex[i] == '\\')
+        {
+            if (regex[i + 1] >= '1' && regex[i + 1] <= '9')
+            {
+                return false;
+            }
+            // Skip escaped character
+            ++i;
+        }
+    }
+    return true;
+}
+
+bool CompiledTopicFilter::any_matches_(
+        const std::vector<std::shared_ptr<DdsFilterTopic>>& candidates,
+        const DdsTopic& topic) noexcept
+{
+    for (const auto& filter : candidates)
+    {
+        if (filter->matches(topic))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
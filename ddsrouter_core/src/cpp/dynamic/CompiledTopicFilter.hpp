@@ -0,0 +1,154 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file CompiledTopicFilter.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_DYNAMIC_COMPILEDTOPICFILTER_HPP_
+#define __SRC_DDSROUTERCORE_DYNAMIC_COMPILEDTOPICFILTER_HPP_
+
+#include <map>
+#include <memory>
+#include <regex>
+#include <set>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+#include <ddsrouter_core/types/topic/filter/DdsFilterTopic.hpp>
+#include <ddsrouter_core/types/topic/filter/RegexDdsFilterTopic.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Set of \c DdsFilterTopic indexed so a topic is only checked against the filters that could match it.
+ *
+ * Wildcard filters are indexed by the literal prefix of their topic name (the characters before the first
+ * wildcard) in a prefix trie, and filters without wildcards in their topic name are indexed by exact name.
+ * Regex filters that share type name and key filters are combined in a single alternation regular expression,
+ * so each group is checked with one match call. std::regex still tries the alternatives one after the other, so
+ * the cost of regex filters remains linear in the number of patterns: combining them only saves the overhead of
+ * each separate match.
+ * Any other kind of filter is always checked.
+ *
+ * The final decision for each candidate is taken by \c DdsFilterTopic::matches , so the result is
+ * always the same as checking every filter one by one.
+ *
+ * @warning This class is not thread safe.
+ */
+class CompiledTopicFilter
+{
+public:
+
+    //! Default constructor with no filters
+    CompiledTopicFilter();
+
+    //! Compile the filters given
+    CompiledTopicFilter(
+            const std::set<std::shared_ptr<types::DdsFilterTopic>>& filters) noexcept;
+
+    //! Whether there are no filters compiled
+    bool empty() const noexcept;
+
+    //! Number of filters compiled
+    std::size_t size() const noexcept;
+
+    /**
+     * @brief Whether any of the filters compiled matches \c topic
+     *
+     * @param [in] topic: topic to check
+     * @return true if at least one filter matches the topic, false otherwise
+     */
+    bool matches(
+            const types::DdsTopic& topic) const noexcept;
+
+protected:
+
+    //! Node of the topic name prefix trie
+    struct PrefixNode
+    {
+        //! Index of the child node for each next character
+        std::map<char, std::size_t> children;
+
+        //! Filters whose topic name literal prefix ends in this node
+        std::vector<std::shared_ptr<types::DdsFilterTopic>> filters;
+    };
+
+    //! Regex filters that share type name and key filters, with their topic names combined
+    struct RegexGroup
+    {
+        //! Alternation of the topic name regular expressions of every filter in the group
+        std::regex topic_name_regex;
+
+        //! Any filter of the group, used to check type name and key
+        std::shared_ptr<types::RegexDdsFilterTopic> representative;
+    };
+
+    //! Key that identifies the type name and key filters of a regex filter
+    using RegexGroupKey = std::tuple<bool, std::string, bool, bool>;
+
+    //! Add a new filter to the index
+    void add_filter_(
+            const std::shared_ptr<types::DdsFilterTopic>& filter) noexcept;
+
+    //! Add \c filter to the node of the trie corresponding to \c prefix , creating nodes as needed
+    void add_prefix_filter_(
+            const std::string& prefix,
+            const std::shared_ptr<types::DdsFilterTopic>& filter) noexcept;
+
+    //! Group regex filters by \c RegexGroupKey and compile each group
+    void compile_regex_groups_(
+            const std::vector<std::shared_ptr<types::RegexDdsFilterTopic>>& regex_filters) noexcept;
+
+    //! Whether a regular expression can be combined with others in an alternation (it has no backreferences)
+    static bool is_combinable_regex_(
+            const std::string& regex) noexcept;
+
+    //! Check \c topic against every filter in \c candidates
+    static bool any_matches_(
+            const std::vector<std::shared_ptr<types::DdsFilterTopic>>& candidates,
+            const types::DdsTopic& topic) noexcept;
+
+    //! Filters indexed by exact topic name
+    std::unordered_map<std::string, std::vector<std::shared_ptr<types::DdsFilterTopic>>> exact_filters_;
+
+    //! Prefix trie nodes. Node 0 is the root, that holds the filters with no literal prefix
+    std::vector<PrefixNode> prefix_nodes_;
+
+    //! Combined regex filters
+    std::vector<RegexGroup> regex_groups_;
+
+    //! Filters that could not be indexed and must always be checked
+    std::vector<std::shared_ptr<types::DdsFilterTopic>> generic_filters_;
+
+    //! Number of filters compiled
+    std::size_t size_;
+
+    //! Characters that make a topic name a pattern
+    static const char* WILDCARD_CHARACTERS_;
+
+    //! Maximum number of regular expressions combined in a single one
+    static const std::size_t MAX_REGEX_PER_GROUP_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_DYNAMIC_COMPILEDTOPICFILTER_HPP_ */
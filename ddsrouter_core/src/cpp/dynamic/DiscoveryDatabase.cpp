@@ -21,6 +21,7 @@
 #include <cpp_utils/Log.hpp>
 
 #include <dynamic/DiscoveryDatabase.hpp>
+#include <trace/Tracepoints.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -28,6 +29,30 @@ namespace core {
 
 using namespace eprosima::ddsrouter::core::types;
 
+namespace {
+
+/**
+ * Remove \c guid from the set indexed by \c key in \c index , erasing the entry if it becomes empty.
+ */
+template <typename Key>
+void remove_from_index(
+        std::map<Key, std::set<Guid>>& index,
+        const Key& key,
+        const Guid& guid) noexcept
+{
+    auto it = index.find(key);
+    if (it != index.end())
+    {
+        it->second.erase(guid);
+        if (it->second.empty())
+        {
+            index.erase(it);
+        }
+    }
+}
+
+} /* namespace */
+
 DiscoveryDatabase::DiscoveryDatabase() noexcept
     : exit_(false)
     , enabled_(false)
@@ -83,16 +108,8 @@ bool DiscoveryDatabase::topic_exists(
 {
     std::shared_lock<std::shared_timed_mutex> lock(mutex_);
 
-    // Loop over every Endpoint checking if topic matches
-    // It is not required to be reference
-    for (auto entity : entities_)
-    {
-        if (entity.second.topic() == topic)
-        {
-            return true;
-        }
-    }
-    return false;
+    // Empty entries are removed from the index, so finding the topic means it has at least one endpoint
+    return topic_endpoints_.find(topic) != topic_endpoints_.end();
 }
 
 bool DiscoveryDatabase::endpoint_exists(
@@ -102,6 +119,58 @@ bool DiscoveryDatabase::endpoint_exists(
     return entities_.find(guid) != entities_.end();
 }
 
+std::set<Guid> DiscoveryDatabase::get_topic_endpoints(
+        const DdsTopic& topic) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = topic_endpoints_.find(topic);
+    if (it == topic_endpoints_.end())
+    {
+        return std::set<Guid>();
+    }
+    return it->second;
+}
+
+std::set<Guid> DiscoveryDatabase::get_topic_writers(
+        const DdsTopic& topic) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = topic_writers_.find(topic);
+    if (it == topic_writers_.end())
+    {
+        return std::set<Guid>();
+    }
+    return it->second;
+}
+
+std::set<Guid> DiscoveryDatabase::get_topic_readers(
+        const DdsTopic& topic) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = topic_readers_.find(topic);
+    if (it == topic_readers_.end())
+    {
+        return std::set<Guid>();
+    }
+    return it->second;
+}
+
+std::set<Guid> DiscoveryDatabase::get_participant_endpoints(
+        const ParticipantId& participant_id) const noexcept
+{
+    std::shared_lock<std::shared_timed_mutex> lock(mutex_);
+
+    auto it = participant_endpoints_.find(participant_id);
+    if (it == participant_endpoints_.end())
+    {
+        return std::set<Guid>();
+    }
+    return it->second;
+}
+
 bool DiscoveryDatabase::add_endpoint_(
         const Endpoint& new_endpoint)
 {
@@ -121,7 +190,16 @@ bool DiscoveryDatabase::add_endpoint_(
             else
             {
                 // If exists but inactive, modify entry
+                unindex_endpoint_nts_(it->second);
                 it->second = new_endpoint;
+                index_endpoint_nts_(new_endpoint);
+
+                DDSROUTER_TRACEPOINT(discovery_add,
+                        new_endpoint.topic().topic_name.c_str(),
+                        new_endpoint.topic().type_name.c_str(),
+                        new_endpoint.discoverer_participant_id().id_name().c_str(),
+                        static_cast<int>(new_endpoint.kind()),
+                        entities_.size());
 
                 logInfo(DDSROUTER_DISCOVERY_DATABASE,
                         "Modifying an already discovered (inactive) Endpoint " << new_endpoint << ".");
@@ -135,11 +213,19 @@ bool DiscoveryDatabase::add_endpoint_(
 
             // Add it to the dictionary
             entities_.insert(std::pair<Guid, Endpoint>(new_endpoint.guid(), new_endpoint));
+            index_endpoint_nts_(new_endpoint);
+
+            DDSROUTER_TRACEPOINT(discovery_add,
+                    new_endpoint.topic().topic_name.c_str(),
+                    new_endpoint.topic().type_name.c_str(),
+                    new_endpoint.discoverer_participant_id().id_name().c_str(),
+                    static_cast<int>(new_endpoint.kind()),
+                    entities_.size());
         }
     }
 
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    for (auto added_endpoint_callback : added_endpoint_callbacks_)
+    for (const auto& added_endpoint_callback : added_endpoint_callbacks_)
     {
         added_endpoint_callback(new_endpoint);
     }
@@ -167,13 +253,22 @@ bool DiscoveryDatabase::update_endpoint_(
                     "Modifying an already discovered Endpoint " << endpoint_to_update << ".");
 
             // Modify entry
+            // Topic, kind or discoverer could have changed, so the indices are rebuilt for this endpoint
+            unindex_endpoint_nts_(it->second);
             it->second = endpoint_to_update;
-            // It is assumed a topic cannot change, otherwise further actions may be taken
+            index_endpoint_nts_(endpoint_to_update);
+
+            DDSROUTER_TRACEPOINT(discovery_update,
+                    endpoint_to_update.topic().topic_name.c_str(),
+                    endpoint_to_update.topic().type_name.c_str(),
+                    endpoint_to_update.discoverer_participant_id().id_name().c_str(),
+                    static_cast<int>(endpoint_to_update.kind()),
+                    entities_.size());
         }
     }
 
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    for (auto updated_endpoint_callback : updated_endpoint_callbacks_)
+    for (const auto& updated_endpoint_callback : updated_endpoint_callbacks_)
     {
         updated_endpoint_callback(endpoint_to_update);
     }
@@ -189,19 +284,30 @@ utils::ReturnCode DiscoveryDatabase::erase_endpoint_(
 
         logInfo(DDSROUTER_DISCOVERY_DATABASE, "Erasing Endpoint " << endpoint_to_erase << ".");
 
-        auto erased = entities_.erase(endpoint_to_erase.guid());
+        auto it = entities_.find(endpoint_to_erase.guid());
 
-        if (erased == 0)
+        if (it == entities_.end())
         {
             throw utils::InconsistencyException(
                       utils::Formatter() <<
                           "Error erasing Endpoint " << endpoint_to_erase <<
                           " from database. Endpoint entry not found.");
         }
+
+        // Use the stored endpoint to clean indices, as it is the one that was indexed
+        unindex_endpoint_nts_(it->second);
+        entities_.erase(it);
+
+        DDSROUTER_TRACEPOINT(discovery_erase,
+                endpoint_to_erase.topic().topic_name.c_str(),
+                endpoint_to_erase.topic().type_name.c_str(),
+                endpoint_to_erase.discoverer_participant_id().id_name().c_str(),
+                static_cast<int>(endpoint_to_erase.kind()),
+                entities_.size());
     }
 
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
-    for (auto erased_endpoint_callback : erased_endpoint_callbacks_)
+    for (const auto& erased_endpoint_callback : erased_endpoint_callbacks_)
     {
         erased_endpoint_callback(endpoint_to_erase);
     }
@@ -210,21 +316,21 @@ utils::ReturnCode DiscoveryDatabase::erase_endpoint_(
 }
 
 void DiscoveryDatabase::add_endpoint(
-        const Endpoint& new_endpoint) noexcept
+        Endpoint new_endpoint) noexcept
 {
-    push_item_to_queue_(std::make_tuple(DatabaseOperation::add, new_endpoint));
+    push_item_to_queue_(std::make_tuple(DatabaseOperation::add, std::move(new_endpoint)));
 }
 
 void DiscoveryDatabase::update_endpoint(
-        const Endpoint& endpoint_to_update) noexcept
+        Endpoint endpoint_to_update) noexcept
 {
-    push_item_to_queue_(std::make_tuple(DatabaseOperation::update, endpoint_to_update));
+    push_item_to_queue_(std::make_tuple(DatabaseOperation::update, std::move(endpoint_to_update)));
 }
 
 void DiscoveryDatabase::erase_endpoint(
-        const Endpoint& endpoint_to_erase) noexcept
+        Endpoint endpoint_to_erase) noexcept
 {
-    push_item_to_queue_(std::make_tuple(DatabaseOperation::erase, endpoint_to_erase));
+    push_item_to_queue_(std::make_tuple(DatabaseOperation::erase, std::move(endpoint_to_erase)));
 }
 
 Endpoint DiscoveryDatabase::get_endpoint(
@@ -268,6 +374,14 @@ void DiscoveryDatabase::add_endpoint_erased_callback(
     erased_endpoint_callbacks_.push_back(endpoint_erased_callback);
 }
 
+void DiscoveryDatabase::add_batch_processed_callback(
+        std::function<void(const std::vector<DatabaseOperationItem>&)> batch_processed_callback) noexcept
+{
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+
+    batch_processed_callbacks_.push_back(batch_processed_callback);
+}
+
 void DiscoveryDatabase::clear_all_callbacks() noexcept
 {
     std::lock_guard<std::mutex> lock(callbacks_mutex_);
@@ -275,6 +389,39 @@ void DiscoveryDatabase::clear_all_callbacks() noexcept
     added_endpoint_callbacks_.clear();
     updated_endpoint_callbacks_.clear();
     erased_endpoint_callbacks_.clear();
+    batch_processed_callbacks_.clear();
+}
+
+void DiscoveryDatabase::index_endpoint_nts_(
+        const Endpoint& endpoint) noexcept
+{
+    const Guid guid = endpoint.guid();
+    const DdsTopic topic = endpoint.topic();
+
+    topic_endpoints_[topic].insert(guid);
+
+    if (endpoint.is_writer())
+    {
+        topic_writers_[topic].insert(guid);
+    }
+    else if (endpoint.is_reader())
+    {
+        topic_readers_[topic].insert(guid);
+    }
+
+    participant_endpoints_[endpoint.discoverer_participant_id()].insert(guid);
+}
+
+void DiscoveryDatabase::unindex_endpoint_nts_(
+        const Endpoint& endpoint) noexcept
+{
+    const Guid guid = endpoint.guid();
+    const DdsTopic topic = endpoint.topic();
+
+    remove_from_index(topic_endpoints_, topic, guid);
+    remove_from_index(topic_writers_, topic, guid);
+    remove_from_index(topic_readers_, topic, guid);
+    remove_from_index(participant_endpoints_, endpoint.discoverer_participant_id(), guid);
 }
 
 void DiscoveryDatabase::queue_processing_thread_routine_() noexcept
@@ -301,23 +448,95 @@ void DiscoveryDatabase::queue_processing_thread_routine_() noexcept
 }
 
 void DiscoveryDatabase::push_item_to_queue_(
-        std::tuple<DatabaseOperation, Endpoint> item) noexcept
+        DatabaseOperationItem&& item) noexcept
 {
     {
         std::lock_guard<std::mutex> lock(entities_to_process_cv_mutex_);
-        entities_to_process_.Push(item);
+        entities_to_process_.Push(std::move(item));
     }
     entities_to_process_cv_.notify_one();
 }
 
-void DiscoveryDatabase::process_queue_() noexcept
+std::vector<DatabaseOperationItem> DiscoveryDatabase::coalesce_queue_() noexcept
 {
+    // Operations to perform, in order of arrival. Coalesced or cancelled ones are marked as not valid.
+    std::vector<DatabaseOperationItem> operations;
+    std::vector<bool> valid_operations;
+    // Index in operations of the last pending operation of each guid
+    std::map<Guid, size_t> last_operation;
+
     entities_to_process_.Swap();
     while (!entities_to_process_.Empty())
     {
-        std::tuple<DatabaseOperation, Endpoint> queue_item = entities_to_process_.Front();
+        DatabaseOperationItem queue_item = std::move(entities_to_process_.Front());
+        entities_to_process_.Pop();
+
+        DatabaseOperation db_operation = std::get<0>(queue_item);
+        Guid guid = std::get<1>(queue_item).guid();
+
+        auto last_it = last_operation.find(guid);
+        if (last_it != last_operation.end())
+        {
+            DatabaseOperation last_db_operation = std::get<0>(operations[last_it->second]);
+
+            if (db_operation == DatabaseOperation::update &&
+                    (last_db_operation == DatabaseOperation::add || last_db_operation == DatabaseOperation::update))
+            {
+                // Keep previous operation kind with newest endpoint information
+                valid_operations[last_it->second] = false;
+                std::get<0>(queue_item) = last_db_operation;
+            }
+            else if (db_operation == DatabaseOperation::erase && last_db_operation == DatabaseOperation::update)
+            {
+                // Updating before erasing has no effect
+                valid_operations[last_it->second] = false;
+            }
+            else if (db_operation == DatabaseOperation::erase && last_db_operation == DatabaseOperation::add &&
+                    !endpoint_exists(guid))
+            {
+                // The endpoint appeared and disappeared within the same batch, so nobody needs to know about it
+                valid_operations[last_it->second] = false;
+                last_operation.erase(last_it);
+                continue;
+            }
+        }
+
+        // Endpoints are moved (never assigned) as Endpoint assignment does not copy every field
+        last_operation[guid] = operations.size();
+        operations.push_back(std::move(queue_item));
+        valid_operations.push_back(true);
+    }
+
+    // Remove cancelled operations keeping order
+    std::vector<DatabaseOperationItem> result;
+    result.reserve(operations.size());
+    for (size_t i = 0; i < operations.size(); ++i)
+    {
+        if (valid_operations[i])
+        {
+            result.push_back(std::move(operations[i]));
+        }
+    }
+
+    logDebug(DDSROUTER_DISCOVERY_DATABASE,
+            "Processing batch of " << result.size() << " database operations (" <<
+            (operations.size() - result.size()) << " cancelled).");
+
+    return result;
+}
+
+void DiscoveryDatabase::process_queue_() noexcept
+{
+    std::vector<DatabaseOperationItem> operations = coalesce_queue_();
+
+    // Operations successfully applied, to be notified as a whole batch
+    std::vector<DatabaseOperationItem> processed_operations;
+    processed_operations.reserve(operations.size());
+
+    for (DatabaseOperationItem& queue_item : operations)
+    {
         DatabaseOperation db_operation = std::get<0>(queue_item);
-        Endpoint entity = std::get<1>(queue_item);
+        const Endpoint& entity = std::get<1>(queue_item);
         try
         {
             if (db_operation == DatabaseOperation::add)
@@ -332,13 +551,24 @@ void DiscoveryDatabase::process_queue_() noexcept
             {
                 erase_endpoint_(entity);
             }
+            processed_operations.push_back(std::move(queue_item));
         }
         catch (const utils::InconsistencyException& e)
         {
             logDevError(DDSROUTER_DISCOVERY_DATABASE,
                     "Error processing database operations queue:" << e.what() << ".");
         }
-        entities_to_process_.Pop();
+    }
+
+    if (processed_operations.empty())
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(callbacks_mutex_);
+    for (const auto& batch_processed_callback : batch_processed_callbacks_)
+    {
+        batch_processed_callback(processed_operations);
     }
 }
 
@@ -24,14 +24,18 @@
 #include <functional>
 #include <map>
 #include <mutex>
+#include <set>
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <tuple>
+#include <vector>
 
 #include <fastrtps/utils/DBQueue.h>
 
 #include <ddsrouter_core/types/endpoint/Endpoint.hpp>
 #include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
 #include <cpp_utils/ReturnCode.hpp>
 #include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
 
@@ -47,6 +51,9 @@ enum class DatabaseOperation
     erase
 };
 
+//! Database operation together with the Endpoint it applies to
+using DatabaseOperationItem = std::tuple<DatabaseOperation, types::Endpoint>;
+
 /**
  * Class that stores a collection of discovered remote (not belonging to this DDSRouter) Endpoints.
  */
@@ -101,16 +108,43 @@ public:
     bool endpoint_exists(
             const types::Guid& guid) const noexcept;
 
+    /**
+     * @brief Guids of every Endpoint (writers and readers) in the database with this topic
+     *
+     * @param [in] topic: topic to query
+     * @return set of guids, empty if the topic has no endpoints
+     */
+    std::set<types::Guid> get_topic_endpoints(
+            const types::DdsTopic& topic) const noexcept;
+
+    //! Guids of every writer in the database with this topic
+    std::set<types::Guid> get_topic_writers(
+            const types::DdsTopic& topic) const noexcept;
+
+    //! Guids of every reader in the database with this topic
+    std::set<types::Guid> get_topic_readers(
+            const types::DdsTopic& topic) const noexcept;
+
+    /**
+     * @brief Guids of every Endpoint in the database discovered by this participant
+     *
+     * @param [in] participant_id: id of the discoverer participant
+     * @return set of guids, empty if the participant has not discovered any endpoint
+     */
+    std::set<types::Guid> get_participant_endpoints(
+            const types::ParticipantId& participant_id) const noexcept;
+
     /**
      * @brief Insert endpoint to the database
      *
      * This method stores an insert operation in an internal queue, being this operation then performed by a
      * dedicated thread.
+     * The endpoint is taken by value so callers that do not need it anymore can move it into the queue.
      *
      * @param [in] new_endpoint: new endpoint to store
      */
     void add_endpoint(
-            const types::Endpoint& new_endpoint) noexcept;
+            types::Endpoint new_endpoint) noexcept;
 
     /**
      * @brief Add update operation to the database
@@ -121,7 +155,7 @@ public:
      * @param [in] endpoint_to_update: endpoint to update
      */
     void update_endpoint(
-            const types::Endpoint& endpoint_to_update) noexcept;
+            types::Endpoint endpoint_to_update) noexcept;
 
     /**
      * @brief Add erase operation to the database
@@ -132,7 +166,7 @@ public:
      * @param [in] endpoint_to_erase endpoint that will be erased
      */
     void erase_endpoint(
-            const types::Endpoint& endpoint_to_erase) noexcept;
+            types::Endpoint endpoint_to_erase) noexcept;
 
     /**
      * @brief Get the endpoint object with this guid
@@ -169,7 +203,20 @@ public:
             std::function<void(types::Endpoint)> endpoint_erased_callback) noexcept;
 
     /**
-     * @brief Remove all callbacks from all types (endpoint discovered, updated and erased)
+     * @brief Add callback to be called once for every batch of operations processed
+     *
+     * Operations queued while the previous batch was being processed are coalesced by guid
+     * (e.g. an add followed by an update is delivered as a single add with the updated endpoint) and applied
+     * together. This callback receives, in order, every operation that has been successfully applied,
+     * so the listener can react to a whole discovery burst at once.
+     *
+     * @param [in] batch_processed_callback: callback to add
+     */
+    void add_batch_processed_callback(
+            std::function<void(const std::vector<DatabaseOperationItem>&)> batch_processed_callback) noexcept;
+
+    /**
+     * @brief Remove all callbacks from all types (endpoint discovered, updated, erased and batch processed)
      *
      */
     void clear_all_callbacks() noexcept;
@@ -206,6 +253,28 @@ protected:
     utils::ReturnCode erase_endpoint_(
             const types::Endpoint& endpoint_to_erase);
 
+    /**
+     * @brief Add an endpoint to the secondary indices
+     *
+     * @note \c mutex_ must be taken in exclusive mode before calling this method
+     *
+     * @param [in] endpoint: endpoint to index
+     */
+    void index_endpoint_nts_(
+            const types::Endpoint& endpoint) noexcept;
+
+    /**
+     * @brief Remove an endpoint from the secondary indices
+     *
+     * Empty index entries are erased, so a topic or participant without endpoints does not remain in the index.
+     *
+     * @note \c mutex_ must be taken in exclusive mode before calling this method
+     *
+     * @param [in] endpoint: endpoint to remove from indices
+     */
+    void unindex_endpoint_nts_(
+            const types::Endpoint& endpoint) noexcept;
+
     //! Routine performed by dedicated thread performing database operations
     void queue_processing_thread_routine_() noexcept;
 
@@ -215,7 +284,21 @@ protected:
      * @param [in] item: operation to add
      */
     void push_item_to_queue_(
-            std::tuple<DatabaseOperation, types::Endpoint> item) noexcept;
+            DatabaseOperationItem&& item) noexcept;
+
+    /**
+     * @brief Take every operation in \c entities_to_process_ and coalesce those referring to the same guid
+     *
+     * Coalescing rules (previous pending operation + new operation):
+     * - add + update    -> add with the updated endpoint
+     * - update + update -> update with the latest endpoint
+     * - update + erase  -> erase
+     * - add + erase     -> nothing, if the endpoint was not in the database before the add
+     * Any other combination is kept as separate operations, so inconsistencies are still reported.
+     *
+     * @return operations to apply, in order of arrival of their last (coalesced) operation
+     */
+    std::vector<DatabaseOperationItem> coalesce_queue_() noexcept;
 
     //! Process queue storing database operations
     void process_queue_() noexcept;
@@ -223,6 +306,18 @@ protected:
     //! Database of endpoints indexed by guid
     std::map<types::Guid, types::Endpoint> entities_;
 
+    //! Guids of the endpoints (writers and readers) of each topic, kept in sync with \c entities_
+    std::map<types::DdsTopic, std::set<types::Guid>> topic_endpoints_;
+
+    //! Guids of the writers of each topic, kept in sync with \c entities_
+    std::map<types::DdsTopic, std::set<types::Guid>> topic_writers_;
+
+    //! Guids of the readers of each topic, kept in sync with \c entities_
+    std::map<types::DdsTopic, std::set<types::Guid>> topic_readers_;
+
+    //! Guids of the endpoints discovered by each participant, kept in sync with \c entities_
+    std::map<types::ParticipantId, std::set<types::Guid>> participant_endpoints_;
+
     //! Mutex to guard queries to the database
     mutable std::shared_timed_mutex mutex_;
 
@@ -235,11 +330,14 @@ protected:
     //! Vector of callbacks to be called when an Endpoint is erased
     std::vector<std::function<void(types::Endpoint)>> erased_endpoint_callbacks_;
 
+    //! Vector of callbacks to be called when a batch of operations has been processed
+    std::vector<std::function<void(const std::vector<DatabaseOperationItem>&)>> batch_processed_callbacks_;
+
     //! Mutex to guard callbacks vectors
     mutable std::mutex callbacks_mutex_;
 
     //! Queue storing database operations to be performed in a dedicated thread
-    fastrtps::DBQueue<std::tuple<DatabaseOperation, types::Endpoint>> entities_to_process_;
+    fastrtps::DBQueue<DatabaseOperationItem> entities_to_process_;
 
     //! Handle of thread dedicated to performing database operations
     std::thread queue_processing_thread_;
@@ -26,6 +26,8 @@ namespace core {
 CacheChangePool::CacheChangePool(
         utils::PoolConfiguration configuration)
     : utils::UnboundedPool<fastrtps::rtps::CacheChange_t>(configuration)
+    , elements_(0)
+    , reserved_(0)
 {
     initialize_vector_();
 }
@@ -33,17 +35,40 @@ CacheChangePool::CacheChangePool(
 bool CacheChangePool::reserve_cache(
         fastrtps::rtps::CacheChange_t*& cache_change)
 {
-    return loan(cache_change);
+    if (!loan(cache_change))
+    {
+        return false;
+    }
+
+    reserved_.fetch_add(1, std::memory_order_relaxed);
+    return true;
 }
 
 bool CacheChangePool::release_cache(
         fastrtps::rtps::CacheChange_t* cache_change)
 {
-    return return_loan(cache_change);
+    if (!return_loan(cache_change))
+    {
+        return false;
+    }
+
+    reserved_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+uint64_t CacheChangePool::elements() const noexcept
+{
+    return elements_.load(std::memory_order_relaxed);
+}
+
+uint64_t CacheChangePool::reserved() const noexcept
+{
+    return reserved_.load(std::memory_order_relaxed);
 }
 
 fastrtps::rtps::CacheChange_t* CacheChangePool::new_element_()
 {
+    elements_.fetch_add(1, std::memory_order_relaxed);
     return new types::RouterCacheChange();
 }
 
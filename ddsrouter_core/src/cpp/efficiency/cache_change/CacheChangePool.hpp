@@ -19,6 +19,8 @@
 #ifndef __SRC_DDSROUTERCORE_EFFICIENCY_CACHECHANGE_CACHACHANGEPOOL_HPP_
 #define __SRC_DDSROUTERCORE_EFFICIENCY_CACHECHANGE_CACHACHANGEPOOL_HPP_
 
+#include <atomic>
+
 #include <fastdds/rtps/history/IChangePool.h>
 
 #include <cpp_utils/pool/UnboundedPool.hpp>
@@ -57,11 +59,23 @@ public:
     virtual bool release_cache(
             fastrtps::rtps::CacheChange_t* cache_change) override;
 
+    //! Number of cache changes allocated by the pool, reserved or not
+    uint64_t elements() const noexcept;
+
+    //! Number of cache changes currently reserved
+    uint64_t reserved() const noexcept;
+
 protected:
 
     //! Override the UnboundedPool::create_element method to create a RouterCacheChange object.
     virtual fastrtps::rtps::CacheChange_t* new_element_() override;
 
+    //! Number of cache changes allocated by \c new_element_
+    std::atomic<uint64_t> elements_;
+
+    //! Number of cache changes reserved and not released
+    std::atomic<uint64_t> reserved_;
+
 };
 
 } /* namespace core */
@@ -22,6 +22,7 @@
 #include <cpp_utils/Log.hpp>
 
 #include <efficiency/payload/FastPayloadPool.hpp>
+#include <trace/Tracepoints.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -126,6 +127,8 @@ bool FastPayloadPool::reserve_(
     payload.data = reinterpret_cast<eprosima::fastrtps::rtps::octet*>(reference_place + 1);
     payload.max_size = size;
 
+    DDSROUTER_TRACEPOINT(payload_reserve, size, payload.data);
+
     add_reserved_payload_();
 
     return true;
@@ -134,6 +137,8 @@ bool FastPayloadPool::reserve_(
 bool FastPayloadPool::release_(
         types::Payload& payload)
 {
+    DDSROUTER_TRACEPOINT(payload_release, payload.max_size, payload.data);
+
     // Free memory from the initial allocation, 4 bytes before
     MetaInfoType* reference_place = reinterpret_cast<MetaInfoType*>(payload.data);
     reference_place--;
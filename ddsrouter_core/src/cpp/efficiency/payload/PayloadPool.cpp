@@ -21,6 +21,7 @@
 #include <cpp_utils/Log.hpp>
 
 #include <efficiency/payload/PayloadPool.hpp>
+#include <trace/Tracepoints.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -116,6 +117,16 @@ bool PayloadPool::is_clean() const noexcept
     return reserve_count_ == release_count_;
 }
 
+uint64_t PayloadPool::reserved_payloads() const noexcept
+{
+    return reserve_count_.load(std::memory_order_relaxed);
+}
+
+uint64_t PayloadPool::released_payloads() const noexcept
+{
+    return release_count_.load(std::memory_order_relaxed);
+}
+
 /////
 // INTERNAL PART
 
@@ -148,6 +159,8 @@ bool PayloadPool::reserve_(
 
     payload.reserve(size);
 
+    DDSROUTER_TRACEPOINT(payload_reserve, size, payload.data);
+
     add_reserved_payload_();
 
     return true;
@@ -156,6 +169,8 @@ bool PayloadPool::reserve_(
 bool PayloadPool::release_(
         Payload& payload)
 {
+    DDSROUTER_TRACEPOINT(payload_release, payload.max_size, payload.data);
+
     payload.empty();
 
     if (payload.data != nullptr)
@@ -197,6 +197,12 @@ public:
     //! Wether every payload get has been released.
     virtual bool is_clean() const noexcept;
 
+    //! Number of payloads reserved since this pool was created
+    uint64_t reserved_payloads() const noexcept;
+
+    //! Number of payloads released since this pool was created
+    uint64_t released_payloads() const noexcept;
+
 protected:
 
     /**
@@ -85,6 +85,7 @@ bool BaseParticipant::is_rtps_kind() const noexcept
     switch (kind())
     {
         case types::ParticipantKind::simple_rtps:
+        case types::ParticipantKind::local_shm:
         case types::ParticipantKind::local_discovery_server:
         case types::ParticipantKind::wan_discovery_server:
         case types::ParticipantKind::wan_initial_peers:
@@ -97,22 +98,41 @@ bool BaseParticipant::is_rtps_kind() const noexcept
 std::shared_ptr<IWriter> BaseParticipant::create_writer(
         types::DdsTopic topic)
 {
-    std::lock_guard <std::recursive_mutex> lock(mutex_);
-
-    if (writers_.find(topic) != writers_.end())
     {
-        throw utils::InitializationException(
-                  utils::Formatter() <<
-                      "Error creating writer for topic " << topic << " in participant " << id() <<
-                      ". Writer already exists.");
+        std::lock_guard <std::recursive_mutex> lock(mutex_);
+
+        if (writers_.find(topic) != writers_.end())
+        {
+            throw utils::InitializationException(
+                      utils::Formatter() <<
+                          "Error creating writer for topic " << topic << " in participant " << id() <<
+                          ". Writer already exists.");
+        }
+
+        // Reserve the entry, so no other thread creates a writer for this topic meanwhile
+        writers_.emplace(topic, nullptr);
     }
 
-    std::shared_ptr <IWriter> new_writer = create_writer_(topic);
+    // The writer is created without holding the mutex, so endpoints of different topics
+    // could be created concurrently (e.g. Bridges constructed in parallel)
+    std::shared_ptr <IWriter> new_writer;
+    try
+    {
+        new_writer = create_writer_(topic);
+    }
+    catch (...)
+    {
+        std::lock_guard <std::recursive_mutex> lock(mutex_);
+        writers_.erase(topic);
+        throw;
+    }
 
     logInfo(DDSROUTER_BASEPARTICIPANT, "Created writer in Participant " << id() << " for topic " << topic);
 
-    // Insertion must not fail as we already know it does not exist
-    writers_.emplace(topic, new_writer);
+    {
+        std::lock_guard <std::recursive_mutex> lock(mutex_);
+        writers_[topic] = new_writer;
+    }
 
     return new_writer;
 }
@@ -120,22 +140,41 @@ std::shared_ptr<IWriter> BaseParticipant::create_writer(
 std::shared_ptr<IReader> BaseParticipant::create_reader(
         types::DdsTopic topic)
 {
-    std::lock_guard <std::recursive_mutex> lock(mutex_);
-
-    if (readers_.find(topic) != readers_.end())
     {
-        throw utils::InitializationException(
-                  utils::Formatter() <<
-                      "Error creating Reader for topic " << topic << " in participant " << id() <<
-                      ". Reader already exists.");
+        std::lock_guard <std::recursive_mutex> lock(mutex_);
+
+        if (readers_.find(topic) != readers_.end())
+        {
+            throw utils::InitializationException(
+                      utils::Formatter() <<
+                          "Error creating Reader for topic " << topic << " in participant " << id() <<
+                          ". Reader already exists.");
+        }
+
+        // Reserve the entry, so no other thread creates a reader for this topic meanwhile
+        readers_.emplace(topic, nullptr);
     }
 
-    std::shared_ptr <IReader> new_reader = create_reader_(topic);
+    // The reader is created without holding the mutex, so endpoints of different topics
+    // could be created concurrently (e.g. Bridges constructed in parallel)
+    std::shared_ptr <IReader> new_reader;
+    try
+    {
+        new_reader = create_reader_(topic);
+    }
+    catch (...)
+    {
+        std::lock_guard <std::recursive_mutex> lock(mutex_);
+        readers_.erase(topic);
+        throw;
+    }
 
     logInfo(DDSROUTER_BASEPARTICIPANT, "Created reader in Participant " << id() << " for topic " << topic);
 
-    // Insertion must not fail as we already know it does not exist
-    readers_.emplace(topic, new_reader);
+    {
+        std::lock_guard <std::recursive_mutex> lock(mutex_);
+        readers_[topic] = new_reader;
+    }
 
     return new_reader;
 }
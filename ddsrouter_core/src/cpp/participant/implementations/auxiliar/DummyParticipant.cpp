@@ -80,7 +80,7 @@ void DummyParticipant::simulate_data_reception(
         DummyDataReceived data)
 {
     auto it = readers_.find(topic);
-    if (it != readers_.end())
+    if (it != readers_.end() && it->second)
     {
         std::shared_ptr<DummyReader> reader = std::dynamic_pointer_cast<DummyReader>(it->second);
         reader->simulate_data_reception(data);
@@ -91,7 +91,7 @@ std::vector<DummyDataStored> DummyParticipant::get_data_that_should_have_been_se
         DdsTopic topic)
 {
     auto it = writers_.find(topic);
-    if (it != writers_.end())
+    if (it != writers_.end() && it->second)
     {
         std::shared_ptr<DummyWriter> writer = std::dynamic_pointer_cast<DummyWriter>(it->second);
         return writer->get_data_that_should_have_been_sent();
@@ -107,7 +107,7 @@ void DummyParticipant::wait_until_n_data_sent(
         uint16_t n) const noexcept
 {
     auto it = writers_.find(topic);
-    if (it != writers_.end())
+    if (it != writers_.end() && it->second)
     {
         std::shared_ptr<DummyWriter> writer = std::dynamic_pointer_cast<DummyWriter>(it->second);
         writer->wait_until_n_data_sent(n);
@@ -16,6 +16,8 @@
  * @file EchoParticipant.cpp
  */
 
+#include <algorithm>
+
 #include <cpp_utils/Log.hpp>
 
 #include <participant/implementations/auxiliar/EchoParticipant.hpp>
@@ -35,6 +37,8 @@ EchoParticipant::EchoParticipant(
         std::shared_ptr<DiscoveryDatabase> discovery_database)
     : BlankParticipant(participant_configuration->id)
     , configuration_(participant_configuration)
+    , last_statistics_time_(std::chrono::steady_clock::now())
+    , stop_(false)
 {
     logDebug(DDSROUTER_TRACK, "Creating Echo Participant : " << configuration_->id << " .");
 
@@ -47,6 +51,30 @@ EchoParticipant::EchoParticipant(
                 this->echo_discovery(endpoint_discovered);
             });
     }
+
+    if (configuration_->statistics && configuration_->statistics_period > 0)
+    {
+        statistics_thread_ = std::thread(&EchoParticipant::statistics_routine_, this);
+    }
+}
+
+EchoParticipant::~EchoParticipant()
+{
+    {
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        stop_ = true;
+    }
+    statistics_cv_.notify_all();
+
+    if (statistics_thread_.joinable())
+    {
+        statistics_thread_.join();
+    }
+
+    if (configuration_->statistics)
+    {
+        print_statistics_(std::chrono::steady_clock::now() - last_statistics_time_);
+    }
 }
 
 void EchoParticipant::echo_discovery(
@@ -61,7 +89,18 @@ void EchoParticipant::echo_discovery(
 std::shared_ptr<IWriter> EchoParticipant::create_writer(
         DdsTopic topic)
 {
-    if (configuration_->echo_data)
+    if (configuration_->statistics)
+    {
+        std::shared_ptr<EchoWriter> writer = std::make_shared<EchoWriter>(
+            topic,
+            configuration_->verbose,
+            true);
+
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        statistics_writers_.push_back(writer);
+        return writer;
+    }
+    else if (configuration_->echo_data)
     {
         return std::make_shared<EchoWriter>(
             topic,
@@ -73,6 +112,79 @@ std::shared_ptr<IWriter> EchoParticipant::create_writer(
     }
 }
 
+void EchoParticipant::delete_writer(
+        std::shared_ptr<IWriter> writer) noexcept
+{
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    statistics_writers_.erase(
+        std::remove(statistics_writers_.begin(), statistics_writers_.end(), writer),
+        statistics_writers_.end());
+}
+
+void EchoParticipant::statistics_routine_() noexcept
+{
+    std::chrono::milliseconds period(configuration_->statistics_period);
+
+    while (true)
+    {
+        std::chrono::steady_clock::duration elapsed;
+        {
+            std::unique_lock<std::mutex> lock(statistics_mutex_);
+            if (statistics_cv_.wait_until(
+                        lock,
+                        last_statistics_time_ + period,
+                        [this]()
+                        {
+                            return stop_;
+                        }))
+            {
+                return;
+            }
+            std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+            elapsed = now - last_statistics_time_;
+            last_statistics_time_ = now;
+        }
+
+        print_statistics_(elapsed);
+    }
+}
+
+void EchoParticipant::print_statistics_(
+        std::chrono::steady_clock::duration elapsed) noexcept
+{
+    std::vector<std::shared_ptr<EchoWriter>> writers;
+    {
+        std::lock_guard<std::mutex> lock(statistics_mutex_);
+        writers = statistics_writers_;
+    }
+
+    double seconds = std::chrono::duration<double>(elapsed).count();
+    if (seconds <= 0)
+    {
+        return;
+    }
+
+    for (const std::shared_ptr<EchoWriter>& writer : writers)
+    {
+        EchoStatistics statistics = writer->take_statistics();
+        if (statistics.samples == 0)
+        {
+            continue;
+        }
+
+        uint64_t jitter = statistics.jitter_count > 0 ? statistics.jitter_sum / statistics.jitter_count : 0;
+        uint64_t latency = statistics.latency_count > 0 ? statistics.latency_sum / statistics.latency_count : 0;
+
+        logUser(
+            DDSROUTER_ECHO_DATA,
+            "Participant: " << id() << " in topic: " << writer->topic() <<
+                " received " << static_cast<uint64_t>(statistics.samples / seconds) << " samples/s, " <<
+                static_cast<uint64_t>(statistics.bytes / seconds) << " bytes/s, " <<
+                "jitter " << jitter / 1000 << " us, " <<
+                "latency avg " << latency / 1000 << " us max " << statistics.latency_max / 1000 << " us.");
+    }
+}
+
 types::ParticipantKind EchoParticipant::kind() const noexcept
 {
     return ParticipantKind::echo;
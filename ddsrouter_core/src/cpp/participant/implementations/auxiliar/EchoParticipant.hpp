@@ -19,9 +19,16 @@
 #ifndef __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_ECHOPARTICIPANT_HPP_
 #define __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_ECHOPARTICIPANT_HPP_
 
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include <ddsrouter_core/configuration/participant/EchoParticipantConfiguration.hpp>
 
 #include <participant/implementations/auxiliar/BlankParticipant.hpp>
+#include <writer/implementations/auxiliar/EchoWriter.hpp>
 
 namespace eprosima {
 namespace ddsrouter {
@@ -29,6 +36,8 @@ namespace core {
 
 /**
  * Concrete Participant that prints in stdout each message that arrives.
+ *
+ * In statistics mode it prints instead a periodic summary per topic of the data received.
  */
 class EchoParticipant : public BlankParticipant
 {
@@ -39,6 +48,9 @@ public:
             std::shared_ptr<configuration::EchoParticipantConfiguration> participant_configuration,
             std::shared_ptr<DiscoveryDatabase> discovery_database);
 
+    //! Stop the statistics thread and print the statistics not printed yet
+    ~EchoParticipant();
+
     //! Override kind() IParticipant method
     types::ParticipantKind kind() const noexcept override;
 
@@ -50,15 +62,42 @@ public:
     std::shared_ptr<IWriter> create_writer(
             types::DdsTopic topic) override;
 
+    //! Override delete_writer() IParticipant method
+    void delete_writer(
+            std::shared_ptr<IWriter> writer) noexcept override;
+
 protected:
 
-    // Deleters do not need to be implemented
+    //! Print a summary of the statistics of every Writer each \c statistics_period until stopped
+    void statistics_routine_() noexcept;
+
+    //! Take the statistics of every Writer and print them, as received during \c elapsed
+    void print_statistics_(
+            std::chrono::steady_clock::duration elapsed) noexcept;
 
     //! Reference to alias access of this object configuration without casting every time
     std::shared_ptr<configuration::EchoParticipantConfiguration> configuration_;
 
     //! DDS Router shared Discovery Database
     std::shared_ptr<DiscoveryDatabase> discovery_database_;
+
+    //! Writers created in statistics mode
+    std::vector<std::shared_ptr<EchoWriter>> statistics_writers_;
+
+    //! Time when the statistics were last printed
+    std::chrono::steady_clock::time_point last_statistics_time_;
+
+    //! Thread that prints the statistics periodically
+    std::thread statistics_thread_;
+
+    //! Whether the statistics thread must stop
+    bool stop_;
+
+    //! Protects \c statistics_writers_ , \c last_statistics_time_ and \c stop_
+    std::mutex statistics_mutex_;
+
+    //! Wakes up the statistics thread when stopping
+    std::condition_variable statistics_cv_;
 };
 
 } /* namespace core */
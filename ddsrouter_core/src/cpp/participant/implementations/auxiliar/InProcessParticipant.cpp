@@ -0,0 +1,129 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessParticipant.cpp
+ */
+
+#include <functional>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <participant/implementations/auxiliar/InProcessParticipant.hpp>
+#include <reader/implementations/auxiliar/InProcessReader.hpp>
+#include <writer/implementations/auxiliar/InProcessWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+InProcessParticipant::InProcessParticipant(
+        std::shared_ptr<configuration::InProcessParticipantConfiguration> participant_configuration,
+        std::shared_ptr<PayloadPool> payload_pool,
+        std::shared_ptr<DiscoveryDatabase> discovery_database)
+    : BaseParticipant(participant_configuration, payload_pool, discovery_database)
+    , connector_(participant_configuration->connector)
+    , endpoints_announced_(0)
+{
+    // Guid Prefix from the participant name, so endpoints of different participants do not collide
+    std::size_t hash = std::hash<std::string>()(id().id_name());
+    for (std::size_t i = 0; i < fastrtps::rtps::GuidPrefix_t::size; i++)
+    {
+        guid_prefix_.value[i] = static_cast<fastrtps::rtps::octet>(hash >> ((i % sizeof(hash)) * 8));
+    }
+
+    if (!connector_->attach_(this, payload_pool_))
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Connector of participant " << id() <<
+                      " is already attached to another participant.");
+    }
+}
+
+InProcessParticipant::~InProcessParticipant()
+{
+    connector_->detach_();
+}
+
+Guid InProcessParticipant::announce_endpoint(
+        const DdsTopic& topic,
+        const EndpointKind& kind) noexcept
+{
+    uint32_t entity = ++endpoints_announced_;
+
+    Guid guid;
+    guid.guidPrefix = guid_prefix_;
+    guid.entityId.value[0] = static_cast<fastrtps::rtps::octet>(entity >> 16);
+    guid.entityId.value[1] = static_cast<fastrtps::rtps::octet>(entity >> 8);
+    guid.entityId.value[2] = static_cast<fastrtps::rtps::octet>(entity);
+    // User defined entity kinds (RTPS 9.3.1.2)
+    guid.entityId.value[3] = (kind == EndpointKind::writer) ? 0x03 : 0x04;
+
+    logInfo(DDSROUTER_INPROCESS_PARTICIPANT,
+            "Application " << kind << " announced in participant " << id() << " for topic " << topic <<
+            " with guid " << guid << ".");
+
+    discovery_database_->add_endpoint(Endpoint(kind, guid, topic, id()));
+
+    return guid;
+}
+
+utils::ReturnCode InProcessParticipant::receive_data(
+        const DdsTopic& topic,
+        std::unique_ptr<DataReceived>&& data) noexcept
+{
+    std::shared_ptr<InProcessReader> reader;
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+        auto it = readers_.find(topic);
+        if (it != readers_.end())
+        {
+            reader = std::dynamic_pointer_cast<InProcessReader>(it->second);
+        }
+    }
+
+    if (!reader)
+    {
+        logDebug(DDSROUTER_INPROCESS_PARTICIPANT,
+                "Data written by application in participant " << id() << " for topic " << topic <<
+                " without Reader. Discarding it.");
+
+        payload_pool_->release_payload(data->payload);
+        return utils::ReturnCode::RETCODE_PRECONDITION_NOT_MET;
+    }
+
+    data->properties.participant_receiver = id();
+
+    return reader->receive_data(std::move(data));
+}
+
+std::shared_ptr<IWriter> InProcessParticipant::create_writer_(
+        DdsTopic topic)
+{
+    return std::make_shared<InProcessWriter>(id(), topic, payload_pool_, connector_);
+}
+
+std::shared_ptr<IReader> InProcessParticipant::create_reader_(
+        DdsTopic topic)
+{
+    return std::make_shared<InProcessReader>(id(), topic, payload_pool_);
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
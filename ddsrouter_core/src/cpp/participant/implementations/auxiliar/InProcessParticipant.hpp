@@ -0,0 +1,106 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessParticipant.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_INPROCESSPARTICIPANT_HPP_
+#define __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_INPROCESSPARTICIPANT_HPP_
+
+#include <atomic>
+
+#include <ddsrouter_core/configuration/participant/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/InProcessConnector.hpp>
+#include <ddsrouter_core/types/dds/GuidPrefix.hpp>
+#include <ddsrouter_core/types/endpoint/Endpoint.hpp>
+
+#include <participant/implementations/auxiliar/BaseParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that connects the router with a host application running in the same process.
+ *
+ * The application uses the \c InProcessConnector of the configuration to announce its endpoints, to write
+ * samples (received by the Readers of this Participant) and to receive the samples sent by its Writers.
+ * Samples never leave the router \c PayloadPool , so there is no serialization nor transport between
+ * the application and the router.
+ */
+class InProcessParticipant : public BaseParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new In Process Participant object and attach it to the connector of the configuration
+     *
+     * @throw \c InitializationException if the connector is already attached to another participant
+     */
+    InProcessParticipant(
+            std::shared_ptr<configuration::InProcessParticipantConfiguration> participant_configuration,
+            std::shared_ptr<PayloadPool> payload_pool,
+            std::shared_ptr<DiscoveryDatabase> discovery_database);
+
+    //! Detach from the connector
+    virtual ~InProcessParticipant();
+
+    /**
+     * @brief Add to the Discovery Database an endpoint of the application
+     *
+     * @param topic : topic of the endpoint
+     * @param kind : whether the endpoint is a writer or a reader
+     *
+     * @return Guid given to the endpoint
+     */
+    types::Guid announce_endpoint(
+            const types::DdsTopic& topic,
+            const types::EndpointKind& kind) noexcept;
+
+    /**
+     * @brief Give a sample written by the application to the Reader of its topic
+     *
+     * @return \c RETCODE_PRECONDITION_NOT_MET if there is no Reader for this topic. The payload is released.
+     * @return result of \c InProcessReader::receive_data otherwise
+     */
+    utils::ReturnCode receive_data(
+            const types::DdsTopic& topic,
+            std::unique_ptr<types::DataReceived>&& data) noexcept;
+
+protected:
+
+    //! Override create_writer_() BaseParticipant method
+    std::shared_ptr<IWriter> create_writer_(
+            types::DdsTopic topic) override;
+
+    //! Override create_reader_() BaseParticipant method
+    std::shared_ptr<IReader> create_reader_(
+            types::DdsTopic topic) override;
+
+    //! Connector of the application
+    std::shared_ptr<InProcessConnector> connector_;
+
+    //! Guid Prefix of every endpoint announced, derived from the participant id
+    types::GuidPrefix guid_prefix_;
+
+    //! Number of endpoints announced, used as entity id
+    std::atomic<uint32_t> endpoints_announced_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_INPROCESSPARTICIPANT_HPP_ */
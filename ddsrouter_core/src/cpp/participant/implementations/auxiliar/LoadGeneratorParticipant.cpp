@@ -0,0 +1,503 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadGeneratorParticipant.cpp
+ */
+
+#include <algorithm>
+#include <cstring>
+#include <functional>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/types/endpoint/Endpoint.hpp>
+
+#include <participant/implementations/auxiliar/LoadGeneratorParticipant.hpp>
+#include <writer/implementations/auxiliar/LoadGeneratorWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+const std::size_t LoadGeneratorParticipant::MAX_PENDING_SAMPLES_ = 1024;
+const std::chrono::microseconds LoadGeneratorParticipant::SPIN_WAIT_TIME_ = std::chrono::microseconds(200);
+
+LoadGeneratorParticipant::LoadGeneratorParticipant(
+        std::shared_ptr<configuration::LoadGeneratorParticipantConfiguration> participant_configuration,
+        std::shared_ptr<PayloadPool> payload_pool,
+        std::shared_ptr<DiscoveryDatabase> discovery_database)
+    : BaseParticipant(participant_configuration, payload_pool, discovery_database)
+    , configuration_(participant_configuration)
+    , creation_time_(std::chrono::steady_clock::now())
+    , any_reader_enabled_(false)
+    , stop_(false)
+{
+    // Guid Prefix from the participant name, so endpoints of different participants do not collide
+    std::size_t hash = std::hash<std::string>()(id().id_name());
+    for (std::size_t i = 0; i < fastrtps::rtps::GuidPrefix_t::size; i++)
+    {
+        guid_prefix_.value[i] = static_cast<fastrtps::rtps::octet>(hash >> ((i % sizeof(hash)) * 8));
+    }
+
+    announce_topics_();
+
+    if (!topics_.empty())
+    {
+        generation_thread_ = std::thread(&LoadGeneratorParticipant::generate_, this);
+    }
+    if (configuration_->report_period > 0)
+    {
+        report_thread_ = std::thread(&LoadGeneratorParticipant::report_, this);
+    }
+}
+
+LoadGeneratorParticipant::~LoadGeneratorParticipant()
+{
+    {
+        std::lock_guard<std::mutex> lock(generator_mutex_);
+        stop_ = true;
+    }
+    generator_cv_.notify_all();
+
+    if (generation_thread_.joinable())
+    {
+        generation_thread_.join();
+    }
+    if (report_thread_.joinable())
+    {
+        report_thread_.join();
+    }
+
+    report_totals_();
+}
+
+std::shared_ptr<IWriter> LoadGeneratorParticipant::create_writer_(
+        DdsTopic topic)
+{
+    return std::make_shared<LoadGeneratorWriter>(id(), topic, payload_pool_);
+}
+
+std::shared_ptr<IReader> LoadGeneratorParticipant::create_reader_(
+        DdsTopic topic)
+{
+    std::shared_ptr<InjectionReader> reader = std::make_shared<InjectionReader>(
+        id(),
+        topic,
+        payload_pool_,
+        std::bind(&LoadGeneratorParticipant::reader_enabled_, this));
+
+    std::lock_guard<std::mutex> lock(generator_mutex_);
+    for (GeneratedTopic& generated_topic : topics_)
+    {
+        if (generated_topic.topic.topic_name == topic.topic_name && generated_topic.topic.type_name == topic.type_name)
+        {
+            generated_topic.reader = reader;
+        }
+    }
+
+    return reader;
+}
+
+void LoadGeneratorParticipant::delete_reader_(
+        std::shared_ptr<IReader> reader) noexcept
+{
+    std::lock_guard<std::mutex> lock(generator_mutex_);
+    for (GeneratedTopic& generated_topic : topics_)
+    {
+        if (generated_topic.reader == reader)
+        {
+            generated_topic.reader.reset();
+        }
+    }
+}
+
+void LoadGeneratorParticipant::announce_topics_() noexcept
+{
+    TopicQoS qos;
+    if (configuration_->reliable)
+    {
+        qos.reliability_qos = ReliabilityKind::RELIABLE;
+    }
+    if (configuration_->transient_local)
+    {
+        qos.durability_qos = DurabilityKind::TRANSIENT_LOCAL;
+    }
+
+    topics_.resize(configuration_->topic_count);
+    for (std::size_t topic_index = 0; topic_index < topics_.size(); ++topic_index)
+    {
+        GeneratedTopic& generated_topic = topics_[topic_index];
+
+        generated_topic.topic = DdsTopic(
+            configuration_->topic_prefix + "_" + std::to_string(topic_index),
+            configuration_->type_name,
+            configuration_->keys > 0,
+            qos);
+
+        // Fixed seed per topic, so the sizes generated are reproducible
+        generated_topic.random_engine.seed(static_cast<std::mt19937::result_type>(topic_index));
+
+        for (EndpointKind kind : {EndpointKind::writer, EndpointKind::reader})
+        {
+            Guid guid;
+            guid.guidPrefix = guid_prefix_;
+            guid.entityId.value[0] = static_cast<fastrtps::rtps::octet>(topic_index >> 16);
+            guid.entityId.value[1] = static_cast<fastrtps::rtps::octet>(topic_index >> 8);
+            guid.entityId.value[2] = static_cast<fastrtps::rtps::octet>(topic_index);
+            // User defined entity kinds (RTPS 9.3.1.2)
+            guid.entityId.value[3] = (kind == EndpointKind::writer) ? 0x03 : 0x04;
+
+            if (kind == EndpointKind::writer)
+            {
+                generated_topic.guid = guid;
+            }
+
+            discovery_database_->add_endpoint(Endpoint(kind, guid, generated_topic.topic, id()));
+        }
+    }
+
+    logInfo(DDSROUTER_LOAD_GENERATOR,
+            "Participant " << id() << " generating " << configuration_->rate << " samples/s in " <<
+            topics_.size() << " topics with sizes " << configuration_->min_size << "-" << configuration_->max_size <<
+            " bytes (" << configuration_->size_distribution << ").");
+}
+
+void LoadGeneratorParticipant::reader_enabled_() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(generator_mutex_);
+        any_reader_enabled_ = true;
+    }
+    generator_cv_.notify_all();
+}
+
+bool LoadGeneratorParticipant::wait_until_(
+        std::chrono::steady_clock::time_point timeout) noexcept
+{
+    std::unique_lock<std::mutex> lock(generator_mutex_);
+    generator_cv_.wait_until(
+        lock,
+        timeout,
+        [this]()
+        {
+            return stop_;
+        });
+    return !stop_;
+}
+
+void LoadGeneratorParticipant::generate_() noexcept
+{
+    // Wait for the router to enable the first Reader
+    {
+        std::unique_lock<std::mutex> lock(generator_mutex_);
+        generator_cv_.wait(
+            lock,
+            [this]()
+            {
+                return stop_ || any_reader_enabled_;
+            });
+        if (stop_)
+        {
+            return;
+        }
+    }
+
+    // Bursts are spaced so the average rate of each topic is the one configured
+    std::chrono::nanoseconds burst_period(0);
+    if (configuration_->rate > 0)
+    {
+        burst_period = std::chrono::nanoseconds(
+            static_cast<int64_t>(1e9 * configuration_->burst / configuration_->rate));
+    }
+
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (GeneratedTopic& generated_topic : topics_)
+    {
+        generated_topic.next_burst = start;
+    }
+
+    while (true)
+    {
+        // Topic with the earliest burst
+        std::size_t topic_index = 0;
+        for (std::size_t i = 1; i < topics_.size(); ++i)
+        {
+            if (topics_[i].next_burst < topics_[topic_index].next_burst)
+            {
+                topic_index = i;
+            }
+        }
+        std::chrono::steady_clock::time_point target = topics_[topic_index].next_burst;
+
+        // Sleep most of the time and busy-wait the last part, as sleeps wake up later than requested
+        if (!wait_until_(target - SPIN_WAIT_TIME_))
+        {
+            return;
+        }
+        while (std::chrono::steady_clock::now() < target)
+        {
+            std::this_thread::yield();
+        }
+
+        generate_burst_(topic_index);
+
+        // Keep the schedule instead of the current time, so delays are compensated and the average rate is kept
+        topics_[topic_index].next_burst += burst_period;
+        if (burst_period.count() == 0)
+        {
+            // As fast as possible: go round the topics
+            topics_[topic_index].next_burst = std::chrono::steady_clock::now();
+        }
+    }
+}
+
+void LoadGeneratorParticipant::generate_burst_(
+        std::size_t topic_index) noexcept
+{
+    GeneratedTopic& generated_topic = topics_[topic_index];
+
+    std::shared_ptr<InjectionReader> reader;
+    {
+        std::lock_guard<std::mutex> lock(generator_mutex_);
+        reader = generated_topic.reader;
+    }
+
+    // There is no bridge for this topic (yet)
+    if (!reader)
+    {
+        return;
+    }
+
+    uint64_t samples_generated = 0;
+    for (unsigned int i = 0; i < configuration_->burst; ++i)
+    {
+        // Do not let samples accumulate in the Reader faster than the Track takes them
+        while (reader->pending_samples() >= MAX_PENDING_SAMPLES_)
+        {
+            std::this_thread::yield();
+
+            std::lock_guard<std::mutex> lock(generator_mutex_);
+            if (stop_)
+            {
+                return;
+            }
+        }
+
+        std::unique_ptr<DataReceived> data = create_sample_(generated_topic);
+        if (!data)
+        {
+            break;
+        }
+
+        // Sequence number only advances with the samples that enter the router, so the sink does not count the
+        // samples discarded here as lost
+        if (reader->receive_data(std::move(data)) != utils::ReturnCode::RETCODE_OK)
+        {
+            break;
+        }
+        ++generated_topic.sequence_number;
+        ++samples_generated;
+    }
+
+    std::lock_guard<std::mutex> lock(generator_mutex_);
+    generated_topic.samples_generated += samples_generated;
+}
+
+std::unique_ptr<DataReceived> LoadGeneratorParticipant::create_sample_(
+        GeneratedTopic& topic) noexcept
+{
+    uint32_t size = next_size_(topic);
+
+    std::unique_ptr<DataReceived> data = std::make_unique<DataReceived>();
+    if (!payload_pool_->get_payload(size, data->payload))
+    {
+        logDevError(DDSROUTER_LOAD_GENERATOR, "Error getting payload to generate sample.");
+        return nullptr;
+    }
+    data->payload.length = size;
+
+    // CDR encapsulation in the byte order of this host
+    const uint16_t endianness_test = 1;
+    const bool little_endian = *reinterpret_cast<const uint8_t*>(&endianness_test) == 1;
+    const uint8_t encapsulation[LOAD_SAMPLE_ENCAPSULATION_SIZE] =
+    {0x00, static_cast<uint8_t>(little_endian ? 0x01 : 0x00), 0x00, 0x00};
+    std::memcpy(data->payload.data, encapsulation, LOAD_SAMPLE_ENCAPSULATION_SIZE);
+
+    LoadSampleHeader header;
+    header.magic = LOAD_SAMPLE_MAGIC;
+    header.key = 0;
+    if (configuration_->keys > 0)
+    {
+        header.key = static_cast<uint32_t>(topic.sequence_number % configuration_->keys) + 1;
+    }
+    header.sequence_number = topic.sequence_number;
+    std::memcpy(data->payload.data + LOAD_SAMPLE_ENCAPSULATION_SIZE, &header, sizeof(header));
+
+    uint32_t header_end = LOAD_SAMPLE_ENCAPSULATION_SIZE + sizeof(header);
+    std::memset(data->payload.data + header_end, static_cast<int>(topic.sequence_number), size - header_end);
+
+    data->properties.kind = eprosima::fastrtps::rtps::ALIVE;
+    data->properties.participant_receiver = id();
+    data->properties.source_guid = topic.guid;
+    DataTime::now(data->properties.source_timestamp);
+    data->properties.origin_sequence_number.high = static_cast<int32_t>((topic.sequence_number + 1) >> 32);
+    data->properties.origin_sequence_number.low = static_cast<uint32_t>(topic.sequence_number + 1);
+
+    if (header.key > 0)
+    {
+        // Key hash of a single uint32 key: its big endian serialization
+        data->properties.instanceHandle.value[0] = static_cast<fastrtps::rtps::octet>(header.key >> 24);
+        data->properties.instanceHandle.value[1] = static_cast<fastrtps::rtps::octet>(header.key >> 16);
+        data->properties.instanceHandle.value[2] = static_cast<fastrtps::rtps::octet>(header.key >> 8);
+        data->properties.instanceHandle.value[3] = static_cast<fastrtps::rtps::octet>(header.key);
+    }
+
+    return data;
+}
+
+uint32_t LoadGeneratorParticipant::next_size_(
+        GeneratedTopic& topic) noexcept
+{
+    uint32_t min_size = configuration_->min_size;
+    uint32_t max_size = configuration_->max_size;
+
+    if (min_size >= max_size)
+    {
+        return min_size;
+    }
+
+    switch (configuration_->size_distribution)
+    {
+        case LoadSizeDistribution::exponential:
+        {
+            std::exponential_distribution<double> distribution(4.0 / (max_size - min_size));
+            double extra = std::min(distribution(topic.random_engine), static_cast<double>(max_size - min_size));
+            return min_size + static_cast<uint32_t>(extra);
+        }
+
+        case LoadSizeDistribution::uniform:
+        default:
+        {
+            std::uniform_int_distribution<uint32_t> distribution(min_size, max_size);
+            return distribution(topic.random_engine);
+        }
+    }
+}
+
+void LoadGeneratorParticipant::report_() noexcept
+{
+    std::chrono::milliseconds period(configuration_->report_period);
+    std::chrono::steady_clock::time_point last_report = std::chrono::steady_clock::now();
+
+    while (wait_until_(last_report + period))
+    {
+        std::chrono::steady_clock::time_point now = std::chrono::steady_clock::now();
+        report_period_(now - last_report);
+        last_report = now;
+    }
+}
+
+void LoadGeneratorParticipant::report_period_(
+        std::chrono::steady_clock::duration elapsed) noexcept
+{
+    double seconds = std::chrono::duration<double>(elapsed).count();
+
+    // Samples generated
+    {
+        std::lock_guard<std::mutex> lock(generator_mutex_);
+        for (GeneratedTopic& generated_topic : topics_)
+        {
+            if (generated_topic.samples_generated > 0)
+            {
+                logUser(DDSROUTER_LOAD_GENERATOR,
+                        "Participant " << id() << " generated in " << generated_topic.topic.topic_name << ": " <<
+                        static_cast<uint64_t>(generated_topic.samples_generated / seconds) << " samples/s.");
+            }
+            generated_topic.samples_generated = 0;
+        }
+    }
+
+    // Samples received
+    std::map<DdsTopic, std::shared_ptr<IWriter>> writers;
+    {
+        std::lock_guard<std::recursive_mutex> lock(mutex_);
+        writers = writers_;
+    }
+
+    for (const auto& writer : writers)
+    {
+        std::shared_ptr<LoadGeneratorWriter> load_writer =
+                std::dynamic_pointer_cast<LoadGeneratorWriter>(writer.second);
+        if (!load_writer)
+        {
+            continue;
+        }
+
+        LoadStatistics statistics = load_writer->take_statistics();
+        total_statistics_[writer.first.topic_name].merge(statistics);
+
+        if (statistics.samples == 0 && statistics.lost == 0)
+        {
+            continue;
+        }
+
+        logUser(DDSROUTER_LOAD_GENERATOR,
+                "Participant " << id() << " received in " << writer.first.topic_name << ": " <<
+                static_cast<uint64_t>(statistics.samples / seconds) << " samples/s, " <<
+                static_cast<uint64_t>(statistics.bytes / seconds) << " bytes/s, " <<
+                statistics.lost << " lost, latency " << statistics.latency << ".");
+    }
+}
+
+void LoadGeneratorParticipant::report_totals_() noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    for (const auto& writer : writers_)
+    {
+        std::shared_ptr<LoadGeneratorWriter> load_writer =
+                std::dynamic_pointer_cast<LoadGeneratorWriter>(writer.second);
+        if (load_writer)
+        {
+            total_statistics_[writer.first.topic_name].merge(load_writer->take_statistics());
+        }
+    }
+
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - creation_time_).count();
+
+    for (const GeneratedTopic& generated_topic : topics_)
+    {
+        logUser(DDSROUTER_LOAD_GENERATOR,
+                "Participant " << id() << " generated " << generated_topic.sequence_number << " samples in " <<
+                generated_topic.topic.topic_name << ".");
+    }
+
+    for (const auto& statistics : total_statistics_)
+    {
+        uint64_t expected = statistics.second.samples + statistics.second.lost;
+        logUser(DDSROUTER_LOAD_GENERATOR,
+                "Participant " << id() << " received " << statistics.second.samples << " samples (" <<
+                statistics.second.bytes << " bytes) in " << statistics.first << " in " << seconds << " s, " <<
+                statistics.second.lost << " lost (" <<
+                (expected > 0 ? 100.0 * statistics.second.lost / expected : 0) << "%), latency " <<
+                statistics.second.latency << ".");
+    }
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
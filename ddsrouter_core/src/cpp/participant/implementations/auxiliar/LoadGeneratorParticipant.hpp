@@ -0,0 +1,189 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadGeneratorParticipant.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_LOADGENERATORPARTICIPANT_HPP_
+#define __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_LOADGENERATORPARTICIPANT_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ddsrouter_core/configuration/participant/LoadGeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/dds/GuidPrefix.hpp>
+
+#include <participant/implementations/auxiliar/BaseParticipant.hpp>
+#include <participant/implementations/auxiliar/LoadSample.hpp>
+#include <reader/implementations/auxiliar/InjectionReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that generates synthetic samples and measures the samples it receives, so the router can be
+ * benchmarked without external applications.
+ *
+ * As a generator, it announces a writer and a reader endpoint for each of its topics, so the router creates their
+ * bridges, and a thread injects samples in its Readers at the configured rate, burst, size and keys.
+ * Each sample carries a \c LoadSampleHeader with a sequence number per topic, and its source timestamp is the
+ * time it is generated.
+ *
+ * As a sink, its Writers are \c LoadGeneratorWriter , that measure rate, loss and latency of every topic
+ * forwarded to this Participant. The samples generated and received are reported periodically and when the
+ * Participant is destroyed.
+ */
+class LoadGeneratorParticipant : public BaseParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new Load Generator Participant object, announce its topics and start its threads
+     */
+    LoadGeneratorParticipant(
+            std::shared_ptr<configuration::LoadGeneratorParticipantConfiguration> participant_configuration,
+            std::shared_ptr<PayloadPool> payload_pool,
+            std::shared_ptr<DiscoveryDatabase> discovery_database);
+
+    //! Stop the threads and report the totals
+    virtual ~LoadGeneratorParticipant();
+
+protected:
+
+    //! State of the generation of a topic
+    struct GeneratedTopic
+    {
+        //! Topic
+        types::DdsTopic topic;
+
+        //! Guid of the writer endpoint announced, used as source of the samples
+        types::Guid guid;
+
+        //! Reader where samples are injected (nullptr if not created)
+        std::shared_ptr<InjectionReader> reader;
+
+        //! Time to generate the next burst
+        std::chrono::steady_clock::time_point next_burst;
+
+        //! Sequence number of the next sample
+        uint64_t sequence_number = 0;
+
+        //! Samples generated since the last report
+        uint64_t samples_generated = 0;
+
+        //! Random generator of the sizes of this topic
+        std::mt19937 random_engine;
+    };
+
+    //! Override create_writer_() BaseParticipant method
+    std::shared_ptr<IWriter> create_writer_(
+            types::DdsTopic topic) override;
+
+    //! Override create_reader_() BaseParticipant method
+    std::shared_ptr<IReader> create_reader_(
+            types::DdsTopic topic) override;
+
+    //! Override delete_reader_() BaseParticipant method
+    void delete_reader_(
+            std::shared_ptr<IReader> reader) noexcept override;
+
+    //! Create the topics to generate and announce a writer and a reader endpoint for each of them
+    void announce_topics_() noexcept;
+
+    //! Notify the generation thread that a Reader has been enabled
+    void reader_enabled_() noexcept;
+
+    //! Generation thread routine
+    void generate_() noexcept;
+
+    //! Generate a burst of samples in topic \c topic_index
+    void generate_burst_(
+            std::size_t topic_index) noexcept;
+
+    //! Create the next sample of \c topic in the payload pool
+    std::unique_ptr<types::DataReceived> create_sample_(
+            GeneratedTopic& topic) noexcept;
+
+    //! Size of the next sample of \c topic
+    uint32_t next_size_(
+            GeneratedTopic& topic) noexcept;
+
+    //! Report thread routine
+    void report_() noexcept;
+
+    //! Log the samples generated and received since the last call, over \c elapsed time
+    void report_period_(
+            std::chrono::steady_clock::duration elapsed) noexcept;
+
+    //! Log the samples received since the Participant was created
+    void report_totals_() noexcept;
+
+    //! Wait until \c stop_ is set or \c timeout expires. Return false if stopped.
+    bool wait_until_(
+            std::chrono::steady_clock::time_point timeout) noexcept;
+
+    //! Configuration of the Participant
+    std::shared_ptr<configuration::LoadGeneratorParticipantConfiguration> configuration_;
+
+    //! Guid Prefix of every endpoint announced, derived from the participant id
+    types::GuidPrefix guid_prefix_;
+
+    //! Topics generated
+    std::vector<GeneratedTopic> topics_;
+
+    //! Statistics of the samples received in each topic since the Participant was created, by topic name
+    std::map<std::string, LoadStatistics> total_statistics_;
+
+    //! Time when the Participant was created
+    std::chrono::steady_clock::time_point creation_time_;
+
+    //! Whether any Reader has been enabled
+    bool any_reader_enabled_;
+
+    //! Whether the threads must stop
+    bool stop_;
+
+    //! Guard \c topics_ readers and counters, \c any_reader_enabled_ and \c stop_
+    std::mutex generator_mutex_;
+
+    //! Wake up the threads when a Reader is enabled or they must stop
+    std::condition_variable generator_cv_;
+
+    //! Generation thread (only if there are topics to generate)
+    std::thread generation_thread_;
+
+    //! Report thread (only if there is a report period)
+    std::thread report_thread_;
+
+    //! Maximum samples waiting in a Reader before the generation thread waits for the Track to take them
+    static const std::size_t MAX_PENDING_SAMPLES_;
+
+    //! Time before the next burst in which the generation thread busy-waits instead of sleeping
+    static const std::chrono::microseconds SPIN_WAIT_TIME_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_LOADGENERATORPARTICIPANT_HPP_ */
@@ -0,0 +1,84 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadSample.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_LOADSAMPLE_HPP_
+#define __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_LOADSAMPLE_HPP_
+
+#include <cstdint>
+
+#include <ddsrouter_core/types/statistics/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Content of the samples generated by a \c LoadGeneratorParticipant , after the 4 bytes of CDR encapsulation.
+ *
+ * Values are in the byte order of the host that generates the sample, as indicated by the encapsulation.
+ * The rest of the sample up to its size is filler.
+ */
+struct LoadSampleHeader
+{
+    //! Must be \c LOAD_SAMPLE_MAGIC
+    uint32_t magic;
+
+    //! Key of the sample (from 1 to the number of keys), 0 if the topic is not keyed
+    uint32_t key;
+
+    //! Number of samples generated before this one in the same topic by the same generator
+    uint64_t sequence_number;
+};
+
+//! Identifies the samples generated by a \c LoadGeneratorParticipant ("LOAD" in ASCII)
+constexpr uint32_t LOAD_SAMPLE_MAGIC = 0x44414F4C;
+
+//! Size of the CDR encapsulation before \c LoadSampleHeader
+constexpr uint32_t LOAD_SAMPLE_ENCAPSULATION_SIZE = 4;
+
+//! Statistics of the samples received by a \c LoadGeneratorParticipant
+struct LoadStatistics
+{
+    //! Add the values of \c other
+    void merge(
+            const LoadStatistics& other) noexcept
+    {
+        samples += other.samples;
+        bytes += other.bytes;
+        lost += other.lost;
+        latency.merge(other.latency);
+    }
+
+    //! Samples received
+    uint64_t samples = 0;
+
+    //! Bytes of payload received
+    uint64_t bytes = 0;
+
+    //! Samples generated by a \c LoadGeneratorParticipant that have not been received (gaps in sequence numbers)
+    uint64_t lost = 0;
+
+    //! Time from the source timestamp of each sample until it is received
+    types::LatencyHistogram latency;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_LOADSAMPLE_HPP_ */
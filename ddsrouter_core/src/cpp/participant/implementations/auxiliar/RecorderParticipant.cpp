@@ -0,0 +1,61 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderParticipant.cpp
+ */
+
+#include <participant/implementations/auxiliar/RecorderParticipant.hpp>
+#include <reader/implementations/auxiliar/BlankReader.hpp>
+#include <writer/implementations/auxiliar/RecorderWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+RecorderParticipant::RecorderParticipant(
+        std::shared_ptr<configuration::RecorderParticipantConfiguration> participant_configuration,
+        std::shared_ptr<PayloadPool> payload_pool,
+        std::shared_ptr<DiscoveryDatabase> discovery_database)
+    : BaseParticipant(participant_configuration, payload_pool, discovery_database)
+    , capture_writer_(std::make_shared<capture::CaptureWriter>(
+                participant_configuration->file_path,
+                participant_configuration->chunk_size,
+                participant_configuration->max_pending_bytes,
+                payload_pool))
+{
+}
+
+RecorderParticipant::~RecorderParticipant()
+{
+    capture_writer_->close();
+}
+
+std::shared_ptr<IWriter> RecorderParticipant::create_writer_(
+        DdsTopic topic)
+{
+    return std::make_shared<RecorderWriter>(id(), topic, payload_pool_, capture_writer_);
+}
+
+std::shared_ptr<IReader> RecorderParticipant::create_reader_(
+        DdsTopic topic)
+{
+    return std::make_shared<BlankReader>();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
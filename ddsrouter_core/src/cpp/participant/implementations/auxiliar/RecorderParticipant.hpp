@@ -0,0 +1,71 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderParticipant.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_RECORDERPARTICIPANT_HPP_
+#define __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_RECORDERPARTICIPANT_HPP_
+
+#include <ddsrouter_core/configuration/participant/RecorderParticipantConfiguration.hpp>
+
+#include <capture/CaptureWriter.hpp>
+#include <participant/implementations/auxiliar/BaseParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that writes every sample it receives from the rest of participants in a capture file.
+ *
+ * It does not receive data, so its Readers are \c BlankReader .
+ */
+class RecorderParticipant : public BaseParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new Recorder Participant object and create its capture file
+     *
+     * @throw \c InitializationException if the capture file could not be created
+     */
+    RecorderParticipant(
+            std::shared_ptr<configuration::RecorderParticipantConfiguration> participant_configuration,
+            std::shared_ptr<PayloadPool> payload_pool,
+            std::shared_ptr<DiscoveryDatabase> discovery_database);
+
+    //! Close the capture file
+    virtual ~RecorderParticipant();
+
+protected:
+
+    //! Override create_writer_() BaseParticipant method
+    std::shared_ptr<IWriter> create_writer_(
+            types::DdsTopic topic) override;
+
+    //! Override create_reader_() BaseParticipant method
+    std::shared_ptr<IReader> create_reader_(
+            types::DdsTopic topic) override;
+
+    //! Capture file shared by every Writer
+    std::shared_ptr<capture::CaptureWriter> capture_writer_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_RECORDERPARTICIPANT_HPP_ */
@@ -0,0 +1,313 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReplayerParticipant.cpp
+ */
+
+#include <cstring>
+#include <functional>
+
+#include <cpp_utils/Log.hpp>
+
+#include <ddsrouter_core/types/endpoint/Endpoint.hpp>
+
+#include <participant/implementations/auxiliar/ReplayerParticipant.hpp>
+#include <writer/implementations/auxiliar/BlankWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+const std::size_t ReplayerParticipant::MAX_PENDING_SAMPLES_ = 1024;
+const std::chrono::microseconds ReplayerParticipant::SPIN_WAIT_TIME_ = std::chrono::microseconds(200);
+
+ReplayerParticipant::ReplayerParticipant(
+        std::shared_ptr<configuration::ReplayerParticipantConfiguration> participant_configuration,
+        std::shared_ptr<PayloadPool> payload_pool,
+        std::shared_ptr<DiscoveryDatabase> discovery_database)
+    : BaseParticipant(participant_configuration, payload_pool, discovery_database)
+    , capture_reader_(std::make_unique<capture::CaptureReader>(participant_configuration->file_path))
+    , speed_(participant_configuration->speed)
+    , start_delay_(participant_configuration->start_delay)
+    , topic_readers_(capture_reader_->topics().size())
+    , any_reader_enabled_(false)
+    , stop_(false)
+{
+    // Guid Prefix from the participant name, so endpoints of different participants do not collide
+    std::size_t hash = std::hash<std::string>()(id().id_name());
+    for (std::size_t i = 0; i < fastrtps::rtps::GuidPrefix_t::size; i++)
+    {
+        guid_prefix_.value[i] = static_cast<fastrtps::rtps::octet>(hash >> ((i % sizeof(hash)) * 8));
+    }
+
+    announce_topics_();
+
+    logInfo(DDSROUTER_REPLAYER_PARTICIPANT,
+            "Participant " << id() << " replaying " << capture_reader_->sample_count() << " samples of " <<
+            capture_reader_->topics().size() << " topics from " << participant_configuration->file_path << ".");
+
+    replay_thread_ = std::thread(&ReplayerParticipant::replay_, this);
+}
+
+ReplayerParticipant::~ReplayerParticipant()
+{
+    {
+        std::lock_guard<std::mutex> lock(replay_mutex_);
+        stop_ = true;
+    }
+    replay_cv_.notify_all();
+
+    if (replay_thread_.joinable())
+    {
+        replay_thread_.join();
+    }
+}
+
+std::shared_ptr<IWriter> ReplayerParticipant::create_writer_(
+        DdsTopic topic)
+{
+    return std::make_shared<BlankWriter>();
+}
+
+std::shared_ptr<IReader> ReplayerParticipant::create_reader_(
+        DdsTopic topic)
+{
+    std::shared_ptr<InjectionReader> reader = std::make_shared<InjectionReader>(
+        id(),
+        topic,
+        payload_pool_,
+        std::bind(&ReplayerParticipant::reader_enabled_, this));
+
+    const std::vector<DdsTopic>& topics = capture_reader_->topics();
+
+    std::lock_guard<std::mutex> lock(replay_mutex_);
+    for (std::size_t topic_id = 0; topic_id < topics.size(); ++topic_id)
+    {
+        if (topics[topic_id].topic_name == topic.topic_name && topics[topic_id].type_name == topic.type_name)
+        {
+            topic_readers_[topic_id] = reader;
+        }
+    }
+
+    return reader;
+}
+
+void ReplayerParticipant::delete_reader_(
+        std::shared_ptr<IReader> reader) noexcept
+{
+    std::lock_guard<std::mutex> lock(replay_mutex_);
+    for (auto& topic_reader : topic_readers_)
+    {
+        if (topic_reader == reader)
+        {
+            topic_reader.reset();
+        }
+    }
+}
+
+void ReplayerParticipant::announce_topics_() noexcept
+{
+    const std::vector<DdsTopic>& topics = capture_reader_->topics();
+
+    for (std::size_t topic_id = 0; topic_id < topics.size(); ++topic_id)
+    {
+        // Topics with no name are ids not registered in the file
+        if (topics[topic_id].topic_name.empty())
+        {
+            continue;
+        }
+
+        for (EndpointKind kind : {EndpointKind::writer, EndpointKind::reader})
+        {
+            Guid guid;
+            guid.guidPrefix = guid_prefix_;
+            guid.entityId.value[0] = static_cast<fastrtps::rtps::octet>(topic_id >> 16);
+            guid.entityId.value[1] = static_cast<fastrtps::rtps::octet>(topic_id >> 8);
+            guid.entityId.value[2] = static_cast<fastrtps::rtps::octet>(topic_id);
+            // User defined entity kinds (RTPS 9.3.1.2)
+            guid.entityId.value[3] = (kind == EndpointKind::writer) ? 0x03 : 0x04;
+
+            discovery_database_->add_endpoint(Endpoint(kind, guid, topics[topic_id], id()));
+        }
+    }
+}
+
+void ReplayerParticipant::reader_enabled_() noexcept
+{
+    {
+        std::lock_guard<std::mutex> lock(replay_mutex_);
+        any_reader_enabled_ = true;
+    }
+    replay_cv_.notify_all();
+}
+
+template <typename Condition>
+bool ReplayerParticipant::wait_until_(
+        std::chrono::steady_clock::time_point timeout,
+        Condition condition) noexcept
+{
+    std::unique_lock<std::mutex> lock(replay_mutex_);
+    replay_cv_.wait_until(
+        lock,
+        timeout,
+        [this, &condition]()
+        {
+            return stop_ || condition();
+        });
+    return !stop_;
+}
+
+void ReplayerParticipant::replay_() noexcept
+{
+    // Wait for the router to enable the first Reader, and then for the start delay
+    {
+        std::unique_lock<std::mutex> lock(replay_mutex_);
+        replay_cv_.wait(
+            lock,
+            [this]()
+            {
+                return stop_ || any_reader_enabled_;
+            });
+        if (stop_)
+        {
+            return;
+        }
+    }
+    if (!wait_until_(std::chrono::steady_clock::now() + start_delay_, []()
+            {
+                return false;
+            }))
+    {
+        return;
+    }
+
+    logInfo(DDSROUTER_REPLAYER_PARTICIPANT, "Participant " << id() << " starting replay.");
+
+    const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    const int64_t first_time = capture_reader_->first_time();
+
+    uint64_t samples_replayed = 0;
+    uint64_t samples_discarded = 0;
+
+    capture::CaptureSample sample;
+    while (capture_reader_->next(sample))
+    {
+        if (speed_ > 0)
+        {
+            // Target time keeping the recorded distance to the first sample, scaled by speed
+            std::chrono::steady_clock::time_point target = start + std::chrono::nanoseconds(
+                static_cast<int64_t>((sample.header->reception_time - first_time) / speed_));
+
+            // Sleep most of the time and busy-wait the last part, as sleeps wake up later than requested
+            if (!wait_until_(target - SPIN_WAIT_TIME_, []()
+                    {
+                        return false;
+                    }))
+            {
+                return;
+            }
+            while (std::chrono::steady_clock::now() < target)
+            {
+                std::this_thread::yield();
+            }
+        }
+        else
+        {
+            std::lock_guard<std::mutex> lock(replay_mutex_);
+            if (stop_)
+            {
+                return;
+            }
+        }
+
+        if (inject_(sample))
+        {
+            ++samples_replayed;
+        }
+        else
+        {
+            ++samples_discarded;
+        }
+    }
+
+    logInfo(DDSROUTER_REPLAYER_PARTICIPANT,
+            "Participant " << id() << " finished replay: " << samples_replayed << " samples replayed, " <<
+            samples_discarded << " discarded.");
+}
+
+bool ReplayerParticipant::inject_(
+        const capture::CaptureSample& sample) noexcept
+{
+    std::shared_ptr<InjectionReader> reader;
+    {
+        std::lock_guard<std::mutex> lock(replay_mutex_);
+        reader = topic_readers_[sample.header->topic_id];
+    }
+
+    if (!reader)
+    {
+        return false;
+    }
+
+    // Do not let samples accumulate in the Reader faster than the Track takes them
+    while (reader->pending_samples() >= MAX_PENDING_SAMPLES_)
+    {
+        std::this_thread::yield();
+
+        std::lock_guard<std::mutex> lock(replay_mutex_);
+        if (stop_)
+        {
+            return false;
+        }
+    }
+
+    std::unique_ptr<DataReceived> data = std::make_unique<DataReceived>();
+
+    // The capture file is not pool memory, so the payload is copied once into the pool.
+    // Disposes and unregisters have no payload
+    if (sample.header->payload_length > 0)
+    {
+        if (!payload_pool_->get_payload(sample.header->payload_length, data->payload))
+        {
+            logDevError(DDSROUTER_REPLAYER_PARTICIPANT, "Error getting payload to replay sample.");
+            return false;
+        }
+        std::memcpy(data->payload.data, sample.payload, sample.header->payload_length);
+        data->payload.length = sample.header->payload_length;
+    }
+
+    data->properties.kind = static_cast<eprosima::fastrtps::rtps::ChangeKind_t>(sample.header->change_kind);
+    data->properties.participant_receiver = id();
+    // Source timestamp is the replay time, so latencies downstream are measured from the injection
+    eprosima::fastrtps::rtps::Time_t::now(data->properties.source_timestamp);
+    std::memcpy(
+        data->properties.source_guid.guidPrefix.value,
+        sample.header->source_guid,
+        fastrtps::rtps::GuidPrefix_t::size);
+    std::memcpy(
+        data->properties.source_guid.entityId.value,
+        sample.header->source_guid + fastrtps::rtps::GuidPrefix_t::size,
+        fastrtps::rtps::EntityId_t::size);
+    data->properties.origin_sequence_number.high = static_cast<int32_t>(sample.header->sequence_number >> 32);
+    data->properties.origin_sequence_number.low = static_cast<uint32_t>(sample.header->sequence_number);
+
+    return reader->receive_data(std::move(data)) == utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
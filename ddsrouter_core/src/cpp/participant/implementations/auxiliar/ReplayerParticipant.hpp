@@ -0,0 +1,143 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ReplayerParticipant.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_REPLAYERPARTICIPANT_HPP_
+#define __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_REPLAYERPARTICIPANT_HPP_
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <ddsrouter_core/configuration/participant/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/types/dds/GuidPrefix.hpp>
+
+#include <capture/CaptureReader.hpp>
+#include <participant/implementations/auxiliar/BaseParticipant.hpp>
+#include <reader/implementations/auxiliar/InjectionReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Participant that injects in the router the samples of a capture file written by a \c RecorderParticipant .
+ *
+ * A writer and a reader endpoint are announced for every topic of the file, so the router creates a bridge
+ * for each of them even if there is no subscriber in the rest of participants yet.
+ * Samples are replayed in a separate thread once the first Reader is enabled and \c start_delay has passed,
+ * keeping the recorded time between them divided by \c speed (or as fast as possible if \c speed is 0).
+ * It does not send data, so its Writers are \c BlankWriter .
+ */
+class ReplayerParticipant : public BaseParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new Replayer Participant object, open its capture file and start the replay thread
+     *
+     * @throw \c InitializationException if the capture file could not be opened or is not valid
+     */
+    ReplayerParticipant(
+            std::shared_ptr<configuration::ReplayerParticipantConfiguration> participant_configuration,
+            std::shared_ptr<PayloadPool> payload_pool,
+            std::shared_ptr<DiscoveryDatabase> discovery_database);
+
+    //! Stop the replay thread
+    virtual ~ReplayerParticipant();
+
+protected:
+
+    //! Override create_writer_() BaseParticipant method
+    std::shared_ptr<IWriter> create_writer_(
+            types::DdsTopic topic) override;
+
+    //! Override create_reader_() BaseParticipant method
+    std::shared_ptr<IReader> create_reader_(
+            types::DdsTopic topic) override;
+
+    //! Override delete_reader_() BaseParticipant method
+    void delete_reader_(
+            std::shared_ptr<IReader> reader) noexcept override;
+
+    //! Announce a writer and a reader endpoint for every topic of the capture file
+    void announce_topics_() noexcept;
+
+    //! Notify the replay thread that a Reader has been enabled
+    void reader_enabled_() noexcept;
+
+    //! Replay thread routine
+    void replay_() noexcept;
+
+    /**
+     * @brief Give a sample of the capture file to its Reader
+     *
+     * @return true if the sample has been given to a Reader
+     */
+    bool inject_(
+            const capture::CaptureSample& sample) noexcept;
+
+    //! Wait until \c stop_ is set or \c condition is true, with a maximum time. Return false if stopped.
+    template <typename Condition>
+    bool wait_until_(
+            std::chrono::steady_clock::time_point timeout,
+            Condition condition) noexcept;
+
+    //! Capture file being replayed (only accessed by the replay thread after construction)
+    std::unique_ptr<capture::CaptureReader> capture_reader_;
+
+    //! Replay speed. 0 means as fast as possible.
+    double speed_;
+
+    //! Time to wait from the first Reader enabled until the replay starts
+    std::chrono::milliseconds start_delay_;
+
+    //! Guid Prefix of every endpoint announced, derived from the participant id
+    types::GuidPrefix guid_prefix_;
+
+    //! Reader of each topic of the capture file, by topic id (nullptr if not created)
+    std::vector<std::shared_ptr<InjectionReader>> topic_readers_;
+
+    //! Whether any Reader has been enabled
+    bool any_reader_enabled_;
+
+    //! Whether the replay thread must stop
+    bool stop_;
+
+    //! Guard \c topic_readers_ , \c any_reader_enabled_ and \c stop_
+    std::mutex replay_mutex_;
+
+    //! Wake up the replay thread when a Reader is enabled or it must stop
+    std::condition_variable replay_cv_;
+
+    //! Replay thread
+    std::thread replay_thread_;
+
+    //! Maximum samples waiting in a Reader before the replay thread waits for the Track to take them
+    static const std::size_t MAX_PENDING_SAMPLES_;
+
+    //! Time before the target time of a sample in which the replay thread busy-waits instead of sleeping
+    static const std::chrono::microseconds SPIN_WAIT_TIME_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_AUXILIAR_REPLAYERPARTICIPANT_HPP_ */
@@ -0,0 +1,85 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LocalShmParticipant.cpp
+ */
+
+#include <memory>
+
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include <participant/implementations/rtps/LocalShmParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace rtps {
+
+using namespace eprosima::ddsrouter::core::types;
+
+LocalShmParticipant::LocalShmParticipant(
+        std::shared_ptr<configuration::LocalShmParticipantConfiguration> participant_configuration,
+        std::shared_ptr<PayloadPool> payload_pool,
+        std::shared_ptr<DiscoveryDatabase> discovery_database)
+    : CommonParticipant(
+        participant_configuration,
+        payload_pool,
+        discovery_database,
+        participant_configuration->domain,
+        get_participant_attributes_(participant_configuration.get()))
+{
+}
+
+fastrtps::rtps::RTPSParticipantAttributes
+LocalShmParticipant::get_participant_attributes_(
+        const configuration::LocalShmParticipantConfiguration* configuration)
+{
+    // Use default as base attributes
+    fastrtps::rtps::RTPSParticipantAttributes params = CommonParticipant::get_participant_attributes_(configuration);
+
+    // Shared Memory is the only transport, so nothing leaves the host
+    params.useBuiltinTransports = false;
+
+    std::shared_ptr<eprosima::fastdds::rtps::SharedMemTransportDescriptor> descriptor =
+            std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>();
+
+    if (configuration->segment_size != 0)
+    {
+        // Allow messages as big as the segment, so samples that fit in it are not fragmented
+        descriptor->segment_size(configuration->segment_size);
+        descriptor->max_message_size(configuration->segment_size);
+    }
+
+    if (configuration->port_queue_capacity != 0)
+    {
+        descriptor->port_queue_capacity(configuration->port_queue_capacity);
+    }
+
+    params.userTransports.push_back(descriptor);
+
+    logDebug(DDSROUTER_LOCALSHM_PARTICIPANT,
+            "Participant " << configuration->id << " configured with Shared Memory segment of " <<
+            descriptor->segment_size() << " bytes and port queue capacity of " <<
+            descriptor->port_queue_capacity() << " messages.");
+
+    return params;
+}
+
+} /* namespace rtps */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,63 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LocalShmParticipant.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_RTPS_LOCALSHMPARTICIPANT_HPP_
+#define __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_RTPS_LOCALSHMPARTICIPANT_HPP_
+
+#include <ddsrouter_core/configuration/participant/LocalShmParticipantConfiguration.hpp>
+#include <participant/implementations/rtps/CommonParticipant.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace rtps {
+
+/**
+ * Participant with Simple Discovery Protocol that only communicates through Shared Memory.
+ *
+ * It is meant to connect the router with applications running in the same host.
+ * Every RTPS message (discovery included) is sent through the Shared Memory Transport, whose segment and
+ * port sizes are taken from the configuration, so big samples are not fragmented into UDP datagrams.
+ */
+class LocalShmParticipant : public CommonParticipant
+{
+public:
+
+    /**
+     * @brief Construct a new Local Shm Participant object
+     *
+     * It creates a new RTPSParticipant with Shared Memory as its only transport.
+     *
+     * @throw \c InitializationException in case any internal error has ocurred while creating RTPSParticipant
+     * @throw \c IConfigurationException in case configuration was incorrectly set
+     */
+    LocalShmParticipant(
+            std::shared_ptr<configuration::LocalShmParticipantConfiguration> participant_configuration,
+            std::shared_ptr<PayloadPool> payload_pool,
+            std::shared_ptr<DiscoveryDatabase> discovery_database);
+
+    static fastrtps::rtps::RTPSParticipantAttributes get_participant_attributes_(
+            const configuration::LocalShmParticipantConfiguration* participant_configuration);
+};
+
+} /* namespace rtps */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_PARTICIPANT_IMPLEMENTATIONS_RTPS_LOCALSHMPARTICIPANT_HPP_ */
@@ -0,0 +1,171 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HardwareCounters.cpp
+ *
+ */
+
+#include <atomic>
+#include <cstring>
+
+#if defined(__linux__)
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/resource.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif // if defined(__linux__)
+
+#include <cpp_utils/Log.hpp>
+
+#include <profiling/HardwareCounters.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+//! Whether the unavailability of the hardware counters has already been logged
+static std::atomic<bool> unavailable_logged(false);
+
+HardwareCountersValues HardwareCountersValues::since(
+        const HardwareCountersValues& origin) const noexcept
+{
+    HardwareCountersValues result;
+    result.cycles = cycles - origin.cycles;
+    result.instructions = instructions - origin.instructions;
+    result.cache_misses = cache_misses - origin.cache_misses;
+    result.context_switches = context_switches - origin.context_switches;
+    return result;
+}
+
+HardwareCountersValues HardwareCounters::read() noexcept
+{
+    HardwareCountersValues values;
+
+#if defined(__linux__)
+    HardwareCounters& counters = thread_counters_();
+
+    if (counters.group_fd_ >= 0)
+    {
+        // Group read format: number of counters followed by their values in order of creation
+        uint64_t buffer[4];
+        if (::read(counters.group_fd_, buffer, sizeof(buffer)) == static_cast<ssize_t>(sizeof(buffer)))
+        {
+            values.cycles = buffer[1];
+            values.instructions = buffer[2];
+            values.cache_misses = buffer[3];
+        }
+    }
+
+    struct rusage usage;
+    if (getrusage(RUSAGE_THREAD, &usage) == 0)
+    {
+        values.context_switches = static_cast<uint64_t>(usage.ru_nvcsw) + static_cast<uint64_t>(usage.ru_nivcsw);
+    }
+#endif // if defined(__linux__)
+
+    return values;
+}
+
+bool HardwareCounters::hardware_available() noexcept
+{
+    return thread_counters_().group_fd_ >= 0;
+}
+
+HardwareCounters::HardwareCounters() noexcept
+    : group_fd_(-1)
+    , instructions_fd_(-1)
+    , cache_misses_fd_(-1)
+{
+    if (!open_() && !unavailable_logged.exchange(true))
+    {
+        logWarning(DDSROUTER_PROFILING,
+                "Hardware performance counters are not available (check perf_event_paranoid), "
+                "only context switches are profiled.");
+    }
+}
+
+HardwareCounters::~HardwareCounters()
+{
+#if defined(__linux__)
+    for (int fd : {cache_misses_fd_, instructions_fd_, group_fd_})
+    {
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+    }
+#endif // if defined(__linux__)
+}
+
+HardwareCounters& HardwareCounters::thread_counters_() noexcept
+{
+    thread_local HardwareCounters counters;
+    return counters;
+}
+
+bool HardwareCounters::open_() noexcept
+{
+#if defined(__linux__)
+    auto open_counter =
+            [](uint64_t config, int group_fd)
+            {
+                struct perf_event_attr attributes;
+                std::memset(&attributes, 0, sizeof(attributes));
+                attributes.type = PERF_TYPE_HARDWARE;
+                attributes.size = sizeof(attributes);
+                attributes.config = config;
+                attributes.read_format = PERF_FORMAT_GROUP;
+                attributes.exclude_kernel = 1;
+                attributes.exclude_hv = 1;
+                // The leader starts disabled, so the whole group starts counting at once
+                attributes.disabled = group_fd < 0 ? 1 : 0;
+
+                // Calling thread, in any CPU
+                return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, group_fd, 0));
+            };
+
+    group_fd_ = open_counter(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (group_fd_ < 0)
+    {
+        return false;
+    }
+
+    instructions_fd_ = open_counter(PERF_COUNT_HW_INSTRUCTIONS, group_fd_);
+    cache_misses_fd_ = open_counter(PERF_COUNT_HW_CACHE_MISSES, group_fd_);
+
+    if (instructions_fd_ < 0 || cache_misses_fd_ < 0 ||
+            ioctl(group_fd_, PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP) != 0)
+    {
+        for (int* fd : {&cache_misses_fd_, &instructions_fd_, &group_fd_})
+        {
+            if (*fd >= 0)
+            {
+                close(*fd);
+                *fd = -1;
+            }
+        }
+        return false;
+    }
+
+    return true;
+#else
+    return false;
+#endif // if defined(__linux__)
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,92 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file HardwareCounters.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_PROFILING_HARDWARECOUNTERS_HPP_
+#define __SRC_DDSROUTERCORE_PROFILING_HARDWARECOUNTERS_HPP_
+
+#include <cstdint>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Values of the counters of a thread.
+ */
+struct HardwareCountersValues
+{
+    //! Values accumulated since \c origin
+    HardwareCountersValues since(
+            const HardwareCountersValues& origin) const noexcept;
+
+    //! CPU cycles spent in user space
+    uint64_t cycles = 0;
+
+    //! Instructions retired in user space
+    uint64_t instructions = 0;
+
+    //! Last level cache misses in user space
+    uint64_t cache_misses = 0;
+
+    //! Voluntary and involuntary context switches
+    uint64_t context_switches = 0;
+};
+
+/**
+ * Hardware performance counters of the calling thread, read with \c perf_event_open .
+ *
+ * The counters of each thread are opened the first time it reads them and closed when it finishes.
+ * Only user space is counted, so no privileges are needed with the default \c perf_event_paranoid level.
+ * If the hardware counters are not available (e.g. virtual machines without PMU, or other platforms than Linux)
+ * they read 0 and a warning is logged once. Context switches are always available in Linux.
+ */
+class HardwareCounters
+{
+public:
+
+    //! Current values of the counters of the calling thread
+    static HardwareCountersValues read() noexcept;
+
+    //! Whether the hardware counters are available in the calling thread
+    static bool hardware_available() noexcept;
+
+    ~HardwareCounters();
+
+protected:
+
+    HardwareCounters() noexcept;
+
+    //! Counters of the calling thread, opened in its first call
+    static HardwareCounters& thread_counters_() noexcept;
+
+    //! Open the group of hardware counters, returning whether they could be opened
+    bool open_() noexcept;
+
+    //! File descriptor of the leader of the group of counters (-1 if not available)
+    int group_fd_;
+
+    //! File descriptors of the rest of counters of the group
+    int instructions_fd_;
+    int cache_misses_fd_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_PROFILING_HARDWARECOUNTERS_HPP_ */
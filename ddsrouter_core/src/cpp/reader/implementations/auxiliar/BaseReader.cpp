@@ -143,6 +143,13 @@ void BaseReader::on_data_available_() const noexcept
     }
 }
 
+void BaseReader::add_memory_statistics(
+        MemoryStatistics&,
+        std::unordered_set<const void*>&) const noexcept
+{
+    // It does nothing. Override this method so it has functionality.
+}
+
 void BaseReader::enable_() noexcept
 {
     // It does nothing. Override this method so it has functionality.
@@ -112,6 +112,15 @@ public:
     utils::ReturnCode take(
             std::unique_ptr<types::DataReceived>& data) noexcept override;
 
+    /**
+     * @brief Override add_memory_statistics() IReader method
+     *
+     * Add no memory held. Override this method in Readers with a history.
+     */
+    virtual void add_memory_statistics(
+            types::MemoryStatistics& statistics,
+            std::unordered_set<const void*>& counted_payloads) const noexcept override;
+
     //! Getter of \c participant_id_ attribute
     types::ParticipantId participant_id() const noexcept;
 
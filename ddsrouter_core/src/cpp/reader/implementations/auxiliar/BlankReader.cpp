@@ -47,6 +47,12 @@ utils::ReturnCode BlankReader::take(
     return utils::ReturnCode::RETCODE_NO_DATA;
 }
 
+void BlankReader::add_memory_statistics(
+        MemoryStatistics&,
+        std::unordered_set<const void*>&) const noexcept
+{
+}
+
 } /* namespace core */
 } /* namespace ddsrouter */
 } /* namespace eprosima */
@@ -50,6 +50,11 @@ public:
     //! Override take() IReader method
     utils::ReturnCode take(
             std::unique_ptr<types::DataReceived>& data) noexcept override;
+
+    //! Override add_memory_statistics() IReader method
+    void add_memory_statistics(
+            types::MemoryStatistics& statistics,
+            std::unordered_set<const void*>& counted_payloads) const noexcept override;
 };
 
 } /* namespace core */
@@ -0,0 +1,85 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessReader.cpp
+ */
+
+#include <cpp_utils/Log.hpp>
+
+#include <efficiency/payload/PayloadPool.hpp>
+#include <reader/implementations/auxiliar/InProcessReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+InProcessReader::~InProcessReader()
+{
+    std::lock_guard<std::mutex> lock(in_process_mutex_);
+
+    while (!data_received_.empty())
+    {
+        payload_pool_->release_payload(data_received_.front()->payload);
+        data_received_.pop();
+    }
+}
+
+utils::ReturnCode InProcessReader::receive_data(
+        std::unique_ptr<DataReceived>&& data) noexcept
+{
+    if (!enabled_.load())
+    {
+        logDebug(DDSROUTER_INPROCESS_READER,
+                "Discarding data written in disabled Reader in topic " << topic_ << ".");
+
+        payload_pool_->release_payload(data->payload);
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(in_process_mutex_);
+        data_received_.push(std::move(data));
+    }
+
+    // Call on data available callback out of the mutex, as the Track may take right away
+    on_data_available_();
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+utils::ReturnCode InProcessReader::take_(
+        std::unique_ptr<DataReceived>& data) noexcept
+{
+    std::lock_guard<std::mutex> lock(in_process_mutex_);
+
+    // Enable check is done in BaseReader
+
+    if (data_received_.empty())
+    {
+        return utils::ReturnCode::RETCODE_NO_DATA;
+    }
+
+    // Payload already belongs to the PayloadPool, so the whole sample is moved
+    data = std::move(data_received_.front());
+    data_received_.pop();
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,84 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessReader.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_READER_IMPLEMENTATIONS_AUXILIAR_INPROCESSREADER_HPP_
+#define __SRC_DDSROUTERCORE_READER_IMPLEMENTATIONS_AUXILIAR_INPROCESSREADER_HPP_
+
+#include <mutex>
+#include <queue>
+
+#include <reader/implementations/auxiliar/BaseReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader implementation that receives the samples written by the host application through an
+ * \c InProcessConnector .
+ *
+ * Samples arrive with their payload already in the router \c PayloadPool , so they are moved to the Track as is.
+ */
+class InProcessReader : public BaseReader
+{
+public:
+
+    //! Use parent constructors
+    using BaseReader::BaseReader;
+
+    //! Release the payloads of the samples not taken
+    virtual ~InProcessReader();
+
+    /**
+     * @brief Store a sample written by the application and notify the Track
+     *
+     * If the Reader is disabled, the sample is discarded and its payload released.
+     *
+     * @param data : sample to store. It is moved to the Reader whatever the result.
+     *
+     * @return \c RETCODE_OK if the sample has been stored
+     * @return \c RETCODE_NOT_ENABLED if the Reader is disabled
+     */
+    utils::ReturnCode receive_data(
+            std::unique_ptr<types::DataReceived>&& data) noexcept;
+
+protected:
+
+    /**
+     * @brief Take specific method
+     *
+     * Move the oldest sample stored to \c data .
+     *
+     * @return \c RETCODE_OK if data has been correctly taken
+     * @return \c RETCODE_NO_DATA if there are no samples stored
+     */
+    utils::ReturnCode take_(
+            std::unique_ptr<types::DataReceived>& data) noexcept override;
+
+    //! Samples written by the application and not taken yet
+    std::queue<std::unique_ptr<types::DataReceived>> data_received_;
+
+    //! Guard access to \c data_received_
+    std::mutex in_process_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_READER_IMPLEMENTATIONS_AUXILIAR_INPROCESSREADER_HPP_ */
@@ -0,0 +1,50 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InjectionReader.cpp
+ */
+
+#include <reader/implementations/auxiliar/InjectionReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+InjectionReader::InjectionReader(
+        const ParticipantId& participant_id,
+        const DdsTopic& topic,
+        std::shared_ptr<PayloadPool> payload_pool,
+        std::function<void()> on_enabled)
+    : InProcessReader(participant_id, topic, payload_pool)
+    , on_enabled_(on_enabled)
+{
+}
+
+std::size_t InjectionReader::pending_samples() noexcept
+{
+    std::lock_guard<std::mutex> lock(in_process_mutex_);
+    return data_received_.size();
+}
+
+void InjectionReader::enable_() noexcept
+{
+    on_enabled_();
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,70 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InjectionReader.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_READER_IMPLEMENTATIONS_AUXILIAR_INJECTIONREADER_HPP_
+#define __SRC_DDSROUTERCORE_READER_IMPLEMENTATIONS_AUXILIAR_INJECTIONREADER_HPP_
+
+#include <functional>
+
+#include <reader/implementations/auxiliar/InProcessReader.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Reader implementation that receives the samples produced by its own Participant, such as the samples of a capture
+ * file replayed by \c ReplayerParticipant or the synthetic samples of \c LoadGeneratorParticipant .
+ *
+ * It notifies the participant when it is enabled, so samples are only produced once the router is running.
+ */
+class InjectionReader : public InProcessReader
+{
+public:
+
+    /**
+     * @brief Construct a new Replayer Reader object
+     *
+     * @param participant_id id of participant
+     * @param topic topic that this Reader will refer to
+     * @param payload_pool DDS Router shared PayloadPool
+     * @param on_enabled function called every time the Reader is enabled
+     */
+    InjectionReader(
+            const types::ParticipantId& participant_id,
+            const types::DdsTopic& topic,
+            std::shared_ptr<PayloadPool> payload_pool,
+            std::function<void()> on_enabled);
+
+    //! Number of samples received and not taken yet
+    std::size_t pending_samples() noexcept;
+
+protected:
+
+    //! Call \c on_enabled_
+    void enable_() noexcept override;
+
+    //! Function called every time the Reader is enabled
+    std::function<void()> on_enabled_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_READER_IMPLEMENTATIONS_AUXILIAR_INJECTIONREADER_HPP_ */
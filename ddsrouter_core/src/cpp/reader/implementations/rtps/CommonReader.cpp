@@ -18,8 +18,11 @@
 
 #include <fastrtps/rtps/RTPSDomain.h>
 #include <fastrtps/rtps/participant/RTPSParticipant.h>
+#include <fastrtps/rtps/common/CacheChange.h>
 
 #include <reader/implementations/rtps/CommonReader.hpp>
+#include <trace/TraceRecorder.hpp>
+#include <trace/Tracepoints.hpp>
 #include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/Log.hpp>
 
@@ -45,6 +48,7 @@ CommonReader::CommonReader(
     , reader_attributes_(reader_attributes)
     , topic_attributes_(topic_attributes)
     , reader_qos_(reader_qos)
+    , trace_name_(DDSROUTER_TRACE_NAME(topic.topic_name))
 {
     // Do nothing
 }
@@ -142,9 +146,82 @@ uint64_t CommonReader::get_unread_count() const noexcept
     return rtps_reader_->get_unread_count();
 }
 
+void CommonReader::add_memory_statistics(
+        MemoryStatistics& statistics,
+        std::unordered_set<const void*>& counted_payloads) const noexcept
+{
+    std::lock_guard<RecursiveTimedMutex> rtps_lock(get_rtps_mutex());
+
+    for (auto change_it = rtps_history_->changesBegin(); change_it != rtps_history_->changesEnd(); ++change_it)
+    {
+        const Payload& payload = (*change_it)->serializedPayload;
+        statistics.reader_history_bytes += payload.length;
+
+        // Payloads are shared with the Writers that forward them, so they are only counted once
+        if (counted_payloads.insert(payload.data).second)
+        {
+            statistics.payloads++;
+            statistics.payload_bytes += payload.length;
+        }
+    }
+
+    uint64_t changes = rtps_history_->getHistorySize();
+    statistics.reader_history_changes += changes;
+    statistics.cache_change_bytes += changes * sizeof(fastrtps::rtps::CacheChange_t);
+}
+
+utils::ReturnCode CommonReader::take_batch(
+        std::vector<std::unique_ptr<DataReceived>>& data,
+        std::size_t max_samples) noexcept
+{
+    std::lock_guard<std::recursive_mutex> lock(mutex_);
+
+    if (!enabled_.load())
+    {
+        logDevError(DDSROUTER_RTPS_READER, "Attempt to take data from disabled Reader in topic " <<
+                topic_ << " in Participant " << participant_id_);
+        return utils::ReturnCode::RETCODE_NOT_ENABLED;
+    }
+
+    // Internal reader mutex is recursive, so every take_ reuses this lock
+    std::lock_guard<RecursiveTimedMutex> rtps_lock(get_rtps_mutex());
+
+    utils::ReturnCode ret = utils::ReturnCode::RETCODE_NO_DATA;
+    bool any_taken = false;
+
+    for (std::size_t i = 0; i < max_samples; ++i)
+    {
+        std::unique_ptr<DataReceived> sample = std::make_unique<DataReceived>();
+        utils::ReturnCode take_ret = take_(sample);
+
+        if (take_ret == utils::ReturnCode::RETCODE_NO_DATA)
+        {
+            break;
+        }
+        else if (!take_ret)
+        {
+            logWarning(DDSROUTER_RTPS_READER,
+                    "Error taking data in Reader " << *this << ". Error code " << take_ret << ". Skipping data.");
+
+            if (!any_taken && ret == utils::ReturnCode::RETCODE_NO_DATA)
+            {
+                ret = take_ret;
+            }
+            continue;
+        }
+
+        data.push_back(std::move(sample));
+        any_taken = true;
+    }
+
+    return any_taken ? utils::ReturnCode::RETCODE_OK : ret;
+}
+
 utils::ReturnCode CommonReader::take_(
         std::unique_ptr<DataReceived>& data) noexcept
 {
+    DDSROUTER_TRACE_SCOPE(take_trace, reader_take, trace_name_);
+
     // Check if there is data available
     if (!(get_unread_count() > 0))
     {
@@ -172,6 +249,8 @@ utils::ReturnCode CommonReader::take_(
 
     // Store the new data that has arrived in the Track data
     fill_received_data_(received_change, data);
+    DDSROUTER_TRACE_SCOPE_VALUE(take_trace, data->payload.length);
+    DDSROUTER_TRACEPOINT(reader_take, topic_.topic_name.c_str(), data->payload.length, data->payload.data);
 
     logDebug(DDSROUTER_RTPS_COMMONREADER_LISTENER,
             "Data transmiting to track from Reader " << *this << " with payload " <<
@@ -199,6 +278,9 @@ void CommonReader::fill_received_data_(
     // NOTE: in case of keyed topics an empty payload is possible
     if (received_change->serializedPayload.length > 0)
     {
+        DDSROUTER_TRACE_SCOPE(copy_trace, payload_copy, trace_name_);
+        DDSROUTER_TRACE_SCOPE_VALUE(copy_trace, received_change->serializedPayload.length);
+
         eprosima::fastrtps::rtps::IPayloadPool* payload_owner = received_change->payload_owner();
         payload_pool_->get_payload(
             received_change->serializedPayload,
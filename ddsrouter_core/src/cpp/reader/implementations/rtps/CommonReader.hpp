@@ -20,6 +20,7 @@
 #define __SRC_DDSROUTERCORE_READER_IMPLEMENTATIONS_RTPS_COMMONREADER_HPP_
 
 #include <mutex>
+#include <vector>
 
 #include <fastdds/rtps/rtps_fwd.h>
 #include <fastrtps/rtps/attributes/HistoryAttributes.h>
@@ -112,6 +113,37 @@ public:
     //! Get number of unread cache changes in internal RTPS reader
     uint64_t get_unread_count() const noexcept;
 
+    /**
+     * @brief Take up to \c max_samples samples locking the internal RTPS reader mutex only once.
+     *
+     * Samples that could not be taken are skipped and also count towards \c max_samples ,
+     * so the call is always bounded.
+     *
+     * Thread safe with mutex \c mutex_ .
+     *
+     * @param [out] data : samples taken are appended in reception order
+     * @param [in] max_samples : maximum number of samples to take
+     *
+     * @return \c RETCODE_OK if at least one sample has been taken
+     * @return \c RETCODE_NO_DATA if there is no data to take
+     * @return \c RETCODE_NOT_ENABLED if the reader is not enabled
+     * @return error code of the first failed take if no sample could be taken
+     */
+    utils::ReturnCode take_batch(
+            std::vector<std::unique_ptr<types::DataReceived>>& data,
+            std::size_t max_samples) noexcept;
+
+    /**
+     * @brief Override add_memory_statistics() IReader method
+     *
+     * Add up the changes of the internal RTPS reader History and the payloads they reference.
+     *
+     * Thread safe with the internal RTPS reader mutex, that is taken while iterating the History.
+     */
+    void add_memory_statistics(
+            types::MemoryStatistics& statistics,
+            std::unordered_set<const void*>& counted_payloads) const noexcept override;
+
 protected:
 
     /**
@@ -244,6 +276,9 @@ protected:
     //! Reader QoS to create the internal RTPS Reader.
     fastrtps::ReaderQos reader_qos_;
 
+    //! Identifier of the topic in trace events (only used if tracing is compiled in)
+    uint32_t trace_name_;
+
 };
 
 } /* namespace rtps */
@@ -0,0 +1,205 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsDeltaEncoder.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <statistics/StatisticsDeltaEncoder.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+StatisticsDeltaEncoder::StatisticsDeltaEncoder(
+        unsigned int full_snapshot_period) noexcept
+    : full_snapshot_period_(full_snapshot_period)
+    , sequence_number_(0)
+    , previous_timestamp_ns_(0)
+{
+}
+
+StatisticsSample StatisticsDeltaEncoder::encode(
+        const RouterStatistics& statistics,
+        uint64_t timestamp_ns) noexcept
+{
+    StatisticsSample sample;
+    sample.sequence_number = sequence_number_;
+    sample.full = next_is_full_();
+    sample.timestamp_ns = timestamp_ns;
+    sample.interval_ns = sequence_number_ == 0 ? 0 : delta_(timestamp_ns, previous_timestamp_ns_);
+    sample.topics_count = static_cast<uint32_t>(statistics.topics.size());
+    sample.payload_pool = statistics.payload_pool;
+    sample.thread_pool = statistics.thread_pool;
+
+    static const TrackStatistics EMPTY_TOPIC;
+    static const ParticipantTotals EMPTY_PARTICIPANT;
+
+    // Topics (both maps are ordered by topic, so new one is filled from the end)
+    std::map<DdsTopic, TrackStatistics> current_topics;
+    std::map<ParticipantId, ParticipantTotals> current_participants;
+
+    for (const auto& topic_it : statistics.topics)
+    {
+        const TrackStatistics& current =
+                current_topics.emplace_hint(current_topics.end(), topic_it.first, topic_it.second.total())->second;
+
+        auto previous_it = previous_topics_.find(topic_it.first);
+        const TrackStatistics& previous = previous_it == previous_topics_.end() ? EMPTY_TOPIC : previous_it->second;
+
+        if (sample.full || has_changed_(current, previous))
+        {
+            TopicMetrics metrics;
+            metrics.topic_name = topic_it.first.topic_name;
+            metrics.type_name = topic_it.first.type_name;
+            metrics.samples_in = delta_(current.samples_in, previous.samples_in);
+            metrics.bytes_in = delta_(current.bytes_in, previous.bytes_in);
+            metrics.take_errors = delta_(current.take_errors, previous.take_errors);
+            metrics.samples_out = delta_(current.samples_out, previous.samples_out);
+            metrics.bytes_out = delta_(current.bytes_out, previous.bytes_out);
+            metrics.write_errors = delta_(current.write_errors, previous.write_errors);
+            metrics.dropped = delta_(current.dropped, previous.dropped);
+            metrics.latency = latency_delta_(current.latency, previous.latency);
+            sample.topics.push_back(std::move(metrics));
+        }
+
+        // Accumulate participant totals
+        for (const auto& track_it : topic_it.second.tracks)
+        {
+            ParticipantTotals& totals = current_participants[track_it.first];
+            totals.samples_in += track_it.second.samples_in;
+            totals.bytes_in += track_it.second.bytes_in;
+        }
+        for (const auto& writer_it : topic_it.second.writers)
+        {
+            ParticipantTotals& totals = current_participants[writer_it.first];
+            totals.samples_out += writer_it.second.samples;
+            totals.bytes_out += writer_it.second.bytes;
+            totals.write_errors += writer_it.second.write_errors;
+        }
+    }
+
+    // Participants
+    for (const auto& participant_it : current_participants)
+    {
+        const ParticipantTotals& current = participant_it.second;
+
+        auto previous_it = previous_participants_.find(participant_it.first);
+        const ParticipantTotals& previous =
+                previous_it == previous_participants_.end() ? EMPTY_PARTICIPANT : previous_it->second;
+
+        if (sample.full || has_changed_(current, previous))
+        {
+            ParticipantMetrics metrics;
+            metrics.participant_id = participant_it.first.id_name();
+            metrics.samples_in = delta_(current.samples_in, previous.samples_in);
+            metrics.bytes_in = delta_(current.bytes_in, previous.bytes_in);
+            metrics.samples_out = delta_(current.samples_out, previous.samples_out);
+            metrics.bytes_out = delta_(current.bytes_out, previous.bytes_out);
+            metrics.write_errors = delta_(current.write_errors, previous.write_errors);
+            sample.participants.push_back(std::move(metrics));
+        }
+    }
+
+    previous_topics_ = std::move(current_topics);
+    previous_participants_ = std::move(current_participants);
+    previous_timestamp_ns_ = timestamp_ns;
+    ++sequence_number_;
+
+    return sample;
+}
+
+bool StatisticsDeltaEncoder::next_is_full_() const noexcept
+{
+    if (sequence_number_ == 0)
+    {
+        return true;
+    }
+    return full_snapshot_period_ > 0 && sequence_number_ % full_snapshot_period_ == 0;
+}
+
+bool StatisticsDeltaEncoder::has_changed_(
+        const TrackStatistics& current,
+        const TrackStatistics& previous) noexcept
+{
+    // Bytes and latencies only change when samples do
+    return current.samples_in != previous.samples_in ||
+           current.take_errors != previous.take_errors ||
+           current.samples_out != previous.samples_out ||
+           current.write_errors != previous.write_errors ||
+           current.dropped != previous.dropped;
+}
+
+bool StatisticsDeltaEncoder::has_changed_(
+        const ParticipantTotals& current,
+        const ParticipantTotals& previous) noexcept
+{
+    return current.samples_in != previous.samples_in ||
+           current.samples_out != previous.samples_out ||
+           current.write_errors != previous.write_errors;
+}
+
+LatencyMetrics StatisticsDeltaEncoder::latency_delta_(
+        const LatencyHistogram& current,
+        const LatencyHistogram& previous) noexcept
+{
+    LatencyMetrics result;
+
+    LatencyHistogram delta;
+    std::size_t highest_bucket = 0;
+    for (std::size_t i = 0; i < LatencyHistogram::NUMBER_OF_BUCKETS; ++i)
+    {
+        delta.buckets[i] = delta_(current.buckets[i], previous.buckets[i]);
+        if (delta.buckets[i] > 0)
+        {
+            highest_bucket = i;
+        }
+    }
+
+    delta.count = delta_(current.count, previous.count);
+    if (delta.count == 0)
+    {
+        return result;
+    }
+
+    delta.total = std::max(current.total - previous.total, LatencyHistogram::Duration::zero());
+
+    // Exact extremes are not known for the latencies of this interval, so they are bounded by the buckets
+    delta.min = LatencyHistogram::Duration::zero();
+    delta.max = std::min(current.max, LatencyHistogram::bucket_upper_limit(highest_bucket));
+
+    result.count = delta.count;
+    result.mean_ns = static_cast<uint64_t>(delta.mean().count());
+    result.p50_ns = static_cast<uint64_t>(delta.percentile(0.5).count());
+    result.p99_ns = static_cast<uint64_t>(delta.percentile(0.99).count());
+    result.max_ns = static_cast<uint64_t>(delta.max.count());
+
+    return result;
+}
+
+uint64_t StatisticsDeltaEncoder::delta_(
+        uint64_t current,
+        uint64_t previous) noexcept
+{
+    return current >= previous ? current - previous : current;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,125 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsDeltaEncoder.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_STATISTICS_STATISTICSDELTAENCODER_HPP_
+#define __SRC_DDSROUTERCORE_STATISTICS_STATISTICSDELTAENCODER_HPP_
+
+#include <cstdint>
+#include <map>
+
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+#include <statistics/StatisticsSample.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Converts consecutive snapshots of \c RouterStatistics (values accumulated since each Bridge was created)
+ * into \c StatisticsSample (values since the previous snapshot).
+ *
+ * Only topics and participants whose counters have changed since the previous snapshot are included, so the
+ * size of each sample depends on the number of active topics and not on the number of topics.
+ * Every \c full_snapshot_period samples (and always the first one) a full snapshot with every topic and
+ * participant is generated, so subscribers that join late learn the whole set.
+ *
+ * @warning This class is not thread safe.
+ */
+class StatisticsDeltaEncoder
+{
+public:
+
+    /**
+     * @brief Construct a new encoder
+     *
+     * @param [in] full_snapshot_period : number of samples between two full snapshots (0 for only the first one)
+     */
+    StatisticsDeltaEncoder(
+            unsigned int full_snapshot_period) noexcept;
+
+    /**
+     * @brief Generate the sample with the difference between \c statistics and the previous snapshot
+     *
+     * @param [in] statistics : current statistics of the router
+     * @param [in] timestamp_ns : time of \c statistics in nanoseconds since epoch
+     *
+     * @return sample to publish
+     */
+    StatisticsSample encode(
+            const types::RouterStatistics& statistics,
+            uint64_t timestamp_ns) noexcept;
+
+protected:
+
+    //! Values accumulated by a participant in every topic
+    struct ParticipantTotals
+    {
+        uint64_t samples_in = 0;
+        uint64_t bytes_in = 0;
+        uint64_t samples_out = 0;
+        uint64_t bytes_out = 0;
+        uint64_t write_errors = 0;
+    };
+
+    //! Whether next sample must be a full snapshot
+    bool next_is_full_() const noexcept;
+
+    //! Whether any counter of \c current differs from \c previous
+    static bool has_changed_(
+            const types::TrackStatistics& current,
+            const types::TrackStatistics& previous) noexcept;
+
+    //! Whether any counter of \c current differs from \c previous
+    static bool has_changed_(
+            const ParticipantTotals& current,
+            const ParticipantTotals& previous) noexcept;
+
+    //! Metrics of the latencies added to \c current since \c previous
+    static LatencyMetrics latency_delta_(
+            const types::LatencyHistogram& current,
+            const types::LatencyHistogram& previous) noexcept;
+
+    //! \c current - \c previous , or \c current if counter has decreased (it has been reset)
+    static uint64_t delta_(
+            uint64_t current,
+            uint64_t previous) noexcept;
+
+    //! Number of samples between two full snapshots
+    unsigned int full_snapshot_period_;
+
+    //! Sequence number of the next sample
+    uint64_t sequence_number_;
+
+    //! Timestamp of the previous sample
+    uint64_t previous_timestamp_ns_;
+
+    //! Values of each topic in previous snapshot
+    std::map<types::DdsTopic, types::TrackStatistics> previous_topics_;
+
+    //! Values of each participant in previous snapshot
+    std::map<types::ParticipantId, ParticipantTotals> previous_participants_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_STATISTICS_STATISTICSDELTAENCODER_HPP_ */
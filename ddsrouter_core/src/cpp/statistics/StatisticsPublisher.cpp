@@ -0,0 +1,306 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsPublisher.cpp
+ *
+ */
+
+#include <chrono>
+#include <cstring>
+
+#include <fastcdr/exceptions/Exception.h>
+#include <fastrtps/attributes/TopicAttributes.h>
+#include <fastrtps/qos/WriterQos.h>
+#include <fastrtps/rtps/attributes/HistoryAttributes.h>
+#include <fastrtps/rtps/attributes/RTPSParticipantAttributes.h>
+#include <fastrtps/rtps/attributes/WriterAttributes.h>
+#include <fastrtps/rtps/common/CacheChange.h>
+#include <fastrtps/rtps/participant/RTPSParticipant.h>
+#include <fastrtps/rtps/RTPSDomain.h>
+#include <fastrtps/rtps/writer/RTPSWriter.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include <statistics/StatisticsPublisher.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+const char* StatisticsPublisher::TYPE_NAME = "eprosima::ddsrouter::statistics::RouterStatistics";
+const int32_t StatisticsPublisher::HISTORY_DEPTH_ = 10;
+const uint32_t StatisticsPublisher::INITIAL_PAYLOAD_SIZE_ = 4096;
+
+StatisticsPublisher::StatisticsPublisher(
+        const configuration::StatisticsConfiguration& configuration,
+        std::function<RouterStatistics()> statistics_source)
+    : configuration_(configuration)
+    , statistics_source_(statistics_source)
+    , encoder_(configuration.full_snapshot_period)
+    , rtps_participant_(nullptr)
+    , rtps_writer_(nullptr)
+    , rtps_history_(nullptr)
+    , stop_(false)
+{
+    create_entities_();
+
+    publish_thread_ = std::thread(&StatisticsPublisher::publish_routine_, this);
+
+    logInfo(DDSROUTER_STATISTICS,
+            "Publishing statistics in topic " << configuration_.topic_name << " of domain " <<
+            configuration_.domain << " every " << configuration_.period.count() << " ms.");
+}
+
+StatisticsPublisher::~StatisticsPublisher()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        stop_ = true;
+    }
+    cv_.notify_all();
+
+    if (publish_thread_.joinable())
+    {
+        publish_thread_.join();
+    }
+
+    destroy_entities_();
+}
+
+void StatisticsPublisher::create_entities_()
+{
+    // Participant
+    fastrtps::rtps::RTPSParticipantAttributes participant_attributes;
+    participant_attributes.setName("DDS Router Statistics");
+
+    rtps_participant_ = fastrtps::rtps::RTPSDomain::createParticipant(
+        configuration_.domain,
+        participant_attributes);
+
+    if (!rtps_participant_)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error creating statistics RTPS Participant in domain " <<
+                      configuration_.domain);
+    }
+
+    // History
+    fastrtps::rtps::HistoryAttributes history_attributes;
+    history_attributes.memoryPolicy =
+            eprosima::fastrtps::rtps::MemoryManagementPolicy_t::PREALLOCATED_WITH_REALLOC_MEMORY_MODE;
+    history_attributes.payloadMaxSize = INITIAL_PAYLOAD_SIZE_;
+    history_attributes.initialReservedCaches = 1;
+    history_attributes.maximumReservedCaches = HISTORY_DEPTH_;
+
+    rtps_history_ = new fastrtps::rtps::WriterHistory(history_attributes);
+
+    // Writer
+    // Asynchronous, as full snapshots of routers with many topics may require fragmentation
+    fastrtps::rtps::WriterAttributes writer_attributes;
+    writer_attributes.endpoint.reliabilityKind = fastrtps::rtps::RELIABLE;
+    writer_attributes.endpoint.durabilityKind = fastrtps::rtps::VOLATILE;
+    writer_attributes.endpoint.topicKind = fastrtps::rtps::NO_KEY;
+    writer_attributes.mode = fastrtps::rtps::RTPSWriterPublishMode::ASYNCHRONOUS_WRITER;
+
+    rtps_writer_ = fastrtps::rtps::RTPSDomain::createRTPSWriter(
+        rtps_participant_,
+        writer_attributes,
+        rtps_history_);
+
+    if (!rtps_writer_)
+    {
+        destroy_entities_();
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error creating statistics RTPS Writer in domain " << configuration_.domain);
+    }
+
+    // Register writer with topic
+    fastrtps::TopicAttributes topic_attributes;
+    topic_attributes.topicKind = fastrtps::rtps::NO_KEY;
+    topic_attributes.topicName = configuration_.topic_name;
+    topic_attributes.topicDataType = TYPE_NAME;
+
+    fastrtps::WriterQos writer_qos;
+    writer_qos.m_reliability.kind = fastdds::dds::RELIABLE_RELIABILITY_QOS;
+    writer_qos.m_durability.kind = fastdds::dds::VOLATILE_DURABILITY_QOS;
+
+    if (!rtps_participant_->registerWriter(rtps_writer_, topic_attributes, writer_qos))
+    {
+        destroy_entities_();
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error registering statistics topic " << configuration_.topic_name);
+    }
+}
+
+void StatisticsPublisher::destroy_entities_() noexcept
+{
+    if (rtps_writer_)
+    {
+        fastrtps::rtps::RTPSDomain::removeRTPSWriter(rtps_writer_);
+        rtps_writer_ = nullptr;
+    }
+
+    if (rtps_history_)
+    {
+        delete rtps_history_;
+        rtps_history_ = nullptr;
+    }
+
+    if (rtps_participant_)
+    {
+        fastrtps::rtps::RTPSDomain::removeRTPSParticipant(rtps_participant_);
+        rtps_participant_ = nullptr;
+    }
+}
+
+void StatisticsPublisher::publish_routine_() noexcept
+{
+    std::chrono::steady_clock::time_point next_publication = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        next_publication += configuration_.period;
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (cv_.wait_until(
+                        lock,
+                        next_publication,
+                        [this]()
+                        {
+                            return stop_;
+                        }))
+            {
+                return;
+            }
+        }
+
+        publish_();
+    }
+}
+
+void StatisticsPublisher::publish_() noexcept
+{
+    uint64_t timestamp_ns = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::system_clock::now().time_since_epoch()).count());
+
+    StatisticsSample sample = encoder_.encode(statistics_source_(), timestamp_ns);
+
+    // Serialize in the buffer of previous publications, that only grows when a larger sample is published
+    eprosima::fastcdr::Cdr cdr(buffer_, eprosima::fastcdr::Cdr::DEFAULT_ENDIAN, eprosima::fastcdr::Cdr::DDS_CDR);
+
+    try
+    {
+        cdr.serialize_encapsulation();
+        serialize_(sample, cdr);
+    }
+    catch (const eprosima::fastcdr::exception::Exception& e)
+    {
+        logWarning(DDSROUTER_STATISTICS, "Error serializing statistics: " << e.what() << ". Skipping publication.");
+        return;
+    }
+
+    write_(static_cast<uint32_t>(cdr.getSerializedDataLength()));
+
+    logDebug(DDSROUTER_STATISTICS,
+            "Statistics " << sample.sequence_number << " published with " << sample.topics.size() << " of " <<
+            sample.topics_count << " topics.");
+}
+
+void StatisticsPublisher::write_(
+        uint32_t length) noexcept
+{
+    // Samples not acknowledged yet are discarded, as newer ones have already been taken into account
+    if (rtps_history_->isFull())
+    {
+        rtps_history_->remove_min_change();
+    }
+
+    fastrtps::rtps::CacheChange_t* change = rtps_writer_->new_change(
+        [length]()
+        {
+            return length;
+        },
+        fastrtps::rtps::ChangeKind_t::ALIVE);
+
+    if (!change)
+    {
+        logWarning(DDSROUTER_STATISTICS, "Error creating statistics change. Skipping publication.");
+        return;
+    }
+
+    // Encapsulation is already in the buffer
+    std::memcpy(change->serializedPayload.data, buffer_.getBuffer(), length);
+    change->serializedPayload.length = length;
+    change->serializedPayload.encapsulation =
+            eprosima::fastcdr::Cdr::DEFAULT_ENDIAN == eprosima::fastcdr::Cdr::BIG_ENDIANNESS ? CDR_BE : CDR_LE;
+
+    rtps_history_->add_change(change);
+}
+
+void StatisticsPublisher::serialize_(
+        const StatisticsSample& sample,
+        eprosima::fastcdr::Cdr& cdr)
+{
+    cdr << sample.sequence_number;
+    cdr << sample.full;
+    cdr << sample.timestamp_ns;
+    cdr << sample.interval_ns;
+    cdr << sample.topics_count;
+
+    cdr << static_cast<uint32_t>(sample.topics.size());
+    for (const TopicMetrics& topic : sample.topics)
+    {
+        cdr << topic.topic_name;
+        cdr << topic.type_name;
+        cdr << topic.samples_in;
+        cdr << topic.bytes_in;
+        cdr << topic.take_errors;
+        cdr << topic.samples_out;
+        cdr << topic.bytes_out;
+        cdr << topic.write_errors;
+        cdr << topic.dropped;
+        cdr << topic.latency.count;
+        cdr << topic.latency.mean_ns;
+        cdr << topic.latency.p50_ns;
+        cdr << topic.latency.p99_ns;
+        cdr << topic.latency.max_ns;
+    }
+
+    cdr << static_cast<uint32_t>(sample.participants.size());
+    for (const ParticipantMetrics& participant : sample.participants)
+    {
+        cdr << participant.participant_id;
+        cdr << participant.samples_in;
+        cdr << participant.bytes_in;
+        cdr << participant.samples_out;
+        cdr << participant.bytes_out;
+        cdr << participant.write_errors;
+    }
+
+    cdr << sample.payload_pool.reserved;
+    cdr << sample.payload_pool.released;
+    cdr << sample.payload_pool.in_use();
+
+    cdr << sample.thread_pool.threads;
+    cdr << sample.thread_pool.busy_tracks;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,136 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsPublisher.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_STATISTICS_STATISTICSPUBLISHER_HPP_
+#define __SRC_DDSROUTERCORE_STATISTICS_STATISTICSPUBLISHER_HPP_
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+
+#include <fastcdr/Cdr.h>
+#include <fastcdr/FastBuffer.h>
+#include <fastdds/rtps/rtps_fwd.h>
+#include <fastrtps/rtps/history/WriterHistory.h>
+
+#include <ddsrouter_core/configuration/StatisticsConfiguration.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+#include <statistics/StatisticsDeltaEncoder.hpp>
+#include <statistics/StatisticsSample.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Publishes periodically the statistics of a DDS Router in a DDS topic.
+ *
+ * It uses its own RTPS Participant and Writer, independent of the participants of the router, so the statistics
+ * are not forwarded by (nor interfere with) the Bridges.
+ * The type published is \c eprosima::ddsrouter::statistics::RouterStatistics in
+ * resources/idl/RouterStatistics.idl , delta encoded by a \c StatisticsDeltaEncoder .
+ */
+class StatisticsPublisher
+{
+public:
+
+    /**
+     * @brief Create the RTPS entities and start publishing
+     *
+     * @param [in] configuration : domain, topic and period of the publication
+     * @param [in] statistics_source : function that returns the current statistics of the router
+     *
+     * @throw \c InitializationException in case the RTPS entities cannot be created
+     */
+    StatisticsPublisher(
+            const configuration::StatisticsConfiguration& configuration,
+            std::function<types::RouterStatistics()> statistics_source);
+
+    //! Stop publishing and destroy the RTPS entities
+    ~StatisticsPublisher();
+
+    //! Name of the type published
+    static const char* TYPE_NAME;
+
+protected:
+
+    //! Create RTPS Participant, History and Writer
+    void create_entities_();
+
+    //! Destroy the RTPS entities already created
+    void destroy_entities_() noexcept;
+
+    //! Periodically call \c publish_ until the publisher is destroyed
+    void publish_routine_() noexcept;
+
+    //! Encode the current statistics and write them
+    void publish_() noexcept;
+
+    //! Write a sample already serialized in \c buffer_
+    void write_(
+            uint32_t length) noexcept;
+
+    //! Serialize \c sample as \c TYPE_NAME
+    static void serialize_(
+            const StatisticsSample& sample,
+            eprosima::fastcdr::Cdr& cdr);
+
+    //! Configuration of the publication
+    configuration::StatisticsConfiguration configuration_;
+
+    //! Source of the statistics
+    std::function<types::RouterStatistics()> statistics_source_;
+
+    //! Converts cumulative statistics into deltas
+    StatisticsDeltaEncoder encoder_;
+
+    //! Serialization buffer, reused (and grown when needed) in every publication
+    eprosima::fastcdr::FastBuffer buffer_;
+
+    fastrtps::rtps::RTPSParticipant* rtps_participant_;
+
+    fastrtps::rtps::RTPSWriter* rtps_writer_;
+
+    fastrtps::rtps::WriterHistory* rtps_history_;
+
+    //! Thread that publishes
+    std::thread publish_thread_;
+
+    //! Whether the publisher thread must stop
+    bool stop_;
+
+    //! Protects \c stop_
+    std::mutex mutex_;
+
+    //! Wakes up the publisher thread when stopping
+    std::condition_variable cv_;
+
+    //! Number of samples kept in the history for late reliable acknowledgements
+    static const int32_t HISTORY_DEPTH_;
+
+    //! Initial size of the payloads of the history (they are reallocated if larger ones are needed)
+    static const uint32_t INITIAL_PAYLOAD_SIZE_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_STATISTICS_STATISTICSPUBLISHER_HPP_ */
@@ -0,0 +1,118 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file StatisticsSample.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_STATISTICS_STATISTICSSAMPLE_HPP_
+#define __SRC_DDSROUTERCORE_STATISTICS_STATISTICSSAMPLE_HPP_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/*
+ * Data structs published by the \c StatisticsPublisher .
+ * They mirror type \c eprosima::ddsrouter::statistics::RouterStatistics in resources/idl/RouterStatistics.idl ,
+ * so any change here must be reflected in the IDL file and in the serialization of the publisher.
+ */
+
+//! Summary of the latencies of the samples written since the previous publication
+struct LatencyMetrics
+{
+    //! Number of latencies measured
+    uint64_t count = 0;
+
+    //! Mean latency in nanoseconds
+    uint64_t mean_ns = 0;
+
+    //! Approximate median latency in nanoseconds
+    uint64_t p50_ns = 0;
+
+    //! Approximate 99th percentile latency in nanoseconds
+    uint64_t p99_ns = 0;
+
+    //! Approximate maximum latency in nanoseconds
+    uint64_t max_ns = 0;
+};
+
+//! Data forwarded in a topic since the previous publication, adding up every Track
+struct TopicMetrics
+{
+    std::string topic_name;
+    std::string type_name;
+    uint64_t samples_in = 0;
+    uint64_t bytes_in = 0;
+    uint64_t take_errors = 0;
+    uint64_t samples_out = 0;
+    uint64_t bytes_out = 0;
+    uint64_t write_errors = 0;
+    uint64_t dropped = 0;
+    LatencyMetrics latency;
+};
+
+//! Data received and sent by a participant since the previous publication, adding up every topic
+struct ParticipantMetrics
+{
+    std::string participant_id;
+    uint64_t samples_in = 0;
+    uint64_t bytes_in = 0;
+    uint64_t samples_out = 0;
+    uint64_t bytes_out = 0;
+    uint64_t write_errors = 0;
+};
+
+//! Each publication of the \c StatisticsPublisher
+struct StatisticsSample
+{
+    //! Number of this publication, starting in 0
+    uint64_t sequence_number = 0;
+
+    //! Whether every topic and participant is present, or only those with activity
+    bool full = false;
+
+    //! Time of this publication in nanoseconds since epoch
+    uint64_t timestamp_ns = 0;
+
+    //! Time since the previous publication in nanoseconds (0 for the first one)
+    uint64_t interval_ns = 0;
+
+    //! Number of topics with a Bridge, whether they are present in \c topics or not
+    uint32_t topics_count = 0;
+
+    //! Topic metrics, ordered by topic
+    std::vector<TopicMetrics> topics;
+
+    //! Participant metrics, ordered by participant id
+    std::vector<ParticipantMetrics> participants;
+
+    //! Current usage of the payload pool (not a delta)
+    types::PayloadPoolStatistics payload_pool;
+
+    //! Current usage of the thread pool (not a delta)
+    types::ThreadPoolStatistics thread_pool;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_STATISTICS_STATISTICSSAMPLE_HPP_ */
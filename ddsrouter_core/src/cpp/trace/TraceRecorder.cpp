@@ -0,0 +1,315 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TraceRecorder.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+#include <trace/TraceRecorder.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace trace {
+
+constexpr uint64_t TraceBuffer::CAPACITY;
+
+//! Events possibly being overwritten while taking a snapshot, discarded as they could mix old and new values
+constexpr uint64_t SNAPSHOT_MARGIN = 64;
+
+//! Minimum time between the creation of the recorder and a dump to measure the frequency of the ticks
+constexpr std::chrono::milliseconds MINIMUM_CALIBRATION_TIME(10);
+
+const char* to_string(
+        TraceStage stage) noexcept
+{
+    switch (stage)
+    {
+        case TraceStage::track_data_available:
+            return "track_data_available";
+        case TraceStage::track_transmit:
+            return "track_transmit";
+        case TraceStage::track_forward:
+            return "track_forward";
+        case TraceStage::reader_take:
+            return "reader_take";
+        case TraceStage::payload_copy:
+            return "payload_copy";
+        case TraceStage::writer_write:
+            return "writer_write";
+        case TraceStage::rpc_data_available:
+            return "rpc_data_available";
+        case TraceStage::rpc_transmit:
+            return "rpc_transmit";
+        case TraceStage::rpc_requests:
+            return "rpc_requests";
+        case TraceStage::rpc_replies:
+            return "rpc_replies";
+        default:
+            return "unknown";
+    }
+}
+
+TraceBuffer::TraceBuffer(
+        uint32_t thread_index) noexcept
+    : head_(0)
+    , slots_(new Slot[CAPACITY])
+    , thread_index_(thread_index)
+{
+}
+
+std::vector<TraceBuffer::Event> TraceBuffer::snapshot() const noexcept
+{
+    const uint64_t end = head_.load(std::memory_order_acquire);
+    const uint64_t begin = end > CAPACITY ? end - CAPACITY : 0;
+
+    std::vector<Event> events;
+    events.reserve(static_cast<std::size_t>(end - begin));
+
+    for (uint64_t i = begin; i < end; ++i)
+    {
+        const Slot& slot = slots_[i & (CAPACITY - 1)];
+        const uint64_t meta = slot.meta.load(std::memory_order_relaxed);
+
+        Event event;
+        event.timestamp = slot.timestamp.load(std::memory_order_relaxed);
+        event.value = slot.value.load(std::memory_order_relaxed);
+        event.name = static_cast<uint32_t>(meta >> 32);
+        event.stage = static_cast<TraceStage>((meta >> 8) & 0xFFFF);
+        event.phase = static_cast<char>(meta & 0xFF);
+        events.push_back(event);
+    }
+
+    // Discard the oldest events if the owner thread could have overwritten them while copying
+    std::atomic_thread_fence(std::memory_order_acquire);
+    const uint64_t current_head = head_.load(std::memory_order_relaxed) + SNAPSHOT_MARGIN;
+    const uint64_t valid_begin = current_head > CAPACITY ? current_head - CAPACITY : 0;
+
+    if (valid_begin > begin)
+    {
+        const uint64_t overwritten = std::min<uint64_t>(valid_begin - begin, events.size());
+        events.erase(events.begin(), events.begin() + static_cast<std::ptrdiff_t>(overwritten));
+    }
+
+    return events;
+}
+
+uint32_t TraceBuffer::thread_index() const noexcept
+{
+    return thread_index_;
+}
+
+TraceRecorder::TraceRecorder() noexcept
+    : origin_ticks_(now())
+    , origin_time_(std::chrono::steady_clock::now())
+{
+}
+
+TraceRecorder& TraceRecorder::instance() noexcept
+{
+    // Never destroyed, as threads could still record while static objects are destroyed
+    static TraceRecorder* instance = new TraceRecorder();
+    return *instance;
+}
+
+TraceBuffer& TraceRecorder::thread_buffer() noexcept
+{
+    thread_local TraceBuffer* buffer = nullptr;
+
+    if (!buffer)
+    {
+        buffer = instance().new_buffer_();
+    }
+
+    return *buffer;
+}
+
+uint32_t TraceRecorder::register_name(
+        const std::string& name) noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    auto it = name_ids_.find(name);
+    if (it != name_ids_.end())
+    {
+        return it->second;
+    }
+
+    uint32_t id = static_cast<uint32_t>(names_.size());
+    names_.push_back(name);
+    name_ids_[name] = id;
+    return id;
+}
+
+void TraceRecorder::dump(
+        std::ostream& output) noexcept
+{
+    std::vector<std::pair<uint32_t, std::vector<TraceBuffer::Event>>> snapshots;
+    std::vector<std::string> names;
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        for (const auto& buffer : buffers_)
+        {
+            snapshots.emplace_back(buffer->thread_index(), buffer->snapshot());
+        }
+
+        names.reserve(names_.size());
+        for (const std::string& name : names_)
+        {
+            names.push_back(json_escape_(name));
+        }
+    }
+
+    const double ns_per_tick = nanoseconds_per_tick_();
+    char timestamp[32];
+
+    output << "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+    output << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":1,\"tid\":0,\"args\":{\"name\":\"DDS Router\"}}";
+
+    for (const auto& snapshot : snapshots)
+    {
+        const uint32_t tid = snapshot.first;
+
+        output << ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":" << tid <<
+            ",\"args\":{\"name\":\"thread " << tid << "\"}}";
+
+        // Ends whose begin has already been overwritten are skipped, so every span is well formed
+        unsigned int depth = 0;
+
+        for (const TraceBuffer::Event& event : snapshot.second)
+        {
+            if (event.phase == 'B')
+            {
+                ++depth;
+            }
+            else if (event.phase == 'E')
+            {
+                if (depth == 0)
+                {
+                    continue;
+                }
+                --depth;
+            }
+
+            // Timestamps in microseconds since the creation of the recorder
+            const int64_t ticks = static_cast<int64_t>(event.timestamp - origin_ticks_);
+            std::snprintf(timestamp, sizeof(timestamp), "%.3f", static_cast<double>(ticks) * ns_per_tick / 1000.0);
+
+            output << ",\n{\"name\":\"" << to_string(event.stage) << "\",\"cat\":\"ddsrouter\",\"ph\":\"" <<
+                event.phase << "\",\"ts\":" << timestamp << ",\"pid\":1,\"tid\":" << tid;
+
+            if (event.phase == 'i')
+            {
+                output << ",\"s\":\"t\"";
+            }
+
+            // Ends only carry the value, as their args are merged with those of their begin
+            output << ",\"args\":{";
+            if (event.phase != 'E')
+            {
+                output << "\"topic\":\"" << (event.name < names.size() ? names[event.name] : "") << "\"";
+            }
+            if (event.phase == 'i')
+            {
+                output << ",";
+            }
+            if (event.phase != 'B')
+            {
+                output << "\"value\":" << event.value;
+            }
+            output << "}}";
+        }
+    }
+
+    output << "\n]}\n";
+}
+
+bool TraceRecorder::dump(
+        const std::string& file_path) noexcept
+{
+    std::ofstream file(file_path, std::ios::out | std::ios::trunc);
+    if (!file.is_open())
+    {
+        return false;
+    }
+
+    dump(file);
+    file.close();
+    return !file.fail();
+}
+
+TraceBuffer* TraceRecorder::new_buffer_() noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    buffers_.push_back(std::make_unique<TraceBuffer>(static_cast<uint32_t>(buffers_.size() + 1)));
+    return buffers_.back().get();
+}
+
+double TraceRecorder::nanoseconds_per_tick_() const noexcept
+{
+    // Too short periods would give an inaccurate frequency
+    std::this_thread::sleep_until(origin_time_ + MINIMUM_CALIBRATION_TIME);
+
+    const uint64_t ticks = now() - origin_ticks_;
+    const auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - origin_time_);
+
+    if (ticks == 0)
+    {
+        return 1.0;
+    }
+
+    return static_cast<double>(elapsed.count()) / static_cast<double>(ticks);
+}
+
+std::string TraceRecorder::json_escape_(
+        const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+
+    for (char c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            result += '\\';
+            result += c;
+        }
+        else if (static_cast<unsigned char>(c) < 0x20)
+        {
+            char escaped[8];
+            std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+            result += escaped;
+        }
+        else
+        {
+            result += c;
+        }
+    }
+
+    return result;
+}
+
+} /* namespace trace */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
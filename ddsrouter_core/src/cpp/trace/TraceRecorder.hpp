@@ -0,0 +1,287 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file TraceRecorder.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_TRACE_TRACERECORDER_HPP_
+#define __SRC_DDSROUTERCORE_TRACE_TRACERECORDER_HPP_
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#elif defined(_M_X64) || defined(_M_IX86)
+#include <intrin.h>
+#endif // if defined(__x86_64__) || defined(__i386__)
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace trace {
+
+/**
+ * Stages of the forwarding of a sample that are traced.
+ *
+ * Spans have a begin and an end event, while notifications are a single instant event.
+ */
+enum class TraceStage : uint16_t
+{
+    track_data_available,   //!< Notification of new data in a Track (value: 1 if its task has been emitted)
+    track_transmit,         //!< Span of a Track task in a thread of the pool
+    track_forward,          //!< Span of a sample taken and written by a Track (value: payload size)
+    reader_take,            //!< Span of \c CommonReader::take_ (value: payload size)
+    payload_copy,           //!< Span of the copy of a received payload into the payload pool (value: payload size)
+    writer_write,           //!< Span of \c CommonWriter::write_ (value: payload size)
+    rpc_data_available,     //!< Notification of new data in a RPCBridge (value: 1 if its task has been emitted)
+    rpc_transmit,           //!< Span of a RPCBridge task in a thread of the pool
+    rpc_requests,           //!< Span of the forwarding of a batch of requests (value: number of requests)
+    rpc_replies,            //!< Span of the forwarding of a batch of replies (value: number of replies)
+};
+
+//! Name of each \c TraceStage in dumps
+const char* to_string(
+        TraceStage stage) noexcept;
+
+/**
+ * Ring buffer of trace events of a single thread.
+ *
+ * Only the owner thread records, without locks, overwriting the oldest events when full. Any thread can take a
+ * snapshot at any moment: events overwritten while copying them are discarded.
+ */
+class TraceBuffer
+{
+public:
+
+    //! Event as read from the buffer
+    struct Event
+    {
+        uint64_t timestamp;
+        uint64_t value;
+        uint32_t name;
+        TraceStage stage;
+        char phase;
+    };
+
+    TraceBuffer(
+            uint32_t thread_index) noexcept;
+
+    //! Record an event (only called from the owner thread)
+    void record(
+            uint64_t timestamp,
+            TraceStage stage,
+            char phase,
+            uint32_t name,
+            uint64_t value) noexcept
+    {
+        const uint64_t head = head_.load(std::memory_order_relaxed);
+        Slot& slot = slots_[head & (CAPACITY - 1)];
+
+        // Relaxed atomics are plain stores in most architectures, and keep concurrent snapshots well defined
+        slot.timestamp.store(timestamp, std::memory_order_relaxed);
+        slot.value.store(value, std::memory_order_relaxed);
+        slot.meta.store(
+            (static_cast<uint64_t>(name) << 32) |
+            (static_cast<uint64_t>(stage) << 8) |
+            static_cast<uint8_t>(phase),
+            std::memory_order_relaxed);
+
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    //! Events currently in the buffer, from oldest to newest
+    std::vector<Event> snapshot() const noexcept;
+
+    //! Index of the thread owning this buffer, in order of first event recorded
+    uint32_t thread_index() const noexcept;
+
+    //! Number of events kept by each buffer (power of 2)
+    static constexpr uint64_t CAPACITY = 1 << 16;
+
+protected:
+
+    struct Slot
+    {
+        std::atomic<uint64_t> timestamp;
+        std::atomic<uint64_t> value;
+        std::atomic<uint64_t> meta;
+    };
+
+    //! Number of events recorded since creation
+    std::atomic<uint64_t> head_;
+
+    std::unique_ptr<Slot[]> slots_;
+
+    uint32_t thread_index_;
+};
+
+/**
+ * Process wide recorder of the stages of every sample forwarded, with a \c TraceBuffer per thread.
+ *
+ * Events are only recorded if the library is compiled with the CMake option \c DDSROUTER_TRACE , through
+ * the \c DDSROUTER_TRACE_* macros below. Otherwise those macros are empty and nothing is ever recorded.
+ * Timestamps are taken from the time stamp counter of the CPU where available, and converted to time when dumped.
+ */
+class TraceRecorder
+{
+public:
+
+    //! Unique instance
+    static TraceRecorder& instance() noexcept;
+
+    //! Whether tracing has been compiled in
+    static constexpr bool enabled() noexcept
+    {
+#if defined(DDSROUTER_TRACE_ENABLED)
+        return true;
+#else
+        return false;
+#endif // if defined(DDSROUTER_TRACE_ENABLED)
+    }
+
+    //! Current timestamp in ticks
+    static uint64_t now() noexcept
+    {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::steady_clock::now().time_since_epoch().count());
+#endif // if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+    }
+
+    //! Buffer of the calling thread, created in its first call
+    static TraceBuffer& thread_buffer() noexcept;
+
+    //! Identifier of \c name in events, registered the first time (not intended for the data path)
+    uint32_t register_name(
+            const std::string& name) noexcept;
+
+    /**
+     * @brief Write every event recorded in Chrome trace event JSON format, that Perfetto UI also loads.
+     *
+     * Can be called while recording: only events recorded until the call are written.
+     */
+    void dump(
+            std::ostream& output) noexcept;
+
+    //! Dump into file \c file_path , returning whether it could be written
+    bool dump(
+            const std::string& file_path) noexcept;
+
+protected:
+
+    TraceRecorder() noexcept;
+
+    //! Create and register the buffer of a new thread
+    TraceBuffer* new_buffer_() noexcept;
+
+    //! Nanoseconds per tick, measured since the creation of the recorder
+    double nanoseconds_per_tick_() const noexcept;
+
+    //! Escape \c value to be written inside a JSON string
+    static std::string json_escape_(
+            const std::string& value);
+
+    //! Guards \c buffers_ , \c names_ and \c name_ids_
+    mutable std::mutex mutex_;
+
+    //! Buffers of every thread that has recorded, kept after the thread finishes so their events are dumped
+    std::vector<std::unique_ptr<TraceBuffer>> buffers_;
+
+    //! Names registered, indexed by identifier
+    std::vector<std::string> names_;
+
+    //! Identifier of each name registered
+    std::map<std::string, uint32_t> name_ids_;
+
+    //! Reference time and ticks to convert ticks into time
+    uint64_t origin_ticks_;
+    std::chrono::steady_clock::time_point origin_time_;
+};
+
+/**
+ * Records the begin of a span when created and its end when destroyed, so every return path closes it.
+ */
+class TraceScope
+{
+public:
+
+    TraceScope(
+            TraceStage stage,
+            uint32_t name) noexcept
+        : value(0)
+        , stage_(stage)
+        , name_(name)
+    {
+        TraceRecorder::thread_buffer().record(TraceRecorder::now(), stage_, 'B', name_, 0);
+    }
+
+    ~TraceScope()
+    {
+        TraceRecorder::thread_buffer().record(TraceRecorder::now(), stage_, 'E', name_, value);
+    }
+
+    //! Value recorded with the end of the span
+    uint64_t value;
+
+protected:
+
+    TraceStage stage_;
+    uint32_t name_;
+};
+
+} /* namespace trace */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#if defined(DDSROUTER_TRACE_ENABLED)
+
+//! Identifier of a name (e.g. a topic) for the events, to store in a member as it requires a lock
+#define DDSROUTER_TRACE_NAME(name) \
+    ::eprosima::ddsrouter::core::trace::TraceRecorder::instance().register_name(name)
+
+//! Span from this line to the end of the scope, whose end value is set with \c DDSROUTER_TRACE_SCOPE_VALUE
+#define DDSROUTER_TRACE_SCOPE(scope, stage, name) \
+    ::eprosima::ddsrouter::core::trace::TraceScope scope( \
+        ::eprosima::ddsrouter::core::trace::TraceStage::stage, name)
+
+#define DDSROUTER_TRACE_SCOPE_VALUE(scope, value_to_record) \
+    scope.value = static_cast<uint64_t>(value_to_record)
+
+//! Single instant event
+#define DDSROUTER_TRACE_INSTANT(stage, name, value_to_record) \
+    ::eprosima::ddsrouter::core::trace::TraceRecorder::thread_buffer().record( \
+        ::eprosima::ddsrouter::core::trace::TraceRecorder::now(), \
+        ::eprosima::ddsrouter::core::trace::TraceStage::stage, 'i', name, static_cast<uint64_t>(value_to_record))
+
+#else
+
+#define DDSROUTER_TRACE_NAME(name) 0u
+#define DDSROUTER_TRACE_SCOPE(scope, stage, name)
+#define DDSROUTER_TRACE_SCOPE_VALUE(scope, value_to_record)
+#define DDSROUTER_TRACE_INSTANT(stage, name, value_to_record)
+
+#endif // if defined(DDSROUTER_TRACE_ENABLED)
+
+#endif /* __SRC_DDSROUTERCORE_TRACE_TRACERECORDER_HPP_ */
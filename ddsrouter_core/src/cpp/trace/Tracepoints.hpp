@@ -0,0 +1,63 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file Tracepoints.hpp
+ *
+ * Static tracepoints (USDT) of the data and discovery paths, compiled in with CMake option
+ * \c DDSROUTER_TRACEPOINTS . Otherwise they are empty and their arguments are never evaluated.
+ *
+ * Every probe is in provider \c ddsrouter , so they can be listed and attached to from a running router, e.g.:
+ *
+ * \code
+ * bpftrace -l 'usdt:/path/to/libddsrouter_core.so:ddsrouter:*'
+ * perf buildid-cache --add /path/to/libddsrouter_core.so && perf list sdt_ddsrouter:*
+ * \endcode
+ *
+ * While nothing is attached a probe is a single \c nop , and the arguments of the data path probes are only pointers
+ * and integers already at hand, so they can be compiled in production routers.
+ * Probes and their arguments (strings are \c const \c char* ):
+ * - \c track_data_available : topic, 1 if a transmission task has been emitted
+ * - \c track_transmit_start , \c track_transmit_end : topic, samples taken and samples written by the Track since
+ *   it was created. Their increase from start to end are the samples taken and written in the transmission task
+ * - \c track_forward : topic, payload size, number of Writers that have written it
+ * - \c reader_take : topic, payload size, payload address (only for samples taken)
+ * - \c writer_write : topic, payload size
+ * - \c payload_reserve , \c payload_release : payload size, payload address. The pool is shared by every topic, so
+ *   the topic of a payload is the one of the \c reader_take with the same address
+ * - \c discovery_add , \c discovery_update , \c discovery_erase : topic, type, discoverer participant,
+ *   endpoint kind, number of endpoints in the database
+ * - \c bridge_requested : topic, type, Bridge constructions pending
+ * - \c bridge_constructed : topic, type, 1 if created, nanoseconds since it was requested
+ */
+
+#ifndef __SRC_DDSROUTERCORE_TRACE_TRACEPOINTS_HPP_
+#define __SRC_DDSROUTERCORE_TRACE_TRACEPOINTS_HPP_
+
+#if defined(DDSROUTER_TRACEPOINTS_ENABLED)
+
+// Required for the variadic STAP_PROBEV
+#define SDT_USE_VARIADIC 1
+#include <sys/sdt.h>
+
+//! Static tracepoint \c name of provider \c ddsrouter with 1 to 12 arguments
+#define DDSROUTER_TRACEPOINT(name, ...) STAP_PROBEV(ddsrouter, name, __VA_ARGS__)
+
+#else
+
+#define DDSROUTER_TRACEPOINT(name, ...)
+
+#endif // if defined(DDSROUTER_TRACEPOINTS_ENABLED)
+
+#endif /* __SRC_DDSROUTERCORE_TRACE_TRACEPOINTS_HPP_ */
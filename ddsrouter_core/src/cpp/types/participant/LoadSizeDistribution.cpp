@@ -0,0 +1,52 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadSizeDistribution.cpp
+ *
+ */
+
+#include <ddsrouter_core/types/participant/LoadSizeDistribution.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const LoadSizeDistribution& distribution)
+{
+    switch (distribution)
+    {
+        case LoadSizeDistribution::uniform:
+            os << "uniform";
+            break;
+
+        case LoadSizeDistribution::exponential:
+            os << "exponential";
+            break;
+
+        default:
+            os << "unknown";
+            break;
+    }
+
+    return os;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,141 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LatencyHistogram.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include <ddsrouter_core/types/statistics/LatencyHistogram.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+constexpr std::size_t LatencyHistogram::NUMBER_OF_BUCKETS;
+
+void LatencyHistogram::add(
+        const Duration& latency) noexcept
+{
+    // Negative latencies (e.g. clocks not synchronized) are counted as 0
+    Duration value = std::max(latency, Duration::zero());
+
+    buckets[bucket_index(value)]++;
+    count++;
+    total += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+}
+
+void LatencyHistogram::merge(
+        const LatencyHistogram& other) noexcept
+{
+    for (std::size_t i = 0; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        buckets[i] += other.buckets[i];
+    }
+    count += other.count;
+    total += other.total;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+}
+
+LatencyHistogram::Duration LatencyHistogram::mean() const noexcept
+{
+    if (count == 0)
+    {
+        return Duration::zero();
+    }
+    return total / count;
+}
+
+LatencyHistogram::Duration LatencyHistogram::percentile(
+        double percentile) const noexcept
+{
+    if (count == 0)
+    {
+        return Duration::zero();
+    }
+
+    percentile = std::min(std::max(percentile, 0.0), 1.0);
+
+    // Number of latencies that must be lower or equal than the result (at least 1)
+    uint64_t target = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(percentile * count)));
+
+    uint64_t accumulated = 0;
+    for (std::size_t i = 0; i < NUMBER_OF_BUCKETS; ++i)
+    {
+        accumulated += buckets[i];
+        if (accumulated >= target)
+        {
+            return std::min(std::max(bucket_upper_limit(i), min), max);
+        }
+    }
+
+    return max;
+}
+
+std::size_t LatencyHistogram::bucket_index(
+        const Duration& latency) noexcept
+{
+    uint64_t value = static_cast<uint64_t>(std::max(latency.count(), Duration::rep(0)));
+
+    // Position of the highest bit set
+    std::size_t index = 0;
+    while (value > 1)
+    {
+        value >>= 1;
+        ++index;
+    }
+
+    return std::min(index, NUMBER_OF_BUCKETS - 1);
+}
+
+LatencyHistogram::Duration LatencyHistogram::bucket_upper_limit(
+        std::size_t index) noexcept
+{
+    if (index >= NUMBER_OF_BUCKETS - 1)
+    {
+        return Duration::max();
+    }
+    return Duration(Duration::rep(1) << (index + 1));
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const LatencyHistogram& histogram)
+{
+    os << "LatencyHistogram{count:" << histogram.count;
+
+    if (histogram.count > 0)
+    {
+        os << ";min:" << histogram.min.count() << "ns"
+           << ";mean:" << histogram.mean().count() << "ns"
+           << ";p50:" << histogram.percentile(0.5).count() << "ns"
+           << ";p99:" << histogram.percentile(0.99).count() << "ns"
+           << ";max:" << histogram.max.count() << "ns";
+    }
+
+    os << "}";
+    return os;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,242 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RouterStatistics.cpp
+ *
+ */
+
+#include <algorithm>
+
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+void TrackStatistics::merge(
+        const TrackStatistics& other) noexcept
+{
+    samples_in += other.samples_in;
+    bytes_in += other.bytes_in;
+    take_errors += other.take_errors;
+    samples_out += other.samples_out;
+    bytes_out += other.bytes_out;
+    write_errors += other.write_errors;
+    dropped += other.dropped;
+    latency.merge(other.latency);
+    profiled_transmissions += other.profiled_transmissions;
+    cycles += other.cycles;
+    instructions += other.instructions;
+    cache_misses += other.cache_misses;
+    context_switches += other.context_switches;
+}
+
+void WriterStatistics::merge(
+        const WriterStatistics& other) noexcept
+{
+    samples += other.samples;
+    bytes += other.bytes;
+    write_errors += other.write_errors;
+    latency.merge(other.latency);
+}
+
+void MemoryStatistics::merge(
+        const MemoryStatistics& other) noexcept
+{
+    reader_history_changes += other.reader_history_changes;
+    reader_history_bytes += other.reader_history_bytes;
+    writer_history_changes += other.writer_history_changes;
+    writer_history_bytes += other.writer_history_bytes;
+    payloads += other.payloads;
+    payload_bytes += other.payload_bytes;
+    cache_change_pool_elements += other.cache_change_pool_elements;
+    cache_change_pool_reserved += other.cache_change_pool_reserved;
+    cache_change_bytes += other.cache_change_bytes;
+}
+
+uint64_t MemoryStatistics::bytes() const noexcept
+{
+    return payload_bytes + cache_change_bytes;
+}
+
+TrackStatistics TopicStatistics::total() const noexcept
+{
+    TrackStatistics result;
+    for (const auto& track : tracks)
+    {
+        result.merge(track.second);
+    }
+    return result;
+}
+
+uint64_t PayloadPoolStatistics::in_use() const noexcept
+{
+    return reserved > released ? reserved - released : 0;
+}
+
+TrackStatistics RouterStatistics::total() const noexcept
+{
+    TrackStatistics result;
+    for (const auto& topic : topics)
+    {
+        result.merge(topic.second.total());
+    }
+    return result;
+}
+
+std::vector<std::pair<DdsTopic, MemoryStatistics>> RouterStatistics::top_memory_topics(
+        std::size_t n) const
+{
+    std::vector<std::pair<DdsTopic, MemoryStatistics>> result;
+    result.reserve(topics.size());
+    for (const auto& topic : topics)
+    {
+        result.emplace_back(topic.first, topic.second.memory);
+    }
+
+    auto compare =
+            [](const std::pair<DdsTopic, MemoryStatistics>& a, const std::pair<DdsTopic, MemoryStatistics>& b)
+            {
+                return a.second.bytes() > b.second.bytes();
+            };
+
+    // Only the first n are sorted, as there may be thousands of topics
+    n = std::min(n, result.size());
+    std::partial_sort(result.begin(), result.begin() + n, result.end(), compare);
+    result.resize(n);
+
+    return result;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const TrackStatistics& statistics)
+{
+    os << "TrackStatistics{"
+       << "samples_in:" << statistics.samples_in
+       << ";bytes_in:" << statistics.bytes_in
+       << ";take_errors:" << statistics.take_errors
+       << ";samples_out:" << statistics.samples_out
+       << ";bytes_out:" << statistics.bytes_out
+       << ";write_errors:" << statistics.write_errors
+       << ";dropped:" << statistics.dropped
+       << ";latency:" << statistics.latency;
+
+    if (statistics.profiled_transmissions > 0)
+    {
+        os << ";profiled_transmissions:" << statistics.profiled_transmissions
+           << ";cycles:" << statistics.cycles
+           << ";instructions:" << statistics.instructions
+           << ";cache_misses:" << statistics.cache_misses
+           << ";context_switches:" << statistics.context_switches;
+    }
+
+    os << "}";
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const WriterStatistics& statistics)
+{
+    os << "WriterStatistics{"
+       << "samples:" << statistics.samples
+       << ";bytes:" << statistics.bytes
+       << ";write_errors:" << statistics.write_errors
+       << ";latency:" << statistics.latency
+       << "}";
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const MemoryStatistics& statistics)
+{
+    os << "MemoryStatistics{"
+       << "reader_history_changes:" << statistics.reader_history_changes
+       << ";reader_history_bytes:" << statistics.reader_history_bytes
+       << ";writer_history_changes:" << statistics.writer_history_changes
+       << ";writer_history_bytes:" << statistics.writer_history_bytes
+       << ";payloads:" << statistics.payloads
+       << ";payload_bytes:" << statistics.payload_bytes
+       << ";cache_change_pool_elements:" << statistics.cache_change_pool_elements
+       << ";cache_change_pool_reserved:" << statistics.cache_change_pool_reserved
+       << ";cache_change_bytes:" << statistics.cache_change_bytes
+       << "}";
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const TopicStatistics& statistics)
+{
+    os << "TopicStatistics{tracks:{";
+    for (const auto& track : statistics.tracks)
+    {
+        os << track.first << ":" << track.second << ";";
+    }
+    os << "};writers:{";
+    for (const auto& writer : statistics.writers)
+    {
+        os << writer.first << ":" << writer.second << ";";
+    }
+    os << "};memory:" << statistics.memory
+       << ";time_to_first_forward_ns:" << statistics.time_to_first_forward.count()
+       << "}";
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const PayloadPoolStatistics& statistics)
+{
+    os << "PayloadPoolStatistics{"
+       << "reserved:" << statistics.reserved
+       << ";released:" << statistics.released
+       << "}";
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const ThreadPoolStatistics& statistics)
+{
+    os << "ThreadPoolStatistics{"
+       << "threads:" << statistics.threads
+       << ";busy_tracks:" << statistics.busy_tracks
+       << "}";
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const RouterStatistics& statistics)
+{
+    os << "RouterStatistics{topics:{";
+    for (const auto& topic : statistics.topics)
+    {
+        os << topic.first << ":" << topic.second << ";";
+    }
+    os << "};payload_pool:" << statistics.payload_pool
+       << ";thread_pool:" << statistics.thread_pool
+       << "}";
+    return os;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
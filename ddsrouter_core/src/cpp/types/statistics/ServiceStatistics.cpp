@@ -0,0 +1,81 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file ServiceStatistics.cpp
+ *
+ */
+
+#include <ddsrouter_core/types/statistics/ServiceStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+void ServiceParticipantStatistics::merge(
+        const ServiceParticipantStatistics& other) noexcept
+{
+    requests += other.requests;
+    replies += other.replies;
+    orphan_replies += other.orphan_replies;
+    outstanding_requests += other.outstanding_requests;
+    timeouts += other.timeouts;
+    evictions += other.evictions;
+    round_trip_time.merge(other.round_trip_time);
+}
+
+ServiceParticipantStatistics ServiceStatistics::total() const noexcept
+{
+    ServiceParticipantStatistics result;
+    for (const auto& participant : participants)
+    {
+        result.merge(participant.second);
+    }
+    return result;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const ServiceParticipantStatistics& statistics)
+{
+    os << "ServiceParticipantStatistics{"
+       << "requests:" << statistics.requests
+       << ";replies:" << statistics.replies
+       << ";orphan_replies:" << statistics.orphan_replies
+       << ";outstanding:" << statistics.outstanding_requests
+       << ";timeouts:" << statistics.timeouts
+       << ";evictions:" << statistics.evictions
+       << ";rtt:" << statistics.round_trip_time
+       << "}";
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const ServiceStatistics& statistics)
+{
+    os << "ServiceStatistics{";
+    for (const auto& participant : statistics.participants)
+    {
+        os << participant.first << ":" << participant.second << ";";
+    }
+    os << "}";
+    return os;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,123 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RegexDdsFilterTopic.cpp
+ *
+ */
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/utils.hpp>
+
+#include <ddsrouter_core/types/topic/filter/RegexDdsFilterTopic.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+const std::regex::flag_type RegexDdsFilterTopic::REGEX_FLAGS = std::regex::ECMAScript | std::regex::optimize;
+
+RegexDdsFilterTopic::RegexDdsFilterTopic(
+        const std::string& topic_name,
+        const utils::Fuzzy<std::string>& type_name /* = utils::Fuzzy<std::string>() */)
+    : topic_name(topic_name)
+    , type_name(type_name)
+{
+    try
+    {
+        topic_name_regex_ = std::regex(topic_name, REGEX_FLAGS);
+
+        if (type_name.is_set())
+        {
+            type_name_regex_ = std::regex(type_name.get_reference(), REGEX_FLAGS);
+        }
+    }
+    catch (const std::regex_error& e)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Invalid regular expression in topic filter <" << topic_name << ";" <<
+                      type_name << ">: " << e.what());
+    }
+}
+
+bool RegexDdsFilterTopic::contains(
+        const DdsFilterTopic& other) const
+{
+    const RegexDdsFilterTopic* other_regex = dynamic_cast<const RegexDdsFilterTopic*>(&other);
+    if (!other_regex)
+    {
+        return false;
+    }
+
+    return *this == *other_regex;
+}
+
+bool RegexDdsFilterTopic::matches(
+        const DdsTopic& real_topic) const
+{
+    return matches_type_and_key(real_topic) && std::regex_match(real_topic.topic_name, topic_name_regex_);
+}
+
+bool RegexDdsFilterTopic::matches_type_and_key(
+        const DdsTopic& real_topic) const
+{
+    // Compare key
+    if (this->keyed.is_set())
+    {
+        if (this->keyed != real_topic.keyed)
+        {
+            return false;
+        }
+    }
+
+    // Compare type_name
+    if (this->type_name.is_set())
+    {
+        if (!std::regex_match(real_topic.type_name, type_name_regex_))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::ostream& RegexDdsFilterTopic::serialize(
+        std::ostream& os) const
+{
+    os << *this;
+    return os;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const RegexDdsFilterTopic& t)
+{
+    std::string keyed_str = t.keyed.is_set()
+        ? STR_ENTRY << ";keyed"
+        : STR_ENTRY << "";
+
+    std::string type_name_str = t.type_name.is_set()
+        ? STR_ENTRY << ";" << t.type_name
+        : STR_ENTRY << "";
+
+    os << "RegexDdsFilterTopic{" << t.topic_name << type_name_str << keyed_str << "}";
+    return os;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
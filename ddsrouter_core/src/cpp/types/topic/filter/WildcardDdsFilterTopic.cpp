@@ -17,6 +17,8 @@
  *
  */
 
+#include <vector>
+
 #include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 #include <cpp_utils/utils.hpp>
 
@@ -25,6 +27,70 @@ namespace ddsrouter {
 namespace core {
 namespace types {
 
+namespace {
+
+/**
+ * @brief Whether every string matched by wildcard \c pattern is also matched by wildcard \c container .
+ *
+ * Each symbol of \c pattern is consumed by \c container as if it were a character:
+ * a '*' in \c container consumes any sequence of symbols, a '?' consumes any symbol but '*',
+ * and a literal only consumes the same literal.
+ *
+ * Bracket expressions and escapes are not interpreted, so patterns using them only contain equal patterns.
+ */
+bool wildcard_pattern_contains(
+        const std::string& container,
+        const std::string& pattern) noexcept
+{
+    if (container.find_first_of("[\\") != std::string::npos || pattern.find_first_of("[\\") != std::string::npos)
+    {
+        return container == pattern;
+    }
+
+    // Fast paths: a container without wildcards only contains itself,
+    // and the literal prefix of the container must be a literal prefix of the pattern
+    std::size_t prefix_size = container.find_first_of("*?");
+    if (prefix_size == std::string::npos)
+    {
+        return container == pattern;
+    }
+    if (pattern.compare(0, prefix_size, container, 0, prefix_size) != 0 ||
+            pattern.find_first_of("*?") < prefix_size)
+    {
+        return false;
+    }
+
+    const std::size_t n = container.size();
+    const std::size_t m = pattern.size();
+
+    // contained[i][j] is true if container[i..] contains pattern[j..]
+    std::vector<std::vector<bool>> contained(n + 1, std::vector<bool>(m + 1, false));
+    contained[n][m] = true;
+
+    for (std::size_t i = n; i-- > 0;)
+    {
+        for (std::size_t j = m + 1; j-- > 0;)
+        {
+            if (container[i] == '*')
+            {
+                contained[i][j] = contained[i + 1][j] || (j < m && contained[i][j + 1]);
+            }
+            else if (container[i] == '?')
+            {
+                contained[i][j] = j < m && pattern[j] != '*' && contained[i + 1][j + 1];
+            }
+            else
+            {
+                contained[i][j] = j < m && pattern[j] == container[i] && contained[i + 1][j + 1];
+            }
+        }
+    }
+
+    return contained[0][0];
+}
+
+} /* namespace */
+
 WildcardDdsFilterTopic::WildcardDdsFilterTopic(
         const std::string topic_name /* = "*" */)
     : topic_name(topic_name)
@@ -34,9 +100,36 @@ WildcardDdsFilterTopic::WildcardDdsFilterTopic(
 bool WildcardDdsFilterTopic::contains(
         const DdsFilterTopic& other) const
 {
-    // TODO: implement
-    static_cast<void> (other);
-    return false;
+    // Only wildcard filters can be compared
+    const WildcardDdsFilterTopic* other_wildcard = dynamic_cast<const WildcardDdsFilterTopic*>(&other);
+    if (!other_wildcard)
+    {
+        return false;
+    }
+
+    // Compare key. If other does not set it, it filters both keyed and non keyed topics
+    if (this->keyed.is_set())
+    {
+        if (!other_wildcard->keyed.is_set() || this->keyed != other_wildcard->keyed)
+        {
+            return false;
+        }
+    }
+
+    // Compare type_name. Not set type name is equivalent to "*"
+    if (this->type_name.is_set())
+    {
+        const std::string other_type_name =
+                other_wildcard->type_name.is_set() ? other_wildcard->type_name.get_reference() : "*";
+
+        if (!wildcard_pattern_contains(this->type_name.get_reference(), other_type_name))
+        {
+            return false;
+        }
+    }
+
+    // Compare topic name
+    return wildcard_pattern_contains(this->topic_name, other_wildcard->topic_name);
 }
 
 bool WildcardDdsFilterTopic::matches(
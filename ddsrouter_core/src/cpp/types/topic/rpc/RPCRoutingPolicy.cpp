@@ -0,0 +1,60 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RPCRoutingPolicy.cpp
+ *
+ */
+
+#include <ddsrouter_core/types/topic/rpc/RPCRoutingPolicy.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+namespace types {
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const RPCRoutingPolicy& policy)
+{
+    switch (policy)
+    {
+        case RPCRoutingPolicy::broadcast:
+            os << "broadcast";
+            break;
+
+        case RPCRoutingPolicy::round_robin:
+            os << "round-robin";
+            break;
+
+        case RPCRoutingPolicy::least_outstanding:
+            os << "least-outstanding";
+            break;
+
+        case RPCRoutingPolicy::hash_by_client:
+            os << "hash-by-client";
+            break;
+
+        default:
+            os << "unknown";
+            break;
+    }
+
+    return os;
+}
+
+} /* namespace types */
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -19,9 +19,12 @@
 #ifndef __SRC_DDSROUTERCORE_WRITER_IDDS_ROUTERWRITER_HPP_
 #define __SRC_DDSROUTERCORE_WRITER_IDDS_ROUTERWRITER_HPP_
 
+#include <unordered_set>
+
 #include <cpp_utils/ReturnCode.hpp>
 
 #include <ddsrouter_core/types/dds/Data.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
 #include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
 
 #include <efficiency/payload/PayloadPool.hpp>
@@ -81,6 +84,23 @@ public:
      */
     virtual utils::ReturnCode write(
             std::unique_ptr<types::DataReceived>& data) noexcept = 0;
+
+    /**
+     * @brief Add the memory held by the Writer to \c statistics : the cache changes in its history and the payloads
+     * they reference.
+     *
+     * Only the \c writer_history_* , payload and cache change fields are modified, so the same \c statistics can be
+     * passed to every endpoint of the topic.
+     *
+     * @param [in,out] statistics memory statistics of the topic
+     * @param [in,out] counted_payloads data of the payloads already counted in \c statistics , so a payload shared
+     * with other endpoints is only added once to \c payload_bytes
+     *
+     * @note It may lock the endpoint and iterate its whole history, so it must not be called periodically.
+     */
+    virtual void add_memory_statistics(
+            types::MemoryStatistics& statistics,
+            std::unordered_set<const void*>& counted_payloads) const noexcept = 0;
 };
 
 } /* namespace core */
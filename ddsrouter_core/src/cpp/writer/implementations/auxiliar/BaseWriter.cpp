@@ -83,6 +83,13 @@ utils::ReturnCode BaseWriter::write(
     }
 }
 
+void BaseWriter::add_memory_statistics(
+        MemoryStatistics&,
+        std::unordered_set<const void*>&) const noexcept
+{
+    // It does nothing. Override this method so it has functionality.
+}
+
 void BaseWriter::enable_() noexcept
 {
     // It does nothing. Override this method so it has functionality.
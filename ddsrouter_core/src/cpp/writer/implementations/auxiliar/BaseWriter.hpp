@@ -87,6 +87,15 @@ public:
     virtual utils::ReturnCode write(
             std::unique_ptr<types::DataReceived>& data) noexcept override;
 
+    /**
+     * @brief Override add_memory_statistics() IWriter method
+     *
+     * Add no memory held. Override this method in Writers with a history.
+     */
+    virtual void add_memory_statistics(
+            types::MemoryStatistics& statistics,
+            std::unordered_set<const void*>& counted_payloads) const noexcept override;
+
 protected:
 
     /**
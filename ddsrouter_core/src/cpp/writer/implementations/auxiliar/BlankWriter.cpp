@@ -38,6 +38,12 @@ utils::ReturnCode BlankWriter::write(
     return utils::ReturnCode::RETCODE_OK;
 }
 
+void BlankWriter::add_memory_statistics(
+        MemoryStatistics&,
+        std::unordered_set<const void*>&) const noexcept
+{
+}
+
 } /* namespace core */
 } /* namespace ddsrouter */
 } /* namespace eprosima */
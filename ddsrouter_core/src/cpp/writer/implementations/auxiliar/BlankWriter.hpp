@@ -42,6 +42,11 @@ public:
     //! Override write() IWriter method
     utils::ReturnCode write(
             std::unique_ptr<types::DataReceived>& data) noexcept override;
+
+    //! Override add_memory_statistics() IWriter method
+    void add_memory_statistics(
+            types::MemoryStatistics& statistics,
+            std::unordered_set<const void*>& counted_payloads) const noexcept override;
 };
 
 } /* namespace core */
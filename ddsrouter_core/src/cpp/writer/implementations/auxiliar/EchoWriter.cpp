@@ -16,6 +16,8 @@
  * @file EchoWriter.cpp
  */
 
+#include <chrono>
+
 #include <cpp_utils/Log.hpp>
 
 #include <writer/implementations/auxiliar/EchoWriter.hpp>
@@ -28,19 +30,106 @@ using namespace eprosima::ddsrouter::core::types;
 
 EchoWriter::EchoWriter(
         const types::DdsTopic& topic,
-        bool verbose)
+        bool verbose,
+        bool statistics /* = false */)
     : topic_(topic)
     , verbose_(verbose)
+    , statistics_(statistics)
+    , samples_(0)
+    , bytes_(0)
+    , jitter_sum_(0)
+    , jitter_count_(0)
+    , latency_sum_(0)
+    , latency_count_(0)
+    , latency_max_(0)
+    , last_arrival_(0)
+    , last_interarrival_(-1)
 {
     logDebug(
         DDSROUTER_BASEWRITER,
         "Creating Echo Writer with verbose: " <<
-            (verbose_ ? "active" : "inactive") << ".");
+            (verbose_ ? "active" : "inactive") <<
+            " and statistics: " <<
+            (statistics_ ? "active" : "inactive") << ".");
+}
+
+const DdsTopic& EchoWriter::topic() const noexcept
+{
+    return topic_;
+}
+
+EchoStatistics EchoWriter::take_statistics() noexcept
+{
+    EchoStatistics result;
+    result.samples = samples_.exchange(0, std::memory_order_relaxed);
+    result.bytes = bytes_.exchange(0, std::memory_order_relaxed);
+    result.jitter_sum = jitter_sum_.exchange(0, std::memory_order_relaxed);
+    result.jitter_count = jitter_count_.exchange(0, std::memory_order_relaxed);
+    result.latency_sum = latency_sum_.exchange(0, std::memory_order_relaxed);
+    result.latency_count = latency_count_.exchange(0, std::memory_order_relaxed);
+    result.latency_max = latency_max_.exchange(0, std::memory_order_relaxed);
+    return result;
+}
+
+void EchoWriter::aggregate_statistics_(
+        const DataReceived& data) noexcept
+{
+    samples_.fetch_add(1, std::memory_order_relaxed);
+    bytes_.fetch_add(data.payload.length, std::memory_order_relaxed);
+
+    // Inter-arrival jitter: difference between consecutive inter-arrival times
+    int64_t arrival = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+    int64_t last_arrival = last_arrival_.load(std::memory_order_relaxed);
+    while (arrival >= last_arrival &&
+            !last_arrival_.compare_exchange_weak(last_arrival, arrival, std::memory_order_relaxed))
+    {
+        // last_arrival has been updated with the current value, try again
+    }
+
+    // If another track has stored a later arrival meanwhile, the inter-arrival would be negative: skip it
+    if (last_arrival != 0 && arrival >= last_arrival)
+    {
+        int64_t interarrival = arrival - last_arrival;
+        int64_t last_interarrival = last_interarrival_.exchange(interarrival, std::memory_order_relaxed);
+        if (last_interarrival >= 0)
+        {
+            int64_t difference = interarrival - last_interarrival;
+            jitter_sum_.fetch_add(
+                static_cast<uint64_t>(difference >= 0 ? difference : -difference),
+                std::memory_order_relaxed);
+            jitter_count_.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    // Latency since the sample was published. Only meaningful if clocks are synchronized.
+    DataTime now;
+    DataTime::now(now);
+    int64_t latency = now.to_ns() - data.properties.source_timestamp.to_ns();
+    if (latency >= 0)
+    {
+        latency_sum_.fetch_add(static_cast<uint64_t>(latency), std::memory_order_relaxed);
+        latency_count_.fetch_add(1, std::memory_order_relaxed);
+
+        uint64_t latency_max = latency_max_.load(std::memory_order_relaxed);
+        while (static_cast<uint64_t>(latency) > latency_max &&
+                !latency_max_.compare_exchange_weak(latency_max, static_cast<uint64_t>(latency),
+                std::memory_order_relaxed))
+        {
+            // latency_max has been updated with the current value, try again
+        }
+    }
 }
 
 utils::ReturnCode EchoWriter::write(
         std::unique_ptr<DataReceived>& data) noexcept
 {
+    if (statistics_)
+    {
+        aggregate_statistics_(*data);
+        return utils::ReturnCode::RETCODE_OK;
+    }
+
     // TODO: Add Participant receiver Id when added to DataReceived
     if (!verbose_)
     {
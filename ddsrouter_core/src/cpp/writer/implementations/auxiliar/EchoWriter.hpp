@@ -20,6 +20,7 @@
 #define __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_ECHOWRITER_HPP_
 
 #include <atomic>
+#include <cstdint>
 
 #include <ddsrouter_core/types/participant/ParticipantId.hpp>
 
@@ -29,8 +30,39 @@ namespace eprosima {
 namespace ddsrouter {
 namespace core {
 
+/**
+ * Statistics of the data received by an \c EchoWriter since the last time they were taken.
+ */
+struct EchoStatistics
+{
+    //! Number of samples received
+    uint64_t samples = 0;
+
+    //! Bytes of payload received
+    uint64_t bytes = 0;
+
+    //! Sum of the differences between consecutive inter-arrival times, in nanoseconds
+    uint64_t jitter_sum = 0;
+
+    //! Number of inter-arrival time differences added in \c jitter_sum
+    uint64_t jitter_count = 0;
+
+    //! Sum of the latencies from source timestamp to reception, in nanoseconds
+    uint64_t latency_sum = 0;
+
+    //! Number of latencies added in \c latency_sum
+    uint64_t latency_count = 0;
+
+    //! Maximum latency from source timestamp to reception, in nanoseconds
+    uint64_t latency_max = 0;
+};
+
 /**
  * Writer Implementation that prints in stdout every message that is required to write.
+ *
+ * In statistics mode nothing is printed per sample. Instead, the number of samples and bytes received,
+ * the inter-arrival jitter and the latency since the source timestamp are aggregated in lock-free counters,
+ * that the Participant takes periodically with \c take_statistics .
  */
 class EchoWriter : public BlankWriter
 {
@@ -39,7 +71,19 @@ public:
     //! Using parent class constructors
     EchoWriter(
             const types::DdsTopic& topic,
-            bool verbose);
+            bool verbose,
+            bool statistics = false);
+
+    //! Topic that this Writer refers to
+    const types::DdsTopic& topic() const noexcept;
+
+    /**
+     * @brief Get the statistics aggregated since the last call and reset them.
+     *
+     * Counters are reset one by one, so a sample received while taking them may be split between
+     * two consecutive results, but it is never lost.
+     */
+    EchoStatistics take_statistics() noexcept;
 
 protected:
 
@@ -55,8 +99,30 @@ protected:
     //! Topic that this Writer refers to
     types::DdsTopic topic_;
 
+    //! Aggregate \c data in the statistics counters
+    void aggregate_statistics_(
+            const types::DataReceived& data) noexcept;
+
     // Specific enable/disable do not need to be implemented
     bool verbose_;
+
+    //! Whether only statistics are aggregated instead of printing each sample
+    bool statistics_;
+
+    //! Statistics counters. Each one is updated independently with relaxed ordering.
+    std::atomic<uint64_t> samples_;
+    std::atomic<uint64_t> bytes_;
+    std::atomic<uint64_t> jitter_sum_;
+    std::atomic<uint64_t> jitter_count_;
+    std::atomic<uint64_t> latency_sum_;
+    std::atomic<uint64_t> latency_count_;
+    std::atomic<uint64_t> latency_max_;
+
+    //! Latest arrival time of a sample, in nanoseconds of a steady clock (0 if none yet). It never goes back.
+    std::atomic<int64_t> last_arrival_;
+
+    //! Time between the last two arrivals, in nanoseconds (-1 if less than two samples yet)
+    std::atomic<int64_t> last_interarrival_;
 };
 
 } /* namespace core */
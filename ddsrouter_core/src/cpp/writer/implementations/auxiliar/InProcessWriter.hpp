@@ -0,0 +1,75 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file InProcessWriter.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_INPROCESSWRITER_HPP_
+#define __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_INPROCESSWRITER_HPP_
+
+#include <ddsrouter_core/core/InProcessConnector.hpp>
+
+#include <writer/implementations/auxiliar/BaseWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer implementation that gives the samples forwarded by the router to the host application through an
+ * \c InProcessConnector .
+ *
+ * The application receives a reference to the sample in the router \c PayloadPool , so nothing is copied.
+ */
+class InProcessWriter : public BaseWriter
+{
+public:
+
+    /**
+     * @brief Construct a new In Process Writer object
+     *
+     * @param participant_id id of participant
+     * @param topic topic that this Writer will refer to
+     * @param payload_pool DDS Router shared PayloadPool
+     * @param connector connector of the application to give the data to
+     */
+    InProcessWriter(
+            const types::ParticipantId& participant_id,
+            const types::DdsTopic& topic,
+            std::shared_ptr<PayloadPool> payload_pool,
+            std::shared_ptr<InProcessConnector> connector);
+
+protected:
+
+    /**
+     * @brief Write specific method
+     *
+     * Call the data callback of the connector with \c data .
+     *
+     * @param data : sample to give to the application
+     * @return \c RETCODE_OK always
+     */
+    utils::ReturnCode write_(
+            std::unique_ptr<types::DataReceived>& data) noexcept override;
+
+    //! Connector of the application
+    std::shared_ptr<InProcessConnector> connector_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_INPROCESSWRITER_HPP_ */
@@ -0,0 +1,80 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadGeneratorWriter.cpp
+ */
+
+#include <cstring>
+
+#include <writer/implementations/auxiliar/LoadGeneratorWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+LoadStatistics LoadGeneratorWriter::take_statistics() noexcept
+{
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+    LoadStatistics result = statistics_;
+    statistics_ = LoadStatistics();
+    return result;
+}
+
+utils::ReturnCode LoadGeneratorWriter::write_(
+        std::unique_ptr<DataReceived>& data) noexcept
+{
+    DataTime now;
+    DataTime::now(now);
+    int64_t latency = now.to_ns() - data->properties.source_timestamp.to_ns();
+
+    // Read the header out of the lock. Samples from other sources are only counted.
+    LoadSampleHeader header{};
+    if (data->payload.length >= LOAD_SAMPLE_ENCAPSULATION_SIZE + sizeof(LoadSampleHeader))
+    {
+        std::memcpy(&header, data->payload.data + LOAD_SAMPLE_ENCAPSULATION_SIZE, sizeof(header));
+    }
+
+    std::lock_guard<std::mutex> lock(statistics_mutex_);
+
+    ++statistics_.samples;
+    statistics_.bytes += data->payload.length;
+    if (latency >= 0)
+    {
+        statistics_.latency.add(std::chrono::nanoseconds(latency));
+    }
+
+    if (header.magic == LOAD_SAMPLE_MAGIC)
+    {
+        auto it = next_sequence_numbers_.find(data->properties.source_guid);
+        if (it == next_sequence_numbers_.end())
+        {
+            // Samples generated before the first one received are not considered lost
+            next_sequence_numbers_[data->properties.source_guid] = header.sequence_number + 1;
+        }
+        else if (header.sequence_number >= it->second)
+        {
+            statistics_.lost += header.sequence_number - it->second;
+            it->second = header.sequence_number + 1;
+        }
+    }
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
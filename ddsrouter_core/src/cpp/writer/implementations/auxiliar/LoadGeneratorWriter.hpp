@@ -0,0 +1,77 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file LoadGeneratorWriter.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_LOADGENERATORWRITER_HPP_
+#define __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_LOADGENERATORWRITER_HPP_
+
+#include <map>
+#include <mutex>
+
+#include <ddsrouter_core/types/dds/Guid.hpp>
+
+#include <participant/implementations/auxiliar/LoadSample.hpp>
+#include <writer/implementations/auxiliar/BaseWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer implementation that measures the samples forwarded by the router instead of sending them.
+ *
+ * It counts samples and bytes, the latency from their source timestamp, and the samples lost from each
+ * \c LoadGeneratorParticipant source, detected as gaps in the sequence numbers of \c LoadSampleHeader .
+ */
+class LoadGeneratorWriter : public BaseWriter
+{
+public:
+
+    //! Use parent constructors
+    using BaseWriter::BaseWriter;
+
+    //! Statistics since the last call, reset afterwards
+    LoadStatistics take_statistics() noexcept;
+
+protected:
+
+    /**
+     * @brief Write specific method
+     *
+     * Add \c data to the statistics.
+     *
+     * @param data : sample received
+     * @return \c RETCODE_OK always
+     */
+    utils::ReturnCode write_(
+            std::unique_ptr<types::DataReceived>& data) noexcept override;
+
+    //! Statistics since the last \c take_statistics
+    LoadStatistics statistics_;
+
+    //! Next sequence number expected from each generator
+    std::map<types::Guid, uint64_t> next_sequence_numbers_;
+
+    //! Guard \c statistics_ and \c next_sequence_numbers_ (samples may arrive from several Tracks)
+    std::mutex statistics_mutex_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_LOADGENERATORWRITER_HPP_ */
@@ -0,0 +1,49 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderWriter.cpp
+ */
+
+#include <writer/implementations/auxiliar/RecorderWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+using namespace eprosima::ddsrouter::core::types;
+
+RecorderWriter::RecorderWriter(
+        const ParticipantId& participant_id,
+        const DdsTopic& topic,
+        std::shared_ptr<PayloadPool> payload_pool,
+        std::shared_ptr<capture::CaptureWriter> capture_writer)
+    : BaseWriter(participant_id, topic, payload_pool)
+    , capture_writer_(capture_writer)
+    , topic_id_(capture_writer_->register_topic(topic))
+{
+}
+
+utils::ReturnCode RecorderWriter::write_(
+        std::unique_ptr<DataReceived>& data) noexcept
+{
+    // The Track releases the payload afterwards, the capture writer retains its own reference
+    capture_writer_->write_data(topic_id_, *data);
+
+    return utils::ReturnCode::RETCODE_OK;
+}
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,79 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file RecorderWriter.hpp
+ */
+
+#ifndef __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_RECORDERWRITER_HPP_
+#define __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_RECORDERWRITER_HPP_
+
+#include <capture/CaptureWriter.hpp>
+#include <writer/implementations/auxiliar/BaseWriter.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace core {
+
+/**
+ * Writer implementation that queues the samples forwarded by the router to be written in a capture file.
+ *
+ * The payload is retained in the router \c PayloadPool instead of copied, and written in the file by the
+ * thread of the \c CaptureWriter , so the Track thread is never blocked by the file.
+ */
+class RecorderWriter : public BaseWriter
+{
+public:
+
+    /**
+     * @brief Construct a new Recorder Writer object and register its topic in the capture file
+     *
+     * @param participant_id id of participant
+     * @param topic topic that this Writer will refer to
+     * @param payload_pool DDS Router shared PayloadPool
+     * @param capture_writer capture file to write the samples in
+     */
+    RecorderWriter(
+            const types::ParticipantId& participant_id,
+            const types::DdsTopic& topic,
+            std::shared_ptr<PayloadPool> payload_pool,
+            std::shared_ptr<capture::CaptureWriter> capture_writer);
+
+protected:
+
+    /**
+     * @brief Write specific method
+     *
+     * Queue \c data in the capture file.
+     * Samples dropped because the file cannot keep up are counted by the \c CaptureWriter and not reported
+     * as errors, so an overloaded recorder does not flood the log of the Track.
+     *
+     * @param data : sample to record
+     * @return \c RETCODE_OK always
+     */
+    utils::ReturnCode write_(
+            std::unique_ptr<types::DataReceived>& data) noexcept override;
+
+    //! Capture file
+    std::shared_ptr<capture::CaptureWriter> capture_writer_;
+
+    //! Id of the topic in the capture file
+    uint32_t topic_id_;
+};
+
+} /* namespace core */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* __SRC_DDSROUTERCORE_WRITER_IMPLEMENTATIONS_AUXILIAR_RECORDERWRITER_HPP_ */
@@ -23,6 +23,8 @@
 #include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/Log.hpp>
 #include <efficiency/cache_change/CacheChangePool.hpp>
+#include <trace/TraceRecorder.hpp>
+#include <trace/Tracepoints.hpp>
 #include <writer/implementations/rtps/CommonWriter.hpp>
 #include <writer/implementations/rtps/filter/RepeaterDataFilter.hpp>
 #include <writer/implementations/rtps/filter/SelfDataFilter.hpp>
@@ -54,6 +56,7 @@ CommonWriter::CommonWriter(
     , topic_attributes_(topic_attributes)
     , writer_qos_(writer_qos)
     , pool_configuration_(pool_configuration)
+    , trace_name_(DDSROUTER_TRACE_NAME(topic.topic_name))
 {
     // Do nothing
 }
@@ -111,6 +114,47 @@ void CommonWriter::onWriterMatched(
     }
 }
 
+void CommonWriter::add_memory_statistics(
+        MemoryStatistics& statistics,
+        std::unordered_set<const void*>& counted_payloads) const noexcept
+{
+    uint64_t changes = 0;
+
+    {
+        std::lock_guard<fastrtps::RecursiveTimedMutex> rtps_lock(rtps_writer_->getMutex());
+
+        for (auto change_it = rtps_history_->changesBegin(); change_it != rtps_history_->changesEnd(); ++change_it)
+        {
+            const Payload& payload = (*change_it)->serializedPayload;
+            statistics.writer_history_bytes += payload.length;
+
+            // Payloads are shared with the Reader and the rest of Writers of the topic, so they are only counted once
+            if (counted_payloads.insert(payload.data).second)
+            {
+                statistics.payloads++;
+                statistics.payload_bytes += payload.length;
+            }
+        }
+
+        changes = rtps_history_->getHistorySize();
+    }
+
+    statistics.writer_history_changes += changes;
+
+    if (cache_change_pool_)
+    {
+        // Changes in the History are reserved from the pool, so they are already counted in its elements
+        uint64_t elements = cache_change_pool_->elements();
+        statistics.cache_change_pool_elements += elements;
+        statistics.cache_change_pool_reserved += cache_change_pool_->reserved();
+        statistics.cache_change_bytes += elements * sizeof(types::RouterCacheChange);
+    }
+    else
+    {
+        statistics.cache_change_bytes += changes * sizeof(fastrtps::rtps::CacheChange_t);
+    }
+}
+
 bool CommonWriter::come_from_this_participant_(
         const fastrtps::rtps::GUID_t guid) const noexcept
 {
@@ -121,6 +165,8 @@ bool CommonWriter::come_from_this_participant_(
 utils::ReturnCode CommonWriter::write_(
         std::unique_ptr<DataReceived>& data) noexcept
 {
+    DDSROUTER_TRACE_SCOPE(write_trace, writer_write, trace_name_);
+    DDSROUTER_TRACE_SCOPE_VALUE(write_trace, data->payload.length);
 
     // Take new Change from history
     fastrtps::rtps::CacheChange_t* new_change;
@@ -175,6 +221,8 @@ utils::ReturnCode CommonWriter::write_(
         rtps_history_->remove_min_change();
     }
 
+    DDSROUTER_TRACEPOINT(writer_write, topic_.topic_name.c_str(), data->payload.length);
+
     return utils::ReturnCode::RETCODE_OK;
 }
 
@@ -251,11 +299,13 @@ void CommonWriter::internal_entities_creation_(
     {
         logDebug(DDSROUTER_RTPS_COMMONWRITER, "CommonWriter created with repeater filter");
 
+        cache_change_pool_ = std::make_shared<CacheChangePool>(pool_configuration);
+
         rtps_writer_ = fastrtps::rtps::RTPSDomain::createRTPSWriter(
             rtps_participant_,
             non_const_writer_attributes,
             payload_pool_,
-            std::make_shared<CacheChangePool>(pool_configuration),
+            cache_change_pool_,
             rtps_history_,
             this);
     }
@@ -104,6 +104,18 @@ public:
             fastrtps::rtps::RTPSWriter*,
             fastrtps::rtps::MatchingInfo& info) noexcept override;
 
+    /**
+     * @brief Override add_memory_statistics() IWriter method
+     *
+     * Add up the changes of the internal RTPS writer History, the payloads they reference and the cache changes
+     * allocated by the CacheChangePool (if repeater).
+     *
+     * Thread safe with the internal RTPS writer mutex, that is taken while iterating the History.
+     */
+    void add_memory_statistics(
+            types::MemoryStatistics& statistics,
+            std::unordered_set<const void*>& counted_payloads) const noexcept override;
+
 protected:
 
     /**
@@ -233,6 +245,9 @@ protected:
     //! RTPS CommonWriter History associated to \c rtps_reader_
     fastrtps::rtps::WriterHistory* rtps_history_;
 
+    //! Pool of the cache changes of \c rtps_writer_ (only if repeater, otherwise the RTPS writer uses its own)
+    std::shared_ptr<CacheChangePool> cache_change_pool_;
+
     //! Data Filter used to filter cache changes at the RTPSWriter level.
     std::unique_ptr<fastdds::rtps::IReaderDataFilter> data_filter_;
 
@@ -250,6 +265,9 @@ protected:
 
     //! Pool Configuration to create the internal History.
     utils::PoolConfiguration pool_configuration_;
+
+    //! Identifier of the topic in trace events (only used if tracing is compiled in)
+    uint32_t trace_name_;
 };
 
 } /* namespace rtps */
@@ -65,6 +65,17 @@ MultiWriter::~MultiWriter()
             participant_id_ << " for topic " << topic_);
 }
 
+void MultiWriter::add_memory_statistics(
+        MemoryStatistics& statistics,
+        std::unordered_set<const void*>& counted_payloads) const noexcept
+{
+    std::shared_lock<WritersMapType> lock(writers_map_);
+    for (const auto& writer : writers_map_)
+    {
+        writer.second->add_memory_statistics(statistics, counted_payloads);
+    }
+}
+
 void MultiWriter::enable_() noexcept
 {
     std::shared_lock<WritersMapType> lock(writers_map_);
@@ -69,6 +69,11 @@ public:
      */
     virtual ~MultiWriter();
 
+    //! Override add_memory_statistics() IWriter method, adding up every internal Writer
+    void add_memory_statistics(
+            types::MemoryStatistics& statistics,
+            std::unordered_set<const void*>& counted_payloads) const noexcept override;
+
 protected:
 
     // Specific enable/disable.
@@ -106,8 +111,8 @@ protected:
     // TODO: This could be an unordered_map avoiding the use of operator< with SpecificEndpointQoS,
     // what may be a problem.
     using WritersMapType = utils::SharedAtomicable<std::map<types::SpecificEndpointQoS, QoSSpecificWriter*>>;
-    //! Map of writer indexed by Specific QoS of each.
-    WritersMapType writers_map_;
+    //! Map of writer indexed by Specific QoS of each (mutable so it can be locked to read the memory statistics).
+    mutable WritersMapType writers_map_;
 
     //! Reference to RTPS Participant.
     fastrtps::rtps::RTPSParticipant* rtps_participant_;
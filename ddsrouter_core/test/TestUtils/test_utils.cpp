@@ -17,6 +17,9 @@
  *
  */
 
+#include <cstring>
+#include <fstream>
+
 #include <cpp_utils/testing/gtest_aux.hpp>
 #include <gtest/gtest.h>
 
@@ -176,6 +179,24 @@ std::set<DiscoveryServerConnectionAddress> random_connection_addresses(
     return result;
 }
 
+std::string empty_capture_file(
+        uint16_t seed /* = 0 */)
+{
+    std::string path = "replayer_" + std::to_string(seed) + ".ddscap";
+
+    // File header of a closed capture file (magic, version 1 and index right after the header) with no chunks
+    char header[64] = {'D', 'D', 'S', 'R', 'C', 'A', 'P', '\0'};
+    uint32_t version = 1;
+    uint64_t index_offset = sizeof(header);
+    std::memcpy(header + 8, &version, sizeof(version));
+    std::memcpy(header + 32, &index_offset, sizeof(index_offset));
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(header, sizeof(header));
+
+    return path;
+}
+
 std::shared_ptr<core::configuration::ParticipantConfiguration> random_participant_configuration(
         ParticipantKind kind,
         uint16_t seed /* = 0 */)
@@ -191,6 +212,13 @@ std::shared_ptr<core::configuration::ParticipantConfiguration> random_participan
                 false,
                 random_domain(seed));
 
+        case ParticipantKind::local_shm:
+            return std::make_shared<core::configuration::LocalShmParticipantConfiguration>(
+                id,
+                kind,
+                false,
+                random_domain(seed));
+
         case ParticipantKind::local_discovery_server:
         case ParticipantKind::wan_discovery_server:
 
@@ -233,6 +261,41 @@ std::shared_ptr<core::configuration::ParticipantConfiguration> random_participan
                 false);
         }
 
+        case ParticipantKind::in_process:
+        {
+            return std::make_shared<core::configuration::InProcessParticipantConfiguration>(
+                id,
+                kind,
+                false,
+                std::make_shared<core::InProcessConnector>());
+        }
+
+        case ParticipantKind::recorder:
+        {
+            return std::make_shared<core::configuration::RecorderParticipantConfiguration>(
+                id,
+                kind,
+                false,
+                "recorder_" + std::to_string(seed) + ".ddscap");
+        }
+
+        case ParticipantKind::replayer:
+        {
+            return std::make_shared<core::configuration::ReplayerParticipantConfiguration>(
+                id,
+                kind,
+                false,
+                empty_capture_file(seed));
+        }
+
+        case ParticipantKind::load_generator:
+        {
+            return std::make_shared<core::configuration::LoadGeneratorParticipantConfiguration>(
+                id,
+                kind,
+                false);
+        }
+
         // Add cases where Participants need specific arguments
         default:
             return std::make_shared<core::configuration::ParticipantConfiguration>(id, kind, false);
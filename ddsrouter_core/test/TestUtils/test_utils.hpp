@@ -23,7 +23,12 @@
 #include <ddsrouter_core/configuration/participant/SimpleParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/DiscoveryServerParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/EchoParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/LoadGeneratorParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/InitialPeersParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/LocalShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/ReplayerParticipantConfiguration.hpp>
 #include <ddsrouter_core/types/dds/DomainId.hpp>
 #include <ddsrouter_core/types/dds/Guid.hpp>
 #include <ddsrouter_core/types/dds/GuidPrefix.hpp>
@@ -115,6 +120,10 @@ std::set<DiscoveryServerConnectionAddress> random_connection_addresses(
         uint16_t size = 1,
         bool ros = false);
 
+//! Create a capture file with no topics nor samples and return its path
+std::string empty_capture_file(
+        uint16_t seed = 0);
+
 std::shared_ptr<core::configuration::ParticipantConfiguration> random_participant_configuration(
         ParticipantKind kind,
         uint16_t seed = 0);
@@ -0,0 +1,220 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <set>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ddsrouter_core/types/topic/filter/RegexDdsFilterTopic.hpp>
+#include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include <dynamic/AllowedTopicList.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace {
+
+//! Number of different topics checked, twice the decisions the list caches so most of them are not cached
+constexpr const std::size_t UNCACHED_TOPICS = 200000;
+
+/**
+ * Allowlist with \c size patterns, half wildcards and half regex, that only allow topics \c topic_<i>_* with
+ * <i> below \c size .
+ */
+std::set<std::shared_ptr<DdsFilterTopic>> allowlist(
+        std::size_t size)
+{
+    std::set<std::shared_ptr<DdsFilterTopic>> result;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        if (i % 2 == 0)
+        {
+            result.insert(std::make_shared<WildcardDdsFilterTopic>("topic_" + std::to_string(i) + "_*"));
+        }
+        else
+        {
+            result.insert(std::make_shared<RegexDdsFilterTopic>("topic_" + std::to_string(i) + "_[0-9]+"));
+        }
+    }
+    return result;
+}
+
+//! Allowlist with \c size regex patterns, that only allow topics \c topic_<i>_<digits> with <i> below \c size
+std::set<std::shared_ptr<DdsFilterTopic>> regex_allowlist(
+        std::size_t size)
+{
+    std::set<std::shared_ptr<DdsFilterTopic>> result;
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        result.insert(std::make_shared<RegexDdsFilterTopic>("topic_" + std::to_string(i) + "_[0-9]+"));
+    }
+    return result;
+}
+
+//! Topics that no pattern of \c regex_allowlist matches, so every pattern is tried for each of them
+std::vector<DdsTopic> unmatched_topics()
+{
+    std::vector<DdsTopic> result;
+    result.reserve(UNCACHED_TOPICS);
+    for (std::size_t i = 0; i < UNCACHED_TOPICS; ++i)
+    {
+        result.emplace_back("topic_" + std::to_string(i) + "_unmatched", "type");
+    }
+    return result;
+}
+
+//! Blocklist with a single pattern, so every allowed topic is also checked against it
+std::set<std::shared_ptr<DdsFilterTopic>> blocklist()
+{
+    return {std::make_shared<WildcardDdsFilterTopic>("*_blocked")};
+}
+
+//! Topic \c index of the ones checked, that matches one pattern of an allowlist of \c size patterns every other
+DdsTopic topic(
+        std::size_t index,
+        std::size_t size)
+{
+    std::size_t pattern = (index % 2 == 0) ? (index / 2) % size : size + index;
+    return DdsTopic("topic_" + std::to_string(pattern) + "_" + std::to_string(index), "type");
+}
+
+} /* namespace */
+
+/**
+ * Check the same topic again and again, as done for every endpoint discovered in an already known topic
+ */
+static void BM_AllowedTopicList_is_topic_allowed_cached(
+        benchmark::State& state)
+{
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    AllowedTopicList list(allowlist(size), blocklist());
+    DdsTopic checked = topic(0, size);
+
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.is_topic_allowed(checked));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Check topics never checked before, as done for every new topic discovered
+ */
+static void BM_AllowedTopicList_is_topic_allowed_uncached(
+        benchmark::State& state)
+{
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    AllowedTopicList list(allowlist(size), blocklist());
+
+    std::vector<DdsTopic> topics;
+    topics.reserve(UNCACHED_TOPICS);
+    for (std::size_t i = 0; i < UNCACHED_TOPICS; ++i)
+    {
+        topics.push_back(topic(i, size));
+    }
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.is_topic_allowed(topics[index]));
+        index = (index + 1) % UNCACHED_TOPICS;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Build a list, which compiles its patterns, as done every time the configuration is reloaded
+ */
+static void BM_AllowedTopicList_construct(
+        benchmark::State& state)
+{
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    std::set<std::shared_ptr<DdsFilterTopic>> allowed = allowlist(size);
+    std::set<std::shared_ptr<DdsFilterTopic>> blocked = blocklist();
+
+    for (auto _ : state)
+    {
+        AllowedTopicList list(allowed, blocked);
+        benchmark::DoNotOptimize(&list);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * Check topics never checked before against an allowlist of regex patterns only, that none of them matches.
+ *
+ * Regex patterns cannot be indexed, and std::regex tries the alternatives of the combined expressions one after
+ * the other, so the time per topic grows linearly with the number of patterns (see the complexity reported).
+ */
+static void BM_AllowedTopicList_regex_unmatched(
+        benchmark::State& state)
+{
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    AllowedTopicList list(regex_allowlist(size), {});
+    std::vector<DdsTopic> topics = unmatched_topics();
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        benchmark::DoNotOptimize(list.is_topic_allowed(topics[index]));
+        index = (index + 1) % UNCACHED_TOPICS;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetComplexityN(state.range(0));
+}
+
+/**
+ * Same as \c BM_AllowedTopicList_regex_unmatched but matching each regex filter one by one, as reference of the
+ * gain of combining them (a constant factor, not a different complexity).
+ */
+static void BM_RegexDdsFilterTopic_one_by_one_unmatched(
+        benchmark::State& state)
+{
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    std::set<std::shared_ptr<DdsFilterTopic>> filters = regex_allowlist(size);
+    std::vector<DdsTopic> topics = unmatched_topics();
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        bool matched = false;
+        for (const auto& filter : filters)
+        {
+            if (filter->matches(topics[index]))
+            {
+                matched = true;
+                break;
+            }
+        }
+        benchmark::DoNotOptimize(matched);
+        index = (index + 1) % UNCACHED_TOPICS;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetComplexityN(state.range(0));
+}
+
+BENCHMARK(BM_AllowedTopicList_is_topic_allowed_cached)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_AllowedTopicList_is_topic_allowed_uncached)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_AllowedTopicList_construct)->RangeMultiplier(10)->Range(1, 10000);
+BENCHMARK(BM_AllowedTopicList_regex_unmatched)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
+BENCHMARK(BM_RegexDdsFilterTopic_one_by_one_unmatched)->RangeMultiplier(4)->Range(16, 4096)->Complexity();
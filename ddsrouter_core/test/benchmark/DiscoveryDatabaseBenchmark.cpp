@@ -0,0 +1,170 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/endpoint/Endpoint.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+#include <dynamic/DiscoveryDatabase.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace {
+
+//! Number of endpoints in every topic of the database
+constexpr const std::size_t ENDPOINTS_PER_TOPIC = 10;
+
+/**
+ * This class is used to expose protected methods of the parent class so they can be measured without the
+ * processing thread.
+ */
+class BenchmarkDiscoveryDatabase : public DiscoveryDatabase
+{
+public:
+
+    bool add_endpoint_protected(
+            const Endpoint& new_endpoint)
+    {
+        return add_endpoint_(new_endpoint);
+    }
+
+    void process_queue_protected()
+    {
+        process_queue_();
+    }
+
+};
+
+//! Guid unique for every \c index , as \c random_guid only distinguishes 256 of them
+Guid guid(
+        std::size_t index)
+{
+    Guid result;
+    for (std::size_t byte = 0; byte < 4; ++byte)
+    {
+        result.guidPrefix.value[byte] = static_cast<eprosima::fastrtps::rtps::octet>((index >> (8 * byte)) & 0xff);
+    }
+    result.guidPrefix.value[11] = 1;
+    result.entityId.value[3] = 1;
+    return result;
+}
+
+//! \c size endpoints, half writers and half readers, in groups of \c ENDPOINTS_PER_TOPIC per topic
+std::vector<Endpoint> endpoints(
+        std::size_t size)
+{
+    std::vector<Endpoint> result;
+    result.reserve(size);
+    for (std::size_t i = 0; i < size; ++i)
+    {
+        result.emplace_back(
+            i % 2 == 0 ? EndpointKind::writer : EndpointKind::reader,
+            guid(i),
+            DdsTopic("topic_" + std::to_string(i / ENDPOINTS_PER_TOPIC), "type"),
+            ParticipantId("participant"));
+    }
+    return result;
+}
+
+} /* namespace */
+
+/**
+ * Insert \c range(0) endpoints in an empty database, directly as the processing thread does for each of them
+ */
+static void BM_DiscoveryDatabase_insert(
+        benchmark::State& state)
+{
+    std::vector<Endpoint> to_insert = endpoints(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<BenchmarkDiscoveryDatabase> database = std::make_unique<BenchmarkDiscoveryDatabase>();
+        for (const Endpoint& endpoint : to_insert)
+        {
+            database->add_endpoint_protected(endpoint);
+        }
+
+        state.PauseTiming();
+        database.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * Queue \c range(0) endpoints in an empty database and process them in a single batch, as received from discovery
+ */
+static void BM_DiscoveryDatabase_insert_queued(
+        benchmark::State& state)
+{
+    std::vector<Endpoint> to_insert = endpoints(static_cast<std::size_t>(state.range(0)));
+
+    for (auto _ : state)
+    {
+        std::unique_ptr<BenchmarkDiscoveryDatabase> database = std::make_unique<BenchmarkDiscoveryDatabase>();
+        for (const Endpoint& endpoint : to_insert)
+        {
+            database->add_endpoint(endpoint);
+        }
+        database->process_queue_protected();
+
+        state.PauseTiming();
+        database.reset();
+        state.ResumeTiming();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+/**
+ * Look up the endpoints of a topic, by guid and by topic, in a database with \c range(0) endpoints
+ */
+static void BM_DiscoveryDatabase_lookup(
+        benchmark::State& state)
+{
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+    std::vector<Endpoint> inserted = endpoints(size);
+
+    BenchmarkDiscoveryDatabase database;
+    for (const Endpoint& endpoint : inserted)
+    {
+        database.add_endpoint_protected(endpoint);
+    }
+
+    std::size_t index = 0;
+    for (auto _ : state)
+    {
+        const Endpoint& endpoint = inserted[index];
+        benchmark::DoNotOptimize(database.endpoint_exists(endpoint.guid()));
+        benchmark::DoNotOptimize(database.get_endpoint(endpoint.guid()));
+        benchmark::DoNotOptimize(database.topic_exists(endpoint.topic()));
+        benchmark::DoNotOptimize(database.get_topic_writers(endpoint.topic()));
+        index = (index + 1) % size;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+BENCHMARK(BM_DiscoveryDatabase_insert)->RangeMultiplier(10)->Range(100, 100000)->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DiscoveryDatabase_insert_queued)->RangeMultiplier(10)->Range(100, 100000)
+        ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_DiscoveryDatabase_lookup)->RangeMultiplier(10)->Range(100, 100000);
@@ -0,0 +1,118 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <memory>
+
+#include <benchmark/benchmark.h>
+
+#include <efficiency/payload/CopyPayloadPool.hpp>
+#include <efficiency/payload/FastPayloadPool.hpp>
+#include <efficiency/payload/MapPayloadPool.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace {
+
+//! Pool shared by every thread of a run, created and destroyed by the first one
+template <typename Pool>
+std::unique_ptr<Pool>& shared_pool()
+{
+    static std::unique_ptr<Pool> pool;
+    return pool;
+}
+
+/**
+ * Reserve a new payload of \c range(0) bytes and release it, as a Reader does for every sample received
+ */
+template <typename Pool>
+void BM_PayloadPool_reserve_release(
+        benchmark::State& state)
+{
+    // Threads are synchronized before and after the loop, so the pool exists while any thread uses it
+    if (state.thread_index() == 0)
+    {
+        shared_pool<Pool>() = std::make_unique<Pool>();
+    }
+
+    const uint32_t size = static_cast<uint32_t>(state.range(0));
+
+    for (auto _ : state)
+    {
+        Payload payload;
+        shared_pool<Pool>()->get_payload(size, payload);
+        benchmark::DoNotOptimize(payload.data);
+        shared_pool<Pool>()->release_payload(payload);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+
+    if (state.thread_index() == 0)
+    {
+        shared_pool<Pool>().reset();
+    }
+}
+
+/**
+ * Reference a payload of \c range(0) bytes reserved from the same pool and release it, as a Writer does for every
+ * sample forwarded
+ */
+template <typename Pool>
+void BM_PayloadPool_reference_release(
+        benchmark::State& state)
+{
+    static Payload source;
+
+    if (state.thread_index() == 0)
+    {
+        shared_pool<Pool>() = std::make_unique<Pool>();
+        shared_pool<Pool>()->get_payload(static_cast<uint32_t>(state.range(0)), source);
+        source.length = source.max_size;
+    }
+
+    for (auto _ : state)
+    {
+        Payload payload;
+        eprosima::fastrtps::rtps::IPayloadPool* owner = shared_pool<Pool>().get();
+        shared_pool<Pool>()->get_payload(source, owner, payload);
+        benchmark::DoNotOptimize(payload.data);
+        shared_pool<Pool>()->release_payload(payload);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * state.range(0));
+
+    if (state.thread_index() == 0)
+    {
+        shared_pool<Pool>()->release_payload(source);
+        shared_pool<Pool>().reset();
+    }
+}
+
+} /* namespace */
+
+BENCHMARK_TEMPLATE(BM_PayloadPool_reserve_release, FastPayloadPool)
+        ->RangeMultiplier(16)->Range(64, 1 << 20)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PayloadPool_reserve_release, MapPayloadPool)
+        ->RangeMultiplier(16)->Range(64, 1 << 20)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PayloadPool_reserve_release, CopyPayloadPool)
+        ->RangeMultiplier(16)->Range(64, 1 << 20)->ThreadRange(1, 8)->UseRealTime();
+
+BENCHMARK_TEMPLATE(BM_PayloadPool_reference_release, FastPayloadPool)
+        ->RangeMultiplier(16)->Range(64, 1 << 20)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PayloadPool_reference_release, MapPayloadPool)
+        ->RangeMultiplier(16)->Range(64, 1 << 20)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(BM_PayloadPool_reference_release, CopyPayloadPool)
+        ->RangeMultiplier(16)->Range(64, 1 << 20)->ThreadRange(1, 8)->UseRealTime();
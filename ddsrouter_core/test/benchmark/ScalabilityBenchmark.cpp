@@ -0,0 +1,260 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <set>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <benchmark/benchmark.h>
+
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddsrouter_core/configuration/DDSRouterConfiguration.hpp>
+#include <ddsrouter_core/configuration/DDSRouterReloadConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/SimpleParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DDSRouter.hpp>
+#include <ddsrouter_core/types/dds/DomainId.hpp>
+#include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/endpoint/Endpoint.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+#include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+#include <participant/implementations/auxiliar/DummyParticipant.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace {
+
+//! Id of the Participant where the endpoints are simulated
+const ParticipantId DUMMY_PARTICIPANT_ID("scalability_dummy");
+
+//! Id of the Participant that creates the RTPS endpoints of every bridge in the loopback
+const ParticipantId SIMPLE_PARTICIPANT_ID("scalability_simple");
+
+//! Domain of the simple Participant, far from the default one so no other application is discovered
+constexpr const uint32_t SIMPLE_PARTICIPANT_DOMAIN = 77;
+
+//! Maximum time to wait for every topic to be bridged
+constexpr const std::chrono::seconds DISCOVERY_TIMEOUT(600);
+
+//! Time between checks of the bridges created
+constexpr const std::chrono::milliseconds DISCOVERY_POLL_PERIOD(50);
+
+//! Topics blocked in the reload: one out of every ten, the ones whose index ends in 5
+const std::string RELOAD_BLOCKED_TOPICS("scalability_topic_*5");
+
+//! Resident memory of the process in bytes, 0 if it cannot be read
+uint64_t resident_bytes()
+{
+#if defined(__linux__)
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line))
+    {
+        if (line.rfind("VmRSS:", 0) == 0)
+        {
+            std::istringstream value(line.substr(6));
+            uint64_t kilobytes = 0;
+            value >> kilobytes;
+            return kilobytes * 1024;
+        }
+    }
+#endif // if defined(__linux__)
+    return 0;
+}
+
+double seconds_since(
+        std::chrono::steady_clock::time_point origin)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - origin).count();
+}
+
+//! Guid unique for every \c index , as \c random_guid only distinguishes 256 of them
+Guid guid(
+        std::size_t index)
+{
+    Guid result;
+    for (std::size_t byte = 0; byte < 4; ++byte)
+    {
+        result.guidPrefix.value[byte] = static_cast<eprosima::fastrtps::rtps::octet>((index >> (8 * byte)) & 0xff);
+    }
+    result.guidPrefix.value[11] = 1;
+    result.entityId.value[3] = 1;
+    return result;
+}
+
+DdsTopic topic(
+        std::size_t index)
+{
+    return DdsTopic("scalability_topic_" + std::to_string(index), "scalability_type");
+}
+
+//! Router with a DummyParticipant and a simple Participant, and every topic allowed
+configuration::DDSRouterConfiguration router_configuration()
+{
+    configuration::DDSRouterConfiguration configuration;
+    configuration.participants_configurations =
+    {
+        std::make_shared<configuration::ParticipantConfiguration>(
+            DUMMY_PARTICIPANT_ID,
+            ParticipantKind::dummy,
+            false),
+        std::make_shared<configuration::SimpleParticipantConfiguration>(
+            SIMPLE_PARTICIPANT_ID,
+            ParticipantKind(ParticipantKind::simple_rtps),
+            false,
+            DomainId(SIMPLE_PARTICIPANT_DOMAIN))
+    };
+
+    return configuration;
+}
+
+//! Reload configuration with every topic allowed but the ones matching \c blocked (if any)
+configuration::DDSRouterReloadConfiguration blocking_configuration(
+        const std::string& blocked = "")
+{
+    std::set<std::shared_ptr<DdsFilterTopic>> blocklist;
+    if (!blocked.empty())
+    {
+        blocklist.insert(std::make_shared<WildcardDdsFilterTopic>(blocked));
+    }
+
+    return configuration::DDSRouterReloadConfiguration({}, blocklist, {});
+}
+
+} /* namespace */
+
+/**
+ * Discover \c range(0) topics with \c range(1) endpoints each in a DummyParticipant, and bridge them to a simple
+ * Participant on the local host.
+ *
+ * The time of the benchmark is the time to discover and bridge every topic. Every run also reports as counters:
+ * - the resident memory in steady state, and its increase per topic;
+ * - the memory held by the histories of the topics (every shared payload counted once), per topic;
+ * - the time to reload a configuration that blocks a tenth of the topics, and to allow them back;
+ * - the time to stop and destroy the router.
+ *
+ * Each run creates a whole router, so it is only run once. Compare the JSON output of two builds to find where
+ * \c DDSRouterImpl , \c DiscoveryDatabase or \c DDSBridge stop scaling linearly.
+ */
+static void BM_Scalability_topics(
+        benchmark::State& state)
+{
+    const std::size_t topics = static_cast<std::size_t>(state.range(0));
+    const std::size_t endpoints_per_topic = static_cast<std::size_t>(state.range(1));
+
+    for (auto _ : state)
+    {
+        const uint64_t initial_rss = resident_bytes();
+
+        std::unique_ptr<DDSRouter> router = std::make_unique<DDSRouter>(router_configuration());
+        if (router->start() != eprosima::utils::ReturnCode::RETCODE_OK)
+        {
+            state.SkipWithError("DDS Router could not be started.");
+            return;
+        }
+
+        DummyParticipant* participant = DummyParticipant::get_participant(DUMMY_PARTICIPANT_ID);
+
+        /////
+        // Discovery and bridging
+
+        auto discovery_start = std::chrono::steady_clock::now();
+
+        // The first endpoint of every topic is a Reader, as topics are only discovered with Readers
+        for (std::size_t i = 0; i < topics; ++i)
+        {
+            DdsTopic endpoint_topic = topic(i);
+            for (std::size_t j = 0; j < endpoints_per_topic; ++j)
+            {
+                participant->simulate_discovered_endpoint(
+                    Endpoint(
+                        j % 2 == 0 ? EndpointKind::reader : EndpointKind::writer,
+                        guid(i * endpoints_per_topic + j),
+                        endpoint_topic,
+                        DUMMY_PARTICIPANT_ID));
+            }
+        }
+
+        while (router->statistics().topics.size() < topics)
+        {
+            if (std::chrono::steady_clock::now() - discovery_start > DISCOVERY_TIMEOUT)
+            {
+                state.SkipWithError("Not every topic was bridged before the timeout.");
+                return;
+            }
+            std::this_thread::sleep_for(DISCOVERY_POLL_PERIOD);
+        }
+
+        double discovery_seconds = seconds_since(discovery_start);
+        state.SetIterationTime(discovery_seconds);
+
+        /////
+        // Steady state memory
+
+        const uint64_t steady_rss = resident_bytes();
+
+        uint64_t history_bytes = 0;
+        for (const auto& topic_it : router->statistics(true).topics)
+        {
+            history_bytes += topic_it.second.memory.bytes();
+        }
+
+        /////
+        // Reload with a changed allowlist
+
+        auto reload_start = std::chrono::steady_clock::now();
+        router->reload_configuration(blocking_configuration(RELOAD_BLOCKED_TOPICS));
+        double reload_block_seconds = seconds_since(reload_start);
+
+        reload_start = std::chrono::steady_clock::now();
+        router->reload_configuration(blocking_configuration());
+        double reload_allow_seconds = seconds_since(reload_start);
+
+        /////
+        // Shutdown
+
+        auto shutdown_start = std::chrono::steady_clock::now();
+        router->stop();
+        router.reset();
+        double shutdown_seconds = seconds_since(shutdown_start);
+
+        state.counters["endpoints"] = static_cast<double>(topics * endpoints_per_topic);
+        state.counters["discovery_s"] = discovery_seconds;
+        state.counters["rss_bytes"] = static_cast<double>(steady_rss);
+        state.counters["rss_per_topic_bytes"] =
+                static_cast<double>(steady_rss > initial_rss ? steady_rss - initial_rss : 0) / topics;
+        state.counters["history_per_topic_bytes"] = static_cast<double>(history_bytes) / topics;
+        state.counters["reload_block_s"] = reload_block_seconds;
+        state.counters["reload_allow_s"] = reload_allow_seconds;
+        state.counters["shutdown_s"] = shutdown_seconds;
+    }
+}
+BENCHMARK(BM_Scalability_topics)
+        ->ArgNames({"topics", "endpoints_per_topic"})
+        ->Args({1000, 1})
+        ->Args({10000, 1})
+        ->Args({50000, 1})
+        ->Args({10000, 10})
+        ->Iterations(1)
+        ->UseManualTime()
+        ->Unit(benchmark::kMillisecond);
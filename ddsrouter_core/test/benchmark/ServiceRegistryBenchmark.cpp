@@ -0,0 +1,111 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdint>
+#include <utility>
+
+#include <benchmark/benchmark.h>
+
+#include <communication/rpc/ServiceRegistry.hpp>
+#include <ddsrouter_core/configuration/ServiceConfiguration.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/topic/rpc/RPCTopic.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace {
+
+RPCTopic benchmark_service()
+{
+    return RPCTopic(
+        "service",
+        DdsTopic("rq/serviceRequest", "service_Request_"),
+        DdsTopic("rr/serviceReply", "service_Response_"));
+}
+
+SequenceNumber sequence_number(
+        uint64_t value)
+{
+    return SequenceNumber(static_cast<int32_t>(value >> 32), static_cast<uint32_t>(value));
+}
+
+std::pair<ParticipantId, SampleIdentity> entry(
+        const ParticipantId& participant,
+        uint64_t value)
+{
+    SampleIdentity identity;
+    identity.sequence_number(sequence_number(value));
+    return {participant, identity};
+}
+
+} /* namespace */
+
+/**
+ * Register a request and get and erase the one sent \c range(0) requests before, as done when a reply arrives while
+ * \c range(0) requests are pending
+ */
+static void BM_ServiceRegistry_add_get_erase(
+        benchmark::State& state)
+{
+    const uint64_t pending = static_cast<uint64_t>(state.range(0));
+    ServiceRegistry registry(benchmark_service(), ParticipantId("participant"));
+    ParticipantId server("server");
+
+    uint64_t next = 1;
+    for (; next <= pending; ++next)
+    {
+        registry.add(sequence_number(next), entry(server, next));
+    }
+
+    for (auto _ : state)
+    {
+        registry.add(sequence_number(next), entry(server, next));
+        benchmark::DoNotOptimize(registry.get(sequence_number(next - pending)));
+        registry.erase(sequence_number(next - pending));
+        ++next;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Register requests whose replies never arrive, so once the registry is full every new one overwrites the oldest
+ */
+static void BM_ServiceRegistry_add_evicting(
+        benchmark::State& state)
+{
+    configuration::ServiceConfiguration configuration;
+    configuration.max_pending_requests = static_cast<unsigned int>(state.range(0));
+    ServiceRegistry registry(benchmark_service(), ParticipantId("participant"), configuration);
+    ParticipantId server("server");
+
+    uint64_t next = 1;
+    for (; next <= configuration.max_pending_requests; ++next)
+    {
+        registry.add(sequence_number(next), entry(server, next));
+    }
+
+    for (auto _ : state)
+    {
+        registry.add(sequence_number(next), entry(server, next));
+        ++next;
+    }
+
+    state.SetItemsProcessed(state.iterations());
+    state.counters["evicted"] = static_cast<double>(registry.evicted_count());
+}
+
+BENCHMARK(BM_ServiceRegistry_add_get_erase)->Arg(1)->Arg(100)->Arg(4000);
+BENCHMARK(BM_ServiceRegistry_add_evicting)->Arg(100)->Arg(5000);
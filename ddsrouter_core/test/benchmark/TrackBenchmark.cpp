@@ -0,0 +1,117 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <memory>
+#include <vector>
+
+#include <benchmark/benchmark.h>
+
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+
+#include <communication/Track.hpp>
+#include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+#include <dynamic/DiscoveryDatabase.hpp>
+#include <efficiency/payload/FastPayloadPool.hpp>
+#include <participant/implementations/auxiliar/DummyParticipant.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace {
+
+/**
+ * Iterations of every run.
+ *
+ * DummyWriter stores every sample written and can only wait for up to 65535 of them, so the number of iterations
+ * is fixed instead of chosen by the framework.
+ */
+constexpr const benchmark::IterationCount TRACK_ITERATIONS = 1000;
+
+std::shared_ptr<DummyParticipant> dummy_participant(
+        const std::string& id,
+        std::shared_ptr<PayloadPool> payload_pool,
+        std::shared_ptr<DiscoveryDatabase> discovery_database)
+{
+    return std::make_shared<DummyParticipant>(
+        std::make_shared<configuration::ParticipantConfiguration>(ParticipantId(id), ParticipantKind::dummy, false),
+        payload_pool,
+        discovery_database);
+}
+
+} /* namespace */
+
+/**
+ * Forward \c range(0) samples of \c range(1) bytes from a DummyParticipant to another one through a Track with
+ * \c range(2) threads, waiting for all of them to be written.
+ *
+ * This measures the forwarding path of the router (Reader take, payload pool, thread pool and Writer write) without
+ * any network.
+ */
+static void BM_Track_forward(
+        benchmark::State& state)
+{
+    const uint16_t batch = static_cast<uint16_t>(state.range(0));
+    const std::size_t size = static_cast<std::size_t>(state.range(1));
+
+    DdsTopic topic("benchmark_topic", "benchmark_type");
+    std::shared_ptr<PayloadPool> payload_pool = std::make_shared<FastPayloadPool>();
+    std::shared_ptr<DiscoveryDatabase> discovery_database = std::make_shared<DiscoveryDatabase>();
+    std::shared_ptr<eprosima::utils::SlotThreadPool> thread_pool =
+            std::make_shared<eprosima::utils::SlotThreadPool>(static_cast<unsigned int>(state.range(2)));
+    thread_pool->enable();
+
+    std::shared_ptr<DummyParticipant> source = dummy_participant("source", payload_pool, discovery_database);
+    std::shared_ptr<DummyParticipant> target = dummy_participant("target", payload_pool, discovery_database);
+
+    std::shared_ptr<IReader> reader = source->create_reader(topic);
+    std::shared_ptr<IWriter> writer = target->create_writer(topic);
+
+    std::map<ParticipantId, std::shared_ptr<IWriter>> writers;
+    writers[target->id()] = writer;
+
+    std::unique_ptr<Track> track = std::make_unique<Track>(
+        topic, source->id(), reader, std::move(writers), payload_pool, thread_pool, true);
+
+    DummyDataReceived data;
+    data.payload = std::vector<PayloadUnit>(size, 'x');
+
+    uint16_t sent = 0;
+    for (auto _ : state)
+    {
+        for (uint16_t i = 0; i < batch; ++i)
+        {
+            source->simulate_data_reception(topic, data);
+        }
+        sent += batch;
+        target->wait_until_n_data_sent(topic, sent);
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.SetBytesProcessed(state.iterations() * state.range(0) * state.range(1));
+
+    track.reset();
+    source->delete_reader(reader);
+    target->delete_writer(writer);
+    thread_pool->disable();
+}
+
+BENCHMARK(BM_Track_forward)
+        ->ArgNames({"batch", "size", "threads"})
+        ->ArgsProduct({{1, 50}, {64, 1024}, {1, 4}})
+        ->Iterations(TRACK_ITERATIONS)
+        ->UseRealTime();
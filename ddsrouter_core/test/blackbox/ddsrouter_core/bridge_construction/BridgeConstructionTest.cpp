@@ -0,0 +1,258 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <cpp_utils/testing/LogChecker.hpp>
+#include <gtest/gtest.h>
+#include <test_utils.hpp>
+
+#include <ddsrouter_core/configuration/DDSRouterConfiguration.hpp>
+#include <ddsrouter_core/configuration/DDSRouterReloadConfiguration.hpp>
+#include <ddsrouter_core/core/DDSRouter.hpp>
+#include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/endpoint/Endpoint.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+#include <participant/implementations/auxiliar/DummyParticipant.hpp>
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace bridge_construction_test {
+
+//! Number of topics bridged in each test, enough to have constructions pending with a single thread
+constexpr unsigned int TOPICS = 100;
+
+//! Name of the topics of the tests
+std::string topic_name(
+        unsigned int index)
+{
+    return "topic_" + std::to_string(index);
+}
+
+//! Topics of the tests, as builtin topics
+std::set<std::shared_ptr<DdsTopic>> builtin_topics()
+{
+    std::set<std::shared_ptr<DdsTopic>> result;
+    for (unsigned int i = 0; i < TOPICS; ++i)
+    {
+        result.insert(std::make_shared<DdsTopic>(topic_name(i), "type_dummy"));
+    }
+    return result;
+}
+
+//! Guid unique for every \c index
+Guid unique_guid(
+        unsigned int index)
+{
+    Guid result;
+    for (std::size_t byte = 0; byte < 4; ++byte)
+    {
+        result.guidPrefix.value[byte] = static_cast<eprosima::fastrtps::rtps::octet>((index >> (8 * byte)) & 0xff);
+    }
+    result.guidPrefix.value[11] = 1;
+    result.entityId.value[3] = 1;
+    return result;
+}
+
+//! Wait until the router has a Bridge for \c topics topics, or a timeout expires
+void wait_bridges(
+        DDSRouter& router,
+        std::size_t topics)
+{
+    auto start = std::chrono::steady_clock::now();
+    while (router.statistics().topics.size() < topics &&
+            std::chrono::steady_clock::now() - start < std::chrono::seconds(10))
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+}
+
+//! Filter list that blocks every topic of the tests
+std::set<std::shared_ptr<DdsFilterTopic>> every_topic()
+{
+    return {std::make_shared<WildcardDdsFilterTopic>("topic_*")};
+}
+
+/**
+ * @brief Create a \c DDSRouterConfiguration with 2 dummy participants and a single thread to construct Bridges
+ *
+ * @param [in] topics : builtin topics of the router
+ * @param [in] blocklist : topics blocked from start
+ */
+configuration::DDSRouterConfiguration dummy_configuration(
+        const std::set<std::shared_ptr<DdsTopic>>& topics,
+        const std::set<std::shared_ptr<DdsFilterTopic>>& blocklist = {})
+{
+    configuration::DDSRouterConfiguration configuration;
+
+    configuration.builtin_topics = topics;
+    configuration.blocklist = blocklist;
+
+    configuration.participants_configurations =
+    {
+        std::make_shared<configuration::ParticipantConfiguration>(
+            ParticipantId("Participant1"),
+            ParticipantKind::dummy,
+            false
+            ),
+        std::make_shared<configuration::ParticipantConfiguration>(
+            ParticipantId("Participant2"),
+            ParticipantKind::dummy,
+            false
+            )
+    };
+
+    // A single thread so constructions queue up
+    configuration.advanced_options.bridge_construction_threads = 1;
+
+    return configuration;
+}
+
+//! Send a sample from Participant1 in \c topic and wait for Participant2 to write it
+void forward_sample(
+        const DdsTopic& topic)
+{
+    DummyParticipant* participant_1 = DummyParticipant::get_participant(ParticipantId("Participant1"));
+    DummyParticipant* participant_2 = DummyParticipant::get_participant(ParticipantId("Participant2"));
+    ASSERT_NE(participant_1, nullptr);
+    ASSERT_NE(participant_2, nullptr);
+
+    DummyDataReceived data;
+    data.source_guid = test::random_guid();
+    data.payload = {1, 2, 3};
+
+    participant_1->simulate_data_reception(topic, data);
+    participant_2->wait_until_n_data_sent(topic, 1);
+}
+
+} /* namespace bridge_construction_test */
+
+using namespace bridge_construction_test;
+
+/**
+ * Reload a configuration that allows every topic while none of them has a Bridge yet.
+ *
+ * The reload must return once every Bridge is constructed and installed, so every topic is bridged and forwards
+ * data right after it.
+ */
+TEST(BridgeConstructionTest, reload_while_pending)
+{
+    INSTANTIATE_LOG_TESTER(eprosima::utils::Log::Kind::Error, 0, 0);
+
+    std::set<std::shared_ptr<DdsTopic>> topics = builtin_topics();
+    DDSRouter router(dummy_configuration(topics, every_topic()));
+    router.start();
+
+    ASSERT_TRUE(router.statistics().topics.empty());
+
+    ASSERT_EQ(
+        router.reload_configuration(configuration::DDSRouterReloadConfiguration({}, {}, topics)),
+        eprosima::utils::ReturnCode::RETCODE_OK);
+
+    ASSERT_EQ(router.statistics().topics.size(), TOPICS);
+
+    forward_sample(DdsTopic(topic_name(0), "type_dummy"));
+    forward_sample(DdsTopic(topic_name(TOPICS - 1), "type_dummy"));
+
+    router.stop();
+}
+
+/**
+ * Block and allow again every topic while new topics are discovered and their Bridges are being constructed.
+ *
+ * Every topic activated again must reuse the construction already requested (even if finished and not installed
+ * yet) instead of requesting a second one, which would fail and log an error as the endpoints of the topic already
+ * exist.
+ */
+TEST(BridgeConstructionTest, activate_during_construction)
+{
+    INSTANTIATE_LOG_TESTER(eprosima::utils::Log::Kind::Error, 0, 0);
+
+    DDSRouter router(dummy_configuration({}));
+    router.start();
+
+    DummyParticipant* participant_1 = DummyParticipant::get_participant(ParticipantId("Participant1"));
+    ASSERT_NE(participant_1, nullptr);
+
+    // Topics are discovered (and their Bridges requested) while the main thread reloads the configuration
+    std::thread discoverer(
+        [participant_1]()
+        {
+            for (unsigned int i = 0; i < TOPICS; ++i)
+            {
+                participant_1->simulate_discovered_endpoint(
+                    Endpoint(
+                        EndpointKind::reader,
+                        unique_guid(i),
+                        DdsTopic(topic_name(i), "type_dummy"),
+                        ParticipantId("Participant1")));
+            }
+        });
+
+    for (int i = 0; i < 20; ++i)
+    {
+        router.reload_configuration(configuration::DDSRouterReloadConfiguration({}, every_topic(), {}));
+        router.reload_configuration(configuration::DDSRouterReloadConfiguration({}, {}, {}));
+    }
+
+    discoverer.join();
+
+    wait_bridges(router, TOPICS);
+    ASSERT_EQ(router.statistics().topics.size(), TOPICS);
+
+    for (unsigned int i = 0; i < TOPICS; ++i)
+    {
+        forward_sample(DdsTopic(topic_name(i), "type_dummy"));
+    }
+
+    router.stop();
+}
+
+/**
+ * The time to first forward of a topic is only set once its Bridge has forwarded data.
+ */
+TEST(BridgeConstructionTest, time_to_first_forward)
+{
+    DdsTopic topic(topic_name(0), "type_dummy");
+    DDSRouter router(dummy_configuration({std::make_shared<DdsTopic>(topic)}));
+    router.start();
+
+    RouterStatistics statistics = router.statistics();
+    ASSERT_EQ(statistics.topics.size(), 1u);
+    ASSERT_EQ(statistics.topics[topic].time_to_first_forward.count(), 0);
+
+    forward_sample(topic);
+
+    statistics = router.statistics();
+    ASSERT_GT(statistics.topics[topic].time_to_first_forward.count(), 0);
+
+    router.stop();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -319,6 +319,68 @@ TEST(DDSTestLocal, end_to_end_local_communication_transient_local_disable_dynami
         true);
 }
 
+/**
+ * Test the memory held by the histories of a topic forwarded to two participants, whose Writers share the payloads.
+ *
+ * The memory is only computed when requested, and each shared payload is counted once.
+ */
+TEST(DDSTestLocal, end_to_end_local_communication_memory_statistics)
+{
+    INSTANTIATE_LOG_TESTER(eprosima::utils::Log::Kind::Error, 0, 0);
+
+    // Transient local Writers keep the samples forwarded in their histories
+    configuration::DDSRouterConfiguration ddsrouter_configuration = test::dds_test_simple_configuration(true, true);
+    ddsrouter_configuration.participants_configurations.insert(
+        std::make_shared<configuration::SimpleParticipantConfiguration>(
+            ParticipantId("participant_2"),
+            ParticipantKind(ParticipantKind::simple_rtps),
+            false,
+            DomainId(2u)));
+
+    std::atomic<uint32_t> samples_received(0);
+    HelloWorld msg;
+    msg.message("Testing DDSRouter Blackbox Memory Statistics ...");
+
+    test::TestPublisher<HelloWorld> publisher(msg.isKeyDefined());
+    ASSERT_TRUE(publisher.init(0));
+
+    test::TestSubscriber<HelloWorld> subscriber(msg.isKeyDefined(), true);
+    ASSERT_TRUE(subscriber.init(1, &msg, &samples_received));
+
+    DDSRouter router(ddsrouter_configuration);
+    router.start();
+
+    uint32_t samples_sent = 0;
+    while (samples_received.load() < test::DEFAULT_SAMPLES_TO_RECEIVE)
+    {
+        msg.index(++samples_sent);
+        publisher.publish(msg);
+        std::this_thread::sleep_for(std::chrono::milliseconds(test::DEFAULT_MILLISECONDS_PUBLISH_LOOP));
+    }
+
+    // Periodic statistics do not iterate the histories
+    for (const auto& topic_it : router.statistics().topics)
+    {
+        ASSERT_EQ(topic_it.second.memory.writer_history_changes, 0u);
+        ASSERT_EQ(topic_it.second.memory.bytes(), 0u);
+    }
+
+    MemoryStatistics memory;
+    for (const auto& topic_it : router.statistics(true).topics)
+    {
+        memory.merge(topic_it.second.memory);
+    }
+
+    // Writers of participant_1 and participant_2 reference the same payloads, that are only counted once
+    ASSERT_GT(memory.payloads, 0u);
+    ASSERT_GT(memory.writer_history_changes, memory.payloads);
+    ASSERT_GT(memory.payload_bytes, 0u);
+    ASSERT_LT(memory.payload_bytes, memory.reader_history_bytes + memory.writer_history_bytes);
+    ASSERT_GE(memory.bytes(), memory.payload_bytes);
+
+    router.stop();
+}
+
 int main(
         int argc,
         char** argv)
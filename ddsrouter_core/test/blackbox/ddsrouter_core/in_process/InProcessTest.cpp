@@ -0,0 +1,224 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+#include <test_utils.hpp>
+
+#include <ddsrouter_core/configuration/participant/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DDSRouter.hpp>
+#include <ddsrouter_core/core/InProcessConnector.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <participant/implementations/auxiliar/DummyParticipant.hpp>
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace in_process_test {
+
+const char* TOPIC_NAME = "topic_in_process";
+const char* TOPIC_TYPE = "type_in_process";
+
+/**
+ * @brief Create a \c DDSRouterConfiguration with an in-process participant using \c connector ,
+ * a dummy participant and one builtin topic
+ */
+configuration::DDSRouterConfiguration in_process_configuration(
+        std::shared_ptr<InProcessConnector> connector)
+{
+    configuration::DDSRouterConfiguration configuration;
+
+    configuration.builtin_topics =
+    {
+        std::set<std::shared_ptr<DdsTopic>>({std::make_shared<DdsTopic>(TOPIC_NAME, TOPIC_TYPE)}),
+    };
+
+    configuration.participants_configurations =
+    {
+        std::make_shared<configuration::InProcessParticipantConfiguration>(
+            ParticipantId("Application"),
+            ParticipantKind::in_process,
+            false,
+            connector
+            ),
+        std::make_shared<configuration::ParticipantConfiguration>(
+            ParticipantId("Dummy"),
+            ParticipantKind::dummy,
+            false
+            )
+    };
+
+    return configuration;
+}
+
+std::vector<PayloadUnit> payload_to_vector(
+        const Payload& payload)
+{
+    return std::vector<PayloadUnit>(payload.data, payload.data + payload.length);
+}
+
+} /* namespace in_process_test */
+
+/**
+ * Test that the connector can not be used until a participant is attached to it
+ */
+TEST(InProcessTest, not_connected)
+{
+    InProcessConnector connector;
+    DdsTopic topic(in_process_test::TOPIC_NAME, in_process_test::TOPIC_TYPE);
+    std::vector<PayloadUnit> sample = {1, 2, 3};
+    Payload payload;
+
+    ASSERT_FALSE(connector.connected());
+    ASSERT_EQ(connector.announce_publication(topic), eprosima::utils::ReturnCode::RETCODE_NOT_ENABLED);
+    ASSERT_EQ(connector.announce_subscription(topic), eprosima::utils::ReturnCode::RETCODE_NOT_ENABLED);
+    ASSERT_EQ(connector.loan_payload(3, payload), eprosima::utils::ReturnCode::RETCODE_NOT_ENABLED);
+    ASSERT_EQ(
+        connector.write(topic, sample.data(), static_cast<uint32_t>(sample.size())),
+        eprosima::utils::ReturnCode::RETCODE_NOT_ENABLED);
+}
+
+/**
+ * Test that a sample written by the application (copied from its buffer) arrives to the other participant
+ * with the guid of the publication announced
+ */
+TEST(InProcessTest, application_to_router)
+{
+    std::shared_ptr<InProcessConnector> connector = std::make_shared<InProcessConnector>();
+    DDSRouter router(in_process_test::in_process_configuration(connector));
+    router.start();
+
+    ASSERT_TRUE(connector->connected());
+
+    DdsTopic topic(in_process_test::TOPIC_NAME, in_process_test::TOPIC_TYPE);
+    std::vector<PayloadUnit> sample = {1, 2, 3, 4, 5};
+
+    ASSERT_TRUE(connector->announce_publication(topic));
+    ASSERT_TRUE(connector->write(topic, sample.data(), static_cast<uint32_t>(sample.size())));
+
+    DummyParticipant* dummy = DummyParticipant::get_participant(ParticipantId("Dummy"));
+    ASSERT_NE(dummy, nullptr);
+    dummy->wait_until_n_data_sent(topic, 1);
+
+    std::vector<DummyDataStored> data_received = dummy->get_data_that_should_have_been_sent(topic);
+    ASSERT_EQ(data_received.size(), 1u);
+    ASSERT_EQ(data_received[0].payload, sample);
+    ASSERT_NE(data_received[0].source_guid, Guid());
+
+    router.stop();
+}
+
+/**
+ * Test that a payload loaned from the router pool and filled by the application is forwarded,
+ * and that the application payload is left empty after writing it
+ */
+TEST(InProcessTest, application_to_router_loaned_payload)
+{
+    std::shared_ptr<InProcessConnector> connector = std::make_shared<InProcessConnector>();
+    DDSRouter router(in_process_test::in_process_configuration(connector));
+    router.start();
+
+    DdsTopic topic(in_process_test::TOPIC_NAME, in_process_test::TOPIC_TYPE);
+    std::vector<PayloadUnit> sample = {9, 8, 7};
+
+    Payload payload;
+    ASSERT_TRUE(connector->loan_payload(static_cast<uint32_t>(sample.size()), payload));
+    for (std::size_t i = 0; i < sample.size(); i++)
+    {
+        payload.data[i] = sample[i];
+    }
+    payload.length = static_cast<uint32_t>(sample.size());
+
+    ASSERT_TRUE(connector->write(topic, payload));
+    ASSERT_EQ(payload.data, nullptr);
+    ASSERT_EQ(payload.length, 0u);
+
+    DummyParticipant* dummy = DummyParticipant::get_participant(ParticipantId("Dummy"));
+    ASSERT_NE(dummy, nullptr);
+    dummy->wait_until_n_data_sent(topic, 1);
+
+    std::vector<DummyDataStored> data_received = dummy->get_data_that_should_have_been_sent(topic);
+    ASSERT_EQ(data_received.size(), 1u);
+    ASSERT_EQ(data_received[0].payload, sample);
+
+    router.stop();
+}
+
+/**
+ * Test that a sample received by other participant arrives to the application callback,
+ * and that the application can retain its payload after the callback
+ */
+TEST(InProcessTest, router_to_application)
+{
+    std::shared_ptr<InProcessConnector> connector = std::make_shared<InProcessConnector>();
+
+    std::mutex mutex;
+    std::condition_variable cv;
+    Payload retained;
+    Guid source_guid;
+    bool received = false;
+
+    connector->set_data_callback(
+        [&](const DdsTopic&, const DataReceived& data)
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            ASSERT_TRUE(connector->retain_payload(data.payload, retained));
+            source_guid = data.properties.source_guid;
+            received = true;
+            cv.notify_all();
+        });
+
+    DDSRouter router(in_process_test::in_process_configuration(connector));
+    router.start();
+
+    DdsTopic topic(in_process_test::TOPIC_NAME, in_process_test::TOPIC_TYPE);
+    ASSERT_TRUE(connector->announce_subscription(topic));
+
+    DummyParticipant* dummy = DummyParticipant::get_participant(ParticipantId("Dummy"));
+    ASSERT_NE(dummy, nullptr);
+
+    DummyDataReceived data;
+    data.source_guid = eprosima::ddsrouter::test::random_guid();
+    data.payload = {4, 3, 2, 1};
+    dummy->simulate_data_reception(topic, data);
+
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        cv.wait(lock, [&received]
+                {
+                    return received;
+                });
+    }
+
+    // The Track has released its reference, but the retained one is still valid
+    ASSERT_EQ(in_process_test::payload_to_vector(retained), data.payload);
+    ASSERT_EQ(source_guid, data.source_guid);
+    ASSERT_TRUE(connector->release_payload(retained));
+
+    router.stop();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,186 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstring>
+#include <set>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+#include <test_utils.hpp>
+
+#include <ddsrouter_core/configuration/participant/LoadGeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DDSRouter.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <participant/implementations/auxiliar/DummyParticipant.hpp>
+#include <participant/implementations/auxiliar/LoadSample.hpp>
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace load_generator_test {
+
+constexpr uint16_t SAMPLES = 50;
+
+/**
+ * @brief Create a \c DDSRouterConfiguration with a load generator participant and a dummy participant
+ */
+configuration::DDSRouterConfiguration load_generator_configuration(
+        std::shared_ptr<configuration::LoadGeneratorParticipantConfiguration> generator_configuration)
+{
+    configuration::DDSRouterConfiguration configuration;
+
+    configuration.participants_configurations =
+    {
+        generator_configuration,
+        std::make_shared<configuration::ParticipantConfiguration>(
+            ParticipantId("Dummy"),
+            ParticipantKind::dummy,
+            false
+            )
+    };
+
+    return configuration;
+}
+
+//! Header of a sample generated
+LoadSampleHeader sample_header(
+        const DummyDataStored& data)
+{
+    LoadSampleHeader header{};
+    EXPECT_GE(data.payload.size(), LOAD_SAMPLE_ENCAPSULATION_SIZE + sizeof(LoadSampleHeader));
+    if (data.payload.size() >= LOAD_SAMPLE_ENCAPSULATION_SIZE + sizeof(LoadSampleHeader))
+    {
+        std::memcpy(&header, data.payload.data() + LOAD_SAMPLE_ENCAPSULATION_SIZE, sizeof(header));
+    }
+    return header;
+}
+
+} /* namespace load_generator_test */
+
+using namespace load_generator_test;
+
+/**
+ * Test that the samples generated in each topic arrive to other participant with consecutive sequence numbers
+ *
+ * CASES:
+ *  Every topic generated has a bridge, with no external subscriber
+ *  Sequence numbers start at 0 and are consecutive
+ *  Every sample of a topic has the same source guid, different in each topic
+ */
+TEST(LoadGeneratorTest, generate_samples)
+{
+    auto generator_configuration = std::make_shared<configuration::LoadGeneratorParticipantConfiguration>(
+        ParticipantId("Generator"),
+        ParticipantKind::load_generator,
+        false);
+    generator_configuration->topic_count = 2;
+    generator_configuration->rate = 1000;
+    generator_configuration->report_period = 0;
+
+    DDSRouter router(load_generator_configuration(generator_configuration));
+    router.start();
+
+    DummyParticipant* dummy = DummyParticipant::get_participant(ParticipantId("Dummy"));
+    ASSERT_NE(dummy, nullptr);
+
+    std::set<Guid> source_guids;
+    for (int topic_index = 0; topic_index < 2; ++topic_index)
+    {
+        DdsTopic topic(
+            generator_configuration->topic_prefix + "_" + std::to_string(topic_index),
+            generator_configuration->type_name);
+
+        dummy->wait_until_n_data_sent(topic, SAMPLES);
+        std::vector<DummyDataStored> data_received = dummy->get_data_that_should_have_been_sent(topic);
+        ASSERT_GE(data_received.size(), SAMPLES);
+
+        for (uint64_t i = 0; i < SAMPLES; ++i)
+        {
+            LoadSampleHeader header = sample_header(data_received[i]);
+            ASSERT_EQ(header.magic, LOAD_SAMPLE_MAGIC);
+            ASSERT_EQ(header.sequence_number, i);
+            ASSERT_EQ(header.key, 0u);
+            ASSERT_EQ(data_received[i].payload.size(), generator_configuration->min_size);
+            ASSERT_EQ(data_received[i].source_guid, data_received[0].source_guid);
+        }
+
+        source_guids.insert(data_received[0].source_guid);
+    }
+    ASSERT_EQ(source_guids.size(), 2u);
+
+    router.stop();
+}
+
+/**
+ * Test the sizes and keys of the samples generated, generating in bursts as fast as possible
+ *
+ * CASES:
+ *  Sizes are within the limits configured
+ *  Sizes are not all the same
+ *  Keys go from 1 to the number of keys
+ */
+TEST(LoadGeneratorTest, generate_sizes_and_keys)
+{
+    constexpr uint32_t MIN_SIZE = 32;
+    constexpr uint32_t MAX_SIZE = 4096;
+    constexpr uint32_t KEYS = 3;
+
+    auto generator_configuration = std::make_shared<configuration::LoadGeneratorParticipantConfiguration>(
+        ParticipantId("Generator"),
+        ParticipantKind::load_generator,
+        false);
+    generator_configuration->rate = 0;
+    generator_configuration->burst = 10;
+    generator_configuration->min_size = MIN_SIZE;
+    generator_configuration->max_size = MAX_SIZE;
+    generator_configuration->size_distribution = LoadSizeDistribution::exponential;
+    generator_configuration->keys = KEYS;
+    generator_configuration->report_period = 0;
+
+    DDSRouter router(load_generator_configuration(generator_configuration));
+    router.start();
+
+    DummyParticipant* dummy = DummyParticipant::get_participant(ParticipantId("Dummy"));
+    ASSERT_NE(dummy, nullptr);
+
+    DdsTopic topic(generator_configuration->topic_prefix + "_0", generator_configuration->type_name, true);
+    dummy->wait_until_n_data_sent(topic, SAMPLES);
+    std::vector<DummyDataStored> data_received = dummy->get_data_that_should_have_been_sent(topic);
+    ASSERT_GE(data_received.size(), SAMPLES);
+
+    std::set<std::size_t> sizes;
+    for (uint64_t i = 0; i < SAMPLES; ++i)
+    {
+        LoadSampleHeader header = sample_header(data_received[i]);
+        ASSERT_EQ(header.sequence_number, i);
+        ASSERT_EQ(header.key, i % KEYS + 1);
+        ASSERT_GE(data_received[i].payload.size(), MIN_SIZE);
+        ASSERT_LE(data_received[i].payload.size(), MAX_SIZE);
+        sizes.insert(data_received[i].payload.size());
+    }
+    ASSERT_GT(sizes.size(), 1u);
+
+    router.stop();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,339 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <capture/CaptureFormat.hpp>
+#include <capture/CaptureReader.hpp>
+#include <capture/CaptureWriter.hpp>
+#include <efficiency/payload/FastPayloadPool.hpp>
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::capture;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace capture_test {
+
+constexpr const char* FILE_NAME = "capture_reader_test.ddscap";
+
+//! Write a sample with a payload of \c size bytes with value \c value
+void write_sample(
+        CaptureWriter& writer,
+        PayloadPool& pool,
+        uint32_t topic_id,
+        uint32_t size,
+        uint8_t value,
+        uint32_t sequence_number)
+{
+    std::unique_ptr<DataReceived> data = std::make_unique<DataReceived>();
+    pool.get_payload(size, data->payload);
+    data->payload.length = size;
+    std::memset(data->payload.data, value, size);
+    data->properties.origin_sequence_number = eprosima::fastrtps::rtps::SequenceNumber_t(0, sequence_number);
+    data->properties.source_guid.guidPrefix.value[0] = value;
+
+    ASSERT_TRUE(writer.write_data(topic_id, *data));
+    pool.release_payload(data->payload);
+}
+
+//! Write a capture file with \c samples samples of \c size bytes, alternating between two topics
+void write_capture(
+        uint32_t samples,
+        uint32_t size,
+        uint64_t chunk_size = 1024 * 1024)
+{
+    auto pool = std::make_shared<FastPayloadPool>();
+
+    CaptureWriter writer(FILE_NAME, chunk_size, 64 * 1024 * 1024, pool);
+
+    TopicQoS qos;
+    qos.reliability_qos = ReliabilityKind::RELIABLE;
+    qos.durability_qos = DurabilityKind::TRANSIENT_LOCAL;
+    uint32_t id_a = writer.register_topic(DdsTopic("topic_a", "type_a"));
+    uint32_t id_b = writer.register_topic(DdsTopic("topic_b", "type_b", true, qos));
+
+    for (uint32_t i = 0; i < samples; ++i)
+    {
+        write_sample(writer, *pool, i % 2 ? id_b : id_a, size, static_cast<uint8_t>(i), i);
+    }
+
+    writer.close();
+}
+
+//! Check that \c sample is the sample number \c i written by \c write_capture
+void check_sample(
+        const CaptureReader& reader,
+        const CaptureSample& sample,
+        uint32_t i,
+        uint32_t size)
+{
+    ASSERT_EQ(reader.topics()[sample.header->topic_id].topic_name, i % 2 ? "topic_b" : "topic_a");
+    ASSERT_EQ(sample.header->payload_length, size);
+    ASSERT_EQ(sample.header->sequence_number, i);
+    ASSERT_EQ(sample.header->source_guid[0], static_cast<uint8_t>(i));
+    for (uint32_t j = 0; j < size; ++j)
+    {
+        ASSERT_EQ(sample.payload[j], static_cast<uint8_t>(i));
+    }
+}
+
+} /* namespace capture_test */
+
+using namespace capture_test;
+
+/**
+ * Read the topics of a capture file
+ *
+ * CASES:
+ *  Name and type of each topic
+ *  Key and QoS of each topic
+ */
+TEST(CaptureReaderTest, read_topics)
+{
+    write_capture(0, 0);
+
+    {
+        CaptureReader reader(FILE_NAME);
+        ASSERT_EQ(reader.sample_count(), 0u);
+        ASSERT_EQ(reader.first_time(), 0);
+
+        const std::vector<DdsTopic>& topics = reader.topics();
+        ASSERT_EQ(topics.size(), 2u);
+
+        ASSERT_EQ(topics[0].topic_name, "topic_a");
+        ASSERT_EQ(topics[0].type_name, "type_a");
+        ASSERT_FALSE(topics[0].keyed);
+        ASSERT_FALSE(topics[0].topic_qos.get_reference().is_reliable());
+        ASSERT_FALSE(topics[0].topic_qos.get_reference().is_transient_local());
+
+        ASSERT_EQ(topics[1].topic_name, "topic_b");
+        ASSERT_EQ(topics[1].type_name, "type_b");
+        ASSERT_TRUE(topics[1].keyed);
+        ASSERT_TRUE(topics[1].topic_qos.get_reference().is_reliable());
+        ASSERT_TRUE(topics[1].topic_qos.get_reference().is_transient_local());
+
+        CaptureSample sample;
+        ASSERT_FALSE(reader.next(sample));
+    }
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Read the samples of a capture file with several chunks
+ *
+ * CASES:
+ *  Samples are read in the order they were written
+ *  Payload and properties of each sample
+ *  Reception times do not decrease
+ */
+TEST(CaptureReaderTest, read_samples)
+{
+    constexpr uint32_t SAMPLES = 50;
+    constexpr uint32_t SAMPLE_SIZE = 10000;
+
+    // Minimum chunk size, so samples are split in several chunks
+    write_capture(SAMPLES, SAMPLE_SIZE, 1);
+
+    {
+        CaptureReader reader(FILE_NAME);
+        ASSERT_GT(reader.header().chunk_count, 1u);
+        ASSERT_EQ(reader.sample_count(), SAMPLES);
+
+        CaptureSample sample;
+        int64_t last_time = reader.first_time();
+        for (uint32_t i = 0; i < SAMPLES; ++i)
+        {
+            ASSERT_TRUE(reader.next(sample));
+            check_sample(reader, sample, i, SAMPLE_SIZE);
+            ASSERT_GE(sample.header->reception_time, last_time);
+            last_time = sample.header->reception_time;
+        }
+        ASSERT_FALSE(reader.next(sample));
+    }
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Read the samples of a capture file twice
+ *
+ * CASES:
+ *  After rewind, samples are read again from the first one
+ */
+TEST(CaptureReaderTest, rewind)
+{
+    constexpr uint32_t SAMPLES = 10;
+    constexpr uint32_t SAMPLE_SIZE = 100;
+
+    write_capture(SAMPLES, SAMPLE_SIZE);
+
+    {
+        CaptureReader reader(FILE_NAME);
+
+        for (int round = 0; round < 2; ++round)
+        {
+            CaptureSample sample;
+            for (uint32_t i = 0; i < SAMPLES; ++i)
+            {
+                ASSERT_TRUE(reader.next(sample));
+                check_sample(reader, sample, i, SAMPLE_SIZE);
+            }
+            ASSERT_FALSE(reader.next(sample));
+
+            reader.rewind();
+        }
+    }
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Read a capture file whose index has not been written
+ *
+ * CASES:
+ *  Every sample is read although the file has no index
+ */
+TEST(CaptureReaderTest, not_closed_file)
+{
+    constexpr uint32_t SAMPLES = 10;
+    constexpr uint32_t SAMPLE_SIZE = 100;
+
+    write_capture(SAMPLES, SAMPLE_SIZE);
+
+    // Remove the reference to the index, as if the file had not been closed
+    {
+        std::fstream file(FILE_NAME, std::ios::binary | std::ios::in | std::ios::out);
+        CaptureFileHeader header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        header.index_offset = 0;
+        file.seekp(0);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    }
+
+    {
+        CaptureReader reader(FILE_NAME);
+        ASSERT_EQ(reader.topics().size(), 2u);
+        ASSERT_EQ(reader.sample_count(), SAMPLES);
+
+        CaptureSample sample;
+        for (uint32_t i = 0; i < SAMPLES; ++i)
+        {
+            ASSERT_TRUE(reader.next(sample));
+            check_sample(reader, sample, i, SAMPLE_SIZE);
+        }
+        ASSERT_FALSE(reader.next(sample));
+    }
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Write and read samples without payload, as disposes and unregisters of keyed topics
+ *
+ * CASES:
+ *  Sample with zero-length payload is written and read between samples with payload
+ *  Change kind of each sample is kept
+ */
+TEST(CaptureReaderTest, zero_length_sample)
+{
+    constexpr uint32_t SAMPLE_SIZE = 100;
+
+    {
+        auto pool = std::make_shared<FastPayloadPool>();
+        CaptureWriter writer(FILE_NAME, 1024 * 1024, 64 * 1024 * 1024, pool);
+        uint32_t topic_id = writer.register_topic(DdsTopic("topic_a", "type_a", true, TopicQoS()));
+
+        write_sample(writer, *pool, topic_id, SAMPLE_SIZE, 0, 0);
+
+        DataReceived dispose;
+        dispose.properties.kind = eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED;
+        dispose.properties.origin_sequence_number = eprosima::fastrtps::rtps::SequenceNumber_t(0, 1);
+        ASSERT_TRUE(writer.write_data(topic_id, dispose));
+
+        write_sample(writer, *pool, topic_id, SAMPLE_SIZE, 2, 2);
+
+        writer.close();
+    }
+
+    {
+        CaptureReader reader(FILE_NAME);
+        ASSERT_EQ(reader.sample_count(), 3u);
+
+        CaptureSample sample;
+        ASSERT_TRUE(reader.next(sample));
+        ASSERT_EQ(sample.header->payload_length, SAMPLE_SIZE);
+        ASSERT_EQ(sample.header->change_kind, static_cast<uint16_t>(eprosima::fastrtps::rtps::ALIVE));
+
+        ASSERT_TRUE(reader.next(sample));
+        ASSERT_EQ(sample.header->payload_length, 0u);
+        ASSERT_EQ(sample.header->sequence_number, 1u);
+        ASSERT_EQ(sample.header->change_kind, static_cast<uint16_t>(eprosima::fastrtps::rtps::NOT_ALIVE_DISPOSED));
+
+        ASSERT_TRUE(reader.next(sample));
+        ASSERT_EQ(sample.header->payload_length, SAMPLE_SIZE);
+        ASSERT_EQ(sample.header->sequence_number, 2u);
+        ASSERT_EQ(sample.payload[0], 2);
+
+        ASSERT_FALSE(reader.next(sample));
+    }
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Open files that are not capture files
+ *
+ * CASES:
+ *  File does not exist
+ *  File too small
+ *  File with wrong magic
+ */
+TEST(CaptureReaderTest, invalid_file)
+{
+    std::remove(FILE_NAME);
+    ASSERT_THROW(CaptureReader reader(FILE_NAME), eprosima::utils::InitializationException);
+
+    {
+        std::ofstream file(FILE_NAME, std::ios::binary | std::ios::trunc);
+        file << "DDSRCAP";
+    }
+    ASSERT_THROW(CaptureReader reader(FILE_NAME), eprosima::utils::InitializationException);
+
+    {
+        std::ofstream file(FILE_NAME, std::ios::binary | std::ios::trunc);
+        std::string content(CAPTURE_FILE_HEADER_SIZE, 'x');
+        file << content;
+    }
+    ASSERT_THROW(CaptureReader reader(FILE_NAME), eprosima::utils::InitializationException);
+
+    std::remove(FILE_NAME);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,360 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <capture/CaptureFormat.hpp>
+#include <capture/CaptureWriter.hpp>
+#include <efficiency/payload/FastPayloadPool.hpp>
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::capture;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace capture_test {
+
+constexpr const char* FILE_NAME = "capture_writer_test.ddscap";
+
+//! Record read from a capture file
+struct Record
+{
+    CaptureRecordHeader header;
+    std::vector<uint8_t> content;
+};
+
+//! Whole content of a capture file
+std::vector<uint8_t> read_file(
+        const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    return std::vector<uint8_t>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+}
+
+//! Copy a struct from the file content at \c offset
+template <typename T>
+T read_struct(
+        const std::vector<uint8_t>& file,
+        uint64_t offset)
+{
+    T value;
+    std::memcpy(&value, file.data() + offset, sizeof(T));
+    return value;
+}
+
+//! Every chunk header of the file
+std::vector<CaptureChunkHeader> read_chunks(
+        const std::vector<uint8_t>& file)
+{
+    CaptureFileHeader file_header = read_struct<CaptureFileHeader>(file, 0);
+
+    std::vector<CaptureChunkHeader> chunks;
+    for (uint64_t offset = CAPTURE_FILE_HEADER_SIZE; offset < file_header.index_offset;)
+    {
+        CaptureChunkHeader chunk = read_struct<CaptureChunkHeader>(file, offset);
+        chunks.push_back(chunk);
+        offset += chunk.size;
+    }
+    return chunks;
+}
+
+//! Every record of the file, in order
+std::vector<Record> read_records(
+        const std::vector<uint8_t>& file)
+{
+    CaptureFileHeader file_header = read_struct<CaptureFileHeader>(file, 0);
+
+    std::vector<Record> records;
+    for (uint64_t chunk_offset = CAPTURE_FILE_HEADER_SIZE; chunk_offset < file_header.index_offset;)
+    {
+        CaptureChunkHeader chunk = read_struct<CaptureChunkHeader>(file, chunk_offset);
+
+        for (uint64_t offset = chunk_offset + sizeof(CaptureChunkHeader); offset < chunk_offset + chunk.used;)
+        {
+            Record record;
+            record.header = read_struct<CaptureRecordHeader>(file, offset);
+            const uint8_t* content = file.data() + offset + sizeof(CaptureRecordHeader);
+            record.content.assign(content, content + record.header.payload_length);
+            records.push_back(record);
+            offset += record.header.size;
+        }
+
+        chunk_offset += chunk.size;
+    }
+    return records;
+}
+
+//! Sample with a payload of \c size bytes with value \c value , reserved from \c pool
+std::unique_ptr<DataReceived> sample(
+        PayloadPool& pool,
+        uint32_t size,
+        uint8_t value,
+        uint32_t sequence_number)
+{
+    std::unique_ptr<DataReceived> data = std::make_unique<DataReceived>();
+    pool.get_payload(size, data->payload);
+    data->payload.length = size;
+    std::memset(data->payload.data, value, size);
+
+    data->properties.source_timestamp = DataTime(1, sequence_number);
+    data->properties.origin_sequence_number = eprosima::fastrtps::rtps::SequenceNumber_t(0, sequence_number);
+    data->properties.source_guid.guidPrefix.value[0] = value;
+    data->properties.source_guid.entityId.value[3] = 0x03;
+
+    return data;
+}
+
+} /* namespace capture_test */
+
+using namespace capture_test;
+
+/**
+ * Create a capture file and close it without writing anything
+ *
+ * CASES:
+ *  Header is correct
+ *  There are no chunks
+ *  Index is empty
+ */
+TEST(CaptureWriterTest, empty_capture)
+{
+    auto pool = std::make_shared<FastPayloadPool>();
+    {
+        CaptureWriter writer(FILE_NAME, 1024 * 1024, 1024 * 1024, pool);
+    }
+
+    std::vector<uint8_t> file = read_file(FILE_NAME);
+    ASSERT_GE(file.size(), sizeof(CaptureFileHeader));
+
+    CaptureFileHeader header = read_struct<CaptureFileHeader>(file, 0);
+    ASSERT_EQ(std::memcmp(header.magic, CAPTURE_MAGIC, sizeof(CAPTURE_MAGIC)), 0);
+    ASSERT_EQ(header.version, CAPTURE_VERSION);
+    ASSERT_EQ(header.topic_count, 0u);
+    ASSERT_EQ(header.chunk_count, 0u);
+    ASSERT_EQ(header.index_offset, CAPTURE_FILE_HEADER_SIZE);
+    ASSERT_LE(header.start_time, header.end_time);
+
+    CaptureIndexHeader index = read_struct<CaptureIndexHeader>(file, header.index_offset);
+    ASSERT_EQ(index.magic, CAPTURE_INDEX_MAGIC);
+    ASSERT_EQ(index.topic_count, 0u);
+    ASSERT_EQ(file.size(), header.index_offset + header.index_size);
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Write samples of two topics and read them back
+ *
+ * CASES:
+ *  Topic records are written before the data of the topic
+ *  Payload and properties of each sample are written
+ *  Every payload retained is released
+ */
+TEST(CaptureWriterTest, write_samples)
+{
+    constexpr uint32_t SAMPLES = 20;
+
+    auto pool = std::make_shared<FastPayloadPool>();
+    {
+        CaptureWriter writer(FILE_NAME, 1024 * 1024, 1024 * 1024, pool);
+
+        DdsTopic topic_a("topic_a", "type_a");
+        DdsTopic topic_b("topic_b", "type_b", true, TopicQoS());
+        uint32_t id_a = writer.register_topic(topic_a);
+        uint32_t id_b = writer.register_topic(topic_b);
+        ASSERT_NE(id_a, id_b);
+
+        for (uint32_t i = 0; i < SAMPLES; ++i)
+        {
+            std::unique_ptr<DataReceived> data = sample(*pool, 10 + i, static_cast<uint8_t>(i), i);
+            ASSERT_TRUE(writer.write_data(i % 2 ? id_b : id_a, *data));
+
+            // The Track releases the payload right after writing it
+            pool->release_payload(data->payload);
+        }
+
+        writer.close();
+        ASSERT_EQ(writer.samples_written(), SAMPLES);
+        ASSERT_EQ(writer.samples_dropped(), 0u);
+    }
+
+    ASSERT_TRUE(pool->is_clean());
+
+    std::vector<uint8_t> file = read_file(FILE_NAME);
+    CaptureFileHeader header = read_struct<CaptureFileHeader>(file, 0);
+    ASSERT_EQ(header.topic_count, 2u);
+    ASSERT_EQ(header.chunk_count, 1u);
+
+    std::vector<Record> records = read_records(file);
+    ASSERT_EQ(records.size(), SAMPLES + 2);
+
+    // Topic records
+    ASSERT_EQ(records[0].header.kind, static_cast<uint16_t>(CaptureRecordKind::topic));
+    ASSERT_EQ(records[0].header.topic_id, 0u);
+    ASSERT_EQ(std::string(reinterpret_cast<const char*>(records[0].content.data())), "topic_a");
+    ASSERT_EQ(records[0].content.back(), 0u);
+    ASSERT_EQ(records[1].header.kind, static_cast<uint16_t>(CaptureRecordKind::topic));
+    ASSERT_EQ(records[1].content.back(), CAPTURE_TOPIC_KEYED);
+
+    // Data records
+    for (uint32_t i = 0; i < SAMPLES; ++i)
+    {
+        const Record& record = records[i + 2];
+        ASSERT_EQ(record.header.kind, static_cast<uint16_t>(CaptureRecordKind::data));
+        ASSERT_EQ(record.header.topic_id, i % 2);
+        ASSERT_EQ(record.header.size % CAPTURE_RECORD_ALIGNMENT, 0u);
+        ASSERT_EQ(record.header.sequence_number, i);
+        ASSERT_EQ(record.header.source_time, 1000000000 + static_cast<int64_t>(i));
+        ASSERT_EQ(record.header.source_guid[0], static_cast<uint8_t>(i));
+        ASSERT_EQ(record.header.source_guid[15], 0x03);
+        ASSERT_EQ(record.content, std::vector<uint8_t>(10 + i, static_cast<uint8_t>(i)));
+    }
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Write samples that do not fit in a single chunk
+ *
+ * CASES:
+ *  Several chunks are created
+ *  A record bigger than the chunk size gets a bigger chunk
+ *  The index has an entry per chunk for the topic
+ */
+TEST(CaptureWriterTest, multiple_chunks)
+{
+    constexpr uint32_t SAMPLES = 10;
+    constexpr uint32_t SAMPLE_SIZE = 20000;
+    constexpr uint32_t BIG_SAMPLE_SIZE = 100000;
+
+    auto pool = std::make_shared<FastPayloadPool>();
+    {
+        // Minimum chunk size
+        CaptureWriter writer(FILE_NAME, 1, 16 * 1024 * 1024, pool);
+        uint32_t topic_id = writer.register_topic(DdsTopic("topic", "type"));
+
+        for (uint32_t i = 0; i < SAMPLES; ++i)
+        {
+            std::unique_ptr<DataReceived> data = sample(*pool, SAMPLE_SIZE, static_cast<uint8_t>(i), i);
+            ASSERT_TRUE(writer.write_data(topic_id, *data));
+            pool->release_payload(data->payload);
+        }
+
+        std::unique_ptr<DataReceived> big_data = sample(*pool, BIG_SAMPLE_SIZE, 0xFF, SAMPLES);
+        ASSERT_TRUE(writer.write_data(topic_id, *big_data));
+        pool->release_payload(big_data->payload);
+    }
+
+    ASSERT_TRUE(pool->is_clean());
+
+    std::vector<uint8_t> file = read_file(FILE_NAME);
+    CaptureFileHeader header = read_struct<CaptureFileHeader>(file, 0);
+    ASSERT_EQ(header.chunk_size, CAPTURE_ALIGNMENT);
+    ASSERT_GT(header.chunk_count, 1u);
+
+    std::vector<CaptureChunkHeader> chunks = read_chunks(file);
+    ASSERT_EQ(chunks.size(), header.chunk_count);
+    for (const CaptureChunkHeader& chunk : chunks)
+    {
+        ASSERT_EQ(chunk.magic, CAPTURE_CHUNK_MAGIC);
+        ASSERT_LE(chunk.used, chunk.size);
+        ASSERT_LE(chunk.first_time, chunk.last_time);
+    }
+
+    // The big sample is alone in the last chunk
+    ASSERT_GT(chunks.back().size, BIG_SAMPLE_SIZE);
+    ASSERT_EQ(chunks.back().record_count, 1u);
+
+    std::vector<Record> records = read_records(file);
+    ASSERT_EQ(records.size(), SAMPLES + 2);
+    ASSERT_EQ(records.back().content, std::vector<uint8_t>(BIG_SAMPLE_SIZE, 0xFF));
+
+    // Index of the only topic
+    uint64_t offset = header.index_offset;
+    CaptureIndexHeader index = read_struct<CaptureIndexHeader>(file, offset);
+    ASSERT_EQ(index.topic_count, 1u);
+    offset += sizeof(CaptureIndexHeader);
+
+    CaptureTopicIndexHeader topic_index = read_struct<CaptureTopicIndexHeader>(file, offset);
+    ASSERT_EQ(topic_index.topic_id, 0u);
+    ASSERT_EQ(topic_index.entry_count, header.chunk_count);
+    ASSERT_EQ(topic_index.sample_count, SAMPLES + 1);
+    offset += sizeof(CaptureTopicIndexHeader);
+
+    for (uint32_t i = 0; i < topic_index.entry_count; ++i)
+    {
+        CaptureIndexEntry entry = read_struct<CaptureIndexEntry>(file, offset + i * sizeof(CaptureIndexEntry));
+        CaptureRecordHeader record = read_struct<CaptureRecordHeader>(file, entry.offset);
+        ASSERT_EQ(record.kind, static_cast<uint16_t>(CaptureRecordKind::data));
+        ASSERT_EQ(record.reception_time, entry.time);
+    }
+
+    std::remove(FILE_NAME);
+}
+
+/**
+ * Write samples when the pending buffer is full
+ *
+ * CASES:
+ *  Samples are dropped instead of blocking
+ *  Topic records are never dropped
+ *  Dropped payloads are released
+ */
+TEST(CaptureWriterTest, drop_samples)
+{
+    constexpr uint32_t SAMPLES = 10;
+
+    auto pool = std::make_shared<FastPayloadPool>();
+    {
+        // Buffer so small that no sample fits
+        CaptureWriter writer(FILE_NAME, 1024 * 1024, 1, pool);
+        uint32_t topic_id = writer.register_topic(DdsTopic("topic", "type"));
+
+        for (uint32_t i = 0; i < SAMPLES; ++i)
+        {
+            std::unique_ptr<DataReceived> data = sample(*pool, 100, static_cast<uint8_t>(i), i);
+            ASSERT_FALSE(writer.write_data(topic_id, *data));
+            pool->release_payload(data->payload);
+        }
+
+        writer.close();
+        ASSERT_EQ(writer.samples_written(), 0u);
+        ASSERT_EQ(writer.samples_dropped(), SAMPLES);
+    }
+
+    ASSERT_TRUE(pool->is_clean());
+
+    std::vector<Record> records = read_records(read_file(FILE_NAME));
+    ASSERT_EQ(records.size(), 1u);
+    ASSERT_EQ(records[0].header.kind, static_cast<uint16_t>(CaptureRecordKind::topic));
+
+    std::remove(FILE_NAME);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,189 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <map>
+#include <set>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <communication/rpc/RPCRequestRouter.hpp>
+#include <ddsrouter_core/types/dds/Guid.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace {
+
+//! Participants with servers behind them
+std::vector<ParticipantId> test_candidates()
+{
+    return {ParticipantId("participant_0"), ParticipantId("participant_1"), ParticipantId("participant_2")};
+}
+
+Guid client_guid(
+        uint8_t value)
+{
+    Guid guid;
+    guid.guidPrefix.value[0] = 0x01;
+    guid.guidPrefix.value[11] = value;
+    guid.entityId.value[3] = 0x03;
+    return guid;
+}
+
+std::size_t no_outstanding_requests(
+        const ParticipantId&)
+{
+    return 0;
+}
+
+} /* namespace */
+
+/**
+ * Every request is forwarded through every candidate
+ */
+TEST(RPCRequestRouterTest, broadcast)
+{
+    RPCRequestRouter router(RPCRoutingPolicy::broadcast);
+    std::vector<ParticipantId> candidates = test_candidates();
+
+    for (uint8_t i = 0; i < 5; ++i)
+    {
+        ASSERT_EQ(router.route(candidates, client_guid(i), no_outstanding_requests), candidates);
+    }
+}
+
+/**
+ * Requests are forwarded through a single candidate, taking them in turns
+ */
+TEST(RPCRequestRouterTest, round_robin)
+{
+    RPCRequestRouter router(RPCRoutingPolicy::round_robin);
+    std::vector<ParticipantId> candidates = test_candidates();
+    std::map<ParticipantId, unsigned int> routed;
+
+    for (unsigned int i = 0; i < 3 * candidates.size(); ++i)
+    {
+        std::vector<ParticipantId> targets = router.route(candidates, client_guid(0), no_outstanding_requests);
+        ASSERT_EQ(targets.size(), 1u);
+        ASSERT_EQ(targets[0], candidates[i % candidates.size()]);
+        routed[targets[0]]++;
+    }
+
+    // Same number of requests through each participant
+    for (const ParticipantId& candidate : candidates)
+    {
+        ASSERT_EQ(routed[candidate], 3u);
+    }
+
+    // A participant disappearing does not stop the rotation among the rest
+    candidates.pop_back();
+    std::set<ParticipantId> targets;
+    for (unsigned int i = 0; i < candidates.size(); ++i)
+    {
+        std::vector<ParticipantId> request_targets = router.route(candidates, client_guid(0), no_outstanding_requests);
+        ASSERT_EQ(request_targets.size(), 1u);
+        targets.insert(request_targets[0]);
+    }
+    ASSERT_EQ(targets.size(), candidates.size());
+}
+
+/**
+ * Requests are forwarded through the candidate with fewer requests pending of reply
+ */
+TEST(RPCRequestRouterTest, least_outstanding)
+{
+    RPCRequestRouter router(RPCRoutingPolicy::least_outstanding);
+    std::vector<ParticipantId> candidates = test_candidates();
+    std::map<ParticipantId, std::size_t> outstanding =
+    {
+        {candidates[0], 4},
+        {candidates[1], 2},
+        {candidates[2], 3},
+    };
+
+    auto outstanding_requests = [&outstanding](const ParticipantId& participant_id)
+            {
+                return outstanding[participant_id];
+            };
+
+    // Simulate requests that are never replied: load is balanced among participants
+    for (unsigned int i = 0; i < 10; ++i)
+    {
+        std::vector<ParticipantId> targets = router.route(candidates, client_guid(0), outstanding_requests);
+        ASSERT_EQ(targets.size(), 1u);
+
+        for (const ParticipantId& candidate : candidates)
+        {
+            ASSERT_LE(outstanding[targets[0]], outstanding[candidate]);
+        }
+        outstanding[targets[0]]++;
+    }
+
+    // 4 + 2 + 3 + 10 requests shared as evenly as possible
+    for (const ParticipantId& candidate : candidates)
+    {
+        ASSERT_GE(outstanding[candidate], 6u);
+        ASSERT_LE(outstanding[candidate], 7u);
+    }
+}
+
+/**
+ * Requests of the same client are always forwarded through the same candidate
+ */
+TEST(RPCRequestRouterTest, hash_by_client)
+{
+    RPCRequestRouter router(RPCRoutingPolicy::hash_by_client);
+    std::vector<ParticipantId> candidates = test_candidates();
+    std::set<ParticipantId> used_targets;
+
+    for (uint8_t client = 0; client < 30; ++client)
+    {
+        std::vector<ParticipantId> first_targets = router.route(candidates, client_guid(client), no_outstanding_requests);
+        ASSERT_EQ(first_targets.size(), 1u);
+        used_targets.insert(first_targets[0]);
+
+        for (unsigned int i = 0; i < 5; ++i)
+        {
+            ASSERT_EQ(router.route(candidates, client_guid(client), no_outstanding_requests), first_targets);
+        }
+    }
+
+    // Different clients are spread among participants
+    ASSERT_GT(used_targets.size(), 1u);
+}
+
+/**
+ * No participant is chosen if there are no candidates, whatever the policy
+ */
+TEST(RPCRequestRouterTest, no_candidates)
+{
+    for (RPCRoutingPolicy policy :
+            {RPCRoutingPolicy::broadcast, RPCRoutingPolicy::round_robin, RPCRoutingPolicy::least_outstanding,
+             RPCRoutingPolicy::hash_by_client})
+    {
+        RPCRequestRouter router(policy);
+        ASSERT_TRUE(router.route({}, client_guid(0), no_outstanding_requests).empty());
+        ASSERT_EQ(router.policy(), policy);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,308 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <mutex>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <communication/rpc/ServiceRegistry.hpp>
+#include <ddsrouter_core/configuration/ServiceConfiguration.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/topic/rpc/RPCTopic.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace {
+
+RPCTopic test_service()
+{
+    return RPCTopic(
+        "service",
+        DdsTopic("rq/serviceRequest", "service_Request_"),
+        DdsTopic("rr/serviceReply", "service_Response_"));
+}
+
+SequenceNumber sequence_number(
+        uint32_t value)
+{
+    return SequenceNumber(0, value);
+}
+
+std::pair<ParticipantId, SampleIdentity> entry(
+        const std::string& participant_name,
+        uint32_t value)
+{
+    SampleIdentity identity;
+    identity.sequence_number(sequence_number(value));
+    return {ParticipantId(participant_name), identity};
+}
+
+} /* namespace */
+
+/**
+ * Add entries, get them and erase them
+ */
+TEST(ServiceRegistryTest, add_get_erase)
+{
+    ServiceRegistry registry(test_service(), ParticipantId("participant"));
+
+    for (uint32_t i = 1; i <= 10; ++i)
+    {
+        registry.add(sequence_number(i), entry("server_" + std::to_string(i), i));
+    }
+    ASSERT_EQ(registry.size(), 10u);
+
+    for (uint32_t i = 1; i <= 10; ++i)
+    {
+        auto value = registry.get(sequence_number(i));
+        ASSERT_EQ(value.first, ParticipantId("server_" + std::to_string(i)));
+        ASSERT_EQ(value.second.sequence_number(), sequence_number(i));
+    }
+
+    // Not present
+    ASSERT_FALSE(registry.get(sequence_number(11)).first.is_valid());
+
+    registry.erase(sequence_number(5));
+    ASSERT_FALSE(registry.get(sequence_number(5)).first.is_valid());
+    ASSERT_EQ(registry.size(), 9u);
+
+    // Erase not present does nothing
+    registry.erase(sequence_number(5));
+    registry.erase(sequence_number(100));
+    ASSERT_EQ(registry.size(), 9u);
+
+    ASSERT_EQ(registry.evicted_count(), 0u);
+    ASSERT_EQ(registry.expired_count(), 0u);
+}
+
+/**
+ * Adding an entry with a sequence number already present keeps the old one
+ */
+TEST(ServiceRegistryTest, duplicated_entry)
+{
+    ServiceRegistry registry(test_service(), ParticipantId("participant"));
+
+    registry.add(sequence_number(1), entry("server_1", 1));
+    registry.add(sequence_number(1), entry("server_2", 1));
+
+    ASSERT_EQ(registry.size(), 1u);
+    ASSERT_EQ(registry.get(sequence_number(1)).first, ParticipantId("server_1"));
+}
+
+/**
+ * When maximum capacity is reached, oldest entries are evicted
+ */
+TEST(ServiceRegistryTest, evict_when_full)
+{
+    configuration::ServiceConfiguration configuration;
+    configuration.max_pending_requests = 4;
+    ServiceRegistry registry(test_service(), ParticipantId("participant"), configuration);
+
+    ASSERT_EQ(registry.capacity(), 4u);
+
+    for (uint32_t i = 1; i <= 6; ++i)
+    {
+        registry.add(sequence_number(i), entry("server", i));
+    }
+
+    ASSERT_EQ(registry.size(), 4u);
+    ASSERT_EQ(registry.evicted_count(), 2u);
+
+    ASSERT_FALSE(registry.get(sequence_number(1)).first.is_valid());
+    ASSERT_FALSE(registry.get(sequence_number(2)).first.is_valid());
+    for (uint32_t i = 3; i <= 6; ++i)
+    {
+        ASSERT_TRUE(registry.get(sequence_number(i)).first.is_valid());
+    }
+
+    // Replied entries are not evicted
+    registry.erase(sequence_number(3));
+    registry.add(sequence_number(7), entry("server", 7));
+    ASSERT_EQ(registry.evicted_count(), 2u);
+}
+
+/**
+ * Registry grows up to its capacity keeping every entry, even if it is not a power of two
+ */
+TEST(ServiceRegistryTest, grow_on_demand)
+{
+    configuration::ServiceConfiguration configuration;
+    configuration.max_pending_requests = 1000;
+    ServiceRegistry registry(test_service(), ParticipantId("participant"), configuration);
+
+    for (uint32_t i = 1; i <= 1000; ++i)
+    {
+        registry.add(sequence_number(i), entry("server", i));
+    }
+
+    ASSERT_EQ(registry.size(), 1000u);
+    ASSERT_EQ(registry.evicted_count(), 0u);
+
+    for (uint32_t i = 1; i <= 1000; ++i)
+    {
+        ASSERT_EQ(registry.get(sequence_number(i)).second.sequence_number(), sequence_number(i));
+    }
+
+    // Once full, it evicts
+    registry.add(sequence_number(1001), entry("server", 1001));
+    ASSERT_EQ(registry.size(), 1000u);
+    ASSERT_EQ(registry.evicted_count(), 1u);
+    ASSERT_FALSE(registry.get(sequence_number(1)).first.is_valid());
+}
+
+/**
+ * Entries older than the timeout are not returned and are counted as expired
+ */
+TEST(ServiceRegistryTest, expire_entries)
+{
+    configuration::ServiceConfiguration configuration;
+    configuration.request_timeout = std::chrono::milliseconds(50);
+    ServiceRegistry registry(test_service(), ParticipantId("participant"), configuration);
+
+    registry.add(sequence_number(1), entry("server", 1));
+    registry.add(sequence_number(2), entry("server", 2));
+    registry.add(sequence_number(3), entry("server", 3));
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    registry.add(sequence_number(4), entry("server", 4));
+
+    // Adding removes expired entries
+    ASSERT_EQ(registry.size(), 1u);
+    ASSERT_EQ(registry.expired_count(), 3u);
+    ASSERT_FALSE(registry.get(sequence_number(1)).first.is_valid());
+    ASSERT_TRUE(registry.get(sequence_number(4)).first.is_valid());
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+    // Getting an expired entry removes it
+    ASSERT_FALSE(registry.get(sequence_number(4)).first.is_valid());
+    ASSERT_EQ(registry.size(), 0u);
+    ASSERT_EQ(registry.expired_count(), 4u);
+    ASSERT_EQ(registry.evicted_count(), 0u);
+}
+
+/**
+ * Two replies to the same request in the same batch: only the first one takes the entry
+ */
+TEST(ServiceRegistryTest, take_once)
+{
+    ServiceRegistry registry(test_service(), ParticipantId("participant"));
+
+    registry.add(sequence_number(1), entry("server_1", 1));
+    registry.add(sequence_number(2), entry("server_2", 2));
+
+    {
+        // Batch of replies fetched with the registry locked
+        std::lock_guard<std::recursive_mutex> lock(registry.get_mutex());
+
+        auto first_reply = registry.take(sequence_number(1));
+        auto second_reply = registry.take(sequence_number(1));
+
+        ASSERT_EQ(first_reply.first, ParticipantId("server_1"));
+        ASSERT_EQ(first_reply.second.sequence_number(), sequence_number(1));
+        ASSERT_FALSE(second_reply.first.is_valid());
+    }
+
+    // Later replies to the same request find nothing either, while the first one is forwarded and once it has been
+    ASSERT_FALSE(registry.take(sequence_number(1)).first.is_valid());
+    ASSERT_EQ(registry.size(), 2u);
+    registry.erase(sequence_number(1));
+    ASSERT_EQ(registry.size(), 1u);
+
+    ServiceParticipantStatistics statistics = registry.statistics();
+    ASSERT_EQ(statistics.replies, 1u);
+    ASSERT_EQ(statistics.orphan_replies, 2u);
+}
+
+/**
+ * The reply that takes an entry fails to be forwarded: a later reply to the same request takes it
+ *
+ * CASES:
+ *  Restored entry can be taken again
+ *  Round trip time and replies are only counted for the first reply
+ *  Restoring an entry no longer present does nothing
+ */
+TEST(ServiceRegistryTest, restore_on_failed_reply)
+{
+    ServiceRegistry registry(test_service(), ParticipantId("participant"));
+
+    registry.add(sequence_number(1), entry("server_1", 1));
+
+    // Write of first reply fails
+    ASSERT_EQ(registry.take(sequence_number(1)).first, ParticipantId("server_1"));
+    ASSERT_FALSE(registry.take(sequence_number(1)).first.is_valid());
+    registry.restore(sequence_number(1));
+    ASSERT_EQ(registry.size(), 1u);
+
+    // Write of second reply succeeds
+    ASSERT_EQ(registry.take(sequence_number(1)).first, ParticipantId("server_1"));
+    registry.erase(sequence_number(1));
+    ASSERT_EQ(registry.size(), 0u);
+
+    registry.restore(sequence_number(1));
+    ASSERT_FALSE(registry.take(sequence_number(1)).first.is_valid());
+
+    ServiceParticipantStatistics statistics = registry.statistics();
+    ASSERT_EQ(statistics.requests, 1u);
+    ASSERT_EQ(statistics.replies, 1u);
+    ASSERT_EQ(statistics.orphan_replies, 2u);
+    ASSERT_EQ(statistics.round_trip_time.count, 1u);
+}
+
+ (once per request), orphan replies and round trip times
+ */
+TEST(ServiceRegistryTest, statistics)
+{
+    configuration::ServiceConfiguration configuration;
+    configuration.max_pending_requests = 4;
+    ServiceRegistry registry(test_service(), ParticipantId("participant"), configuration);
+
+    for (uint32_t i = 1; i <= 6; ++i)
+    {
+        registry.add(sequence_number(i), entry("server", i));
+    }
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    // Reply twice to the same request: only the first one is a reply
+    ASSERT_TRUE(registry.get(sequence_number(3)).first.is_valid());
+    ASSERT_TRUE(registry.get(sequence_number(3)).first.is_valid());
+    registry.erase(sequence_number(3));
+
+    // Reply to a request already replied and to an evicted one
+    ASSERT_FALSE(registry.get(sequence_number(3)).first.is_valid());
+    ASSERT_FALSE(registry.get(sequence_number(1)).first.is_valid());
+
+    ServiceParticipantStatistics statistics = registry.statistics();
+    ASSERT_EQ(statistics.requests, 6u);
+    ASSERT_EQ(statistics.replies, 1u);
+    ASSERT_EQ(statistics.orphan_replies, 2u);
+    ASSERT_EQ(statistics.outstanding_requests, 3u);
+    ASSERT_EQ(statistics.evictions, 2u);
+    ASSERT_EQ(statistics.timeouts, 0u);
+    ASSERT_EQ(statistics.round_trip_time.count, 1u);
+    ASSERT_GE(statistics.round_trip_time.min, std::chrono::milliseconds(10));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,126 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <memory>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <cpp_utils/thread_pool/pool/SlotThreadPool.hpp>
+#include <gtest/gtest.h>
+
+#include <communication/Track.hpp>
+#include <efficiency/payload/FastPayloadPool.hpp>
+#include <reader/implementations/auxiliar/DummyReader.hpp>
+#include <writer/implementations/auxiliar/BaseWriter.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace track_test {
+
+/**
+ * Writer that fails every write until it is told to succeed
+ */
+class FailingWriter : public BaseWriter
+{
+public:
+
+    using BaseWriter::BaseWriter;
+
+    //! Whether next writes fail
+    std::atomic<bool> fail{true};
+
+protected:
+
+    utils::ReturnCode write_(
+            std::unique_ptr<DataReceived>&) noexcept override
+    {
+        return fail ? utils::ReturnCode::RETCODE_ERROR : utils::ReturnCode::RETCODE_OK;
+    }
+};
+
+//! Simulate the reception of a sample in \c reader and wait until \c track has transmitted it
+void transmit_sample(
+        DummyReader& reader,
+        const Track& track)
+{
+    DummyDataReceived data;
+    data.payload = {1, 2, 3};
+    reader.simulate_data_reception(data);
+
+    while (track.busy())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+}
+
+} /* namespace track_test */
+
+using namespace track_test;
+
+/**
+ * First forward time of a Track is only set once a Writer has written a sample
+ *
+ * CASES:
+ *  Sample that every Writer fails to write does not set the first forward time
+ *  First sample written sets the first forward time
+ *  Later samples do not change it
+ */
+TEST(TrackTest, first_forward_time_on_write)
+{
+    DdsTopic topic("topic", "type");
+    ParticipantId reader_id("reader_participant");
+    ParticipantId writer_id("writer_participant");
+
+    auto payload_pool = std::make_shared<FastPayloadPool>();
+    auto thread_pool = std::make_shared<utils::SlotThreadPool>(1);
+    thread_pool->enable();
+
+    auto reader = std::make_shared<DummyReader>(reader_id, topic, payload_pool);
+    auto writer = std::make_shared<FailingWriter>(writer_id, topic, payload_pool);
+
+    {
+        std::map<ParticipantId, std::shared_ptr<IWriter>> writers;
+        writers[writer_id] = writer;
+        Track track(topic, reader_id, reader, std::move(writers), payload_pool, thread_pool, true);
+
+        transmit_sample(*reader, track);
+        ASSERT_EQ(track.first_forward_time(), std::chrono::steady_clock::time_point());
+        ASSERT_EQ(track.statistics().dropped, 1u);
+
+        writer->fail = false;
+        std::chrono::steady_clock::time_point before_write = std::chrono::steady_clock::now();
+        transmit_sample(*reader, track);
+        std::chrono::steady_clock::time_point first_forward = track.first_forward_time();
+        ASSERT_GE(first_forward, before_write);
+
+        transmit_sample(*reader, track);
+        ASSERT_EQ(track.first_forward_time(), first_forward);
+        ASSERT_EQ(track.statistics().samples_out, 2u);
+    }
+
+    thread_pool->disable();
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
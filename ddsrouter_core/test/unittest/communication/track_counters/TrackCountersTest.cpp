@@ -0,0 +1,180 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <communication/TrackCounters.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+using Duration = LatencyHistogram::Duration;
+
+/**
+ * Single writer counters add, keep the minimum and keep the maximum
+ */
+TEST(TrackCountersTest, single_writer_counter)
+{
+    SingleWriterCounter counter;
+    ASSERT_EQ(counter.load(), 0u);
+
+    counter.add(3);
+    counter.add(4);
+    ASSERT_EQ(counter.load(), 7u);
+
+    counter.minimize(10);
+    ASSERT_EQ(counter.load(), 7u);
+    counter.minimize(2);
+    ASSERT_EQ(counter.load(), 2u);
+
+    counter.maximize(1);
+    ASSERT_EQ(counter.load(), 2u);
+    counter.maximize(20);
+    ASSERT_EQ(counter.load(), 20u);
+
+    counter.store(0);
+    ASSERT_EQ(counter.load(), 0u);
+}
+
+/**
+ * Latency counters produce the same histogram as adding the latencies to a LatencyHistogram
+ */
+TEST(TrackCountersTest, latency_counters)
+{
+    LatencyCounters counters;
+    LatencyHistogram expected;
+
+    // Empty
+    {
+        LatencyHistogram result = counters.histogram();
+        ASSERT_EQ(result.count, 0u);
+        ASSERT_EQ(result.min, expected.min);
+        ASSERT_EQ(result.max, expected.max);
+    }
+
+    for (Duration latency : {Duration(1500), Duration(1600), Duration(-5), Duration(1000000), Duration(7)})
+    {
+        counters.add(latency);
+        expected.add(latency);
+    }
+
+    LatencyHistogram result = counters.histogram();
+    ASSERT_EQ(result.buckets, expected.buckets);
+    ASSERT_EQ(result.count, expected.count);
+    ASSERT_EQ(result.total, expected.total);
+    ASSERT_EQ(result.min, expected.min);
+    ASSERT_EQ(result.max, expected.max);
+    ASSERT_EQ(result.percentile(0.5), expected.percentile(0.5));
+}
+
+/**
+ * Counters can be read from other threads while a single thread updates them,
+ * and every value read is never lower than a previous one
+ */
+TEST(TrackCountersTest, concurrent_read)
+{
+    const uint64_t samples = 100000;
+    const uint64_t bytes_per_sample = 100;
+
+    TrackCounters counters;
+
+    std::thread writer(
+        [&]()
+        {
+            for (uint64_t i = 0; i < samples; ++i)
+            {
+                counters.samples_in.add(1);
+                counters.bytes_in.add(bytes_per_sample);
+                counters.latency.add(Duration(i));
+            }
+        });
+
+    uint64_t last_samples = 0;
+    uint64_t last_count = 0;
+    while (last_samples < samples)
+    {
+        TrackStatistics statistics = counters.statistics();
+        ASSERT_GE(statistics.samples_in, last_samples);
+        ASSERT_GE(statistics.latency.count, last_count);
+        last_samples = statistics.samples_in;
+        last_count = statistics.latency.count;
+    }
+
+    writer.join();
+
+    TrackStatistics statistics = counters.statistics();
+    ASSERT_EQ(statistics.samples_in, samples);
+    ASSERT_EQ(statistics.bytes_in, samples * bytes_per_sample);
+    ASSERT_EQ(statistics.latency.count, samples);
+    ASSERT_EQ(statistics.latency.min, Duration(0));
+    ASSERT_EQ(statistics.latency.max, Duration(samples - 1));
+}
+
+/**
+ * Statistics of every Track of every topic are added up in the router total
+ */
+TEST(TrackCountersTest, statistics_total)
+{
+    TrackCounters counters_a;
+    counters_a.samples_in.add(10);
+    counters_a.samples_out.add(20);
+    counters_a.dropped.add(1);
+    counters_a.latency.add(Duration(100));
+    counters_a.profiled_transmissions.add(2);
+    counters_a.cycles.add(1000);
+    counters_a.instructions.add(1500);
+    counters_a.cache_misses.add(10);
+    counters_a.context_switches.add(1);
+
+    TrackCounters counters_b;
+    counters_b.samples_in.add(5);
+    counters_b.take_errors.add(2);
+    counters_b.write_errors.add(3);
+    counters_b.latency.add(Duration(300));
+
+    RouterStatistics router_statistics;
+    router_statistics.topics[DdsTopic("topic_a", "type")].tracks[ParticipantId("participant_1")] =
+            counters_a.statistics();
+    router_statistics.topics[DdsTopic("topic_b", "type")].tracks[ParticipantId("participant_1")] =
+            counters_b.statistics();
+    router_statistics.topics[DdsTopic("topic_b", "type")].tracks[ParticipantId("participant_2")] =
+            counters_b.statistics();
+
+    TrackStatistics total = router_statistics.total();
+    ASSERT_EQ(total.samples_in, 20u);
+    ASSERT_EQ(total.samples_out, 20u);
+    ASSERT_EQ(total.take_errors, 4u);
+    ASSERT_EQ(total.write_errors, 6u);
+    ASSERT_EQ(total.dropped, 1u);
+    ASSERT_EQ(total.latency.count, 3u);
+    ASSERT_EQ(total.latency.min, Duration(100));
+    ASSERT_EQ(total.latency.max, Duration(300));
+    ASSERT_EQ(total.profiled_transmissions, 2u);
+    ASSERT_EQ(total.cycles, 1000u);
+    ASSERT_EQ(total.instructions, 1500u);
+    ASSERT_EQ(total.cache_misses, 10u);
+    ASSERT_EQ(total.context_switches, 1u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
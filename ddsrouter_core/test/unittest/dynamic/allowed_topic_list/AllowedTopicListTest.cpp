@@ -16,6 +16,7 @@
 #include <gtest/gtest.h>
 
 #include <dynamic/AllowedTopicList.hpp>
+#include <ddsrouter_core/types/topic/filter/RegexDdsFilterTopic.hpp>
 #include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 
 using namespace eprosima::ddsrouter::core;
@@ -493,6 +494,167 @@ TEST(AllowedTopicListTest, is_topic_allowed__complex_allowlist_and_blocklist_ent
         real_topics_negative);
 }
 
+/**
+ * Test \c AllowedTopicList \c is_topic_allowed method
+ *
+ * Case using a big number of exact and wildcard filters, comparing each decision with the result of
+ * checking the filters one by one.
+ * Every topic is checked twice, so the second decision comes from the cache.
+ */
+TEST(AllowedTopicListTest, is_topic_allowed__many_filters)
+{
+    std::set<std::shared_ptr<DdsFilterTopic>> allowlist;
+    std::set<std::shared_ptr<DdsFilterTopic>> blocklist;
+
+    for (int i = 0; i < 200; ++i)
+    {
+        std::string index = std::to_string(i);
+        add_topic_to_list(allowlist, {"rt/exact_" + index, "*"});
+        add_topic_to_list(allowlist, {"rt/prefix_" + index + "*", "type*"});
+        add_topic_to_list(allowlist, {"*_suffix_" + index, "*"});
+        add_topic_to_list(blocklist, {"rt/prefix_" + index + "?blocked", "*"});
+    }
+
+    AllowedTopicList atl(allowlist, blocklist);
+
+    // Generate topics that hit, partially hit and miss the filters
+    std::vector<DdsTopic> topics;
+    for (int i = 0; i < 300; ++i)
+    {
+        std::string index = std::to_string(i);
+        topics.push_back(DdsTopic("rt/exact_" + index, "type"));
+        topics.push_back(DdsTopic("rt/exact_" + index + "_not", "type"));
+        topics.push_back(DdsTopic("rt/prefix_" + index + "_topic", "type_" + index));
+        topics.push_back(DdsTopic("rt/prefix_" + index + "_topic", "other_type"));
+        topics.push_back(DdsTopic("rt/prefix_" + index + "_blocked", "type"));
+        topics.push_back(DdsTopic("any/topic_suffix_" + index, "type"));
+        topics.push_back(DdsTopic("rt/prefix", "type"));
+    }
+
+    for (int repetition = 0; repetition < 2; ++repetition)
+    {
+        for (const DdsTopic& topic : topics)
+        {
+            // Check filters one by one
+            bool expected = false;
+            for (const auto& filter : allowlist)
+            {
+                if (filter->matches(topic))
+                {
+                    expected = true;
+                    break;
+                }
+            }
+            for (const auto& filter : blocklist)
+            {
+                if (filter->matches(topic))
+                {
+                    expected = false;
+                    break;
+                }
+            }
+
+            ASSERT_EQ(expected, atl.is_topic_allowed(topic)) << topic;
+        }
+    }
+}
+
+/**
+ * Test \c AllowedTopicList \c is_topic_allowed method
+ *
+ * Case where lists are replaced after a topic has been checked, so cached decisions must not be used.
+ */
+TEST(AllowedTopicListTest, is_topic_allowed__reassigned_lists)
+{
+    DdsTopic topic("rt/chatter", "std::string");
+
+    std::set<std::shared_ptr<DdsFilterTopic>> allowlist;
+    std::set<std::shared_ptr<DdsFilterTopic>> blocklist;
+    add_topic_to_list(blocklist, {"rt/*", "*"});
+
+    AllowedTopicList atl;
+    ASSERT_TRUE(atl.is_topic_allowed(topic));
+
+    atl = AllowedTopicList(allowlist, blocklist);
+    ASSERT_FALSE(atl.is_topic_allowed(topic));
+
+    atl.clear();
+    ASSERT_TRUE(atl.is_topic_allowed(topic));
+}
+
+/**
+ * Test \c AllowedTopicList \c is_topic_allowed method
+ *
+ * Case using regex filters, mixed with wildcard ones and with regex filters that cannot be combined
+ * (backreferences) or that have different type filters.
+ */
+TEST(AllowedTopicListTest, is_topic_allowed__regex_filters)
+{
+    std::set<std::shared_ptr<DdsFilterTopic>> allowlist;
+    std::set<std::shared_ptr<DdsFilterTopic>> blocklist;
+
+    for (int i = 0; i < 300; ++i)
+    {
+        allowlist.insert(std::make_shared<RegexDdsFilterTopic>("rt/robot_" + std::to_string(i) + "/(odom|scan)"));
+    }
+    allowlist.insert(std::make_shared<RegexDdsFilterTopic>("rt/camera_[0-9]+", std::string("sensor_msgs::.*")));
+    allowlist.insert(std::make_shared<RegexDdsFilterTopic>("(rt|rq)/(\\w+)/\\2"));
+    add_topic_to_list(allowlist, {"HelloWorld*", "*"});
+
+    blocklist.insert(std::make_shared<RegexDdsFilterTopic>("rt/robot_1[0-9]*/scan"));
+
+    AllowedTopicList atl(allowlist, blocklist);
+
+    std::vector<pair_topic_type> real_topics_positive =
+    {
+        {"rt/robot_0/odom", "type"},
+        {"rt/robot_299/scan", "type"},
+        {"rt/robot_1/odom", "type"},
+        {"rt/camera_12", "sensor_msgs::Image"},
+        {"rt/echo/echo", "type"},
+        {"HelloWorldTopic", "HelloWorld"},
+    };
+
+    std::vector<pair_topic_type> real_topics_negative =
+    {
+        {"rt/robot_300/odom", "type"},
+        {"rt/robot_1/scan", "type"},
+        {"rt/robot_150/scan", "type"},
+        {"rt/robot_0/odom/extra", "type"},
+        {"rt/camera_12", "std_msgs::Image"},
+        {"rt/camera_", "sensor_msgs::Image"},
+        {"rt/echo/other", "type"},
+        {"OtherTopic", "HelloWorld"},
+    };
+
+    for (pair_topic_type topic_name : real_topics_positive)
+    {
+        ASSERT_TRUE(atl.is_topic_allowed(DdsTopic(topic_name.first, topic_name.second))) << topic_name.first;
+    }
+
+    for (pair_topic_type topic_name : real_topics_negative)
+    {
+        ASSERT_FALSE(atl.is_topic_allowed(DdsTopic(topic_name.first, topic_name.second))) << topic_name.first;
+    }
+}
+
+/**
+ * Test \c AllowedTopicList equality
+ *
+ * Filters contained in other filters of the same list are redundant, so lists that only differ on them are equal.
+ */
+TEST(AllowedTopicListTest, redundant_filters)
+{
+    std::set<std::shared_ptr<DdsFilterTopic>> allowlist_1;
+    std::set<std::shared_ptr<DdsFilterTopic>> allowlist_2;
+    std::set<std::shared_ptr<DdsFilterTopic>> blocklist;
+
+    add_topics_to_list(allowlist_1, {{"rt/*", "*"}, {"rt/chatter", "std::string"}, {"rt/chatter*", "std*"}});
+    add_topics_to_list(allowlist_2, {{"rt/*", "*"}});
+
+    ASSERT_EQ(AllowedTopicList(allowlist_1, blocklist), AllowedTopicList(allowlist_2, blocklist));
+}
+
 int main(
         int argc,
         char** argv)
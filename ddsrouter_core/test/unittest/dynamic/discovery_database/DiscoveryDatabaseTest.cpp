@@ -42,10 +42,14 @@ class DiscoveryDatabase : public eprosima::ddsrouter::core::DiscoveryDatabase
 {
 public:
 
-    DiscoveryDatabase()
+    DiscoveryDatabase(
+            bool start_processing_thread = true)
         : eprosima::ddsrouter::core::DiscoveryDatabase()
     {
-        start();
+        if (start_processing_thread)
+        {
+            start();
+        }
     }
 
     bool add_endpoint_protected(
@@ -66,6 +70,11 @@ public:
         return erase_endpoint_(endpoint_to_erase);
     }
 
+    void process_queue_protected()
+    {
+        process_queue_();
+    }
+
 };
 
 } /* namespace test */
@@ -241,6 +250,113 @@ TEST(DiscoveryDatabaseTest, get_endpoint)
     ASSERT_EQ(discovery_database.get_endpoint(guid), endpoint);
 }
 
+/**
+ * Test \c DiscoveryDatabase secondary indices (topic and participant queries)
+ *
+ * CASES:
+ *  Topic and participant without endpoints
+ *  Writers and readers indexed separately in same topic
+ *  Endpoint updated to a different topic
+ *  Endpoints erased
+ */
+TEST(DiscoveryDatabaseTest, topic_and_participant_indices)
+{
+    test::DiscoveryDatabase discovery_database;
+    DdsTopic topic("test", "test");
+    DdsTopic new_topic("new", "new");
+    ParticipantId participant_1("participant_1");
+    ParticipantId participant_2("participant_2");
+    Guid writer_guid = random_guid(1);
+    Guid reader_guid = random_guid(2);
+    Endpoint writer(EndpointKind::writer, writer_guid, topic, participant_1);
+    Endpoint reader(EndpointKind::reader, reader_guid, topic, participant_2);
+
+    // Nothing indexed yet
+    ASSERT_TRUE(discovery_database.get_topic_endpoints(topic).empty());
+    ASSERT_TRUE(discovery_database.get_participant_endpoints(participant_1).empty());
+
+    // Insert writer and reader in the same topic
+    discovery_database.add_endpoint_protected(writer);
+    discovery_database.add_endpoint_protected(reader);
+    ASSERT_EQ(discovery_database.get_topic_endpoints(topic), std::set<Guid>({writer_guid, reader_guid}));
+    ASSERT_EQ(discovery_database.get_topic_writers(topic), std::set<Guid>({writer_guid}));
+    ASSERT_EQ(discovery_database.get_topic_readers(topic), std::set<Guid>({reader_guid}));
+    ASSERT_EQ(discovery_database.get_participant_endpoints(participant_1), std::set<Guid>({writer_guid}));
+    ASSERT_EQ(discovery_database.get_participant_endpoints(participant_2), std::set<Guid>({reader_guid}));
+
+    // Move reader to another topic
+    Endpoint updated_reader(EndpointKind::reader, reader_guid, new_topic, participant_2);
+    discovery_database.update_endpoint_protected(updated_reader);
+    ASSERT_EQ(discovery_database.get_topic_endpoints(topic), std::set<Guid>({writer_guid}));
+    ASSERT_TRUE(discovery_database.get_topic_readers(topic).empty());
+    ASSERT_EQ(discovery_database.get_topic_readers(new_topic), std::set<Guid>({reader_guid}));
+
+    // Erase every endpoint
+    discovery_database.erase_endpoint_protected(writer);
+    discovery_database.erase_endpoint_protected(updated_reader);
+    ASSERT_FALSE(discovery_database.topic_exists(topic));
+    ASSERT_FALSE(discovery_database.topic_exists(new_topic));
+    ASSERT_TRUE(discovery_database.get_participant_endpoints(participant_1).empty());
+    ASSERT_TRUE(discovery_database.get_participant_endpoints(participant_2).empty());
+}
+
+/**
+ * Test \c DiscoveryDatabase batch processing of queued operations
+ *
+ * CASES:
+ *  add + update of same endpoint are delivered as a single add with updated endpoint
+ *  add + erase of an endpoint not in database are cancelled
+ *  update + erase of same endpoint are delivered as a single erase
+ *  operations of different endpoints are all delivered in the same batch
+ */
+TEST(DiscoveryDatabaseTest, batch_coalescing)
+{
+    // Do not start processing thread so every operation is processed in the same batch
+    test::DiscoveryDatabase discovery_database(false);
+    std::vector<std::vector<DatabaseOperationItem>> batches;
+    discovery_database.add_batch_processed_callback(
+        [&batches](const std::vector<DatabaseOperationItem>& batch)
+        {
+            batches.push_back(batch);
+        });
+
+    DdsTopic topic("original", "original");
+    DdsTopic new_topic("new", "new");
+    Guid updated_guid = random_guid(1);
+    Guid cancelled_guid = random_guid(2);
+    Guid erased_guid = random_guid(3);
+
+    // Endpoint to be erased must already be in database
+    discovery_database.add_endpoint_protected(Endpoint(EndpointKind::reader, erased_guid, topic));
+
+    discovery_database.add_endpoint(Endpoint(EndpointKind::reader, updated_guid, topic));
+    discovery_database.add_endpoint(Endpoint(EndpointKind::writer, cancelled_guid, topic));
+    discovery_database.update_endpoint(Endpoint(EndpointKind::reader, erased_guid, new_topic));
+    discovery_database.update_endpoint(Endpoint(EndpointKind::reader, updated_guid, new_topic));
+    discovery_database.erase_endpoint(Endpoint(EndpointKind::writer, cancelled_guid, topic));
+    discovery_database.erase_endpoint(Endpoint(EndpointKind::reader, erased_guid, new_topic));
+
+    discovery_database.process_queue_protected();
+
+    // Only one batch with 2 operations
+    ASSERT_EQ(batches.size(), 1u);
+    ASSERT_EQ(batches[0].size(), 2u);
+
+    // Updated endpoint is added with its last information
+    ASSERT_EQ(std::get<0>(batches[0][0]), DatabaseOperation::add);
+    ASSERT_EQ(std::get<1>(batches[0][0]).guid(), updated_guid);
+    ASSERT_EQ(std::get<1>(batches[0][0]).topic(), new_topic);
+    ASSERT_EQ(discovery_database.get_endpoint(updated_guid).topic(), new_topic);
+
+    // Erased endpoint is only erased
+    ASSERT_EQ(std::get<0>(batches[0][1]), DatabaseOperation::erase);
+    ASSERT_EQ(std::get<1>(batches[0][1]).guid(), erased_guid);
+    ASSERT_FALSE(discovery_database.endpoint_exists(erased_guid));
+
+    // Cancelled endpoint never reached the database
+    ASSERT_FALSE(discovery_database.endpoint_exists(cancelled_guid));
+}
+
 int main(
         int argc,
         char** argv)
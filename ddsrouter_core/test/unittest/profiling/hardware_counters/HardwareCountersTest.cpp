@@ -0,0 +1,145 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <profiling/HardwareCounters.hpp>
+
+using namespace eprosima::ddsrouter::core;
+
+namespace test {
+
+//! Spend some CPU time in user space
+uint64_t busy_loop(
+        uint64_t iterations)
+{
+    volatile uint64_t result = 0;
+    for (uint64_t i = 0; i < iterations; ++i)
+    {
+        result = result + i * i;
+    }
+    return result;
+}
+
+} /* namespace test */
+
+/**
+ * Values since an origin are the difference of every counter
+ */
+TEST(HardwareCountersTest, since)
+{
+    HardwareCountersValues origin;
+    origin.cycles = 100;
+    origin.instructions = 200;
+    origin.cache_misses = 3;
+    origin.context_switches = 4;
+
+    HardwareCountersValues current;
+    current.cycles = 1100;
+    current.instructions = 2200;
+    current.cache_misses = 13;
+    current.context_switches = 5;
+
+    HardwareCountersValues result = current.since(origin);
+    ASSERT_EQ(result.cycles, 1000u);
+    ASSERT_EQ(result.instructions, 2000u);
+    ASSERT_EQ(result.cache_misses, 10u);
+    ASSERT_EQ(result.context_switches, 1u);
+}
+
+/**
+ * Counters never decrease, and count the work of the thread when the hardware counters are available
+ */
+TEST(HardwareCountersTest, monotonic)
+{
+    HardwareCountersValues previous = HardwareCounters::read();
+
+    for (int i = 0; i < 10; ++i)
+    {
+        test::busy_loop(100000);
+        HardwareCountersValues current = HardwareCounters::read();
+
+        ASSERT_GE(current.cycles, previous.cycles);
+        ASSERT_GE(current.instructions, previous.instructions);
+        ASSERT_GE(current.cache_misses, previous.cache_misses);
+        ASSERT_GE(current.context_switches, previous.context_switches);
+
+        if (HardwareCounters::hardware_available())
+        {
+            ASSERT_GT(current.instructions, previous.instructions);
+            ASSERT_GT(current.cycles, previous.cycles);
+        }
+        else
+        {
+            ASSERT_EQ(current.instructions, 0u);
+            ASSERT_EQ(current.cycles, 0u);
+        }
+
+        previous = current;
+    }
+}
+
+/**
+ * Sleeping gives up the CPU, so it is counted as a context switch
+ */
+TEST(HardwareCountersTest, context_switches)
+{
+#if defined(__linux__)
+    HardwareCountersValues origin = HardwareCounters::read();
+
+    for (int i = 0; i < 5; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+
+    ASSERT_GE(HardwareCounters::read().since(origin).context_switches, 5u);
+#endif // if defined(__linux__)
+}
+
+/**
+ * The work of a thread is not counted in the counters of other threads
+ */
+TEST(HardwareCountersTest, per_thread)
+{
+    HardwareCountersValues origin = HardwareCounters::read();
+    test::busy_loop(10000000);
+    HardwareCountersValues main_thread = HardwareCounters::read().since(origin);
+
+    HardwareCountersValues other_thread;
+    std::thread thread(
+        [&other_thread]()
+        {
+            HardwareCountersValues other_origin = HardwareCounters::read();
+            test::busy_loop(1000);
+            other_thread = HardwareCounters::read().since(other_origin);
+        });
+    thread.join();
+
+    if (HardwareCounters::hardware_available())
+    {
+        ASSERT_LT(other_thread.instructions, main_thread.instructions / 10);
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
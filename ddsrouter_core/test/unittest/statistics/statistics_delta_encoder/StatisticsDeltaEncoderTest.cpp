@@ -0,0 +1,210 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <statistics/StatisticsDeltaEncoder.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace test {
+
+//! Add \c samples of \c size bytes read by \c reader and written by \c writer in \c topic
+void add_data(
+        RouterStatistics& statistics,
+        const DdsTopic& topic,
+        const ParticipantId& reader,
+        const ParticipantId& writer,
+        uint64_t samples,
+        uint64_t size)
+{
+    TopicStatistics& topic_statistics = statistics.topics[topic];
+
+    TrackStatistics& track = topic_statistics.tracks[reader];
+    track.samples_in += samples;
+    track.bytes_in += samples * size;
+    track.samples_out += samples;
+    track.bytes_out += samples * size;
+
+    WriterStatistics& writer_statistics = topic_statistics.writers[writer];
+    writer_statistics.samples += samples;
+    writer_statistics.bytes += samples * size;
+}
+
+} /* namespace test */
+
+/**
+ * First sample is a full snapshot with every topic and participant, and the values accumulated until then
+ */
+TEST(StatisticsDeltaEncoderTest, first_sample_full)
+{
+    DdsTopic topic_a("topic_a", "type");
+    DdsTopic topic_b("topic_b", "type");
+    ParticipantId p1("P1");
+    ParticipantId p2("P2");
+
+    RouterStatistics statistics;
+    test::add_data(statistics, topic_a, p1, p2, 10, 100);
+    statistics.topics[topic_b];
+    statistics.payload_pool.reserved = 7;
+    statistics.payload_pool.released = 5;
+    statistics.thread_pool.threads = 4;
+
+    StatisticsDeltaEncoder encoder(0);
+    StatisticsSample sample = encoder.encode(statistics, 1000);
+
+    ASSERT_EQ(sample.sequence_number, 0u);
+    ASSERT_TRUE(sample.full);
+    ASSERT_EQ(sample.timestamp_ns, 1000u);
+    ASSERT_EQ(sample.interval_ns, 0u);
+    ASSERT_EQ(sample.topics_count, 2u);
+
+    ASSERT_EQ(sample.topics.size(), 2u);
+    ASSERT_EQ(sample.topics[0].topic_name, "topic_a");
+    ASSERT_EQ(sample.topics[0].samples_in, 10u);
+    ASSERT_EQ(sample.topics[0].bytes_out, 1000u);
+    ASSERT_EQ(sample.topics[1].topic_name, "topic_b");
+    ASSERT_EQ(sample.topics[1].samples_in, 0u);
+
+    ASSERT_EQ(sample.participants.size(), 2u);
+    ASSERT_EQ(sample.participants[0].participant_id, "P1");
+    ASSERT_EQ(sample.participants[0].samples_in, 10u);
+    ASSERT_EQ(sample.participants[0].samples_out, 0u);
+    ASSERT_EQ(sample.participants[1].participant_id, "P2");
+    ASSERT_EQ(sample.participants[1].samples_in, 0u);
+    ASSERT_EQ(sample.participants[1].bytes_out, 1000u);
+
+    ASSERT_EQ(sample.payload_pool.in_use(), 2u);
+    ASSERT_EQ(sample.thread_pool.threads, 4u);
+}
+
+/**
+ * Following samples only contain the topics and participants that have changed, with the difference of values
+ */
+TEST(StatisticsDeltaEncoderTest, only_changes)
+{
+    DdsTopic topic_a("topic_a", "type");
+    DdsTopic topic_b("topic_b", "type");
+    ParticipantId p1("P1");
+    ParticipantId p2("P2");
+    ParticipantId p3("P3");
+
+    RouterStatistics statistics;
+    test::add_data(statistics, topic_a, p1, p2, 10, 100);
+    test::add_data(statistics, topic_b, p1, p3, 5, 10);
+
+    StatisticsDeltaEncoder encoder(0);
+    encoder.encode(statistics, 1000);
+
+    // No changes
+    StatisticsSample sample = encoder.encode(statistics, 3000);
+    ASSERT_EQ(sample.sequence_number, 1u);
+    ASSERT_FALSE(sample.full);
+    ASSERT_EQ(sample.interval_ns, 2000u);
+    ASSERT_EQ(sample.topics_count, 2u);
+    ASSERT_TRUE(sample.topics.empty());
+    ASSERT_TRUE(sample.participants.empty());
+
+    // Changes in topic b
+    test::add_data(statistics, topic_b, p1, p3, 3, 10);
+    sample = encoder.encode(statistics, 4000);
+    ASSERT_EQ(sample.topics.size(), 1u);
+    ASSERT_EQ(sample.topics[0].topic_name, "topic_b");
+    ASSERT_EQ(sample.topics[0].samples_in, 3u);
+    ASSERT_EQ(sample.topics[0].bytes_in, 30u);
+    ASSERT_EQ(sample.participants.size(), 2u);
+    ASSERT_EQ(sample.participants[0].participant_id, "P1");
+    ASSERT_EQ(sample.participants[0].samples_in, 3u);
+    ASSERT_EQ(sample.participants[1].participant_id, "P3");
+    ASSERT_EQ(sample.participants[1].samples_out, 3u);
+
+    // New topic
+    DdsTopic topic_c("topic_c", "type");
+    test::add_data(statistics, topic_c, p2, p1, 1, 1);
+    sample = encoder.encode(statistics, 5000);
+    ASSERT_EQ(sample.topics_count, 3u);
+    ASSERT_EQ(sample.topics.size(), 1u);
+    ASSERT_EQ(sample.topics[0].topic_name, "topic_c");
+    ASSERT_EQ(sample.topics[0].samples_in, 1u);
+}
+
+/**
+ * Every full snapshot period a sample with every topic is generated
+ */
+TEST(StatisticsDeltaEncoderTest, full_snapshot_period)
+{
+    DdsTopic topic("topic", "type");
+    RouterStatistics statistics;
+    test::add_data(statistics, topic, ParticipantId("P1"), ParticipantId("P2"), 1, 1);
+
+    StatisticsDeltaEncoder encoder(3);
+    for (uint64_t i = 0; i < 10; ++i)
+    {
+        StatisticsSample sample = encoder.encode(statistics, i);
+        ASSERT_EQ(sample.full, i % 3 == 0);
+        ASSERT_EQ(sample.topics.size(), i % 3 == 0 ? 1u : 0u);
+    }
+}
+
+/**
+ * Latencies summarize only the latencies added since the previous sample
+ */
+TEST(StatisticsDeltaEncoderTest, latency_delta)
+{
+    DdsTopic topic("topic", "type");
+    ParticipantId p1("P1");
+
+    RouterStatistics statistics;
+    TrackStatistics& track = statistics.topics[topic].tracks[p1];
+    track.samples_in = 100;
+    for (int i = 0; i < 100; ++i)
+    {
+        track.latency.add(LatencyHistogram::Duration(1000000));
+    }
+
+    StatisticsDeltaEncoder encoder(0);
+    StatisticsSample sample = encoder.encode(statistics, 0);
+    ASSERT_EQ(sample.topics[0].latency.count, 100u);
+    ASSERT_EQ(sample.topics[0].latency.mean_ns, 1000000u);
+
+    // New latencies much lower than the previous ones
+    track.samples_in += 10;
+    for (int i = 0; i < 10; ++i)
+    {
+        track.latency.add(LatencyHistogram::Duration(100));
+    }
+
+    sample = encoder.encode(statistics, 1);
+    ASSERT_EQ(sample.topics.size(), 1u);
+    ASSERT_EQ(sample.topics[0].latency.count, 10u);
+    ASSERT_EQ(sample.topics[0].latency.mean_ns, 100u);
+    ASSERT_LE(sample.topics[0].latency.p99_ns, 128u);
+    ASSERT_LE(sample.topics[0].latency.max_ns, 128u);
+
+    // No new latencies
+    track.samples_in += 1;
+    sample = encoder.encode(statistics, 2);
+    ASSERT_EQ(sample.topics[0].latency.count, 0u);
+    ASSERT_EQ(sample.topics[0].latency.max_ns, 0u);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,196 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sstream>
+#include <thread>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <trace/TraceRecorder.hpp>
+
+using namespace eprosima::ddsrouter::core::trace;
+
+namespace test {
+
+//! Dump of the events recorded by every thread until now
+std::string dump()
+{
+    std::stringstream output;
+    TraceRecorder::instance().dump(output);
+    return output.str();
+}
+
+//! Run \c function in a new thread, so its events are recorded in a new buffer
+template <typename Function>
+void run_in_thread(
+        Function function)
+{
+    std::thread thread(function);
+    thread.join();
+}
+
+} /* namespace test */
+
+/**
+ * Events are read in the same order and with the same values they have been recorded
+ */
+TEST(TraceRecorderTest, buffer_snapshot)
+{
+    TraceBuffer buffer(7);
+
+    buffer.record(100, TraceStage::reader_take, 'B', 3, 0);
+    buffer.record(200, TraceStage::reader_take, 'E', 3, 1024);
+    buffer.record(300, TraceStage::track_data_available, 'i', 4, 1);
+
+    std::vector<TraceBuffer::Event> events = buffer.snapshot();
+
+    ASSERT_EQ(events.size(), 3u);
+    ASSERT_EQ(buffer.thread_index(), 7u);
+
+    ASSERT_EQ(events[0].timestamp, 100u);
+    ASSERT_EQ(events[0].stage, TraceStage::reader_take);
+    ASSERT_EQ(events[0].phase, 'B');
+    ASSERT_EQ(events[0].name, 3u);
+
+    ASSERT_EQ(events[1].phase, 'E');
+    ASSERT_EQ(events[1].value, 1024u);
+
+    ASSERT_EQ(events[2].timestamp, 300u);
+    ASSERT_EQ(events[2].stage, TraceStage::track_data_available);
+    ASSERT_EQ(events[2].phase, 'i');
+    ASSERT_EQ(events[2].name, 4u);
+    ASSERT_EQ(events[2].value, 1u);
+}
+
+/**
+ * When the buffer is full the oldest events are overwritten, and only the latest ones are read
+ */
+TEST(TraceRecorderTest, buffer_overflow)
+{
+    TraceBuffer buffer(1);
+
+    const uint64_t recorded = TraceBuffer::CAPACITY * 2 + 10;
+    for (uint64_t i = 0; i < recorded; ++i)
+    {
+        buffer.record(i, TraceStage::writer_write, 'i', 0, i);
+    }
+
+    std::vector<TraceBuffer::Event> events = buffer.snapshot();
+
+    ASSERT_LE(events.size(), TraceBuffer::CAPACITY);
+    ASSERT_GT(events.size(), TraceBuffer::CAPACITY / 2);
+
+    // Consecutive and ending in the last one recorded
+    for (std::size_t i = 0; i < events.size(); ++i)
+    {
+        ASSERT_EQ(events[i].value, recorded - events.size() + i);
+    }
+}
+
+/**
+ * The same name always gets the same identifier, and different names different ones
+ */
+TEST(TraceRecorderTest, register_name)
+{
+    TraceRecorder& recorder = TraceRecorder::instance();
+
+    uint32_t id_a = recorder.register_name("register_name_a");
+    uint32_t id_b = recorder.register_name("register_name_b");
+
+    ASSERT_NE(id_a, id_b);
+    ASSERT_EQ(recorder.register_name("register_name_a"), id_a);
+    ASSERT_EQ(recorder.register_name("register_name_b"), id_b);
+}
+
+/**
+ * Spans are dumped as a begin with the topic and an end with the value, in Chrome trace format
+ */
+TEST(TraceRecorderTest, dump_spans)
+{
+    uint32_t name = TraceRecorder::instance().register_name("dump_spans_topic");
+
+    test::run_in_thread(
+        [name]()
+        {
+            TraceScope scope(TraceStage::track_forward, name);
+            scope.value = 4242;
+        });
+
+    std::string output = test::dump();
+
+    ASSERT_EQ(output.find("{\"displayTimeUnit\":\"ns\",\"traceEvents\":["), 0u);
+    ASSERT_NE(output.find("\"name\":\"process_name\""), std::string::npos);
+    ASSERT_NE(output.find("\"name\":\"thread_name\""), std::string::npos);
+
+    std::size_t begin = output.find(
+        "{\"name\":\"track_forward\",\"cat\":\"ddsrouter\",\"ph\":\"B\"");
+    ASSERT_NE(begin, std::string::npos);
+    ASSERT_NE(output.find("\"args\":{\"topic\":\"dump_spans_topic\"}}", begin), std::string::npos);
+
+    std::size_t end = output.find(
+        "{\"name\":\"track_forward\",\"cat\":\"ddsrouter\",\"ph\":\"E\"", begin);
+    ASSERT_NE(end, std::string::npos);
+    ASSERT_NE(output.find("\"args\":{\"value\":4242}}", end), std::string::npos);
+
+    ASSERT_EQ(output.substr(output.size() - 4), "\n]}\n");
+}
+
+/**
+ * Ends whose begin is not in the buffer (because it has been overwritten) are not dumped
+ */
+TEST(TraceRecorderTest, dump_unmatched_end)
+{
+    uint32_t name = TraceRecorder::instance().register_name("dump_unmatched_end_topic");
+
+    test::run_in_thread(
+        [name]()
+        {
+            TraceBuffer& buffer = TraceRecorder::thread_buffer();
+            buffer.record(TraceRecorder::now(), TraceStage::rpc_replies, 'E', name, 987654321);
+            buffer.record(TraceRecorder::now(), TraceStage::rpc_data_available, 'i', name, 123456789);
+        });
+
+    std::string output = test::dump();
+
+    ASSERT_EQ(output.find("\"value\":987654321"), std::string::npos);
+    ASSERT_NE(output.find("\"args\":{\"topic\":\"dump_unmatched_end_topic\",\"value\":123456789}}"),
+        std::string::npos);
+}
+
+/**
+ * Names are escaped so the dump is always valid JSON
+ */
+TEST(TraceRecorderTest, dump_escaped_names)
+{
+    uint32_t name = TraceRecorder::instance().register_name("rt/\"quoted\"\\topic\n");
+
+    test::run_in_thread(
+        [name]()
+        {
+            TraceRecorder::thread_buffer().record(TraceRecorder::now(), TraceStage::payload_copy, 'i', name, 0);
+        });
+
+    std::string output = test::dump();
+
+    ASSERT_NE(output.find("\"topic\":\"rt/\\\"quoted\\\"\\\\topic\\u000a\""), std::string::npos);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
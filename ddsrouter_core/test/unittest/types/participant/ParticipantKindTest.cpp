@@ -53,6 +53,21 @@ TEST(ParticipantKindTest, string_conversions)
     ASSERT_EQ(std::string(
                 PARTICIPANT_KIND_STRINGS[static_cast<ParticipantKindType>(ParticipantKind::simple_rtps)]),
             std::string("simple-rtps"));
+    ASSERT_EQ(std::string(
+                PARTICIPANT_KIND_STRINGS[static_cast<ParticipantKindType>(ParticipantKind::local_shm)]),
+            std::string("local-shm"));
+    ASSERT_EQ(std::string(
+                PARTICIPANT_KIND_STRINGS[static_cast<ParticipantKindType>(ParticipantKind::in_process)]),
+            std::string("in-process"));
+    ASSERT_EQ(std::string(
+                PARTICIPANT_KIND_STRINGS[static_cast<ParticipantKindType>(ParticipantKind::recorder)]),
+            std::string("recorder"));
+    ASSERT_EQ(std::string(
+                PARTICIPANT_KIND_STRINGS[static_cast<ParticipantKindType>(ParticipantKind::replayer)]),
+            std::string("replayer"));
+    ASSERT_EQ(std::string(
+                PARTICIPANT_KIND_STRINGS[static_cast<ParticipantKindType>(ParticipantKind::load_generator)]),
+            std::string("load-generator"));
     ASSERT_EQ(std::string(PARTICIPANT_KIND_STRINGS[static_cast<ParticipantKindType>(ParticipantKind::
                     local_discovery_server)]), std::string("local-discovery-server"));
     ASSERT_EQ(std::string(
@@ -83,6 +98,28 @@ TEST(ParticipantKindTest, string_conversions)
     ASSERT_EQ(participant_kind_from_name("local"), ParticipantKind::simple_rtps);
     ASSERT_EQ(participant_kind_from_name("simple"), ParticipantKind::simple_rtps);
 
+    // Strings mapping to ParticipantKind::local_shm
+    ASSERT_EQ(participant_kind_from_name("local-shm"), ParticipantKind::local_shm);
+    ASSERT_EQ(participant_kind_from_name("shm"), ParticipantKind::local_shm);
+    ASSERT_EQ(participant_kind_from_name("shared-memory"), ParticipantKind::local_shm);
+
+    // Strings mapping to ParticipantKind::in_process
+    ASSERT_EQ(participant_kind_from_name("in-process"), ParticipantKind::in_process);
+    ASSERT_EQ(participant_kind_from_name("application"), ParticipantKind::in_process);
+
+    // Strings mapping to ParticipantKind::recorder
+    ASSERT_EQ(participant_kind_from_name("recorder"), ParticipantKind::recorder);
+    ASSERT_EQ(participant_kind_from_name("record"), ParticipantKind::recorder);
+
+    // Strings mapping to ParticipantKind::replayer
+    ASSERT_EQ(participant_kind_from_name("replayer"), ParticipantKind::replayer);
+    ASSERT_EQ(participant_kind_from_name("replay"), ParticipantKind::replayer);
+
+    // Strings mapping to ParticipantKind::load_generator
+    ASSERT_EQ(participant_kind_from_name("load-generator"), ParticipantKind::load_generator);
+    ASSERT_EQ(participant_kind_from_name("load"), ParticipantKind::load_generator);
+    ASSERT_EQ(participant_kind_from_name("generator"), ParticipantKind::load_generator);
+
     // Strings mapping to ParticipantKind::local_discovery_server
     ASSERT_EQ(participant_kind_from_name("discovery-server"), ParticipantKind::local_discovery_server);
     ASSERT_EQ(participant_kind_from_name("ds"), ParticipantKind::local_discovery_server);
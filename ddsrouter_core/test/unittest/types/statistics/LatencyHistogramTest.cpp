@@ -0,0 +1,126 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/types/statistics/LatencyHistogram.hpp>
+
+using namespace eprosima::ddsrouter::core::types;
+
+using Duration = LatencyHistogram::Duration;
+
+/**
+ * An empty histogram reports every value as 0
+ */
+TEST(LatencyHistogramTest, empty)
+{
+    LatencyHistogram histogram;
+
+    ASSERT_EQ(histogram.count, 0u);
+    ASSERT_EQ(histogram.mean(), Duration::zero());
+    ASSERT_EQ(histogram.percentile(0.5), Duration::zero());
+    ASSERT_EQ(histogram.percentile(1), Duration::zero());
+}
+
+/**
+ * Latencies are counted in logarithmic buckets
+ */
+TEST(LatencyHistogramTest, buckets)
+{
+    ASSERT_EQ(LatencyHistogram::bucket_index(Duration(0)), 0u);
+    ASSERT_EQ(LatencyHistogram::bucket_index(Duration(1)), 0u);
+    ASSERT_EQ(LatencyHistogram::bucket_index(Duration(2)), 1u);
+    ASSERT_EQ(LatencyHistogram::bucket_index(Duration(3)), 1u);
+    ASSERT_EQ(LatencyHistogram::bucket_index(Duration(1024)), 10u);
+    ASSERT_EQ(LatencyHistogram::bucket_index(Duration(2047)), 10u);
+    ASSERT_EQ(LatencyHistogram::bucket_index(Duration::max()), LatencyHistogram::NUMBER_OF_BUCKETS - 1);
+
+    ASSERT_EQ(LatencyHistogram::bucket_upper_limit(10), Duration(2048));
+    ASSERT_EQ(LatencyHistogram::bucket_upper_limit(LatencyHistogram::NUMBER_OF_BUCKETS - 1), Duration::max());
+
+    LatencyHistogram histogram;
+    histogram.add(Duration(1500));
+    histogram.add(Duration(1600));
+    histogram.add(Duration(-5));
+
+    ASSERT_EQ(histogram.buckets[10], 2u);
+    ASSERT_EQ(histogram.buckets[0], 1u);
+    ASSERT_EQ(histogram.count, 3u);
+    ASSERT_EQ(histogram.total, Duration(3100));
+    ASSERT_EQ(histogram.min, Duration(0));
+    ASSERT_EQ(histogram.max, Duration(1600));
+}
+
+/**
+ * Percentiles are approximated by the upper limit of their bucket, bounded by minimum and maximum
+ */
+TEST(LatencyHistogramTest, percentiles)
+{
+    LatencyHistogram histogram;
+
+    // 90 latencies of 100 ns, 9 of 10 us and 1 of 1 ms
+    for (unsigned int i = 0; i < 90; ++i)
+    {
+        histogram.add(Duration(100));
+    }
+    for (unsigned int i = 0; i < 9; ++i)
+    {
+        histogram.add(Duration(10000));
+    }
+    histogram.add(Duration(1000000));
+
+    ASSERT_EQ(histogram.percentile(0), Duration(128));
+    ASSERT_EQ(histogram.percentile(0.5), Duration(128));
+    ASSERT_EQ(histogram.percentile(0.9), Duration(128));
+    ASSERT_EQ(histogram.percentile(0.95), Duration(16384));
+    ASSERT_EQ(histogram.percentile(0.99), Duration(16384));
+    ASSERT_EQ(histogram.percentile(1), Duration(1000000));
+    ASSERT_EQ(histogram.mean(), Duration((90 * 100 + 9 * 10000 + 1000000) / 100));
+}
+
+/**
+ * Merging histograms is equivalent to adding every latency to one of them
+ */
+TEST(LatencyHistogramTest, merge)
+{
+    LatencyHistogram first;
+    LatencyHistogram second;
+    LatencyHistogram all;
+
+    for (int64_t i = 1; i <= 100; ++i)
+    {
+        first.add(Duration(i * 7));
+        second.add(Duration(i * 1000));
+        all.add(Duration(i * 7));
+        all.add(Duration(i * 1000));
+    }
+
+    first.merge(second);
+
+    ASSERT_EQ(first.buckets, all.buckets);
+    ASSERT_EQ(first.count, all.count);
+    ASSERT_EQ(first.total, all.total);
+    ASSERT_EQ(first.min, all.min);
+    ASSERT_EQ(first.max, all.max);
+    ASSERT_EQ(first.percentile(0.99), all.percentile(0.99));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
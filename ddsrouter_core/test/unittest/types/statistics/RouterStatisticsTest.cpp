@@ -0,0 +1,158 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <sstream>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+using namespace eprosima::ddsrouter::core::types;
+
+namespace test {
+
+//! Memory of a topic with a payload of \c bytes shared by the histories of two Writers
+MemoryStatistics memory(
+        uint64_t bytes)
+{
+    MemoryStatistics result;
+    result.writer_history_changes = 2;
+    result.writer_history_bytes = 2 * bytes;
+    result.payloads = 1;
+    result.payload_bytes = bytes;
+    return result;
+}
+
+} /* namespace test */
+
+/**
+ * Merging memory statistics adds up every field, and the bytes held are the distinct payloads and the cache changes
+ */
+TEST(RouterStatisticsTest, memory_merge)
+{
+    MemoryStatistics reader;
+    reader.reader_history_changes = 2;
+    reader.reader_history_bytes = 200;
+    reader.payloads = 2;
+    reader.payload_bytes = 200;
+    reader.cache_change_bytes = 20;
+
+    MemoryStatistics writer;
+    writer.writer_history_changes = 3;
+    writer.writer_history_bytes = 3000;
+    writer.payloads = 1;
+    writer.payload_bytes = 1000;
+    writer.cache_change_pool_elements = 5;
+    writer.cache_change_pool_reserved = 3;
+    writer.cache_change_bytes = 50;
+
+    MemoryStatistics total;
+    total.merge(reader);
+    total.merge(writer);
+    total.merge(writer);
+
+    ASSERT_EQ(total.reader_history_changes, 2u);
+    ASSERT_EQ(total.reader_history_bytes, 200u);
+    ASSERT_EQ(total.writer_history_changes, 6u);
+    ASSERT_EQ(total.writer_history_bytes, 6000u);
+    ASSERT_EQ(total.payloads, 4u);
+    ASSERT_EQ(total.payload_bytes, 2200u);
+    ASSERT_EQ(total.cache_change_pool_elements, 10u);
+    ASSERT_EQ(total.cache_change_pool_reserved, 6u);
+    ASSERT_EQ(total.cache_change_bytes, 120u);
+    // Bytes referenced by the histories are not added, as they count shared payloads more than once
+    ASSERT_EQ(total.bytes(), 2200u + 120u);
+}
+
+/**
+ * The memory of a topic is part of its statistics and of their serialization
+ */
+TEST(RouterStatisticsTest, memory_in_topic)
+{
+    TopicStatistics topic;
+    topic.memory = test::memory(12345);
+
+    std::stringstream output;
+    output << topic;
+
+    ASSERT_NE(output.str().find("memory:MemoryStatistics{"), std::string::npos);
+    ASSERT_NE(output.str().find("writer_history_bytes:24690"), std::string::npos);
+    ASSERT_NE(output.str().find("payload_bytes:12345"), std::string::npos);
+}
+
+/**
+ * The time to first forward of a topic is part of its statistics and of their serialization
+ */
+TEST(RouterStatisticsTest, time_to_first_forward_in_topic)
+{
+    TopicStatistics topic;
+    ASSERT_EQ(topic.time_to_first_forward.count(), 0);
+
+    topic.time_to_first_forward = std::chrono::milliseconds(25);
+
+    std::stringstream output;
+    output << topic;
+
+    ASSERT_NE(output.str().find("time_to_first_forward_ns:25000000"), std::string::npos);
+}
+
+/**
+ * Topics are returned from the one that holds more memory, and only the first ones requested
+ */
+TEST(RouterStatisticsTest, top_memory_topics)
+{
+    RouterStatistics statistics;
+    statistics.topics[DdsTopic("topic_a", "type")].memory = test::memory(100);
+    statistics.topics[DdsTopic("topic_b", "type")].memory = test::memory(5000);
+    statistics.topics[DdsTopic("topic_c", "type")].memory = test::memory(0);
+    statistics.topics[DdsTopic("topic_d", "type")].memory = test::memory(700);
+
+    std::vector<std::pair<DdsTopic, MemoryStatistics>> top = statistics.top_memory_topics(3);
+
+    ASSERT_EQ(top.size(), 3u);
+    ASSERT_EQ(top[0].first.topic_name, "topic_b");
+    ASSERT_EQ(top[0].second.bytes(), 5000u);
+    ASSERT_EQ(top[1].first.topic_name, "topic_d");
+    ASSERT_EQ(top[1].second.bytes(), 700u);
+    ASSERT_EQ(top[2].first.topic_name, "topic_a");
+    ASSERT_EQ(top[2].second.bytes(), 100u);
+}
+
+/**
+ * Asking for more topics than there are returns all of them
+ */
+TEST(RouterStatisticsTest, top_memory_topics_fewer_topics)
+{
+    RouterStatistics statistics;
+    ASSERT_TRUE(statistics.top_memory_topics(10).empty());
+
+    statistics.topics[DdsTopic("topic_a", "type")].memory = test::memory(100);
+    statistics.topics[DdsTopic("topic_b", "type")].memory = test::memory(200);
+
+    std::vector<std::pair<DdsTopic, MemoryStatistics>> top = statistics.top_memory_topics(10);
+
+    ASSERT_EQ(top.size(), 2u);
+    ASSERT_EQ(top[0].first.topic_name, "topic_b");
+    ASSERT_EQ(top[1].first.topic_name, "topic_a");
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
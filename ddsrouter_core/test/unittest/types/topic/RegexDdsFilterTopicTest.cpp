@@ -0,0 +1,142 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/types/topic/filter/RegexDdsFilterTopic.hpp>
+#include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+using pair_topic_type = std::pair<std::string, std::string>;
+
+/**
+ * Test RegexDdsFilterTopic matches method for positive cases
+ */
+TEST(RegexTopicTest, matches)
+{
+    std::vector<                            // Test cases
+        std::pair<
+            pair_topic_type,                // Regex Topic
+            std::vector<pair_topic_type>    // List of accepted DdsTopics
+            >> test_cases = {
+
+        {{"topic", ".*"},
+            {{"topic", "type"}, {"topic", "type1"}, {"topic", ""}}},
+
+        {{"rt/(chatter|pub)", "std_msgs::.*"},
+            {{"rt/chatter", "std_msgs::string"}, {"rt/pub", "std_msgs::int"}}},
+
+        {{"topic_[0-9]+", "type"},
+            {{"topic_0", "type"}, {"topic_123", "type"}}},
+
+        {{".*/topic", "type[12]?"},
+            {{"/topic", "type"}, {"rt/topic", "type1"}, {"a/b/topic", "type2"}}},
+    };
+
+    for (auto test_case : test_cases)
+    {
+        RegexDdsFilterTopic rt(test_case.first.first, test_case.first.second);
+
+        for (auto real_topic_names : test_case.second)
+        {
+            DdsTopic real_topic(real_topic_names.first, real_topic_names.second);
+
+            ASSERT_TRUE(rt.matches(real_topic)) << "regex: " << rt << " ; real: " << real_topic;
+        }
+    }
+}
+
+/**
+ * Test RegexDdsFilterTopic matches method for negative cases
+ *
+ * Regular expressions must match the whole name, not only a part of it.
+ */
+TEST(RegexTopicTest, non_matches)
+{
+    std::vector<                            // Test cases
+        std::pair<
+            pair_topic_type,                // Regex Topic
+            std::vector<pair_topic_type>    // List of rejected DdsTopics
+            >> test_cases = {
+
+        {{"topic", ".*"},
+            {{"topic1", "type"}, {"std_topic", "type"}}},
+
+        {{"rt/(chatter|pub)", "std_msgs::.*"},
+            {{"rt/chatter", "std::string"}, {"rt/sub", "std_msgs::int"}, {"rt/chatter/pub", "std_msgs::int"}}},
+
+        {{"topic_[0-9]+", "type"},
+            {{"topic_", "type"}, {"topic_1a", "type"}, {"topic_1", "type1"}}},
+    };
+
+    for (auto test_case : test_cases)
+    {
+        RegexDdsFilterTopic rt(test_case.first.first, test_case.first.second);
+
+        for (auto real_topic_names : test_case.second)
+        {
+            DdsTopic real_topic(real_topic_names.first, real_topic_names.second);
+
+            ASSERT_FALSE(rt.matches(real_topic)) << "regex: " << rt << " ; real: " << real_topic;
+        }
+    }
+}
+
+/**
+ * Test RegexDdsFilterTopic with key and without type
+ */
+TEST(RegexTopicTest, matches_keyed_without_type)
+{
+    RegexDdsFilterTopic rt("rt/.*");
+    rt.keyed = true;
+
+    ASSERT_TRUE(rt.matches(DdsTopic("rt/topic", "any_type", true, TopicQoS())));
+    ASSERT_FALSE(rt.matches(DdsTopic("rt/topic", "any_type", false, TopicQoS())));
+}
+
+/**
+ * Test RegexDdsFilterTopic construction with invalid regular expressions
+ */
+TEST(RegexTopicTest, invalid_regex)
+{
+    ASSERT_THROW(RegexDdsFilterTopic("topic(["), eprosima::utils::InitializationException);
+    ASSERT_THROW(RegexDdsFilterTopic("topic", std::string("type[")), eprosima::utils::InitializationException);
+}
+
+/**
+ * Test RegexDdsFilterTopic contains method
+ *
+ * A regex filter only contains equal regex filters.
+ */
+TEST(RegexTopicTest, contains)
+{
+    RegexDdsFilterTopic rt("rt/.*", std::string("type"));
+
+    ASSERT_TRUE(rt.contains(RegexDdsFilterTopic("rt/.*", std::string("type"))));
+    ASSERT_FALSE(rt.contains(RegexDdsFilterTopic("rt/.*")));
+    ASSERT_FALSE(rt.contains(RegexDdsFilterTopic("rt/topic", std::string("type"))));
+    ASSERT_FALSE(rt.contains(WildcardDdsFilterTopic("rt/topic")));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,149 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <thread>
+#include <vector>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/types/dds/Data.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+#include <writer/implementations/auxiliar/EchoWriter.hpp>
+
+using namespace eprosima::ddsrouter::core;
+using namespace eprosima::ddsrouter::core::types;
+
+namespace test {
+
+DdsTopic test_topic()
+{
+    return DdsTopic("topic", "type");
+}
+
+//! Write a sample of \c length bytes, published now
+void write_sample(
+        IWriter& writer,
+        uint32_t length)
+{
+    std::unique_ptr<DataReceived> data = std::make_unique<DataReceived>();
+    data->payload.length = length;
+    DataTime::now(data->properties.source_timestamp);
+
+    ASSERT_EQ(writer.write(data), eprosima::utils::ReturnCode::RETCODE_OK);
+}
+
+} /* namespace test */
+
+/**
+ * Statistics count samples, bytes, jitter and latency, and are reset when taken
+ */
+TEST(EchoWriterTest, take_statistics)
+{
+    EchoWriter writer(test::test_topic(), false, true);
+    writer.enable();
+
+    for (uint32_t length : {10u, 20u, 30u, 40u, 50u})
+    {
+        test::write_sample(writer, length);
+    }
+
+    EchoStatistics statistics = writer.take_statistics();
+    ASSERT_EQ(statistics.samples, 5u);
+    ASSERT_EQ(statistics.bytes, 150u);
+    // First sample has no inter-arrival, and the first inter-arrival has no previous one to compare with
+    ASSERT_EQ(statistics.jitter_count, 3u);
+    ASSERT_EQ(statistics.latency_count, 5u);
+    ASSERT_LE(statistics.latency_max, statistics.latency_sum);
+    ASSERT_GE(statistics.latency_max * statistics.latency_count, statistics.latency_sum);
+
+    // Taking them again returns nothing
+    statistics = writer.take_statistics();
+    ASSERT_EQ(statistics.samples, 0u);
+    ASSERT_EQ(statistics.bytes, 0u);
+    ASSERT_EQ(statistics.jitter_sum, 0u);
+    ASSERT_EQ(statistics.jitter_count, 0u);
+    ASSERT_EQ(statistics.latency_sum, 0u);
+    ASSERT_EQ(statistics.latency_count, 0u);
+    ASSERT_EQ(statistics.latency_max, 0u);
+
+    // Inter-arrival times keep going across takes
+    test::write_sample(writer, 5);
+
+    statistics = writer.take_statistics();
+    ASSERT_EQ(statistics.samples, 1u);
+    ASSERT_EQ(statistics.bytes, 5u);
+    ASSERT_EQ(statistics.jitter_count, 1u);
+    ASSERT_EQ(statistics.latency_count, 1u);
+}
+
+/**
+ * Without statistics mode, samples are echoed and no statistics are aggregated
+ */
+TEST(EchoWriterTest, statistics_disabled)
+{
+    EchoWriter writer(test::test_topic(), false);
+    writer.enable();
+
+    test::write_sample(writer, 10);
+    test::write_sample(writer, 10);
+
+    EchoStatistics statistics = writer.take_statistics();
+    ASSERT_EQ(statistics.samples, 0u);
+    ASSERT_EQ(statistics.bytes, 0u);
+    ASSERT_EQ(statistics.latency_count, 0u);
+}
+
+/**
+ * Several tracks writing at the same time: no sample is lost and inter-arrival times are never negative
+ */
+TEST(EchoWriterTest, concurrent_writes)
+{
+    constexpr unsigned int THREADS = 4;
+    constexpr unsigned int SAMPLES = 1000;
+
+    EchoWriter writer(test::test_topic(), false, true);
+    writer.enable();
+
+    std::vector<std::thread> threads;
+    for (unsigned int i = 0; i < THREADS; ++i)
+    {
+        threads.emplace_back(
+            [&writer]()
+            {
+                for (unsigned int j = 0; j < SAMPLES; ++j)
+                {
+                    test::write_sample(writer, 8);
+                }
+            });
+    }
+    for (std::thread& thread : threads)
+    {
+        thread.join();
+    }
+
+    EchoStatistics statistics = writer.take_statistics();
+    ASSERT_EQ(statistics.samples, THREADS * SAMPLES);
+    ASSERT_EQ(statistics.bytes, THREADS * SAMPLES * 8u);
+    ASSERT_EQ(statistics.latency_count, THREADS * SAMPLES);
+    ASSERT_LE(statistics.jitter_count, THREADS * SAMPLES - 2);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
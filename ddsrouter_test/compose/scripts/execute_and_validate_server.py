@@ -20,7 +20,7 @@ import validation
 
 DESCRIPTION = """Script to validate servers output"""
 USAGE = ('python3 execute_and_validate_server.py '
-         '[-s <samples>] [-t <timeout>] [-d]')
+         '[-s <samples>] [-t <timeout>] [--exact] [-d]')
 
 
 def parse_options():
@@ -62,6 +62,12 @@ def parse_options():
         default=0,
         help='Time to wait before starting execution.'
     )
+    parser.add_argument(
+        '--exact',
+        action='store_true',
+        help=('Run until timeout and fail unless exactly <samples> '
+              'requests are replied.')
+    )
     parser.add_argument(
         '-d',
         '--debug',
@@ -79,13 +85,64 @@ def _server_command(args):
     :param args: Arguments parsed
     :return: Command to execute the server
     """
+    samples = args.samples
+    if args.exact:
+        # Do not stop after the expected samples, so any extra one is seen
+        samples += 1
+
     command = [
         'python3', args.exe,
-        '--samples', str(args.samples)]
+        '--samples', str(samples)]
 
     return command
 
 
+def _server_parse_output(stdout, stderr):
+    """
+    Transform the output of the program in a list of replied requests.
+
+    :param stdout: Process stdout
+    :param stdout: Process stderr
+
+    :return: (List of replied requests , stderr)
+    """
+    head_message_expected = 'Request { '
+
+    lines = stdout.splitlines()
+
+    # Get only lines of format "Request { a + b = c }"
+    requests = [
+        line
+        for line
+        in lines
+        if head_message_expected in line]
+
+    return requests, stderr
+
+
+def _server_exact_validate(samples):
+    """
+    Build a validator that checks the number of requests replied.
+
+    :param samples: Number of requests expected
+
+    :return: Function to validate the output of the server
+    """
+    def validate(stdout_parsed, stderr_parsed):
+
+        # stderr is not checked, as the server is interrupted when timeout
+        # is reached
+        if len(stdout_parsed) != samples:
+            log.logger.error(
+                f'Server replied {len(stdout_parsed)} requests, '
+                f'expected {samples}.')
+            return validation.ReturnCode.NOT_VALID_MESSAGES
+
+        return validation.ReturnCode.SUCCESS
+
+    return validate
+
+
 if __name__ == '__main__':
 
     # Parse arguments
@@ -97,12 +154,23 @@ if __name__ == '__main__':
 
     command = _server_command(args)
 
-    ret_code = validation.run_and_validate(
-        command=command,
-        timeout=args.timeout,
-        delay=args.delay,
-        parse_output_function=validation.parse_default,
-        validate_output_function=validation.validate_default)
+    if args.exact:
+        # Server must keep running until timeout, replying the exact samples
+        ret_code = validation.run_and_validate(
+            command=command,
+            timeout=args.timeout,
+            delay=args.delay,
+            parse_output_function=_server_parse_output,
+            validate_output_function=_server_exact_validate(args.samples),
+            timeout_as_error=False)
+
+    else:
+        ret_code = validation.run_and_validate(
+            command=command,
+            timeout=args.timeout,
+            delay=args.delay,
+            parse_output_function=validation.parse_default,
+            validate_output_function=validation.validate_default)
 
     log.logger.info(f'Server validator exited with code {ret_code}')
 
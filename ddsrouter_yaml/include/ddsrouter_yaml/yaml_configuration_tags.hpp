@@ -49,6 +49,7 @@ constexpr const char* TOPIC_NAME_TAG("name");         //! Name of a topic
 constexpr const char* TOPIC_TYPE_NAME_TAG("type");    //! Type name of a topic
 constexpr const char* TOPIC_KIND_TAG("keyed");        //! Kind of a topic (with or without key)
 constexpr const char* TOPIC_QOS_TAG("qos");           //! QoS of a topic
+constexpr const char* TOPIC_REGEX_TAG("regex");       //! Whether name and type of a topic filter are regular expressions
 
 // QoS related tags
 constexpr const char* QOS_RELIABLE_TAG("reliability");  //! The Endpoints of that topic will be configured as RELIABLE
@@ -67,11 +68,43 @@ constexpr const char* IS_REPEATER_TAG("repeater");   //! Is participant a repeat
 constexpr const char* ECHO_DATA_TAG("data");            //! Echo Data received
 constexpr const char* ECHO_DISCOVERY_TAG("discovery");  //! Echo Discovery received
 constexpr const char* ECHO_VERBOSE_TAG("verbose");      //! Echo in verbose mode
+constexpr const char* ECHO_STATISTICS_TAG("statistics");   //! Only aggregate statistics of the data received
+constexpr const char* ECHO_STATISTICS_PERIOD_TAG("statistics-period"); //! Milliseconds between statistics summaries
 
 // RTPS related tags
 // Simple RTPS related tags
 constexpr const char* DOMAIN_ID_TAG("domain"); //! Domain Id of the participant
 
+// Shared Memory related tags
+constexpr const char* SHM_SEGMENT_SIZE_TAG("segment-size"); //! Size in bytes of the Shared Memory segment
+constexpr const char* SHM_PORT_QUEUE_CAPACITY_TAG("port-queue-capacity"); //! Messages that fit in a Shared Memory port
+
+// Recorder related tags
+constexpr const char* RECORDER_FILE_TAG("file");               //! Path of the capture file
+constexpr const char* RECORDER_CHUNK_SIZE_TAG("chunk-size");   //! Size in bytes of each chunk of the capture file
+constexpr const char* RECORDER_BUFFER_SIZE_TAG("buffer-size"); //! Bytes of samples waiting to be written before dropping
+
+// Replayer related tags
+constexpr const char* REPLAYER_FILE_TAG("file");                //! Path of the capture file
+constexpr const char* REPLAYER_SPEED_TAG("speed");              //! Replay speed factor (0 as fast as possible)
+constexpr const char* REPLAYER_START_DELAY_TAG("start-delay");  //! Milliseconds to wait before starting the replay
+
+// Load Generator related tags
+constexpr const char* LOAD_TOPIC_COUNT_TAG("topic-count");             //! Number of topics generated
+constexpr const char* LOAD_TOPIC_PREFIX_TAG("topic-prefix");           //! Prefix of the topic names generated
+constexpr const char* LOAD_TYPE_TAG("type");                           //! Type name of the topics generated
+constexpr const char* LOAD_RATE_TAG("rate");                           //! Samples per second in each topic
+constexpr const char* LOAD_BURST_TAG("burst");                         //! Samples generated together
+constexpr const char* LOAD_MIN_SIZE_TAG("min-size");                   //! Minimum sample size in bytes
+constexpr const char* LOAD_MAX_SIZE_TAG("max-size");                   //! Maximum sample size in bytes
+constexpr const char* LOAD_SIZE_DISTRIBUTION_TAG("size-distribution"); //! Distribution of the sample sizes
+constexpr const char* LOAD_SIZE_DISTRIBUTION_UNIFORM_TAG("uniform");   //! Uniform sizes
+constexpr const char* LOAD_SIZE_DISTRIBUTION_EXPONENTIAL_TAG("exponential"); //! Exponential sizes, mostly small
+constexpr const char* LOAD_KEYS_TAG("keys");                           //! Number of different keys
+constexpr const char* LOAD_RELIABLE_TAG("reliable");                   //! Generate reliable topics
+constexpr const char* LOAD_TRANSIENT_LOCAL_TAG("transient-local");     //! Generate transient local topics
+constexpr const char* LOAD_REPORT_PERIOD_TAG("report-period");         //! Milliseconds between reports
+
 // Discovery Server related tags
 constexpr const char* DISCOVERY_SERVER_GUID_PREFIX_TAG("discovery-server-guid"); //! TODO: add comment
 constexpr const char* LISTENING_ADDRESSES_TAG("listening-addresses"); //! TODO: add comment
@@ -110,7 +143,23 @@ constexpr const char* DISCOVERY_SERVER_ID_ROS_TAG("ros-discovery-server"); //! T
 // Advanced configuration
 constexpr const char* SPECS_TAG("specs"); //! Specs options for DDS Router configuration
 constexpr const char* NUMBER_THREADS_TAG("threads"); //! Number of threads to configure the thread pool
+constexpr const char* BRIDGE_CONSTRUCTION_THREADS_TAG("bridge-construction-threads"); //! Number of threads that construct Bridges
 constexpr const char* MAX_HISTORY_DEPTH_TAG("max-depth"); //! Maximum size (number of stored cache changes) for RTPS History instances
+constexpr const char* PROFILING_TAG("profiling"); //! Whether the transmissions are profiled with hardware performance counters
+constexpr const char* RPC_TAG("rpc"); //! Configuration of the tracking of service requests
+constexpr const char* RPC_MAX_PENDING_REQUESTS_TAG("max-pending-requests"); //! Maximum number of requests pending of reply
+constexpr const char* RPC_REQUEST_TIMEOUT_TAG("request-timeout"); //! Time in milliseconds after which a request pending of reply expires
+constexpr const char* RPC_SERVICES_TAG("services"); //! Specific configuration for services by name
+constexpr const char* RPC_ROUTING_POLICY_TAG("routing"); //! Policy to choose the participants a request is forwarded through
+constexpr const char* RPC_ROUTING_BROADCAST_TAG("broadcast"); //! Forward each request through every participant with servers
+constexpr const char* RPC_ROUTING_ROUND_ROBIN_TAG("round-robin"); //! Forward each request through the next participant in turn
+constexpr const char* RPC_ROUTING_LEAST_OUTSTANDING_TAG("least-outstanding"); //! Forward each request through the participant with fewer pending requests
+constexpr const char* RPC_ROUTING_HASH_BY_CLIENT_TAG("hash-by-client"); //! Forward all requests of a client through the same participant
+constexpr const char* STATISTICS_TAG("statistics"); //! Publication of the router statistics in a DDS topic
+constexpr const char* STATISTICS_ENABLE_TAG("enable"); //! Whether statistics are published (true if the section is present)
+constexpr const char* STATISTICS_TOPIC_TAG("topic"); //! Name of the topic where statistics are published
+constexpr const char* STATISTICS_PERIOD_TAG("period"); //! Milliseconds between two statistics publications
+constexpr const char* STATISTICS_FULL_SNAPSHOT_PERIOD_TAG("full-snapshot-period"); //! Publications between two that contain every topic
 
 // Old versions tags
 constexpr const char* PARTICIPANT_KIND_TAG_V1("type"); //! Participant Kind
@@ -17,21 +17,32 @@
  *
  */
 
+#include <algorithm>
+
 #include <ddsrouter_core/configuration/participant/DiscoveryServerParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/InitialPeersParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/ParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/EchoParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/InProcessParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/LoadGeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/LocalShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/ReplayerParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/participant/SimpleParticipantConfiguration.hpp>
 #include <ddsrouter_core/configuration/DDSRouterConfiguration.hpp>
 #include <ddsrouter_core/types/address/Address.hpp>
 #include <ddsrouter_core/types/address/DiscoveryServerConnectionAddress.hpp>
 #include <ddsrouter_core/types/dds/DomainId.hpp>
 #include <ddsrouter_core/types/dds/GuidPrefix.hpp>
+#include <ddsrouter_core/types/participant/LoadSizeDistribution.hpp>
 #include <ddsrouter_core/types/participant/ParticipantId.hpp>
 #include <ddsrouter_core/types/participant/ParticipantKind.hpp>
 #include <ddsrouter_core/types/security/tls/TlsConfiguration.hpp>
 #include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+#include <ddsrouter_core/types/topic/filter/RegexDdsFilterTopic.hpp>
 #include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+#include <ddsrouter_core/types/topic/rpc/RPCRoutingPolicy.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
 #include <cpp_utils/Log.hpp>
 #include <cpp_utils/utils.hpp>
 
@@ -114,6 +125,14 @@ unsigned int YamlReader::get<unsigned int>(
     return get_scalar<unsigned int>(yml);
 }
 
+template <>
+double YamlReader::get<double>(
+        const Yaml& yml,
+        const YamlReaderVersion version /* version */)
+{
+    return get_scalar<double>(yml);
+}
+
 template <>
 bool YamlReader::get<bool>(
         const Yaml& yml,
@@ -537,6 +556,56 @@ types::WildcardDdsFilterTopic YamlReader::get(
     return object;
 }
 
+template <>
+types::RegexDdsFilterTopic YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Required name
+    std::string topic_name = get<std::string>(yml, TOPIC_NAME_TAG, version);
+
+    // Optional data type
+    utils::Fuzzy<std::string> type_name;
+    if (is_tag_present(yml, TOPIC_TYPE_NAME_TAG))
+    {
+        type_name = get<std::string>(yml, TOPIC_TYPE_NAME_TAG, version);
+    }
+
+    // Regular expressions are compiled at construction
+    try
+    {
+        types::RegexDdsFilterTopic object(topic_name, type_name);
+
+        // Optional keyed
+        if (is_tag_present(yml, TOPIC_KIND_TAG))
+        {
+            object.keyed = get<bool>(yml, TOPIC_KIND_TAG, version);
+        }
+
+        return object;
+    }
+    catch (const utils::InitializationException& e)
+    {
+        throw eprosima::utils::ConfigurationException(e.what());
+    }
+}
+
+template <>
+std::shared_ptr<types::DdsFilterTopic> YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Filters are wildcard unless regex is explicitly set
+    if (is_tag_present(yml, TOPIC_REGEX_TAG) && get<bool>(yml, TOPIC_REGEX_TAG, version))
+    {
+        return std::make_shared<types::RegexDdsFilterTopic>(get<types::RegexDdsFilterTopic>(yml, version));
+    }
+    else
+    {
+        return std::make_shared<types::WildcardDdsFilterTopic>(get<types::WildcardDdsFilterTopic>(yml, version));
+    }
+}
+
 /************************
 * TLS CONFIGURATION     *
 ************************/
@@ -683,6 +752,18 @@ void YamlReader::fill(
     {
         object.verbose = get<bool>(yml, ECHO_VERBOSE_TAG, version);
     }
+
+    // statistics optional
+    if (is_tag_present(yml, ECHO_STATISTICS_TAG))
+    {
+        object.statistics = get<bool>(yml, ECHO_STATISTICS_TAG, version);
+    }
+
+    // statistics period optional
+    if (is_tag_present(yml, ECHO_STATISTICS_PERIOD_TAG))
+    {
+        object.statistics_period = get<unsigned int>(yml, ECHO_STATISTICS_PERIOD_TAG, version);
+    }
 }
 
 template <>
@@ -695,6 +776,209 @@ configuration::EchoParticipantConfiguration YamlReader::get(
     return object;
 }
 
+//////////////////////////////////
+// InProcessParticipantConfiguration
+template <>
+void YamlReader::fill(
+        configuration::InProcessParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    // The connector can only be set by an application embedding the router, so the default one is kept
+    fill<configuration::ParticipantConfiguration>(object, yml, version);
+}
+
+template <>
+configuration::InProcessParticipantConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    configuration::InProcessParticipantConfiguration object;
+    fill<configuration::InProcessParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+//////////////////////////////////
+// RecorderParticipantConfiguration
+template <>
+void YamlReader::fill(
+        configuration::RecorderParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<configuration::ParticipantConfiguration>(object, yml, version);
+
+    // File required
+    object.file_path = get<std::string>(yml, RECORDER_FILE_TAG, version);
+
+    // Chunk size optional
+    if (is_tag_present(yml, RECORDER_CHUNK_SIZE_TAG))
+    {
+        object.chunk_size = get<unsigned int>(yml, RECORDER_CHUNK_SIZE_TAG, version);
+    }
+
+    // Buffer size optional
+    if (is_tag_present(yml, RECORDER_BUFFER_SIZE_TAG))
+    {
+        object.max_pending_bytes = get<unsigned int>(yml, RECORDER_BUFFER_SIZE_TAG, version);
+    }
+}
+
+template <>
+configuration::RecorderParticipantConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    configuration::RecorderParticipantConfiguration object;
+    fill<configuration::RecorderParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+//////////////////////////////////
+// ReplayerParticipantConfiguration
+template <>
+void YamlReader::fill(
+        configuration::ReplayerParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<configuration::ParticipantConfiguration>(object, yml, version);
+
+    // File required
+    object.file_path = get<std::string>(yml, REPLAYER_FILE_TAG, version);
+
+    // Speed optional
+    if (is_tag_present(yml, REPLAYER_SPEED_TAG))
+    {
+        object.speed = get<double>(yml, REPLAYER_SPEED_TAG, version);
+    }
+
+    // Start delay optional
+    if (is_tag_present(yml, REPLAYER_START_DELAY_TAG))
+    {
+        object.start_delay = get<unsigned int>(yml, REPLAYER_START_DELAY_TAG, version);
+    }
+}
+
+template <>
+configuration::ReplayerParticipantConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    configuration::ReplayerParticipantConfiguration object;
+    fill<configuration::ReplayerParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
+//////////////////////////////////
+// LoadGeneratorParticipantConfiguration
+template <>
+LoadSizeDistribution YamlReader::get<LoadSizeDistribution>(
+        const Yaml& yml,
+        const YamlReaderVersion /* version */)
+{
+    return get_enumeration<LoadSizeDistribution>(
+        yml,
+                {
+                    {LOAD_SIZE_DISTRIBUTION_UNIFORM_TAG, LoadSizeDistribution::uniform},
+                    {LOAD_SIZE_DISTRIBUTION_EXPONENTIAL_TAG, LoadSizeDistribution::exponential},
+                });
+}
+
+template <>
+void YamlReader::fill(
+        configuration::LoadGeneratorParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<configuration::ParticipantConfiguration>(object, yml, version);
+
+    // Topic count optional
+    if (is_tag_present(yml, LOAD_TOPIC_COUNT_TAG))
+    {
+        object.topic_count = get<unsigned int>(yml, LOAD_TOPIC_COUNT_TAG, version);
+    }
+
+    // Topic prefix optional
+    if (is_tag_present(yml, LOAD_TOPIC_PREFIX_TAG))
+    {
+        object.topic_prefix = get<std::string>(yml, LOAD_TOPIC_PREFIX_TAG, version);
+    }
+
+    // Type name optional
+    if (is_tag_present(yml, LOAD_TYPE_TAG))
+    {
+        object.type_name = get<std::string>(yml, LOAD_TYPE_TAG, version);
+    }
+
+    // Rate optional
+    if (is_tag_present(yml, LOAD_RATE_TAG))
+    {
+        object.rate = get<double>(yml, LOAD_RATE_TAG, version);
+    }
+
+    // Burst optional
+    if (is_tag_present(yml, LOAD_BURST_TAG))
+    {
+        object.burst = get<unsigned int>(yml, LOAD_BURST_TAG, version);
+    }
+
+    // Sizes optional. If only minimum size is given, every sample has that size.
+    if (is_tag_present(yml, LOAD_MIN_SIZE_TAG))
+    {
+        object.min_size = get<unsigned int>(yml, LOAD_MIN_SIZE_TAG, version);
+        object.max_size = std::max(object.max_size, object.min_size);
+    }
+
+    if (is_tag_present(yml, LOAD_MAX_SIZE_TAG))
+    {
+        object.max_size = get<unsigned int>(yml, LOAD_MAX_SIZE_TAG, version);
+    }
+
+    // Size distribution optional
+    if (is_tag_present(yml, LOAD_SIZE_DISTRIBUTION_TAG))
+    {
+        object.size_distribution = get<LoadSizeDistribution>(yml, LOAD_SIZE_DISTRIBUTION_TAG, version);
+    }
+
+    // Keys optional
+    if (is_tag_present(yml, LOAD_KEYS_TAG))
+    {
+        object.keys = get<unsigned int>(yml, LOAD_KEYS_TAG, version);
+    }
+
+    // QoS optional
+    if (is_tag_present(yml, LOAD_RELIABLE_TAG))
+    {
+        object.reliable = get<bool>(yml, LOAD_RELIABLE_TAG, version);
+    }
+
+    if (is_tag_present(yml, LOAD_TRANSIENT_LOCAL_TAG))
+    {
+        object.transient_local = get<bool>(yml, LOAD_TRANSIENT_LOCAL_TAG, version);
+    }
+
+    // Report period optional
+    if (is_tag_present(yml, LOAD_REPORT_PERIOD_TAG))
+    {
+        object.report_period = get<unsigned int>(yml, LOAD_REPORT_PERIOD_TAG, version);
+    }
+}
+
+template <>
+configuration::LoadGeneratorParticipantConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    configuration::LoadGeneratorParticipantConfiguration object;
+    fill<configuration::LoadGeneratorParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
 //////////////////////////////////
 // SimpleParticipantConfiguration
 template <>
@@ -723,6 +1007,40 @@ configuration::SimpleParticipantConfiguration YamlReader::get(
     return object;
 }
 
+//////////////////////////////////
+// LocalShmParticipantConfiguration
+template <>
+void YamlReader::fill(
+        configuration::LocalShmParticipantConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Parent class fill
+    fill<configuration::SimpleParticipantConfiguration>(object, yml, version);
+
+    // Segment size optional
+    if (is_tag_present(yml, SHM_SEGMENT_SIZE_TAG))
+    {
+        object.segment_size = get<unsigned int>(yml, SHM_SEGMENT_SIZE_TAG, version);
+    }
+
+    // Port queue capacity optional
+    if (is_tag_present(yml, SHM_PORT_QUEUE_CAPACITY_TAG))
+    {
+        object.port_queue_capacity = get<unsigned int>(yml, SHM_PORT_QUEUE_CAPACITY_TAG, version);
+    }
+}
+
+template <>
+configuration::LocalShmParticipantConfiguration YamlReader::get(
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    configuration::LocalShmParticipantConfiguration object;
+    fill<configuration::LocalShmParticipantConfiguration>(object, yml, version);
+    return object;
+}
+
 //////////////////////////////////
 // DiscoveryServerParticipantConfiguration
 template <>
@@ -835,6 +1153,100 @@ configuration::InitialPeersParticipantConfiguration YamlReader::get(
     return object;
 }
 
+//////////////////////////////////
+// ServiceConfiguration
+template <>
+RPCRoutingPolicy YamlReader::get<RPCRoutingPolicy>(
+        const Yaml& yml,
+        const YamlReaderVersion /* version */)
+{
+    return get_enumeration<RPCRoutingPolicy>(
+        yml,
+                {
+                    {RPC_ROUTING_BROADCAST_TAG, RPCRoutingPolicy::broadcast},
+                    {RPC_ROUTING_ROUND_ROBIN_TAG, RPCRoutingPolicy::round_robin},
+                    {RPC_ROUTING_LEAST_OUTSTANDING_TAG, RPCRoutingPolicy::least_outstanding},
+                    {RPC_ROUTING_HASH_BY_CLIENT_TAG, RPCRoutingPolicy::hash_by_client},
+                });
+}
+
+template <>
+void YamlReader::fill(
+        configuration::ServiceConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    /////
+    // Get optional routing policy
+    if (YamlReader::is_tag_present(yml, RPC_ROUTING_POLICY_TAG))
+    {
+        object.routing_policy = YamlReader::get<RPCRoutingPolicy>(yml, RPC_ROUTING_POLICY_TAG, version);
+    }
+
+    /////
+    // Get optional maximum number of pending requests
+    if (YamlReader::is_tag_present(yml, RPC_MAX_PENDING_REQUESTS_TAG))
+    {
+        object.max_pending_requests = YamlReader::get<unsigned int>(yml, RPC_MAX_PENDING_REQUESTS_TAG, version);
+    }
+
+    /////
+    // Get optional request timeout
+    if (YamlReader::is_tag_present(yml, RPC_REQUEST_TIMEOUT_TAG))
+    {
+        object.request_timeout =
+                std::chrono::milliseconds(YamlReader::get<unsigned int>(yml, RPC_REQUEST_TIMEOUT_TAG, version));
+    }
+}
+
+//////////////////////////////////
+// StatisticsConfiguration
+template <>
+void YamlReader::fill(
+        configuration::StatisticsConfiguration& object,
+        const Yaml& yml,
+        const YamlReaderVersion version)
+{
+    // Statistics are published if the section is present, unless explicitly disabled
+    object.enabled = true;
+
+    /////
+    // Get optional enable
+    if (YamlReader::is_tag_present(yml, STATISTICS_ENABLE_TAG))
+    {
+        object.enabled = YamlReader::get<bool>(yml, STATISTICS_ENABLE_TAG, version);
+    }
+
+    /////
+    // Get optional domain
+    if (YamlReader::is_tag_present(yml, DOMAIN_ID_TAG))
+    {
+        object.domain = YamlReader::get<types::DomainId>(yml, DOMAIN_ID_TAG, version);
+    }
+
+    /////
+    // Get optional topic name
+    if (YamlReader::is_tag_present(yml, STATISTICS_TOPIC_TAG))
+    {
+        object.topic_name = YamlReader::get<std::string>(yml, STATISTICS_TOPIC_TAG, version);
+    }
+
+    /////
+    // Get optional period
+    if (YamlReader::is_tag_present(yml, STATISTICS_PERIOD_TAG))
+    {
+        object.period = std::chrono::milliseconds(YamlReader::get<unsigned int>(yml, STATISTICS_PERIOD_TAG, version));
+    }
+
+    /////
+    // Get optional full snapshot period
+    if (YamlReader::is_tag_present(yml, STATISTICS_FULL_SNAPSHOT_PERIOD_TAG))
+    {
+        object.full_snapshot_period =
+                YamlReader::get<unsigned int>(yml, STATISTICS_FULL_SNAPSHOT_PERIOD_TAG, version);
+    }
+}
+
 //////////////////////////////////
 // SpecsConfiguration
 template <>
@@ -850,12 +1262,74 @@ void YamlReader::fill(
         object.number_of_threads = YamlReader::get<unsigned int>(yml, NUMBER_THREADS_TAG, version);
     }
 
+    /////
+    // Get optional number of threads to construct Bridges
+    if (YamlReader::is_tag_present(yml, BRIDGE_CONSTRUCTION_THREADS_TAG))
+    {
+        object.bridge_construction_threads =
+                YamlReader::get<unsigned int>(yml, BRIDGE_CONSTRUCTION_THREADS_TAG, version);
+    }
+
     /////
     // Get optional maximum history depth
     if (YamlReader::is_tag_present(yml, MAX_HISTORY_DEPTH_TAG))
     {
         object.max_history_depth = YamlReader::get<unsigned int>(yml, MAX_HISTORY_DEPTH_TAG, version);
     }
+
+    /////
+    // Get optional profiling
+    if (YamlReader::is_tag_present(yml, PROFILING_TAG))
+    {
+        object.profiling = YamlReader::get<bool>(yml, PROFILING_TAG, version);
+    }
+
+    /////
+    // Get optional service registries configuration
+    if (YamlReader::is_tag_present(yml, RPC_TAG))
+    {
+        Yaml rpc_yml = YamlReader::get_value_in_tag(yml, RPC_TAG);
+
+        // Default values for every service
+        YamlReader::fill<configuration::ServiceConfiguration>(
+            object.default_service,
+            rpc_yml,
+            version);
+
+        // Specific values by service name, that take default ones for those not set
+        if (YamlReader::is_tag_present(rpc_yml, RPC_SERVICES_TAG))
+        {
+            Yaml services_yml = YamlReader::get_value_in_tag(rpc_yml, RPC_SERVICES_TAG);
+
+            if (!services_yml.IsSequence())
+            {
+                throw eprosima::utils::ConfigurationException(
+                          utils::Formatter() << "Tag <" << RPC_SERVICES_TAG << "> must be a list of services.");
+            }
+
+            for (Yaml service_yml : services_yml)
+            {
+                configuration::ServiceConfiguration service_configuration = object.default_service;
+                YamlReader::fill<configuration::ServiceConfiguration>(
+                    service_configuration,
+                    service_yml,
+                    version);
+
+                object.services[YamlReader::get<std::string>(service_yml, TOPIC_NAME_TAG, version)] =
+                        service_configuration;
+            }
+        }
+    }
+
+    /////
+    // Get optional statistics publication configuration
+    if (YamlReader::is_tag_present(yml, STATISTICS_TAG))
+    {
+        YamlReader::fill<configuration::StatisticsConfiguration>(
+            object.statistics,
+            YamlReader::get_value_in_tag(yml, STATISTICS_TAG),
+            version);
+    }
 }
 
 /***************************
@@ -884,10 +1358,30 @@ YamlReader::get<std::shared_ptr<core::configuration::ParticipantConfiguration>>(
             return std::make_shared<core::configuration::EchoParticipantConfiguration>(
                 YamlReader::get<core::configuration::EchoParticipantConfiguration>(yml, version));
 
+        case types::ParticipantKind::in_process:
+            return std::make_shared<core::configuration::InProcessParticipantConfiguration>(
+                YamlReader::get<core::configuration::InProcessParticipantConfiguration>(yml, version));
+
+        case types::ParticipantKind::recorder:
+            return std::make_shared<core::configuration::RecorderParticipantConfiguration>(
+                YamlReader::get<core::configuration::RecorderParticipantConfiguration>(yml, version));
+
+        case types::ParticipantKind::replayer:
+            return std::make_shared<core::configuration::ReplayerParticipantConfiguration>(
+                YamlReader::get<core::configuration::ReplayerParticipantConfiguration>(yml, version));
+
+        case types::ParticipantKind::load_generator:
+            return std::make_shared<core::configuration::LoadGeneratorParticipantConfiguration>(
+                YamlReader::get<core::configuration::LoadGeneratorParticipantConfiguration>(yml, version));
+
         case types::ParticipantKind::simple_rtps:
             return std::make_shared<core::configuration::SimpleParticipantConfiguration>(
                 YamlReader::get<core::configuration::SimpleParticipantConfiguration>(yml, version));
 
+        case types::ParticipantKind::local_shm:
+            return std::make_shared<core::configuration::LocalShmParticipantConfiguration>(
+                YamlReader::get<core::configuration::LocalShmParticipantConfiguration>(yml, version));
+
         case types::ParticipantKind::local_discovery_server:
         case types::ParticipantKind::wan_discovery_server:
             return std::make_shared<core::configuration::DiscoveryServerParticipantConfiguration>(
@@ -915,16 +1409,14 @@ void _fill_ddsrouter_configuration_v1(
     // Get optional allowlist
     if (YamlReader::is_tag_present(yml, ALLOWLIST_TAG))
     {
-        object.allowlist = utils::convert_set_to_shared<types::DdsFilterTopic, types::WildcardDdsFilterTopic>(
-            YamlReader::get_set<types::WildcardDdsFilterTopic>(yml, ALLOWLIST_TAG, version));
+        object.allowlist = YamlReader::get_set<std::shared_ptr<types::DdsFilterTopic>>(yml, ALLOWLIST_TAG, version);
     }
 
     /////
     // Get optional blocklist
     if (YamlReader::is_tag_present(yml, BLOCKLIST_TAG))
     {
-        object.blocklist = utils::convert_set_to_shared<types::DdsFilterTopic, types::WildcardDdsFilterTopic>(
-            YamlReader::get_set<types::WildcardDdsFilterTopic>(yml, BLOCKLIST_TAG, version));
+        object.blocklist = YamlReader::get_set<std::shared_ptr<types::DdsFilterTopic>>(yml, BLOCKLIST_TAG, version);
     }
 
     /////
@@ -1008,16 +1500,14 @@ void _fill_ddsrouter_configuration_latest(
     // Get optional allowlist
     if (YamlReader::is_tag_present(yml, ALLOWLIST_TAG))
     {
-        object.allowlist = utils::convert_set_to_shared<types::DdsFilterTopic, types::WildcardDdsFilterTopic>(
-            YamlReader::get_set<types::WildcardDdsFilterTopic>(yml, ALLOWLIST_TAG, version));
+        object.allowlist = YamlReader::get_set<std::shared_ptr<types::DdsFilterTopic>>(yml, ALLOWLIST_TAG, version);
     }
 
     /////
     // Get optional blocklist
     if (YamlReader::is_tag_present(yml, BLOCKLIST_TAG))
     {
-        object.blocklist = utils::convert_set_to_shared<types::DdsFilterTopic, types::WildcardDdsFilterTopic>(
-            YamlReader::get_set<types::WildcardDdsFilterTopic>(yml, BLOCKLIST_TAG, version));
+        object.blocklist = YamlReader::get_set<std::shared_ptr<types::DdsFilterTopic>>(yml, BLOCKLIST_TAG, version);
     }
 
     /////
@@ -34,6 +34,7 @@ std::set<std::string> ddsrouter_tags() noexcept
             TOPIC_NAME_TAG,
             TOPIC_TYPE_NAME_TAG,
             TOPIC_KIND_TAG,
+            TOPIC_REGEX_TAG,
             PARTICIPANT_KIND_TAG,
             PARTICIPANT_NAME_TAG,
             COLLECTION_PARTICIPANTS_TAG,
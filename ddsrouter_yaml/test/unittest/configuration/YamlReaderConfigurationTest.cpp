@@ -280,6 +280,66 @@ TEST(YamlReaderConfigurationTest, number_of_threads)
     }
 }
 
+/**
+ * Test load the number of threads that construct Bridges in the configuration
+ *
+ * CASES:
+ * - not present
+ * - several values
+ * - zero threads
+ */
+TEST(YamlReaderConfigurationTest, bridge_construction_threads)
+{
+    const char* yml_configuration =
+            // trivial configuration
+            R"(
+        version: v3.0
+        participants:
+          - name: "P1"
+            kind: "void"
+          - name: "P2"
+            kind: "void"
+        )";
+
+    // not present
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_EQ(4u, configuration_result.advanced_options.bridge_construction_threads);
+    }
+
+    // several values
+    for (unsigned int test_case : {1u, 2u, 8u, 32u})
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+        Yaml yml_specs;
+        yml_specs[BRIDGE_CONSTRUCTION_THREADS_TAG] = test_case;
+        yml[SPECS_TAG] = yml_specs;
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_EQ(test_case, configuration_result.advanced_options.bridge_construction_threads);
+    }
+
+    // zero threads
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+        Yaml yml_specs;
+        yml_specs[BRIDGE_CONSTRUCTION_THREADS_TAG] = 0;
+        yml[SPECS_TAG] = yml_specs;
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_FALSE(configuration_result.is_valid(error_msg)) << error_msg;
+    }
+}
+
 /**
  * Test load of maximum history depth in the configuration
  *
@@ -317,6 +377,143 @@ TEST(YamlReaderConfigurationTest, max_history_depth)
     }
 }
 
+/**
+ * Test load of statistics publication in the configuration
+ *
+ * CASES:
+ * - not present
+ * - empty section
+ * - every value set
+ * - disabled
+ */
+TEST(YamlReaderConfigurationTest, statistics)
+{
+    const char* yml_configuration =
+            // trivial configuration
+            R"(
+        version: v3.0
+        participants:
+          - name: "P1"
+            kind: "void"
+          - name: "P2"
+            kind: "void"
+        )";
+
+    // not present
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_FALSE(configuration_result.advanced_options.statistics.enabled);
+    }
+
+    // empty section
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+        Yaml yml_specs;
+        yml_specs[STATISTICS_TAG] = YAML::Node(YAML::NodeType::Map);
+        yml[SPECS_TAG] = yml_specs;
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        core::configuration::StatisticsConfiguration default_statistics;
+        const core::configuration::StatisticsConfiguration& statistics =
+                configuration_result.advanced_options.statistics;
+        ASSERT_TRUE(statistics.enabled);
+        ASSERT_EQ(default_statistics.domain, statistics.domain);
+        ASSERT_EQ(default_statistics.topic_name, statistics.topic_name);
+        ASSERT_EQ(default_statistics.period, statistics.period);
+        ASSERT_EQ(default_statistics.full_snapshot_period, statistics.full_snapshot_period);
+    }
+
+    // every value set
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+        Yaml yml_statistics;
+        yml_statistics[DOMAIN_ID_TAG] = 42;
+        yml_statistics[STATISTICS_TOPIC_TAG] = "monitoring/router";
+        yml_statistics[STATISTICS_PERIOD_TAG] = 500;
+        yml_statistics[STATISTICS_FULL_SNAPSHOT_PERIOD_TAG] = 20;
+        Yaml yml_specs;
+        yml_specs[STATISTICS_TAG] = yml_statistics;
+        yml[SPECS_TAG] = yml_specs;
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        const core::configuration::StatisticsConfiguration& statistics =
+                configuration_result.advanced_options.statistics;
+        ASSERT_TRUE(statistics.enabled);
+        ASSERT_EQ(core::types::DomainId(42u), statistics.domain);
+        ASSERT_EQ("monitoring/router", statistics.topic_name);
+        ASSERT_EQ(std::chrono::milliseconds(500), statistics.period);
+        ASSERT_EQ(20u, statistics.full_snapshot_period);
+    }
+
+    // disabled
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+        Yaml yml_statistics;
+        yml_statistics[STATISTICS_ENABLE_TAG] = false;
+        Yaml yml_specs;
+        yml_specs[STATISTICS_TAG] = yml_statistics;
+        yml[SPECS_TAG] = yml_specs;
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_FALSE(configuration_result.advanced_options.statistics.enabled);
+    }
+}
+
+/**
+ * Test load of profiling in the configuration
+ *
+ * CASES:
+ * - not present
+ * - enabled
+ * - disabled
+ */
+TEST(YamlReaderConfigurationTest, profiling)
+{
+    const char* yml_configuration =
+            // trivial configuration
+            R"(
+        version: v3.0
+        participants:
+          - name: "P1"
+            kind: "void"
+          - name: "P2"
+            kind: "void"
+        )";
+
+    // not present
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_FALSE(configuration_result.advanced_options.profiling);
+    }
+
+    for (bool test_case : {true, false})
+    {
+        Yaml yml = YAML::Load(yml_configuration);
+        Yaml yml_specs;
+        yml_specs[PROFILING_TAG] = test_case;
+        yml[SPECS_TAG] = yml_specs;
+
+        core::configuration::DDSRouterConfiguration configuration_result =
+                YamlReaderConfiguration::load_ddsrouter_configuration(yml);
+
+        ASSERT_EQ(test_case, configuration_result.advanced_options.profiling);
+    }
+}
+
 int main(
         int argc,
         char** argv)
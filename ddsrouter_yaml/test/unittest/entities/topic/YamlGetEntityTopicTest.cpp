@@ -18,6 +18,7 @@
 #include <ddsrouter_core/types/address/Address.hpp>
 #include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
 #include <ddsrouter_core/types/dds/TopicQoS.hpp>
+#include <ddsrouter_core/types/topic/filter/RegexDdsFilterTopic.hpp>
 #include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
 #include <ddsrouter_yaml/YamlReader.hpp>
 #include <ddsrouter_yaml/yaml_configuration_tags.hpp>
@@ -418,6 +419,78 @@ TEST(YamlGetEntityTopicTest, get_wildcard_topic_negative)
     }
 }
 
+/**
+ * Test read topic filters from yaml, that are wildcard by default and regex if regex tag is set
+ *
+ * POSITIVE CASES:
+ * - Filter without regex tag
+ * - Filter with regex tag to false
+ * - Filter with regex tag
+ *
+ * NEGATIVE CASES:
+ * - Filter with invalid regex
+ */
+TEST(YamlGetEntityTopicTest, get_filter_topic)
+{
+    std::string name = "rt/(chatter|pub)_[0-9]+";
+    std::string type = "std_msgs::.*";
+
+    // Filter without regex tag
+    {
+        Yaml yml;
+        yml["topic"][TOPIC_NAME_TAG] = "rt/*";
+
+        auto topic = YamlReader::get<std::shared_ptr<core::types::DdsFilterTopic>>(yml, "topic", LATEST);
+        ASSERT_TRUE(std::dynamic_pointer_cast<core::types::WildcardDdsFilterTopic>(topic));
+    }
+
+    // Filter with regex tag to false
+    {
+        Yaml yml;
+        yml["topic"][TOPIC_NAME_TAG] = "rt/*";
+        yml["topic"][TOPIC_REGEX_TAG] = false;
+
+        auto topic = YamlReader::get<std::shared_ptr<core::types::DdsFilterTopic>>(yml, "topic", LATEST);
+        ASSERT_TRUE(std::dynamic_pointer_cast<core::types::WildcardDdsFilterTopic>(topic));
+    }
+
+    // Filter with regex tag
+    {
+        Yaml yml_topic;
+        test::topic_to_yaml(
+            yml_topic,
+            test::YamlField<std::string>(name),
+            test::YamlField<std::string>(type),
+            test::YamlField<bool>(true),
+            test::YamlField<Yaml>());
+        yml_topic[TOPIC_REGEX_TAG] = true;
+
+        Yaml yml;
+        yml["topic"] = yml_topic;
+
+        auto topic = std::dynamic_pointer_cast<core::types::RegexDdsFilterTopic>(
+            YamlReader::get<std::shared_ptr<core::types::DdsFilterTopic>>(yml, "topic", LATEST));
+
+        ASSERT_TRUE(topic);
+        ASSERT_EQ(topic->topic_name, name);
+        ASSERT_EQ(topic->type_name.get_reference(), type);
+        ASSERT_TRUE(topic->keyed.get_reference());
+        ASSERT_TRUE(topic->matches(core::types::DdsTopic("rt/chatter_1", "std_msgs::string", true, {})));
+        ASSERT_FALSE(topic->matches(core::types::DdsTopic("rt/chatter", "std_msgs::string", true, {})));
+    }
+
+    // Filter with invalid regex
+    {
+        Yaml yml;
+        yml["topic"][TOPIC_NAME_TAG] = "rt/(chatter";
+        yml["topic"][TOPIC_REGEX_TAG] = true;
+
+        ASSERT_THROW(
+            YamlReader::get<std::shared_ptr<core::types::DdsFilterTopic>>(yml, "topic", LATEST),
+            eprosima::utils::ConfigurationException);
+    }
+}
+
 int main(
         int argc,
         char** argv)
@@ -0,0 +1,172 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+#include <test_utils.hpp>
+
+#include <ddsrouter_core/configuration/participant/EchoParticipantConfiguration.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_yaml/YamlReader.hpp>
+#include <ddsrouter_yaml/yaml_configuration_tags.hpp>
+
+#include "../YamlConfigurationTestUtils.hpp"
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::yaml;
+
+/**
+ * Test get Participant Configuration from yaml without statistics tags
+ *
+ * Statistics mode must be disabled, with the default period.
+ */
+TEST(YamlGetEchoParticipantConfigurationTest, get_participant_minimum)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::echo);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    core::configuration::EchoParticipantConfiguration result =
+            YamlReader::get<core::configuration::EchoParticipantConfiguration>(yml, "participant", LATEST);
+
+    // Check result
+    ASSERT_EQ(id, result.id);
+    ASSERT_EQ(kind, result.kind);
+    ASSERT_FALSE(result.statistics);
+    ASSERT_EQ(1000u, result.statistics_period);
+
+    eprosima::utils::Formatter error_msg;
+    ASSERT_TRUE(result.is_valid(error_msg));
+}
+
+/**
+ * Test get Participant Configuration from yaml with statistics tags
+ *
+ * CASES:
+ * - statistics with a period
+ * - statistics with period 0 (summary only when closed)
+ * - statistics disabled with a period
+ */
+TEST(YamlGetEchoParticipantConfigurationTest, get_participant_statistics)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::echo);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    // statistics with a period
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[ECHO_STATISTICS_TAG] = true;
+        yml_participant[ECHO_STATISTICS_PERIOD_TAG] = 500u;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::EchoParticipantConfiguration result =
+                YamlReader::get<core::configuration::EchoParticipantConfiguration>(yml, "participant", LATEST);
+
+        // Check result
+        ASSERT_TRUE(result.statistics);
+        ASSERT_EQ(500u, result.statistics_period);
+    }
+
+    // statistics with period 0
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[ECHO_STATISTICS_TAG] = true;
+        yml_participant[ECHO_STATISTICS_PERIOD_TAG] = 0u;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::EchoParticipantConfiguration result =
+                YamlReader::get<core::configuration::EchoParticipantConfiguration>(yml, "participant", LATEST);
+
+        // Check result
+        ASSERT_TRUE(result.statistics);
+        ASSERT_EQ(0u, result.statistics_period);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_TRUE(result.is_valid(error_msg));
+    }
+
+    // statistics disabled with a period
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[ECHO_STATISTICS_TAG] = false;
+        yml_participant[ECHO_STATISTICS_PERIOD_TAG] = 200u;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::EchoParticipantConfiguration result =
+                YamlReader::get<core::configuration::EchoParticipantConfiguration>(yml, "participant", LATEST);
+
+        // Check result
+        ASSERT_FALSE(result.statistics);
+        ASSERT_EQ(200u, result.statistics_period);
+    }
+}
+
+/**
+ * Test get Participant Configuration from yaml with a statistics tag of a wrong type fails
+ */
+TEST(YamlGetEchoParticipantConfigurationTest, get_participant_negative)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::echo);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+    yml_participant[ECHO_STATISTICS_PERIOD_TAG] = "fast";
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    ASSERT_THROW(
+        core::configuration::EchoParticipantConfiguration result =
+        YamlReader::get<core::configuration::EchoParticipantConfiguration>(yml, "participant", LATEST),
+        eprosima::utils::ConfigurationException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
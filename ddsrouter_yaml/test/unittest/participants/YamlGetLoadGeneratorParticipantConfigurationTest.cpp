@@ -0,0 +1,216 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+#include <test_utils.hpp>
+
+#include <ddsrouter_core/configuration/participant/LoadGeneratorParticipantConfiguration.hpp>
+#include <ddsrouter_core/types/participant/LoadSizeDistribution.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_yaml/YamlReader.hpp>
+#include <ddsrouter_yaml/yaml_configuration_tags.hpp>
+
+#include "../YamlConfigurationTestUtils.hpp"
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::yaml;
+
+/**
+ * Test get Participant Configuration from yaml with only name and kind
+ *
+ * Every value must be the default one.
+ */
+TEST(YamlGetLoadGeneratorParticipantConfigurationTest, get_participant_minimum)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::load_generator);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    core::configuration::LoadGeneratorParticipantConfiguration result =
+            YamlReader::get<core::configuration::LoadGeneratorParticipantConfiguration>(yml, "participant", LATEST);
+
+    // Check result
+    ASSERT_EQ(id, result.id);
+    ASSERT_EQ(kind, result.kind);
+
+    core::configuration::LoadGeneratorParticipantConfiguration expected(id, kind, false);
+    ASSERT_EQ(expected, result);
+
+    eprosima::utils::Formatter error_msg;
+    ASSERT_TRUE(result.is_valid(error_msg));
+}
+
+/**
+ * Test get Participant Configuration from yaml with every tag set
+ */
+TEST(YamlGetLoadGeneratorParticipantConfigurationTest, get_participant_all)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::load_generator);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+    yml_participant[LOAD_TOPIC_COUNT_TAG] = 4u;
+    yml_participant[LOAD_TOPIC_PREFIX_TAG] = "bench";
+    yml_participant[LOAD_TYPE_TAG] = "BenchType";
+    yml_participant[LOAD_RATE_TAG] = 2500.5;
+    yml_participant[LOAD_BURST_TAG] = 10u;
+    yml_participant[LOAD_MIN_SIZE_TAG] = 64u;
+    yml_participant[LOAD_MAX_SIZE_TAG] = 4096u;
+    yml_participant[LOAD_SIZE_DISTRIBUTION_TAG] = LOAD_SIZE_DISTRIBUTION_EXPONENTIAL_TAG;
+    yml_participant[LOAD_KEYS_TAG] = 8u;
+    yml_participant[LOAD_RELIABLE_TAG] = true;
+    yml_participant[LOAD_TRANSIENT_LOCAL_TAG] = true;
+    yml_participant[LOAD_REPORT_PERIOD_TAG] = 0u;
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    core::configuration::LoadGeneratorParticipantConfiguration result =
+            YamlReader::get<core::configuration::LoadGeneratorParticipantConfiguration>(yml, "participant", LATEST);
+
+    // Check result
+    ASSERT_EQ(4u, result.topic_count);
+    ASSERT_EQ("bench", result.topic_prefix);
+    ASSERT_EQ("BenchType", result.type_name);
+    ASSERT_EQ(2500.5, result.rate);
+    ASSERT_EQ(10u, result.burst);
+    ASSERT_EQ(64u, result.min_size);
+    ASSERT_EQ(4096u, result.max_size);
+    ASSERT_EQ(core::types::LoadSizeDistribution::exponential, result.size_distribution);
+    ASSERT_EQ(8u, result.keys);
+    ASSERT_TRUE(result.reliable);
+    ASSERT_TRUE(result.transient_local);
+    ASSERT_EQ(0u, result.report_period);
+
+    eprosima::utils::Formatter error_msg;
+    ASSERT_TRUE(result.is_valid(error_msg));
+}
+
+/**
+ * Test that only setting the minimum size makes every sample that size, and that sizes are checked
+ *
+ * CASES:
+ * - only minimum size
+ * - maximum size lower than minimum size
+ * - minimum size lower than the sample header
+ */
+TEST(YamlGetLoadGeneratorParticipantConfigurationTest, get_participant_min_size)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::load_generator);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    // only minimum size
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[LOAD_MIN_SIZE_TAG] = 1024u;
+
+        yml["participant"] = yml_participant;
+
+        core::configuration::LoadGeneratorParticipantConfiguration result =
+                YamlReader::get<core::configuration::LoadGeneratorParticipantConfiguration>(yml, "participant", LATEST);
+
+        ASSERT_EQ(1024u, result.min_size);
+        ASSERT_EQ(1024u, result.max_size);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_TRUE(result.is_valid(error_msg));
+    }
+
+    // maximum size lower than minimum size
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[LOAD_MIN_SIZE_TAG] = 1024u;
+        yml_participant[LOAD_MAX_SIZE_TAG] = 512u;
+
+        yml["participant"] = yml_participant;
+
+        core::configuration::LoadGeneratorParticipantConfiguration result =
+                YamlReader::get<core::configuration::LoadGeneratorParticipantConfiguration>(yml, "participant", LATEST);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_FALSE(result.is_valid(error_msg));
+    }
+
+    // minimum size lower than the sample header
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[LOAD_MIN_SIZE_TAG] = 4u;
+
+        yml["participant"] = yml_participant;
+
+        core::configuration::LoadGeneratorParticipantConfiguration result =
+                YamlReader::get<core::configuration::LoadGeneratorParticipantConfiguration>(yml, "participant", LATEST);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_FALSE(result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test get Participant Configuration from yaml with an unknown size distribution fails
+ */
+TEST(YamlGetLoadGeneratorParticipantConfigurationTest, get_participant_negative)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::load_generator);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+    yml_participant[LOAD_SIZE_DISTRIBUTION_TAG] = "gaussian";
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    ASSERT_THROW(
+        core::configuration::LoadGeneratorParticipantConfiguration result =
+        YamlReader::get<core::configuration::LoadGeneratorParticipantConfiguration>(yml, "participant", LATEST),
+        eprosima::utils::ConfigurationException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,128 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+#include <test_utils.hpp>
+
+#include <ddsrouter_core/configuration/participant/LocalShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/dds/DomainId.hpp>
+#include <ddsrouter_yaml/YamlReader.hpp>
+#include <ddsrouter_yaml/yaml_configuration_tags.hpp>
+
+#include "../YamlConfigurationTestUtils.hpp"
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::yaml;
+
+/**
+ * Test get Participant Configuration from yaml without Shared Memory specific tags
+ *
+ * Shared Memory sizes must be left to Fast DDS defaults (0).
+ */
+TEST(YamlGetLocalShmParticipantConfigurationTest, get_participant_minimum)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::local_shm);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+    core::types::DomainId domain(3u);
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+    yaml::test::domain_to_yaml(yml_participant, domain);
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    core::configuration::LocalShmParticipantConfiguration result =
+            YamlReader::get<core::configuration::LocalShmParticipantConfiguration>(yml, "participant", LATEST);
+
+    // Check result
+    ASSERT_EQ(id, result.id);
+    ASSERT_EQ(kind, result.kind);
+    ASSERT_EQ(domain, result.domain);
+    ASSERT_EQ(0u, result.segment_size);
+    ASSERT_EQ(0u, result.port_queue_capacity);
+
+    eprosima::utils::Formatter error_msg;
+    ASSERT_TRUE(result.is_valid(error_msg));
+}
+
+/**
+ * Test get Participant Configuration from yaml with segment size and port queue capacity
+ *
+ * CASES:
+ * - valid sizes
+ * - segment size under minimum is read but the configuration is not valid
+ */
+TEST(YamlGetLocalShmParticipantConfigurationTest, get_participant_shm_sizes)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::local_shm);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    // valid sizes
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[SHM_SEGMENT_SIZE_TAG] = 16777216u;
+        yml_participant[SHM_PORT_QUEUE_CAPACITY_TAG] = 1024u;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::LocalShmParticipantConfiguration result =
+                YamlReader::get<core::configuration::LocalShmParticipantConfiguration>(yml, "participant", LATEST);
+
+        // Check result
+        ASSERT_EQ(16777216u, result.segment_size);
+        ASSERT_EQ(1024u, result.port_queue_capacity);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_TRUE(result.is_valid(error_msg));
+    }
+
+    // segment size under minimum
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[SHM_SEGMENT_SIZE_TAG] = 16u;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::LocalShmParticipantConfiguration result =
+                YamlReader::get<core::configuration::LocalShmParticipantConfiguration>(yml, "participant", LATEST);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_FALSE(result.is_valid(error_msg));
+    }
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
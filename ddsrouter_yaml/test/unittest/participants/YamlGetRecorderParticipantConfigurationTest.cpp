@@ -0,0 +1,152 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+#include <test_utils.hpp>
+
+#include <ddsrouter_core/configuration/participant/RecorderParticipantConfiguration.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_yaml/YamlReader.hpp>
+#include <ddsrouter_yaml/yaml_configuration_tags.hpp>
+
+#include "../YamlConfigurationTestUtils.hpp"
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::yaml;
+
+/**
+ * Test get Participant Configuration from yaml with only the file of the recorder
+ *
+ * Chunk and buffer sizes must be the default ones.
+ */
+TEST(YamlGetRecorderParticipantConfigurationTest, get_participant_minimum)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::recorder);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+    yml_participant[RECORDER_FILE_TAG] = "capture.ddscap";
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    core::configuration::RecorderParticipantConfiguration result =
+            YamlReader::get<core::configuration::RecorderParticipantConfiguration>(yml, "participant", LATEST);
+
+    // Check result
+    ASSERT_EQ(id, result.id);
+    ASSERT_EQ(kind, result.kind);
+    ASSERT_EQ("capture.ddscap", result.file_path);
+    ASSERT_EQ(core::configuration::RecorderParticipantConfiguration::DEFAULT_CHUNK_SIZE, result.chunk_size);
+    ASSERT_EQ(core::configuration::RecorderParticipantConfiguration::DEFAULT_MAX_PENDING_BYTES,
+            result.max_pending_bytes);
+
+    eprosima::utils::Formatter error_msg;
+    ASSERT_TRUE(result.is_valid(error_msg));
+}
+
+/**
+ * Test get Participant Configuration from yaml with chunk and buffer sizes
+ *
+ * CASES:
+ * - valid sizes
+ * - buffer size 0 is read but the configuration is not valid
+ */
+TEST(YamlGetRecorderParticipantConfigurationTest, get_participant_sizes)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::recorder);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    // valid sizes
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[RECORDER_FILE_TAG] = "capture.ddscap";
+        yml_participant[RECORDER_CHUNK_SIZE_TAG] = 1048576u;
+        yml_participant[RECORDER_BUFFER_SIZE_TAG] = 4194304u;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::RecorderParticipantConfiguration result =
+                YamlReader::get<core::configuration::RecorderParticipantConfiguration>(yml, "participant", LATEST);
+
+        // Check result
+        ASSERT_EQ(1048576u, result.chunk_size);
+        ASSERT_EQ(4194304u, result.max_pending_bytes);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_TRUE(result.is_valid(error_msg));
+    }
+
+    // buffer size 0
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[RECORDER_FILE_TAG] = "capture.ddscap";
+        yml_participant[RECORDER_BUFFER_SIZE_TAG] = 0u;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::RecorderParticipantConfiguration result =
+                YamlReader::get<core::configuration::RecorderParticipantConfiguration>(yml, "participant", LATEST);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_FALSE(result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test get Participant Configuration from yaml without file fails
+ */
+TEST(YamlGetRecorderParticipantConfigurationTest, get_participant_negative)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::recorder);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    ASSERT_THROW(
+        core::configuration::RecorderParticipantConfiguration result =
+        YamlReader::get<core::configuration::RecorderParticipantConfiguration>(yml, "participant", LATEST),
+        eprosima::utils::ConfigurationException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
@@ -0,0 +1,175 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+#include <test_utils.hpp>
+
+#include <ddsrouter_core/configuration/participant/ReplayerParticipantConfiguration.hpp>
+#include <ddsrouter_core/types/participant/ParticipantKind.hpp>
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_yaml/YamlReader.hpp>
+#include <ddsrouter_yaml/yaml_configuration_tags.hpp>
+
+#include "../YamlConfigurationTestUtils.hpp"
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::yaml;
+
+/**
+ * Test get Participant Configuration from yaml with only the file of the replayer
+ *
+ * Speed and start delay must be the default ones.
+ */
+TEST(YamlGetReplayerParticipantConfigurationTest, get_participant_minimum)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::replayer);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+    yml_participant[REPLAYER_FILE_TAG] = "capture.ddscap";
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    core::configuration::ReplayerParticipantConfiguration result =
+            YamlReader::get<core::configuration::ReplayerParticipantConfiguration>(yml, "participant", LATEST);
+
+    // Check result
+    ASSERT_EQ(id, result.id);
+    ASSERT_EQ(kind, result.kind);
+    ASSERT_EQ("capture.ddscap", result.file_path);
+    ASSERT_EQ(1.0, result.speed);
+    ASSERT_EQ(core::configuration::ReplayerParticipantConfiguration::DEFAULT_START_DELAY, result.start_delay);
+
+    eprosima::utils::Formatter error_msg;
+    ASSERT_TRUE(result.is_valid(error_msg));
+}
+
+/**
+ * Test get Participant Configuration from yaml with speed and start delay
+ *
+ * CASES:
+ * - decimal speed
+ * - speed 0 (as fast as possible)
+ * - negative speed is read but the configuration is not valid
+ */
+TEST(YamlGetReplayerParticipantConfigurationTest, get_participant_speed)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::replayer);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    // decimal speed
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[REPLAYER_FILE_TAG] = "capture.ddscap";
+        yml_participant[REPLAYER_SPEED_TAG] = 2.5;
+        yml_participant[REPLAYER_START_DELAY_TAG] = 200u;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::ReplayerParticipantConfiguration result =
+                YamlReader::get<core::configuration::ReplayerParticipantConfiguration>(yml, "participant", LATEST);
+
+        // Check result
+        ASSERT_EQ(2.5, result.speed);
+        ASSERT_EQ(200u, result.start_delay);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_TRUE(result.is_valid(error_msg));
+    }
+
+    // speed 0
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[REPLAYER_FILE_TAG] = "capture.ddscap";
+        yml_participant[REPLAYER_SPEED_TAG] = 0;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::ReplayerParticipantConfiguration result =
+                YamlReader::get<core::configuration::ReplayerParticipantConfiguration>(yml, "participant", LATEST);
+
+        // Check result
+        ASSERT_EQ(0.0, result.speed);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_TRUE(result.is_valid(error_msg));
+    }
+
+    // negative speed
+    {
+        Yaml yml;
+        Yaml yml_participant;
+
+        yaml::test::participantid_to_yaml(yml_participant, id);
+        yaml::test::participantkind_to_yaml(yml_participant, kind);
+        yml_participant[REPLAYER_FILE_TAG] = "capture.ddscap";
+        yml_participant[REPLAYER_SPEED_TAG] = -1.0;
+
+        yml["participant"] = yml_participant;
+
+        // Read Yaml
+        core::configuration::ReplayerParticipantConfiguration result =
+                YamlReader::get<core::configuration::ReplayerParticipantConfiguration>(yml, "participant", LATEST);
+
+        eprosima::utils::Formatter error_msg;
+        ASSERT_FALSE(result.is_valid(error_msg));
+    }
+}
+
+/**
+ * Test get Participant Configuration from yaml without file fails
+ */
+TEST(YamlGetReplayerParticipantConfigurationTest, get_participant_negative)
+{
+    core::types::ParticipantKind kind(core::types::ParticipantKind::replayer);
+    core::types::ParticipantId id(eprosima::ddsrouter::test::random_participant_id());
+
+    Yaml yml;
+    Yaml yml_participant;
+
+    yaml::test::participantid_to_yaml(yml_participant, id);
+    yaml::test::participantkind_to_yaml(yml_participant, kind);
+
+    yml["participant"] = yml_participant;
+
+    // Read Yaml
+    ASSERT_THROW(
+        core::configuration::ReplayerParticipantConfiguration result =
+        YamlReader::get<core::configuration::ReplayerParticipantConfiguration>(yml, "participant", LATEST),
+        eprosima::utils::ConfigurationException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
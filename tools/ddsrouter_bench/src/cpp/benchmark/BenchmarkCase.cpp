@@ -0,0 +1,139 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkCase.cpp
+ */
+
+#include "BenchmarkCase.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+std::string to_string(
+        BenchmarkTransport transport) noexcept
+{
+    switch (transport)
+    {
+        case BenchmarkTransport::shm:
+            return "shm";
+
+        case BenchmarkTransport::udp:
+        default:
+            return "udp";
+    }
+}
+
+bool from_string(
+        const std::string& name,
+        BenchmarkTransport& transport) noexcept
+{
+    if (name == "udp")
+    {
+        transport = BenchmarkTransport::udp;
+        return true;
+    }
+    else if (name == "shm")
+    {
+        transport = BenchmarkTransport::shm;
+        return true;
+    }
+    return false;
+}
+
+uint64_t BenchmarkResult::lost() const noexcept
+{
+    return sent > received ? sent - received : 0;
+}
+
+double BenchmarkResult::loss_ratio() const noexcept
+{
+    if (sent == 0)
+    {
+        return 0;
+    }
+    return static_cast<double>(lost()) / static_cast<double>(sent);
+}
+
+double BenchmarkResult::throughput_samples() const noexcept
+{
+    if (duration.count() <= 0)
+    {
+        return 0;
+    }
+    return static_cast<double>(received) / std::chrono::duration<double>(duration).count();
+}
+
+double BenchmarkResult::throughput_mbps() const noexcept
+{
+    return throughput_samples() * benchmark_case.payload_size * 8 / 1e6;
+}
+
+std::vector<BenchmarkCase> sweep(
+        const std::vector<BenchmarkTransport>& transports,
+        const std::vector<uint32_t>& payload_sizes,
+        const std::vector<uint32_t>& rates,
+        const std::vector<bool>& reliabilities,
+        const std::vector<uint32_t>& history_depths,
+        const std::vector<unsigned int>& threads)
+{
+    std::vector<BenchmarkCase> cases;
+
+    for (BenchmarkTransport transport : transports)
+    {
+        for (uint32_t payload_size : payload_sizes)
+        {
+            for (uint32_t rate : rates)
+            {
+                for (bool reliable : reliabilities)
+                {
+                    for (uint32_t history_depth : history_depths)
+                    {
+                        for (unsigned int thread_count : threads)
+                        {
+                            BenchmarkCase benchmark_case;
+                            benchmark_case.transport = transport;
+                            benchmark_case.payload_size = payload_size;
+                            benchmark_case.rate = rate;
+                            benchmark_case.reliable = reliable;
+                            benchmark_case.history_depth = history_depth;
+                            benchmark_case.threads = thread_count;
+                            cases.push_back(benchmark_case);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    return cases;
+}
+
+std::ostream& operator <<(
+        std::ostream& os,
+        const BenchmarkCase& benchmark_case)
+{
+    os << "BenchmarkCase{transport:" << to_string(benchmark_case.transport) <<
+        ";payload_size:" << benchmark_case.payload_size <<
+        ";rate:" << benchmark_case.rate <<
+        ";reliability:" << (benchmark_case.reliable ? "reliable" : "best-effort") <<
+        ";history_depth:" << benchmark_case.history_depth <<
+        ";threads:" << benchmark_case.threads << "}";
+    return os;
+}
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,147 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkCase.hpp
+ */
+
+#ifndef EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKCASE_HPP
+#define EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKCASE_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+/**
+ * Transport that carries the data between the DDS entities of the benchmark and the DDS Router.
+ */
+enum class BenchmarkTransport
+{
+    //! Router with \c simple participants, publisher and subscriber only with UDP in 127.0.0.1
+    udp,
+    //! Router with \c local-shm participants, publisher and subscriber only with Shared Memory
+    shm,
+};
+
+//! Name of \c transport as used in the arguments and reports
+std::string to_string(
+        BenchmarkTransport transport) noexcept;
+
+/**
+ * @brief Transport named \c name
+ *
+ * @return whether \c name is the name of a transport
+ */
+bool from_string(
+        const std::string& name,
+        BenchmarkTransport& transport) noexcept;
+
+/**
+ * Parameters of a single measurement.
+ */
+struct BenchmarkCase
+{
+    //! Transport between the DDS entities and the router
+    BenchmarkTransport transport = BenchmarkTransport::udp;
+
+    //! Bytes of data in every sample (apart from the sequence number and timestamp)
+    uint32_t payload_size = 64;
+
+    //! Samples published per second (0 publishes as fast as possible)
+    uint32_t rate = 100;
+
+    //! Whether the publisher, the subscriber and thus the router are reliable (best effort otherwise)
+    bool reliable = true;
+
+    //! Depth of the keep last history of the publisher and the subscriber
+    uint32_t history_depth = 10;
+
+    //! Threads of the router
+    unsigned int threads = 12;
+};
+
+/**
+ * Measurements of a single \c BenchmarkCase .
+ */
+struct BenchmarkResult
+{
+    //! Case measured
+    BenchmarkCase benchmark_case;
+
+    //! Whether the subscriber received data through the router before the measurement started
+    bool communicated = false;
+
+    //! Samples published during the measurement
+    uint64_t sent = 0;
+
+    //! Samples published during the measurement that the subscriber has received
+    uint64_t received = 0;
+
+    //! Time since the first sample measured is published until the last one is published or received
+    std::chrono::nanoseconds duration {0};
+
+    //! Median latency from publication to reception
+    std::chrono::nanoseconds latency_p50 {0};
+
+    //! 99th percentile latency from publication to reception
+    std::chrono::nanoseconds latency_p99 {0};
+
+    //! 99.9th percentile latency from publication to reception
+    std::chrono::nanoseconds latency_p999 {0};
+
+    //! Maximum latency from publication to reception
+    std::chrono::nanoseconds latency_max {0};
+
+    //! Samples sent and not received
+    uint64_t lost() const noexcept;
+
+    //! Ratio in range [0, 1] of the samples sent that have not been received
+    double loss_ratio() const noexcept;
+
+    //! Samples received per second
+    double throughput_samples() const noexcept;
+
+    //! Megabits of payload received per second
+    double throughput_mbps() const noexcept;
+};
+
+/**
+ * @brief Every combination of the values given, in order with the first parameter varying slowest
+ *
+ * Cases are sorted by transport first, so all cases of a transport are measured together.
+ */
+std::vector<BenchmarkCase> sweep(
+        const std::vector<BenchmarkTransport>& transports,
+        const std::vector<uint32_t>& payload_sizes,
+        const std::vector<uint32_t>& rates,
+        const std::vector<bool>& reliabilities,
+        const std::vector<uint32_t>& history_depths,
+        const std::vector<unsigned int>& threads);
+
+//! \c BenchmarkCase to stream serialization
+std::ostream& operator <<(
+        std::ostream& os,
+        const BenchmarkCase& benchmark_case);
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKCASE_HPP */
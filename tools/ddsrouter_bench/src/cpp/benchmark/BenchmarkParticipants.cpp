@@ -0,0 +1,271 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkParticipants.cpp
+ */
+
+#include <algorithm>
+#include <chrono>
+
+#include <fastdds/dds/domain/DomainParticipantFactory.hpp>
+#include <fastdds/dds/publisher/qos/DataWriterQos.hpp>
+#include <fastdds/dds/subscriber/qos/DataReaderQos.hpp>
+#include <fastdds/dds/subscriber/SampleInfo.hpp>
+#include <fastdds/dds/topic/TypeSupport.hpp>
+
+#include "BenchmarkParticipants.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+using namespace eprosima::fastdds::dds;
+
+const std::size_t BenchmarkSubscriber::MAX_LATENCIES = 10000000;
+
+namespace {
+
+//! Reliability of \c benchmark_case
+ReliabilityQosPolicyKind reliability_kind(
+        const BenchmarkCase& benchmark_case)
+{
+    return benchmark_case.reliable ?
+           ReliabilityQosPolicyKind::RELIABLE_RELIABILITY_QOS :
+           ReliabilityQosPolicyKind::BEST_EFFORT_RELIABILITY_QOS;
+}
+
+/**
+ * Create \c participant with the type and topic of the benchmark
+ *
+ * @return the topic created, or nullptr if any entity could not be created
+ */
+Topic* create_participant_and_topic(
+        uint32_t domain,
+        const DomainParticipantQos& participant_qos,
+        const BenchmarkCase& benchmark_case,
+        const char* topic_name,
+        DomainParticipant*& participant)
+{
+    participant = DomainParticipantFactory::get_instance()->create_participant(domain, participant_qos);
+
+    if (participant == nullptr)
+    {
+        return nullptr;
+    }
+
+    TypeSupport type(new BenchmarkSampleType(benchmark_case.payload_size));
+    type.register_type(participant);
+
+    return participant->create_topic(topic_name, BenchmarkSampleType::TYPE_NAME, TOPIC_QOS_DEFAULT);
+}
+
+} /* namespace */
+
+int64_t steady_now() noexcept
+{
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+BenchmarkPublisher::~BenchmarkPublisher()
+{
+    if (participant_ != nullptr)
+    {
+        if (publisher_ != nullptr)
+        {
+            if (writer_ != nullptr)
+            {
+                publisher_->delete_datawriter(writer_);
+            }
+            participant_->delete_publisher(publisher_);
+        }
+        if (topic_ != nullptr)
+        {
+            participant_->delete_topic(topic_);
+        }
+        DomainParticipantFactory::get_instance()->delete_participant(participant_);
+    }
+}
+
+bool BenchmarkPublisher::init(
+        uint32_t domain,
+        const DomainParticipantQos& participant_qos,
+        const BenchmarkCase& benchmark_case,
+        const char* topic_name)
+{
+    topic_ = create_participant_and_topic(domain, participant_qos, benchmark_case, topic_name, participant_);
+
+    if (topic_ == nullptr)
+    {
+        return false;
+    }
+
+    publisher_ = participant_->create_publisher(PUBLISHER_QOS_DEFAULT, nullptr);
+
+    if (publisher_ == nullptr)
+    {
+        return false;
+    }
+
+    // Reserve memory for each sample when it is written, instead of preallocating the whole history
+    DataWriterQos wqos = DATAWRITER_QOS_DEFAULT;
+    wqos.endpoint().history_memory_policy =
+            eprosima::fastrtps::rtps::MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE;
+    wqos.reliability().kind = reliability_kind(benchmark_case);
+    wqos.durability().kind = DurabilityQosPolicyKind::VOLATILE_DURABILITY_QOS;
+    wqos.history().kind = HistoryQosPolicyKind::KEEP_LAST_HISTORY_QOS;
+    wqos.history().depth = static_cast<int32_t>(benchmark_case.history_depth);
+    writer_ = publisher_->create_datawriter(topic_, wqos, nullptr);
+
+    if (writer_ == nullptr)
+    {
+        return false;
+    }
+
+    sample_.payload.assign(benchmark_case.payload_size, 'x');
+
+    return true;
+}
+
+bool BenchmarkPublisher::publish(
+        uint64_t sequence)
+{
+    sample_.sequence = sequence;
+    sample_.timestamp = steady_now();
+    return writer_->write(&sample_);
+}
+
+BenchmarkSubscriber::~BenchmarkSubscriber()
+{
+    if (participant_ != nullptr)
+    {
+        if (subscriber_ != nullptr)
+        {
+            if (reader_ != nullptr)
+            {
+                subscriber_->delete_datareader(reader_);
+            }
+            participant_->delete_subscriber(subscriber_);
+        }
+        if (topic_ != nullptr)
+        {
+            participant_->delete_topic(topic_);
+        }
+        DomainParticipantFactory::get_instance()->delete_participant(participant_);
+    }
+}
+
+bool BenchmarkSubscriber::init(
+        uint32_t domain,
+        const DomainParticipantQos& participant_qos,
+        const BenchmarkCase& benchmark_case,
+        const char* topic_name)
+{
+    topic_ = create_participant_and_topic(domain, participant_qos, benchmark_case, topic_name, participant_);
+
+    if (topic_ == nullptr)
+    {
+        return false;
+    }
+
+    subscriber_ = participant_->create_subscriber(SUBSCRIBER_QOS_DEFAULT, nullptr);
+
+    if (subscriber_ == nullptr)
+    {
+        return false;
+    }
+
+    DataReaderQos rqos = DATAREADER_QOS_DEFAULT;
+    rqos.endpoint().history_memory_policy =
+            eprosima::fastrtps::rtps::MemoryManagementPolicy_t::DYNAMIC_REUSABLE_MEMORY_MODE;
+    rqos.reliability().kind = reliability_kind(benchmark_case);
+    rqos.durability().kind = DurabilityQosPolicyKind::VOLATILE_DURABILITY_QOS;
+    rqos.history().kind = HistoryQosPolicyKind::KEEP_LAST_HISTORY_QOS;
+    rqos.history().depth = static_cast<int32_t>(benchmark_case.history_depth);
+    reader_ = subscriber_->create_datareader(topic_, rqos, this);
+
+    return reader_ != nullptr;
+}
+
+void BenchmarkSubscriber::start_measurement(
+        uint64_t first_sequence,
+        std::size_t expected_samples)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    latencies_.clear();
+    latencies_.reserve(std::min(expected_samples, MAX_LATENCIES));
+    received_ = 0;
+    last_reception_ = 0;
+    first_sequence_ = first_sequence;
+}
+
+void BenchmarkSubscriber::on_data_available(
+        DataReader* reader)
+{
+    SampleInfo info;
+
+    while (reader->take_next_sample(&sample_, &info) == eprosima::fastrtps::types::ReturnCode_t::RETCODE_OK)
+    {
+        if (!info.valid_data)
+        {
+            continue;
+        }
+
+        int64_t now = steady_now();
+
+        std::lock_guard<std::mutex> lock(mutex_);
+
+        if (sample_.sequence < first_sequence_)
+        {
+            ++warmup_received_;
+            continue;
+        }
+
+        ++received_;
+        last_reception_ = now;
+        if (latencies_.size() < MAX_LATENCIES)
+        {
+            latencies_.push_back(now - sample_.timestamp);
+        }
+    }
+}
+
+uint64_t BenchmarkSubscriber::warmup_received() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return warmup_received_;
+}
+
+uint64_t BenchmarkSubscriber::received() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return received_;
+}
+
+int64_t BenchmarkSubscriber::last_reception() const noexcept
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return last_reception_;
+}
+
+std::vector<int64_t> BenchmarkSubscriber::latencies() const
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    return latencies_;
+}
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,176 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkParticipants.hpp
+ */
+
+#ifndef EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKPARTICIPANTS_HPP
+#define EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKPARTICIPANTS_HPP
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#include <fastdds/dds/domain/DomainParticipant.hpp>
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+#include <fastdds/dds/publisher/DataWriter.hpp>
+#include <fastdds/dds/publisher/Publisher.hpp>
+#include <fastdds/dds/subscriber/DataReader.hpp>
+#include <fastdds/dds/subscriber/DataReaderListener.hpp>
+#include <fastdds/dds/subscriber/Subscriber.hpp>
+#include <fastdds/dds/topic/Topic.hpp>
+
+#include "BenchmarkCase.hpp"
+#include "BenchmarkSampleType.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+/**
+ * DDS Participant with a single DataWriter of \c BenchmarkSample that stamps every sample with its publication time.
+ */
+class BenchmarkPublisher
+{
+public:
+
+    BenchmarkPublisher() = default;
+
+    //! Delete every DDS entity created
+    ~BenchmarkPublisher();
+
+    /**
+     * @brief Create the DDS entities in \c domain with the QoS of \c benchmark_case
+     *
+     * @return whether every entity has been created
+     */
+    bool init(
+            uint32_t domain,
+            const eprosima::fastdds::dds::DomainParticipantQos& participant_qos,
+            const BenchmarkCase& benchmark_case,
+            const char* topic_name);
+
+    /**
+     * @brief Publish the sample with number \c sequence stamped with the current time
+     *
+     * @return whether the sample has been written
+     */
+    bool publish(
+            uint64_t sequence);
+
+protected:
+
+    eprosima::fastdds::dds::DomainParticipant* participant_ = nullptr;
+
+    eprosima::fastdds::dds::Publisher* publisher_ = nullptr;
+
+    eprosima::fastdds::dds::Topic* topic_ = nullptr;
+
+    eprosima::fastdds::dds::DataWriter* writer_ = nullptr;
+
+    //! Sample reused for every publication, so its payload is only allocated once
+    BenchmarkSample sample_;
+};
+
+/**
+ * DDS Participant with a single DataReader of \c BenchmarkSample that measures the latency of the samples received.
+ *
+ * Samples published before the measurement starts only count as received in the warm up, so the measurement is
+ * not affected by discovery.
+ */
+class BenchmarkSubscriber : public eprosima::fastdds::dds::DataReaderListener
+{
+public:
+
+    BenchmarkSubscriber() = default;
+
+    //! Delete every DDS entity created
+    ~BenchmarkSubscriber();
+
+    /**
+     * @brief Create the DDS entities in \c domain with the QoS of \c benchmark_case
+     *
+     * @return whether every entity has been created
+     */
+    bool init(
+            uint32_t domain,
+            const eprosima::fastdds::dds::DomainParticipantQos& participant_qos,
+            const BenchmarkCase& benchmark_case,
+            const char* topic_name);
+
+    /**
+     * @brief Start measuring the samples with sequence number \c first_sequence or higher
+     *
+     * @param [in] expected_samples : number of samples expected, to reserve the space of their latencies
+     */
+    void start_measurement(
+            uint64_t first_sequence,
+            std::size_t expected_samples);
+
+    //! Take the samples received and measure them
+    void on_data_available(
+            eprosima::fastdds::dds::DataReader* reader) override;
+
+    //! Samples received before the measurement started
+    uint64_t warmup_received() const noexcept;
+
+    //! Samples received since the measurement started
+    uint64_t received() const noexcept;
+
+    //! Nanoseconds of the steady clock when the last sample measured was received
+    int64_t last_reception() const noexcept;
+
+    //! Latencies in nanoseconds of the samples measured, in order of reception
+    std::vector<int64_t> latencies() const;
+
+    //! Maximum number of latencies stored (samples received over it are only counted)
+    static const std::size_t MAX_LATENCIES;
+
+protected:
+
+    eprosima::fastdds::dds::DomainParticipant* participant_ = nullptr;
+
+    eprosima::fastdds::dds::Subscriber* subscriber_ = nullptr;
+
+    eprosima::fastdds::dds::Topic* topic_ = nullptr;
+
+    eprosima::fastdds::dds::DataReader* reader_ = nullptr;
+
+    //! Sample reused for every reception, so its payload is only allocated once
+    BenchmarkSample sample_;
+
+    //! First sequence number measured (none until the measurement starts)
+    uint64_t first_sequence_ = UINT64_MAX;
+
+    uint64_t warmup_received_ = 0;
+
+    uint64_t received_ = 0;
+
+    int64_t last_reception_ = 0;
+
+    std::vector<int64_t> latencies_;
+
+    //! Protect the counters and latencies, that are written from the DDS listener thread
+    mutable std::mutex mutex_;
+};
+
+//! Nanoseconds of the steady clock, the one used to stamp and measure samples
+int64_t steady_now() noexcept;
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKPARTICIPANTS_HPP */
@@ -0,0 +1,138 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkReport.cpp
+ */
+
+#include <chrono>
+
+#include "BenchmarkReport.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+namespace {
+
+//! Microseconds in \c duration
+double microseconds(
+        const std::chrono::nanoseconds& duration)
+{
+    return std::chrono::duration<double, std::micro>(duration).count();
+}
+
+} /* namespace */
+
+bool from_string(
+        const std::string& name,
+        ReportFormat& format) noexcept
+{
+    if (name == "csv")
+    {
+        format = ReportFormat::csv;
+        return true;
+    }
+    else if (name == "json")
+    {
+        format = ReportFormat::json;
+        return true;
+    }
+    return false;
+}
+
+BenchmarkReport::BenchmarkReport(
+        std::ostream& output,
+        ReportFormat format)
+    : output_(output)
+    , format_(format)
+{
+    if (format_ == ReportFormat::csv)
+    {
+        output_ << "transport,payload_size,rate,reliability,history_depth,threads,communicated," <<
+            "sent,received,lost,loss_ratio,duration_s,throughput_samples_s,throughput_mbps," <<
+            "latency_p50_us,latency_p99_us,latency_p999_us,latency_max_us" << std::endl;
+    }
+    else
+    {
+        output_ << "[";
+    }
+}
+
+BenchmarkReport::~BenchmarkReport()
+{
+    close();
+}
+
+void BenchmarkReport::add(
+        const BenchmarkResult& result)
+{
+    const BenchmarkCase& benchmark_case = result.benchmark_case;
+    const char* reliability = benchmark_case.reliable ? "reliable" : "best-effort";
+    double duration = std::chrono::duration<double>(result.duration).count();
+
+    if (format_ == ReportFormat::csv)
+    {
+        output_ << to_string(benchmark_case.transport) << "," << benchmark_case.payload_size << "," <<
+            benchmark_case.rate << "," << reliability << "," << benchmark_case.history_depth << "," <<
+            benchmark_case.threads << "," << (result.communicated ? "true" : "false") << "," <<
+            result.sent << "," << result.received << "," << result.lost() << "," << result.loss_ratio() << "," <<
+            duration << "," << result.throughput_samples() << "," << result.throughput_mbps() << "," <<
+            microseconds(result.latency_p50) << "," << microseconds(result.latency_p99) << "," <<
+            microseconds(result.latency_p999) << "," << microseconds(result.latency_max) << std::endl;
+    }
+    else
+    {
+        output_ << (first_result_written_ ? ",\n" : "\n") <<
+            "{\"transport\":\"" << to_string(benchmark_case.transport) << "\"" <<
+            ",\"payload_size\":" << benchmark_case.payload_size <<
+            ",\"rate\":" << benchmark_case.rate <<
+            ",\"reliability\":\"" << reliability << "\"" <<
+            ",\"history_depth\":" << benchmark_case.history_depth <<
+            ",\"threads\":" << benchmark_case.threads <<
+            ",\"communicated\":" << (result.communicated ? "true" : "false") <<
+            ",\"sent\":" << result.sent <<
+            ",\"received\":" << result.received <<
+            ",\"lost\":" << result.lost() <<
+            ",\"loss_ratio\":" << result.loss_ratio() <<
+            ",\"duration_s\":" << duration <<
+            ",\"throughput_samples_s\":" << result.throughput_samples() <<
+            ",\"throughput_mbps\":" << result.throughput_mbps() <<
+            ",\"latency_p50_us\":" << microseconds(result.latency_p50) <<
+            ",\"latency_p99_us\":" << microseconds(result.latency_p99) <<
+            ",\"latency_p999_us\":" << microseconds(result.latency_p999) <<
+            ",\"latency_max_us\":" << microseconds(result.latency_max) << "}" << std::flush;
+    }
+
+    first_result_written_ = true;
+}
+
+void BenchmarkReport::close()
+{
+    if (closed_)
+    {
+        return;
+    }
+
+    if (format_ == ReportFormat::json)
+    {
+        output_ << "\n]" << std::endl;
+    }
+
+    closed_ = true;
+}
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,89 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkReport.hpp
+ */
+
+#ifndef EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKREPORT_HPP
+#define EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKREPORT_HPP
+
+#include <iostream>
+#include <string>
+
+#include "BenchmarkCase.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+//! Formats of the report
+enum class ReportFormat
+{
+    csv,
+    json,
+};
+
+/**
+ * @brief Format named \c name ( \c csv or \c json )
+ *
+ * @return whether \c name is the name of a format
+ */
+bool from_string(
+        const std::string& name,
+        ReportFormat& format) noexcept;
+
+/**
+ * Write the results of every case in a stream as soon as they are measured, so a long sweep can be followed and
+ * an interrupted one keeps the cases already measured.
+ *
+ * Both formats have the same fields, one row or object per case. Latencies are in microseconds.
+ */
+class BenchmarkReport
+{
+public:
+
+    //! Write the header of the report in \c output
+    BenchmarkReport(
+            std::ostream& output,
+            ReportFormat format);
+
+    //! Write the end of the report, if not written yet
+    ~BenchmarkReport();
+
+    //! Write the results of a case
+    void add(
+            const BenchmarkResult& result);
+
+    //! Write the end of the report
+    void close();
+
+protected:
+
+    std::ostream& output_;
+
+    ReportFormat format_;
+
+    //! Whether any result has been written
+    bool first_result_written_ = false;
+
+    //! Whether the end of the report has been written
+    bool closed_ = false;
+};
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKREPORT_HPP */
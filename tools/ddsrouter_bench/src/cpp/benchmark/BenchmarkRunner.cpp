@@ -0,0 +1,274 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkRunner.cpp
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fastdds/rtps/transport/shared_mem/SharedMemTransportDescriptor.h>
+#include <fastdds/rtps/transport/UDPv4TransportDescriptor.h>
+#include <fastrtps/utils/IPLocator.h>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Formatter.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/ReturnCode.hpp>
+
+#include <ddsrouter_core/configuration/participant/LocalShmParticipantConfiguration.hpp>
+#include <ddsrouter_core/configuration/participant/SimpleParticipantConfiguration.hpp>
+#include <ddsrouter_core/core/DDSRouter.hpp>
+#include <ddsrouter_core/types/topic/filter/WildcardDdsFilterTopic.hpp>
+
+#include "BenchmarkParticipants.hpp"
+#include "BenchmarkRunner.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+using namespace eprosima::ddsrouter::core;
+
+const char* BenchmarkRunner::TOPIC_NAME = "ddsrouter_bench";
+
+const std::chrono::milliseconds BenchmarkRunner::DISCOVERY_TIMEOUT(10000);
+
+const std::chrono::milliseconds BenchmarkRunner::WARMUP_PERIOD(10);
+
+const std::chrono::milliseconds BenchmarkRunner::DRAIN_TIMEOUT(2000);
+
+namespace {
+
+//! Latency of the \c percentile of \c latencies , that must be sorted (0 if empty)
+std::chrono::nanoseconds percentile(
+        const std::vector<int64_t>& latencies,
+        double percentile)
+{
+    if (latencies.empty())
+    {
+        return std::chrono::nanoseconds(0);
+    }
+
+    // Nearest rank
+    std::size_t rank = static_cast<std::size_t>(std::ceil(percentile * latencies.size()));
+    std::size_t index = std::min(latencies.size() - 1, rank > 0 ? rank - 1 : 0);
+    return std::chrono::nanoseconds(latencies[index]);
+}
+
+} /* namespace */
+
+BenchmarkRunner::BenchmarkRunner(
+        uint32_t domain,
+        std::chrono::milliseconds duration)
+    : domain_(domain)
+    , duration_(duration)
+{
+}
+
+BenchmarkResult BenchmarkRunner::run(
+        const BenchmarkCase& benchmark_case) const
+{
+    BenchmarkResult result;
+    result.benchmark_case = benchmark_case;
+
+    logInfo(DDSROUTER_BENCHMARK, "Running " << benchmark_case << ".");
+
+    // Router first, so its participants take the first participant ids of each domain, that the DDS entities
+    // announce themselves to
+    DDSRouter router(router_configuration_(benchmark_case));
+    if (router.start() != utils::ReturnCode::RETCODE_OK)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error starting DDS Router for " << benchmark_case);
+    }
+
+    eprosima::fastdds::dds::DomainParticipantQos participant_qos = participant_qos_(benchmark_case);
+
+    BenchmarkSubscriber subscriber;
+    if (!subscriber.init(domain_ + 1, participant_qos, benchmark_case, TOPIC_NAME))
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error creating subscriber for " << benchmark_case);
+    }
+
+    BenchmarkPublisher publisher;
+    if (!publisher.init(domain_, participant_qos, benchmark_case, TOPIC_NAME))
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error creating publisher for " << benchmark_case);
+    }
+
+    // Publish until a sample has gone through the router, so publisher, router and subscriber have matched
+    uint64_t sequence = 0;
+    std::chrono::steady_clock::time_point discovery_deadline = std::chrono::steady_clock::now() + DISCOVERY_TIMEOUT;
+    while (subscriber.warmup_received() == 0)
+    {
+        if (std::chrono::steady_clock::now() > discovery_deadline)
+        {
+            logWarning(DDSROUTER_BENCHMARK, "No sample went through the router for " << benchmark_case << ".");
+            router.stop();
+            return result;
+        }
+
+        publisher.publish(sequence++);
+        std::this_thread::sleep_for(WARMUP_PERIOD);
+    }
+    result.communicated = true;
+
+    // Measure
+    std::size_t expected_samples = benchmark_case.rate == 0 ?
+            BenchmarkSubscriber::MAX_LATENCIES :
+            static_cast<std::size_t>(benchmark_case.rate * std::chrono::duration<double>(duration_).count()) + 1;
+    subscriber.start_measurement(sequence, expected_samples);
+
+    int64_t start = steady_now();
+    std::chrono::steady_clock::time_point start_time = std::chrono::steady_clock::now();
+    std::chrono::steady_clock::time_point end_time = start_time + duration_;
+    std::chrono::nanoseconds period = benchmark_case.rate == 0 ?
+            std::chrono::nanoseconds(0) :
+            std::chrono::nanoseconds(1000000000 / benchmark_case.rate);
+
+    for (uint64_t i = 0;; ++i)
+    {
+        std::chrono::steady_clock::time_point next = start_time + period * static_cast<int64_t>(i);
+        if (next >= end_time || std::chrono::steady_clock::now() >= end_time)
+        {
+            break;
+        }
+        std::this_thread::sleep_until(next);
+
+        if (publisher.publish(sequence++))
+        {
+            ++result.sent;
+        }
+    }
+    int64_t end = steady_now();
+
+    // Wait for the samples in flight
+    std::chrono::steady_clock::time_point drain_deadline = std::chrono::steady_clock::now() + DRAIN_TIMEOUT;
+    while (subscriber.received() < result.sent && std::chrono::steady_clock::now() < drain_deadline)
+    {
+        std::this_thread::sleep_for(WARMUP_PERIOD);
+    }
+
+    result.received = subscriber.received();
+    result.duration = std::chrono::nanoseconds(std::max(end, subscriber.last_reception()) - start);
+
+    std::vector<int64_t> latencies = subscriber.latencies();
+    std::sort(latencies.begin(), latencies.end());
+    result.latency_p50 = percentile(latencies, 0.5);
+    result.latency_p99 = percentile(latencies, 0.99);
+    result.latency_p999 = percentile(latencies, 0.999);
+    result.latency_max = percentile(latencies, 1);
+
+    router.stop();
+
+    return result;
+}
+
+configuration::DDSRouterConfiguration BenchmarkRunner::router_configuration_(
+        const BenchmarkCase& benchmark_case) const
+{
+    std::set<std::shared_ptr<types::DdsFilterTopic>> allowlist;
+    allowlist.insert(std::make_shared<types::WildcardDdsFilterTopic>(TOPIC_NAME));
+
+    std::set<std::shared_ptr<configuration::ParticipantConfiguration>> participants_configurations;
+
+    for (uint32_t domain : {domain_, domain_ + 1})
+    {
+        types::ParticipantId id("participant_" + std::to_string(domain));
+
+        if (benchmark_case.transport == BenchmarkTransport::shm)
+        {
+            participants_configurations.insert(
+                std::make_shared<configuration::LocalShmParticipantConfiguration>(
+                    id,
+                    types::ParticipantKind(types::ParticipantKind::local_shm),
+                    false,
+                    types::DomainId(domain),
+                    shm_segment_size_(benchmark_case.payload_size)));
+        }
+        else
+        {
+            participants_configurations.insert(
+                std::make_shared<configuration::SimpleParticipantConfiguration>(
+                    id,
+                    types::ParticipantKind(types::ParticipantKind::simple_rtps),
+                    false,
+                    types::DomainId(domain)));
+        }
+    }
+
+    configuration::SpecsConfiguration advanced_options;
+    advanced_options.number_of_threads = benchmark_case.threads;
+
+    return configuration::DDSRouterConfiguration(
+        allowlist,
+        {},
+        {},
+        participants_configurations,
+        advanced_options);
+}
+
+eprosima::fastdds::dds::DomainParticipantQos BenchmarkRunner::participant_qos_(
+        const BenchmarkCase& benchmark_case) const
+{
+    eprosima::fastdds::dds::DomainParticipantQos qos;
+    qos.name("ddsrouter_bench");
+    qos.transport().use_builtin_transports = false;
+
+    if (benchmark_case.transport == BenchmarkTransport::shm)
+    {
+        std::shared_ptr<eprosima::fastdds::rtps::SharedMemTransportDescriptor> descriptor =
+                std::make_shared<eprosima::fastdds::rtps::SharedMemTransportDescriptor>();
+        descriptor->segment_size(shm_segment_size_(benchmark_case.payload_size));
+        descriptor->max_message_size(shm_segment_size_(benchmark_case.payload_size));
+        qos.transport().user_transports.push_back(descriptor);
+    }
+    else
+    {
+        std::shared_ptr<eprosima::fastdds::rtps::UDPv4TransportDescriptor> descriptor =
+                std::make_shared<eprosima::fastdds::rtps::UDPv4TransportDescriptor>();
+        descriptor->interfaceWhiteList.push_back("127.0.0.1");
+        qos.transport().user_transports.push_back(descriptor);
+
+        // Announce to the participants in 127.0.0.1 instead of by multicast
+        eprosima::fastrtps::rtps::Locator_t localhost;
+        localhost.kind = LOCATOR_KIND_UDPv4;
+        eprosima::fastrtps::rtps::IPLocator::setIPv4(localhost, "127.0.0.1");
+        qos.wire_protocol().builtin.initialPeersList.push_back(localhost);
+    }
+
+    return qos;
+}
+
+uint32_t BenchmarkRunner::shm_segment_size_(
+        uint32_t payload_size) noexcept
+{
+    // Room for 4 samples with their RTPS headers, and at least 1 MB
+    constexpr const uint64_t MIN_SEGMENT_SIZE = 1024 * 1024;
+    constexpr const uint64_t MESSAGE_OVERHEAD = 64 * 1024;
+    return static_cast<uint32_t>(std::max(MIN_SEGMENT_SIZE, 4 * (payload_size + MESSAGE_OVERHEAD)));
+}
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
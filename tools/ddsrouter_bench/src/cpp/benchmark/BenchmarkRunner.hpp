@@ -0,0 +1,106 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkRunner.hpp
+ */
+
+#ifndef EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKRUNNER_HPP
+#define EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKRUNNER_HPP
+
+#include <chrono>
+#include <cstdint>
+
+#include <fastdds/dds/domain/qos/DomainParticipantQos.hpp>
+
+#include <ddsrouter_core/configuration/DDSRouterConfiguration.hpp>
+
+#include "BenchmarkCase.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+/**
+ * Measure a \c BenchmarkCase in this process.
+ *
+ * Each case starts a new DDS Router between domains \c domain and \c domain+1 , with a participant of the kind of
+ * the transport in each one, a publisher in the first domain and a subscriber in the second one.
+ * Publisher and subscriber only use the loopback interface or Shared Memory, and announce themselves to the router
+ * by unicast in 127.0.0.1, so every sample measured stays in the host.
+ *
+ * Publication starts once a sample has gone through the router, and lasts \c duration . Samples still in flight
+ * are waited for up to \c DRAIN_TIMEOUT before counting the ones lost.
+ */
+class BenchmarkRunner
+{
+public:
+
+    BenchmarkRunner(
+            uint32_t domain,
+            std::chrono::milliseconds duration);
+
+    /**
+     * @brief Measure \c benchmark_case
+     *
+     * @return measurements, with \c communicated false if no sample went through the router in
+     * \c DISCOVERY_TIMEOUT
+     *
+     * @throw \c InitializationException if the router or any DDS entity could not be created
+     */
+    BenchmarkResult run(
+            const BenchmarkCase& benchmark_case) const;
+
+    //! Topic where samples are published, the only one the router forwards
+    static const char* TOPIC_NAME;
+
+    //! Maximum time to wait for the first sample to go through the router
+    static const std::chrono::milliseconds DISCOVERY_TIMEOUT;
+
+    //! Time between samples published until the first one goes through the router
+    static const std::chrono::milliseconds WARMUP_PERIOD;
+
+    //! Maximum time to wait for the samples in flight once publication stops
+    static const std::chrono::milliseconds DRAIN_TIMEOUT;
+
+protected:
+
+    //! Router between both domains with the participants of the transport of \c benchmark_case
+    core::configuration::DDSRouterConfiguration router_configuration_(
+            const BenchmarkCase& benchmark_case) const;
+
+    //! QoS of publisher and subscriber participants that only use the transport of \c benchmark_case
+    eprosima::fastdds::dds::DomainParticipantQos participant_qos_(
+            const BenchmarkCase& benchmark_case) const;
+
+    /**
+     * @brief Shared Memory segment used by every participant for \c payload_size bytes samples
+     *
+     * It holds several samples, so large ones are neither fragmented nor wait for the segment to be freed.
+     */
+    static uint32_t shm_segment_size_(
+            uint32_t payload_size) noexcept;
+
+    //! Domain of the publisher (the subscriber is in the next one)
+    uint32_t domain_;
+
+    //! Time publishing samples in every case
+    std::chrono::milliseconds duration_;
+};
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKRUNNER_HPP */
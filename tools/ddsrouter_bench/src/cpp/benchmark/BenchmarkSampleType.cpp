@@ -0,0 +1,147 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkSampleType.cpp
+ */
+
+#include <cstring>
+
+#include <fastdds/rtps/common/SerializedPayload.h>
+
+#include "BenchmarkSampleType.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+using eprosima::fastrtps::rtps::InstanceHandle_t;
+using eprosima::fastrtps::rtps::SerializedPayload_t;
+
+const char* BenchmarkSampleType::TYPE_NAME = "ddsrouter_bench::BenchmarkSample";
+
+const uint32_t BenchmarkSampleType::HEADER_SIZE_ = 4 + sizeof(uint64_t) + sizeof(int64_t) + sizeof(uint32_t);
+
+BenchmarkSampleType::BenchmarkSampleType(
+        uint32_t max_payload_size)
+{
+    setName(TYPE_NAME);
+    m_typeSize = serialized_size_(max_payload_size);
+    m_isGetKeyDefined = false;
+}
+
+bool BenchmarkSampleType::serialize(
+        void* data,
+        SerializedPayload_t* payload)
+{
+    const BenchmarkSample* sample = static_cast<const BenchmarkSample*>(data);
+    uint32_t payload_size = static_cast<uint32_t>(sample->payload.size());
+    uint32_t size = serialized_size_(payload_size);
+
+    if (payload->max_size < size)
+    {
+        return false;
+    }
+
+    // CDR little endian encapsulation with no options
+    payload->encapsulation = CDR_LE;
+    payload->data[0] = 0x00;
+    payload->data[1] = 0x01;
+    payload->data[2] = 0x00;
+    payload->data[3] = 0x00;
+
+    uint8_t* position = payload->data + 4;
+    std::memcpy(position, &sample->sequence, sizeof(sample->sequence));
+    position += sizeof(sample->sequence);
+    std::memcpy(position, &sample->timestamp, sizeof(sample->timestamp));
+    position += sizeof(sample->timestamp);
+    std::memcpy(position, &payload_size, sizeof(payload_size));
+    position += sizeof(payload_size);
+    if (payload_size > 0)
+    {
+        std::memcpy(position, sample->payload.data(), payload_size);
+    }
+
+    payload->length = size;
+    return true;
+}
+
+bool BenchmarkSampleType::deserialize(
+        SerializedPayload_t* payload,
+        void* data)
+{
+    BenchmarkSample* sample = static_cast<BenchmarkSample*>(data);
+
+    if (payload->length < HEADER_SIZE_)
+    {
+        return false;
+    }
+
+    const uint8_t* position = payload->data + 4;
+    std::memcpy(&sample->sequence, position, sizeof(sample->sequence));
+    position += sizeof(sample->sequence);
+    std::memcpy(&sample->timestamp, position, sizeof(sample->timestamp));
+    position += sizeof(sample->timestamp);
+
+    uint32_t payload_size = 0;
+    std::memcpy(&payload_size, position, sizeof(payload_size));
+    position += sizeof(payload_size);
+
+    if (payload->length < serialized_size_(payload_size))
+    {
+        return false;
+    }
+
+    sample->payload.assign(position, position + payload_size);
+    return true;
+}
+
+std::function<uint32_t()> BenchmarkSampleType::getSerializedSizeProvider(
+        void* data)
+{
+    return [data]()
+           {
+               return serialized_size_(static_cast<uint32_t>(static_cast<BenchmarkSample*>(data)->payload.size()));
+           };
+}
+
+void* BenchmarkSampleType::createData()
+{
+    return new BenchmarkSample();
+}
+
+void BenchmarkSampleType::deleteData(
+        void* data)
+{
+    delete static_cast<BenchmarkSample*>(data);
+}
+
+bool BenchmarkSampleType::getKey(
+        void*,
+        InstanceHandle_t*,
+        bool)
+{
+    // Type without key
+    return false;
+}
+
+uint32_t BenchmarkSampleType::serialized_size_(
+        uint32_t payload_size) noexcept
+{
+    return HEADER_SIZE_ + payload_size;
+}
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,100 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file BenchmarkSampleType.hpp
+ */
+
+#ifndef EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKSAMPLETYPE_HPP
+#define EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKSAMPLETYPE_HPP
+
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include <fastdds/dds/topic/TopicDataType.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace bench {
+
+/**
+ * Sample published in the benchmark.
+ */
+struct BenchmarkSample
+{
+    //! Number of the sample in the order published
+    uint64_t sequence = 0;
+
+    //! Nanoseconds of the steady clock when the sample is published
+    int64_t timestamp = 0;
+
+    //! Data that fills the sample up to the payload size measured
+    std::vector<uint8_t> payload;
+};
+
+/**
+ * Type support of \c BenchmarkSample .
+ *
+ * The fields are stored in host byte order after a CDR little endian encapsulation, which is enough as every
+ * entity runs in the same process, and avoids generating code from an IDL for a type that only this tool uses.
+ * The router does not deserialize the data, so it forwards it as any other type.
+ */
+class BenchmarkSampleType : public eprosima::fastdds::dds::TopicDataType
+{
+public:
+
+    //! Type that holds samples with up to \c max_payload_size bytes of payload
+    BenchmarkSampleType(
+            uint32_t max_payload_size);
+
+    bool serialize(
+            void* data,
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload) override;
+
+    bool deserialize(
+            eprosima::fastrtps::rtps::SerializedPayload_t* payload,
+            void* data) override;
+
+    std::function<uint32_t()> getSerializedSizeProvider(
+            void* data) override;
+
+    void* createData() override;
+
+    void deleteData(
+            void* data) override;
+
+    bool getKey(
+            void* data,
+            eprosima::fastrtps::rtps::InstanceHandle_t* ihandle,
+            bool force_md5 = false) override;
+
+    //! Name of the type
+    static const char* TYPE_NAME;
+
+protected:
+
+    //! Bytes of a serialized sample with \c payload_size bytes of payload
+    static uint32_t serialized_size_(
+            uint32_t payload_size) noexcept;
+
+    //! Bytes of the encapsulation, sequence number, timestamp and payload length
+    static const uint32_t HEADER_SIZE_;
+};
+
+} /* namespace bench */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_BENCHMARK_BENCHMARKSAMPLETYPE_HPP */
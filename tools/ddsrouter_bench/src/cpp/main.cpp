@@ -0,0 +1,136 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file main.cpp
+ *
+ */
+
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+#include <cpp_utils/exception/ConfigurationException.hpp>
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+#include <cpp_utils/logging/CustomStdLogConsumer.hpp>
+
+#include "benchmark/BenchmarkCase.hpp"
+#include "benchmark/BenchmarkReport.hpp"
+#include "benchmark/BenchmarkRunner.hpp"
+#include "user_interface/arguments_configuration.hpp"
+#include "user_interface/ProcessReturnCode.hpp"
+
+using namespace eprosima::ddsrouter;
+
+int main(
+        int argc,
+        char** argv)
+{
+    ui::BenchmarkArguments arguments;
+
+    // Parse arguments
+    ui::ProcessReturnCode arg_parse_result = ui::parse_arguments(argc, argv, arguments);
+
+    if (arg_parse_result == ui::ProcessReturnCode::help_argument)
+    {
+        return static_cast<int>(ui::ProcessReturnCode::success);
+    }
+    else if (arg_parse_result == ui::ProcessReturnCode::version_argument)
+    {
+        return static_cast<int>(ui::ProcessReturnCode::success);
+    }
+    else if (arg_parse_result != ui::ProcessReturnCode::success)
+    {
+        return static_cast<int>(arg_parse_result);
+    }
+
+    // Debug
+    {
+        // Remove every consumer
+        eprosima::utils::Log::ClearConsumers();
+
+        // Activate log with verbosity, as this will avoid running log thread with not desired kind
+        eprosima::utils::Log::SetVerbosity(arguments.log_verbosity);
+
+        eprosima::utils::Log::RegisterConsumer(
+            std::make_unique<eprosima::utils::CustomStdLogConsumer>("DDSROUTER", arguments.log_verbosity));
+    }
+
+    // Report in a file or in standard output (progress is written in standard error, so it can be redirected)
+    std::ofstream output_file;
+    if (!arguments.output_file.empty())
+    {
+        output_file.open(arguments.output_file);
+        if (!output_file.is_open())
+        {
+            logError(DDSROUTER_ARGS, "File '" << arguments.output_file << "' could not be opened to write.");
+            return static_cast<int>(ui::ProcessReturnCode::incorrect_argument);
+        }
+    }
+    std::ostream& output = arguments.output_file.empty() ? std::cout : output_file;
+
+    std::vector<bench::BenchmarkCase> cases = bench::sweep(
+        arguments.transports,
+        arguments.payload_sizes,
+        arguments.rates,
+        arguments.reliabilities,
+        arguments.history_depths,
+        arguments.threads);
+
+    bench::BenchmarkRunner runner(arguments.domain, std::chrono::seconds(arguments.duration));
+
+    ui::ProcessReturnCode result_code = ui::ProcessReturnCode::success;
+
+    {
+        bench::BenchmarkReport report(output, arguments.format);
+
+        for (std::size_t i = 0; i < cases.size(); ++i)
+        {
+            std::cerr << "[" << (i + 1) << "/" << cases.size() << "] " << cases[i] << std::endl;
+
+            bench::BenchmarkResult result;
+            result.benchmark_case = cases[i];
+
+            try
+            {
+                result = runner.run(cases[i]);
+            }
+            catch (const eprosima::utils::ConfigurationException& e)
+            {
+                logError(DDSROUTER_ERROR, "Error configuring " << cases[i] << ". Error message:\n " << e.what());
+                result_code = ui::ProcessReturnCode::execution_failed;
+            }
+            catch (const eprosima::utils::InitializationException& e)
+            {
+                logError(DDSROUTER_ERROR, "Error running " << cases[i] << ". Error message:\n " << e.what());
+                result_code = ui::ProcessReturnCode::execution_failed;
+            }
+
+            if (!result.communicated)
+            {
+                result_code = ui::ProcessReturnCode::execution_failed;
+            }
+
+            report.add(result);
+        }
+    }
+
+    // Force print every log before closing
+    eprosima::utils::Log::Flush();
+
+    return static_cast<int>(result_code);
+}
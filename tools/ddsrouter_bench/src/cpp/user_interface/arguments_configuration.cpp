@@ -0,0 +1,534 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file arguments_configuration.cpp
+ *
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <ddsrouter_core/library/config.h>
+
+#include "arguments_configuration.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace ui {
+
+const option::Descriptor usage[] = {
+    {
+        optionIndex::UNKNOWN_OPT,
+        0,
+        "",
+        "",
+        Arg::None,
+        "Usage: Fast DDS Router Benchmark \n" \
+        "Measure throughput, loss and latency of a DDS Router between two domains in this host.\n" \
+        "A DDS Router, a publisher and a subscriber are run in this process for every combination of the values " \
+        "given, only communicating through the loopback interface or Shared Memory.\n" \
+        "Lists of values are separated by commas (e.g. --sizes 64,1024).\n" \
+        "General options:"
+    },
+
+    ////////////////////
+    // Help options
+    {
+        optionIndex::UNKNOWN_OPT, 0, "", "", Arg::None,
+        "\nApplication help and information."
+    },
+
+    {
+        optionIndex::HELP,
+        0,
+        "h",
+        "help",
+        Arg::None,
+        "  -h \t--help\t  \t" \
+        "Print this help message."
+    },
+
+    {
+        optionIndex::VERSION,
+        0,
+        "v",
+        "version",
+        Arg::None,
+        "  -v \t--version\t  \t" \
+        "Print version, branch and commit hash." \
+    },
+
+    ////////////////////
+    // Benchmark options
+    {
+        optionIndex::UNKNOWN_OPT, 0, "", "", Arg::None,
+        "\nBenchmark parameters"
+    },
+
+    {
+        optionIndex::TRANSPORTS,
+        0,
+        "",
+        "transports",
+        Arg::String,
+        "  \t--transports\t  \t" \
+        "Transports between the DDS entities and the router: \"udp\" (simple participants and UDP in 127.0.0.1) " \
+        "and/or \"shm\" (local-shm participants and Shared Memory). [Default: udp,shm]."
+    },
+
+    {
+        optionIndex::PAYLOAD_SIZES,
+        0,
+        "s",
+        "sizes",
+        Arg::String,
+        "  -s \t--sizes\t  \t" \
+        "Bytes of payload of each sample. [Default: 64,65536,4194304]."
+    },
+
+    {
+        optionIndex::RATES,
+        0,
+        "r",
+        "rates",
+        Arg::String,
+        "  -r \t--rates\t  \t" \
+        "Samples published per second. Value 0 publishes as fast as possible. [Default: 100]."
+    },
+
+    {
+        optionIndex::RELIABILITIES,
+        0,
+        "",
+        "reliability",
+        Arg::String,
+        "  \t--reliability\t  \t" \
+        "Reliability of publisher and subscriber: \"reliable\" and/or \"best-effort\". " \
+        "[Default: reliable,best-effort]."
+    },
+
+    {
+        optionIndex::HISTORY_DEPTHS,
+        0,
+        "",
+        "depths",
+        Arg::String,
+        "  \t--depths\t  \t" \
+        "History depth of publisher and subscriber. [Default: 10]."
+    },
+
+    {
+        optionIndex::THREADS,
+        0,
+        "",
+        "threads",
+        Arg::String,
+        "  \t--threads\t  \t" \
+        "Number of threads of the router. [Default: 12]."
+    },
+
+    {
+        optionIndex::DURATION,
+        0,
+        "t",
+        "duration",
+        Arg::Numeric,
+        "  -t \t--duration\t  \t" \
+        "Seconds publishing samples in every case. [Default: 5]."
+    },
+
+    {
+        optionIndex::DOMAIN_ID,
+        0,
+        "",
+        "domain",
+        Arg::Numeric,
+        "  \t--domain\t  \t" \
+        "Domain of the publisher. The subscriber uses the next one. [Default: 0]."
+    },
+
+    ////////////////////
+    // Output options
+    {
+        optionIndex::UNKNOWN_OPT, 0, "", "", Arg::None,
+        "\nOutput parameters"
+    },
+
+    {
+        optionIndex::FORMAT,
+        0,
+        "f",
+        "format",
+        Arg::String,
+        "  -f \t--format\t  \t" \
+        "Format of the report: \"csv\" or \"json\". [Default: csv]."
+    },
+
+    {
+        optionIndex::OUTPUT_FILE,
+        0,
+        "o",
+        "output",
+        Arg::String,
+        "  -o \t--output\t  \t" \
+        "File where the report is written. [Default: standard output]."
+    },
+
+    {
+        optionIndex::ACTIVATE_DEBUG,
+        0,
+        "d",
+        "debug",
+        Arg::None,
+        "  -d \t--debug\t  \t" \
+        "Set log verbosity to Info."
+    },
+
+    {
+        optionIndex::UNKNOWN_OPT, 0, "", "", Arg::None,
+        "\n"
+    },
+
+    { 0, 0, 0, 0, 0, 0 }
+};
+
+namespace {
+
+//! Values in a list separated by commas
+std::vector<std::string> split(
+        const std::string& list)
+{
+    std::vector<std::string> values;
+    std::stringstream stream(list);
+    std::string value;
+    while (std::getline(stream, value, ','))
+    {
+        values.push_back(value);
+    }
+    return values;
+}
+
+/**
+ * @brief Parse a list of unsigned numbers separated by commas
+ *
+ * @return whether every value is a number in the range of \c T
+ */
+template <typename T>
+bool parse_numbers(
+        const std::string& list,
+        std::vector<T>& numbers)
+{
+    std::vector<T> result;
+    for (const std::string& value : split(list))
+    {
+        if (value.empty() || !std::isdigit(static_cast<unsigned char>(value[0])))
+        {
+            return false;
+        }
+
+        char* end = nullptr;
+        unsigned long long number = std::strtoull(value.c_str(), &end, 10);
+        if (*end != 0 || number > std::numeric_limits<T>::max())
+        {
+            return false;
+        }
+        result.push_back(static_cast<T>(number));
+    }
+
+    if (result.empty())
+    {
+        return false;
+    }
+
+    numbers = result;
+    return true;
+}
+
+//! Parse a single unsigned number
+bool parse_number(
+        const std::string& value,
+        uint32_t& number)
+{
+    std::vector<uint32_t> numbers;
+    if (!parse_numbers(value, numbers) || numbers.size() != 1)
+    {
+        return false;
+    }
+    number = numbers[0];
+    return true;
+}
+
+//! Parse a list of transports separated by commas
+bool parse_transports(
+        const std::string& list,
+        std::vector<bench::BenchmarkTransport>& transports)
+{
+    std::vector<bench::BenchmarkTransport> result;
+    for (const std::string& value : split(list))
+    {
+        bench::BenchmarkTransport transport;
+        if (!bench::from_string(value, transport))
+        {
+            return false;
+        }
+        result.push_back(transport);
+    }
+
+    if (result.empty())
+    {
+        return false;
+    }
+
+    transports = result;
+    return true;
+}
+
+//! Parse a list of reliabilities separated by commas (true for reliable)
+bool parse_reliabilities(
+        const std::string& list,
+        std::vector<bool>& reliabilities)
+{
+    std::vector<bool> result;
+    for (const std::string& value : split(list))
+    {
+        if (value == "reliable")
+        {
+            result.push_back(true);
+        }
+        else if (value == "best-effort")
+        {
+            result.push_back(false);
+        }
+        else
+        {
+            return false;
+        }
+    }
+
+    if (result.empty())
+    {
+        return false;
+    }
+
+    reliabilities = result;
+    return true;
+}
+
+} /* namespace */
+
+void print_version()
+{
+    std::cout << "DDSRouter Benchmark " << DDSROUTER_CORE_VERSION_STRING << "\ncommit hash: " <<
+        DDSROUTER_CORE_COMMIT_HASH << std::endl;
+}
+
+ProcessReturnCode parse_arguments(
+        int argc,
+        char** argv,
+        BenchmarkArguments& arguments)
+{
+    // Variable to pretty print usage help
+    int columns;
+#if defined(_WIN32)
+    char* buf = nullptr;
+    size_t sz = 0;
+    if (_dupenv_s(&buf, &sz, "COLUMNS") == 0 && buf != nullptr)
+    {
+        columns = std::strtol(buf, nullptr, 10);
+        free(buf);
+    }
+    else
+    {
+        columns = 80;
+    }
+#else
+    columns = getenv("COLUMNS") ? atoi(getenv("COLUMNS")) : 180;
+#endif // if defined(_WIN32)
+
+    // No required arguments, so running without any uses the default values
+    argc -= (argc > 0); // reduce arg count of program name if present
+    argv += (argc > 0); // skip program name argv[0] if present
+
+    option::Stats stats(usage, argc, argv);
+    std::vector<option::Option> options(stats.options_max);
+    std::vector<option::Option> buffer(stats.buffer_max);
+    option::Parser parse(usage, argc, argv, &options[0], &buffer[0]);
+
+    // Parsing error
+    if (parse.error())
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return ProcessReturnCode::incorrect_argument;
+    }
+
+    // Unknown args provided
+    if (parse.nonOptionsCount())
+    {
+        logError(DDSROUTER_ARGS, "ERROR: Unknown argument: <" << parse.nonOption(0) << ">." );
+        option::printUsage(fwrite, stdout, usage, columns);
+        return ProcessReturnCode::incorrect_argument;
+    }
+
+    // Adding Help before every other check to show help in case an argument is incorrect
+    if (options[optionIndex::HELP])
+    {
+        option::printUsage(fwrite, stdout, usage, columns);
+        return ProcessReturnCode::help_argument;
+    }
+
+    if (options[optionIndex::VERSION])
+    {
+        print_version();
+        return ProcessReturnCode::version_argument;
+    }
+
+    for (int i = 0; i < parse.optionsCount(); ++i)
+    {
+        option::Option& opt = buffer[i];
+        bool correct = true;
+
+        switch (opt.index())
+        {
+            case optionIndex::TRANSPORTS:
+                correct = parse_transports(opt.arg, arguments.transports);
+                break;
+
+            case optionIndex::PAYLOAD_SIZES:
+                correct = parse_numbers(opt.arg, arguments.payload_sizes);
+                break;
+
+            case optionIndex::RATES:
+                correct = parse_numbers(opt.arg, arguments.rates);
+                break;
+
+            case optionIndex::RELIABILITIES:
+                correct = parse_reliabilities(opt.arg, arguments.reliabilities);
+                break;
+
+            case optionIndex::HISTORY_DEPTHS:
+                correct = parse_numbers(opt.arg, arguments.history_depths) &&
+                        std::count(arguments.history_depths.begin(), arguments.history_depths.end(), 0u) == 0;
+                break;
+
+            case optionIndex::THREADS:
+                correct = parse_numbers(opt.arg, arguments.threads) &&
+                        std::count(arguments.threads.begin(), arguments.threads.end(), 0u) == 0;
+                break;
+
+            case optionIndex::DURATION:
+                correct = parse_number(opt.arg, arguments.duration) && arguments.duration > 0;
+                break;
+
+            case optionIndex::DOMAIN_ID:
+                correct = parse_number(opt.arg, arguments.domain);
+                break;
+
+            case optionIndex::FORMAT:
+                correct = bench::from_string(opt.arg, arguments.format);
+                break;
+
+            case optionIndex::OUTPUT_FILE:
+                arguments.output_file = opt.arg;
+                break;
+
+            case optionIndex::ACTIVATE_DEBUG:
+                arguments.log_verbosity = eprosima::fastdds::dds::Log::Kind::Info;
+                break;
+
+            case optionIndex::UNKNOWN_OPT:
+                logError(DDSROUTER_ARGS, opt << " is not a valid argument.");
+                option::printUsage(fwrite, stdout, usage, columns);
+                return ProcessReturnCode::incorrect_argument;
+                break;
+
+            default:
+                break;
+        }
+
+        if (!correct)
+        {
+            logError(DDSROUTER_ARGS, "Option '" << opt << "' has an incorrect value <" << opt.arg << ">.");
+            return ProcessReturnCode::incorrect_argument;
+        }
+    }
+
+    return ProcessReturnCode::success;
+}
+
+option::ArgStatus Arg::Unknown(
+        const option::Option& option,
+        bool msg)
+{
+    if (msg)
+    {
+        logError(
+            DDSROUTER_ARGS,
+            "Unknown option '" << option << "'. Use -h to see this executable possible arguments.");
+    }
+    return option::ARG_ILLEGAL;
+}
+
+option::ArgStatus Arg::Numeric(
+        const option::Option& option,
+        bool msg)
+{
+    char* endptr = 0;
+    if (option.arg != 0 && std::strtol(option.arg, &endptr, 10))
+    {
+    }
+    if (endptr != option.arg && *endptr == 0)
+    {
+        return option::ARG_OK;
+    }
+
+    if (msg)
+    {
+        logError(DDSROUTER_ARGS, "Option '" << option << "' requires a numeric argument.");
+    }
+    return option::ARG_ILLEGAL;
+}
+
+option::ArgStatus Arg::String(
+        const option::Option& option,
+        bool msg)
+{
+    if (option.arg != 0)
+    {
+        return option::ARG_OK;
+    }
+    if (msg)
+    {
+        logError(DDSROUTER_ARGS, "Option '" << option << "' requires a text argument.");
+    }
+    return option::ARG_ILLEGAL;
+}
+
+std::ostream& operator <<(
+        std::ostream& output,
+        const option::Option& option)
+{
+    output << std::string(option.name, option.name + option.namelen);
+    return output;
+}
+
+} /* namespace ui */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
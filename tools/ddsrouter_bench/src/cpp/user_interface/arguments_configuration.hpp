@@ -0,0 +1,157 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file arguments_configuration.hpp
+ *
+ */
+
+#ifndef EPROSIMA_DDSROUTER_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP
+#define EPROSIMA_DDSROUTER_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <optionparser.h>
+
+#include <cpp_utils/Log.hpp>
+
+#include "../benchmark/BenchmarkCase.hpp"
+#include "../benchmark/BenchmarkReport.hpp"
+#include "ProcessReturnCode.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace ui {
+
+/*
+ * Struct to parse the executable arguments
+ */
+struct Arg : public option::Arg
+{
+    //! Print error message when argument type is not known
+    static option::ArgStatus Unknown(
+            const option::Option& option,
+            bool msg);
+
+    //! Check that the argument has integer numeric value
+    static option::ArgStatus Numeric(
+            const option::Option& option,
+            bool msg);
+
+    //! Check that the argument is a string
+    static option::ArgStatus String(
+            const option::Option& option,
+            bool msg);
+};
+
+/*
+ * Option arguments available
+ */
+enum optionIndex
+{
+    UNKNOWN_OPT,
+    HELP,
+    VERSION,
+    TRANSPORTS,
+    PAYLOAD_SIZES,
+    RATES,
+    RELIABILITIES,
+    HISTORY_DEPTHS,
+    THREADS,
+    DURATION,
+    DOMAIN_ID,
+    FORMAT,
+    OUTPUT_FILE,
+    ACTIVATE_DEBUG,
+};
+
+/**
+ * Usage description
+ *
+ * @note : Extern used to initialize it in source file
+ */
+extern const option::Descriptor usage[];
+
+/**
+ * Parameters of the benchmark, with the default values used when not given as arguments.
+ *
+ * Every combination of the lists of values is measured.
+ * Default values compare both transports, including samples of 4 MB where Shared Memory should outperform UDP.
+ */
+struct BenchmarkArguments
+{
+    std::vector<bench::BenchmarkTransport> transports = {
+        bench::BenchmarkTransport::udp,
+        bench::BenchmarkTransport::shm};
+
+    std::vector<uint32_t> payload_sizes = {64, 65536, 4194304};
+
+    std::vector<uint32_t> rates = {100};
+
+    std::vector<bool> reliabilities = {true, false};
+
+    std::vector<uint32_t> history_depths = {10};
+
+    std::vector<unsigned int> threads = {12};
+
+    //! Seconds publishing samples in every case
+    uint32_t duration = 5;
+
+    //! Domain of the publisher (the subscriber is in the next one)
+    uint32_t domain = 0;
+
+    bench::ReportFormat format = bench::ReportFormat::csv;
+
+    //! File where the report is written (standard output if empty)
+    std::string output_file = "";
+
+    eprosima::fastdds::dds::Log::Kind log_verbosity = eprosima::fastdds::dds::Log::Kind::Warning;
+};
+
+/**
+ * @brief Parse process arguments
+ *
+ * Set in \c arguments the values given to the process, and keep the default value of the ones not given
+ *
+ * @param [in] argc number of process arguments
+ * @param [in] argv process arguments array (with size \c argc )
+ * @param [in,out] arguments parameters of the benchmark
+ *
+ * @return \c SUCCESS if everything OK
+ * @return \c INCORRECT_ARGUMENT if arguments were incorrect (unknown or incorrect value)
+ * @return \c HELP_ARGUMENT if arguments help given
+ * @return \c VERSION_ARGUMENT if arguments version given
+ */
+ProcessReturnCode parse_arguments(
+        int argc,
+        char** argv,
+        BenchmarkArguments& arguments);
+
+//! \c Option to stream serializator
+std::ostream& operator <<(
+        std::ostream& output,
+        const option::Option& option);
+
+/**
+ * @brief Print version in console.
+ */
+void print_version();
+
+} /* namespace ui */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP */
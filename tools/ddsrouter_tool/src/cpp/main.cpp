@@ -32,9 +32,12 @@
 #include <ddsrouter_yaml/YamlReaderConfiguration.hpp>
 #include <ddsrouter_yaml/YamlManager.hpp>
 
+#include "metrics/MetricsExporter.hpp"
 #include "user_interface/constants.hpp"
 #include "user_interface/arguments_configuration.hpp"
 #include "user_interface/ProcessReturnCode.hpp"
+#include "user_interface/MemoryReport.hpp"
+#include "user_interface/UserSignalHandler.hpp"
 
 using namespace eprosima::ddsrouter;
 
@@ -55,9 +58,17 @@ int main(
     std::string log_filter = "DDSROUTER";
     eprosima::fastdds::dds::Log::Kind log_verbosity = eprosima::fastdds::dds::Log::Kind::Warning;
 
+    // Metrics endpoint (disabled by default)
+    uint16_t metrics_port = 0;
+    std::string metrics_address = "127.0.0.1";
+
+    // Trace file (no trace dumped by default)
+    std::string trace_file = "";
+
     // Parse arguments
     ui::ProcessReturnCode arg_parse_result =
-            ui::parse_arguments(argc, argv, file_path, reload_time, timeout, log_filter, log_verbosity);
+            ui::parse_arguments(argc, argv, file_path, reload_time, timeout, log_filter, log_verbosity,
+                    metrics_port, metrics_address, trace_file);
 
     if (arg_parse_result == ui::ProcessReturnCode::help_argument)
     {
@@ -213,6 +224,69 @@ int main(
                             reload_time);
         }
 
+        /////
+        // Metrics endpoint
+
+        // It must be a ptr, so the endpoint is only opened when required by arguments
+        std::unique_ptr<metrics::MetricsExporter> metrics_exporter;
+
+        if (metrics_port > 0)
+        {
+            metrics_exporter = std::make_unique<metrics::MetricsExporter>(
+                [&router]()
+                {
+                    return router.statistics();
+                },
+                metrics_address,
+                metrics_port);
+        }
+
+        /////
+        // User signal
+
+        // Dump traces with SIGUSR1, only if a trace file is given
+        std::function<void()> dump_trace_callback =
+                [trace_file]
+                    ()
+                {
+                    if (core::DDSRouter::dump_trace(trace_file) == eprosima::utils::ReturnCode::RETCODE_OK)
+                    {
+                        logUser(DDSROUTER_EXECUTION, "Trace dumped in file " << trace_file << ".");
+                    }
+                    else
+                    {
+                        logWarning(DDSROUTER_EXECUTION, "Error dumping trace in file " << trace_file << ".");
+                    }
+                };
+
+        bool dump_trace = false;
+
+        if (!trace_file.empty())
+        {
+            if (core::DDSRouter::tracing_enabled())
+            {
+                dump_trace = true;
+            }
+            else
+            {
+                logWarning(DDSROUTER_EXECUTION,
+                        "Tracing is not compiled in (CMake option DDSROUTER_TRACE), so no trace will be dumped.");
+            }
+        }
+
+        // Report the topics that hold more memory with SIGUSR1
+        std::unique_ptr<ui::UserSignalHandler> user_signal_handler = std::make_unique<ui::UserSignalHandler>(
+            [&router, &dump_trace_callback, dump_trace]
+                ()
+            {
+                logUser(DDSROUTER_EXECUTION, ui::memory_report(router.statistics(true), ui::MEMORY_REPORT_TOPICS));
+
+                if (dump_trace)
+                {
+                    dump_trace_callback();
+                }
+            });
+
         // Start Router
         router.start();
 
@@ -234,6 +308,20 @@ int main(
             file_watcher_handler.reset();
         }
 
+        // Stop handling SIGUSR1 and dump the last samples forwarded before stopping
+        user_signal_handler.reset();
+
+        if (dump_trace)
+        {
+            dump_trace_callback();
+        }
+
+        // Stop serving metrics before the Router is destroyed
+        if (metrics_exporter)
+        {
+            metrics_exporter.reset();
+        }
+
         // Stop Router
         router.stop();
 
@@ -0,0 +1,321 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MetricsExporter.cpp
+ *
+ */
+
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <unistd.h>
+#endif // if !defined(_WIN32)
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/Log.hpp>
+
+#include "MetricsExporter.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace metrics {
+
+const utils::Duration_ms MetricsExporter::DEFAULT_REFRESH_PERIOD = 1000;
+const int MetricsExporter::POLL_TIMEOUT_ = 200;
+const int MetricsExporter::CONNECTION_TIMEOUT_ = 1000;
+const std::size_t MetricsExporter::MAX_REQUEST_SIZE_ = 8192;
+
+MetricsExporter::MetricsExporter(
+        std::function<core::types::RouterStatistics()> statistics_source,
+        const std::string& address,
+        uint16_t port,
+        utils::Duration_ms refresh_period)
+    : statistics_source_(statistics_source)
+    , refresh_period_(refresh_period)
+    , exposition_(std::make_shared<const std::string>("# EOF\n"))
+    , socket_(-1)
+    , stop_(false)
+{
+    open_socket_(address, port);
+
+    // Render once, so first requests already get every topic
+    refresh_();
+
+    refresh_thread_ = std::thread(&MetricsExporter::refresh_routine_, this);
+    server_thread_ = std::thread(&MetricsExporter::server_routine_, this);
+
+    logUser(DDSROUTER_METRICS, "Serving metrics in http://" << address << ":" << port << "/metrics .");
+}
+
+MetricsExporter::~MetricsExporter()
+{
+    {
+        std::lock_guard<std::mutex> lock(refresh_mutex_);
+        stop_.store(true);
+    }
+    refresh_cv_.notify_all();
+
+    if (refresh_thread_.joinable())
+    {
+        refresh_thread_.join();
+    }
+
+    if (server_thread_.joinable())
+    {
+        server_thread_.join();
+    }
+
+#if !defined(_WIN32)
+    if (socket_ >= 0)
+    {
+        close(socket_);
+    }
+#endif // if !defined(_WIN32)
+}
+
+#if defined(_WIN32)
+
+void MetricsExporter::open_socket_(
+        const std::string&,
+        uint16_t)
+{
+    throw utils::InitializationException("Metrics endpoint is not supported in this platform.");
+}
+
+void MetricsExporter::server_routine_() noexcept
+{
+}
+
+void MetricsExporter::handle_connection_(
+        int) noexcept
+{
+}
+
+bool MetricsExporter::send_all_(
+        int,
+        const char*,
+        std::size_t) noexcept
+{
+    return false;
+}
+
+#else
+
+void MetricsExporter::open_socket_(
+        const std::string& address,
+        uint16_t port)
+{
+    sockaddr_in socket_address;
+    std::memset(&socket_address, 0, sizeof(socket_address));
+    socket_address.sin_family = AF_INET;
+    socket_address.sin_port = htons(port);
+
+    if (inet_pton(AF_INET, address.c_str(), &socket_address.sin_addr) != 1)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Metrics address " << address << " is not a valid IPv4 address.");
+    }
+
+    socket_ = socket(AF_INET, SOCK_STREAM, 0);
+    if (socket_ < 0)
+    {
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error creating metrics socket: " << std::strerror(errno) << ".");
+    }
+
+    // Allow restarting the router right after closing it
+    int reuse = 1;
+    setsockopt(socket_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+
+    if (bind(socket_, reinterpret_cast<sockaddr*>(&socket_address), sizeof(socket_address)) != 0 ||
+            listen(socket_, SOMAXCONN) != 0)
+    {
+        int error = errno;
+        close(socket_);
+        socket_ = -1;
+        throw utils::InitializationException(
+                  utils::Formatter() << "Error listening for metrics requests in " << address << ":" << port << ": " <<
+                      std::strerror(error) << ".");
+    }
+}
+
+void MetricsExporter::server_routine_() noexcept
+{
+    while (!stop_.load())
+    {
+        pollfd listening;
+        listening.fd = socket_;
+        listening.events = POLLIN;
+        listening.revents = 0;
+
+        // Wake up periodically to check whether it must stop
+        if (poll(&listening, 1, POLL_TIMEOUT_) <= 0 || !(listening.revents & POLLIN))
+        {
+            continue;
+        }
+
+        int connection = accept(socket_, nullptr, nullptr);
+        if (connection < 0)
+        {
+            continue;
+        }
+
+        handle_connection_(connection);
+        close(connection);
+    }
+}
+
+void MetricsExporter::handle_connection_(
+        int connection) noexcept
+{
+    // A slow or malicious client must not block the server for long
+    timeval timeout;
+    timeout.tv_sec = CONNECTION_TIMEOUT_ / 1000;
+    timeout.tv_usec = (CONNECTION_TIMEOUT_ % 1000) * 1000;
+    setsockopt(connection, SOL_SOCKET, SO_RCVTIMEO, &timeout, sizeof(timeout));
+    setsockopt(connection, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof(timeout));
+
+    // Read until the end of the headers (body of GET requests is ignored)
+    std::string request;
+    char buffer[1024];
+    while (request.find("\r\n\r\n") == std::string::npos && request.size() < MAX_REQUEST_SIZE_)
+    {
+        ssize_t received = recv(connection, buffer, sizeof(buffer), 0);
+        if (received <= 0)
+        {
+            return;
+        }
+        request.append(buffer, static_cast<std::size_t>(received));
+    }
+
+    // Request line: <method> <target> <version>
+    std::string request_line = request.substr(0, request.find("\r\n"));
+    std::size_t method_end = request_line.find(' ');
+    std::size_t target_end = request_line.find(' ', method_end + 1);
+    std::string method = request_line.substr(0, method_end);
+    std::string target = method_end == std::string::npos ?
+            "" : request_line.substr(method_end + 1, target_end - method_end - 1);
+
+    // Query parameters are ignored
+    target = target.substr(0, target.find('?'));
+
+    std::shared_ptr<const std::string> body;
+    std::string status;
+    std::string content_type = "text/plain; charset=utf-8";
+
+    if (method != "GET" && method != "HEAD")
+    {
+        status = "405 Method Not Allowed";
+        body = std::make_shared<const std::string>("Only GET and HEAD are supported.\n");
+    }
+    else if (target != "/metrics")
+    {
+        status = "404 Not Found";
+        body = std::make_shared<const std::string>("Metrics are served in /metrics .\n");
+    }
+    else
+    {
+        status = "200 OK";
+        content_type = "application/openmetrics-text; version=1.0.0; charset=utf-8";
+        std::lock_guard<std::mutex> lock(exposition_mutex_);
+        body = exposition_;
+    }
+
+    std::string header =
+            "HTTP/1.1 " + status + "\r\n"
+            "Content-Type: " + content_type + "\r\n"
+            "Content-Length: " + std::to_string(body->size()) + "\r\n"
+            "Connection: close\r\n"
+            "\r\n";
+
+    if (send_all_(connection, header.data(), header.size()) && method != "HEAD")
+    {
+        send_all_(connection, body->data(), body->size());
+    }
+}
+
+bool MetricsExporter::send_all_(
+        int connection,
+        const char* data,
+        std::size_t size) noexcept
+{
+    while (size > 0)
+    {
+#if defined(MSG_NOSIGNAL)
+        ssize_t sent = send(connection, data, size, MSG_NOSIGNAL);
+#else
+        ssize_t sent = send(connection, data, size, 0);
+#endif // if defined(MSG_NOSIGNAL)
+
+        if (sent <= 0)
+        {
+            return false;
+        }
+
+        data += sent;
+        size -= static_cast<std::size_t>(sent);
+    }
+
+    return true;
+}
+
+#endif // if defined(_WIN32)
+
+void MetricsExporter::refresh_() noexcept
+{
+    std::shared_ptr<const std::string> exposition =
+            std::make_shared<const std::string>(renderer_.render(statistics_source_()));
+
+    std::lock_guard<std::mutex> lock(exposition_mutex_);
+    exposition_.swap(exposition);
+
+    // The previous exposition is released here, or by the last request still sending it
+}
+
+void MetricsExporter::refresh_routine_() noexcept
+{
+    std::chrono::steady_clock::time_point next_refresh = std::chrono::steady_clock::now();
+
+    while (true)
+    {
+        next_refresh += std::chrono::milliseconds(refresh_period_);
+        {
+            std::unique_lock<std::mutex> lock(refresh_mutex_);
+            if (refresh_cv_.wait_until(
+                        lock,
+                        next_refresh,
+                        [this]()
+                        {
+                            return stop_.load();
+                        }))
+            {
+                return;
+            }
+        }
+
+        refresh_();
+    }
+}
+
+} /* namespace metrics */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
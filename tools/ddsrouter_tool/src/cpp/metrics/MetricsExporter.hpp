@@ -0,0 +1,147 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MetricsExporter.hpp
+ *
+ */
+
+#ifndef EPROSIMA_DDSROUTER_METRICS_METRICSEXPORTER_HPP
+#define EPROSIMA_DDSROUTER_METRICS_METRICSEXPORTER_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/time/time_utils.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+#include "OpenMetricsRenderer.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace metrics {
+
+/**
+ * Serves the statistics of a DDS Router in OpenMetrics text format in \c http://<address>:<port>/metrics .
+ *
+ * The exposition is rendered periodically by an internal thread and requests are answered with the last one
+ * rendered, so scrapes never collect statistics nor format them, whatever the number of topics of the router.
+ * Only a minimal subset of HTTP/1.1 is supported: \c GET and \c HEAD requests, answered and closed one at a time.
+ *
+ * Only available in POSIX systems.
+ */
+class MetricsExporter
+{
+public:
+
+    /**
+     * @brief Start listening in \c address : \c port and rendering the statistics of \c statistics_source .
+     *
+     * @param statistics_source called from the rendering thread every \c refresh_period
+     * @param address IPv4 address where to listen
+     * @param port TCP port where to listen
+     * @param refresh_period time in milliseconds between renderings
+     *
+     * @throw \c InitializationException if the endpoint could not be opened
+     */
+    MetricsExporter(
+            std::function<core::types::RouterStatistics()> statistics_source,
+            const std::string& address,
+            uint16_t port,
+            utils::Duration_ms refresh_period = DEFAULT_REFRESH_PERIOD);
+
+    //! Stop both threads and close the endpoint
+    ~MetricsExporter();
+
+    //! Default time between renderings
+    static const utils::Duration_ms DEFAULT_REFRESH_PERIOD;
+
+protected:
+
+    //! Open, bind and listen in the socket of the endpoint
+    void open_socket_(
+            const std::string& address,
+            uint16_t port);
+
+    //! Render the statistics and replace the exposition served
+    void refresh_() noexcept;
+
+    //! Routine of the rendering thread
+    void refresh_routine_() noexcept;
+
+    //! Routine of the server thread
+    void server_routine_() noexcept;
+
+    //! Read the request of a connection and answer it
+    void handle_connection_(
+            int connection) noexcept;
+
+    //! Send the whole \c data through \c connection
+    static bool send_all_(
+            int connection,
+            const char* data,
+            std::size_t size) noexcept;
+
+    //! Source of the statistics rendered
+    std::function<core::types::RouterStatistics()> statistics_source_;
+
+    //! Time between renderings
+    utils::Duration_ms refresh_period_;
+
+    //! Only used from the rendering thread (and from the constructor before it starts)
+    OpenMetricsRenderer renderer_;
+
+    //! Last exposition rendered, replaced as a whole so requests being answered keep their own copy
+    std::shared_ptr<const std::string> exposition_;
+
+    //! Guards \c exposition_
+    std::mutex exposition_mutex_;
+
+    //! Listening socket
+    int socket_;
+
+    //! Whether the threads must finish
+    std::atomic<bool> stop_;
+
+    //! Guards the wait of the rendering thread
+    std::mutex refresh_mutex_;
+
+    //! Wakes up the rendering thread when stopping
+    std::condition_variable refresh_cv_;
+
+    std::thread refresh_thread_;
+
+    std::thread server_thread_;
+
+    //! Maximum time in milliseconds the server thread waits for connections before checking \c stop_
+    static const int POLL_TIMEOUT_;
+
+    //! Maximum time in milliseconds to receive a request or send a response
+    static const int CONNECTION_TIMEOUT_;
+
+    //! Maximum size of the request accepted
+    static const std::size_t MAX_REQUEST_SIZE_;
+};
+
+} /* namespace metrics */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_METRICS_METRICSEXPORTER_HPP */
@@ -0,0 +1,325 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file OpenMetricsRenderer.cpp
+ *
+ */
+
+#include <chrono>
+#include <cstdio>
+
+#include "OpenMetricsRenderer.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace metrics {
+
+using namespace eprosima::ddsrouter::core::types;
+
+const std::array<OpenMetricsRenderer::Family, OpenMetricsRenderer::TOPIC_COUNTERS_>
+OpenMetricsRenderer::TOPIC_COUNTER_FAMILIES_ = {{
+    {"ddsrouter_topic_received_samples", "counter", "Samples taken from the Readers of the topic."},
+    {"ddsrouter_topic_received_bytes", "counter", "Bytes of payload taken from the Readers of the topic."},
+    {"ddsrouter_topic_take_errors", "counter", "Failed attempts to take a sample from the Readers of the topic."},
+    {"ddsrouter_topic_sent_samples", "counter", "Samples written in the Writers of the topic."},
+    {"ddsrouter_topic_sent_bytes", "counter", "Bytes of payload written in the Writers of the topic."},
+    {"ddsrouter_topic_write_errors", "counter", "Failed attempts to write a sample in the Writers of the topic."},
+    {"ddsrouter_topic_dropped_samples", "counter", "Samples taken that could not be written in any Writer."},
+    {"ddsrouter_topic_profiled_transmissions", "counter", "Transmission tasks of the topic profiled."},
+    {"ddsrouter_topic_cpu_cycles", "counter", "CPU cycles in user space of the transmission tasks profiled."},
+    {"ddsrouter_topic_instructions", "counter", "Instructions in user space of the transmission tasks profiled."},
+    {"ddsrouter_topic_cache_misses", "counter",
+     "Last level cache misses in user space of the transmission tasks profiled."},
+    {"ddsrouter_topic_context_switches", "counter", "Context switches during the transmission tasks profiled."},
+}};
+
+const OpenMetricsRenderer::Family OpenMetricsRenderer::TOPIC_LATENCY_FAMILY_ =
+{"ddsrouter_topic_latency_seconds", "summary",
+ "Time from the source timestamp of each sample until it has been written in every Writer."};
+
+const std::array<OpenMetricsRenderer::Family, OpenMetricsRenderer::PARTICIPANT_COUNTERS_>
+OpenMetricsRenderer::PARTICIPANT_COUNTER_FAMILIES_ = {{
+    {"ddsrouter_participant_received_samples", "counter", "Samples taken from the Readers of the participant."},
+    {"ddsrouter_participant_received_bytes", "counter", "Bytes of payload taken from the Readers of the participant."},
+    {"ddsrouter_participant_sent_samples", "counter", "Samples written in the Writers of the participant."},
+    {"ddsrouter_participant_sent_bytes", "counter", "Bytes of payload written in the Writers of the participant."},
+    {"ddsrouter_participant_write_errors", "counter",
+     "Failed attempts to write a sample in the Writers of the participant."},
+}};
+
+std::string OpenMetricsRenderer::render(
+        const RouterStatistics& statistics)
+{
+    // Topics, formatting again only those whose counters have changed
+    std::map<DdsTopic, TopicEntry> current_topics;
+    std::map<ParticipantId, ParticipantCounters> current_participants;
+
+    for (const auto& topic_it : statistics.topics)
+    {
+        TrackStatistics total = topic_it.second.total();
+        TopicCounters counters = {{
+            total.samples_in, total.bytes_in, total.take_errors,
+            total.samples_out, total.bytes_out, total.write_errors, total.dropped,
+            total.profiled_transmissions, total.cycles, total.instructions, total.cache_misses,
+            total.context_switches}};
+
+        auto previous_it = topics_.find(topic_it.first);
+        if (previous_it != topics_.end() && previous_it->second.counters == counters)
+        {
+            // Latencies only change when samples are written, so the lines are still valid
+            current_topics.emplace_hint(current_topics.end(), topic_it.first, std::move(previous_it->second));
+        }
+        else
+        {
+            TopicEntry& entry = current_topics.emplace_hint(
+                current_topics.end(), topic_it.first, TopicEntry())->second;
+            entry.counters = counters;
+            render_topic_(topic_it.first, total, entry);
+        }
+
+        // Accumulate participant counters
+        for (const auto& track_it : topic_it.second.tracks)
+        {
+            ParticipantCounters& participant_counters = current_participants[track_it.first];
+            participant_counters[0] += track_it.second.samples_in;
+            participant_counters[1] += track_it.second.bytes_in;
+        }
+        for (const auto& writer_it : topic_it.second.writers)
+        {
+            ParticipantCounters& participant_counters = current_participants[writer_it.first];
+            participant_counters[2] += writer_it.second.samples;
+            participant_counters[3] += writer_it.second.bytes;
+            participant_counters[4] += writer_it.second.write_errors;
+        }
+    }
+
+    // Participants
+    std::map<ParticipantId, ParticipantEntry> current_participant_entries;
+    for (const auto& participant_it : current_participants)
+    {
+        auto previous_it = participants_.find(participant_it.first);
+        if (previous_it != participants_.end() && previous_it->second.counters == participant_it.second)
+        {
+            current_participant_entries.emplace_hint(
+                current_participant_entries.end(), participant_it.first, std::move(previous_it->second));
+        }
+        else
+        {
+            ParticipantEntry& entry = current_participant_entries.emplace_hint(
+                current_participant_entries.end(), participant_it.first, ParticipantEntry())->second;
+            entry.counters = participant_it.second;
+            render_participant_(participant_it.first, entry);
+        }
+    }
+
+    topics_ = std::move(current_topics);
+    participants_ = std::move(current_participant_entries);
+
+    // Concatenate every family
+    std::string output;
+    output.reserve(previous_size_ + previous_size_ / 8);
+
+    for (std::size_t i = 0; i < TOPIC_COUNTERS_; ++i)
+    {
+        append_family_header_(output, TOPIC_COUNTER_FAMILIES_[i]);
+        for (const auto& topic_it : topics_)
+        {
+            output += topic_it.second.counter_lines[i];
+        }
+    }
+
+    append_family_header_(output, TOPIC_LATENCY_FAMILY_);
+    for (const auto& topic_it : topics_)
+    {
+        output += topic_it.second.latency_lines;
+    }
+
+    for (std::size_t i = 0; i < PARTICIPANT_COUNTERS_; ++i)
+    {
+        append_family_header_(output, PARTICIPANT_COUNTER_FAMILIES_[i]);
+        for (const auto& participant_it : participants_)
+        {
+            output += participant_it.second.counter_lines[i];
+        }
+    }
+
+    // Resources, that are always formatted again as they are just a few lines
+    static const Family PAYLOAD_POOL_FAMILIES[] = {
+        {"ddsrouter_payload_pool_reserved_payloads", "counter", "Payloads reserved since the router started."},
+        {"ddsrouter_payload_pool_released_payloads", "counter", "Payloads released since the router started."},
+        {"ddsrouter_payload_pool_payloads_in_use", "gauge", "Payloads currently reserved and not released."},
+    };
+    static const Family THREAD_POOL_FAMILIES[] = {
+        {"ddsrouter_thread_pool_threads", "gauge", "Threads that transmit the data of the Tracks."},
+        {"ddsrouter_thread_pool_busy_tracks", "gauge", "Tracks transmitting or waiting for a thread to transmit."},
+    };
+
+    const std::string no_labels;
+
+    append_family_header_(output, PAYLOAD_POOL_FAMILIES[0]);
+    append_sample_(output, std::string(PAYLOAD_POOL_FAMILIES[0].name) + "_total", no_labels,
+            statistics.payload_pool.reserved);
+    append_family_header_(output, PAYLOAD_POOL_FAMILIES[1]);
+    append_sample_(output, std::string(PAYLOAD_POOL_FAMILIES[1].name) + "_total", no_labels,
+            statistics.payload_pool.released);
+    append_family_header_(output, PAYLOAD_POOL_FAMILIES[2]);
+    append_sample_(output, PAYLOAD_POOL_FAMILIES[2].name, no_labels, statistics.payload_pool.in_use());
+
+    append_family_header_(output, THREAD_POOL_FAMILIES[0]);
+    append_sample_(output, THREAD_POOL_FAMILIES[0].name, no_labels, statistics.thread_pool.threads);
+    append_family_header_(output, THREAD_POOL_FAMILIES[1]);
+    append_sample_(output, THREAD_POOL_FAMILIES[1].name, no_labels, statistics.thread_pool.busy_tracks);
+
+    output += "# EOF\n";
+
+    previous_size_ = output.size();
+    return output;
+}
+
+std::string OpenMetricsRenderer::escape_label_value(
+        const std::string& value)
+{
+    std::string result;
+    result.reserve(value.size());
+
+    for (char c : value)
+    {
+        switch (c)
+        {
+            case '\\':
+                result += "\\\\";
+                break;
+
+            case '"':
+                result += "\\\"";
+                break;
+
+            case '\n':
+                result += "\\n";
+                break;
+
+            default:
+                result += c;
+                break;
+        }
+    }
+
+    return result;
+}
+
+void OpenMetricsRenderer::render_topic_(
+        const DdsTopic& topic,
+        const TrackStatistics& total,
+        TopicEntry& entry)
+{
+    const std::string labels =
+            "topic=\"" + escape_label_value(topic.topic_name) + "\",type=\"" +
+            escape_label_value(topic.type_name) + "\"";
+    const std::string braced_labels = "{" + labels + "}";
+
+    for (std::size_t i = 0; i < TOPIC_COUNTERS_; ++i)
+    {
+        entry.counter_lines[i].clear();
+
+        // Topics not profiled do not have profiling lines, so they cost nothing when profiling is disabled
+        if (i >= TOPIC_PROFILING_COUNTERS_BEGIN_ && total.profiled_transmissions == 0)
+        {
+            continue;
+        }
+
+        append_sample_(
+            entry.counter_lines[i],
+            std::string(TOPIC_COUNTER_FAMILIES_[i].name) + "_total",
+            braced_labels,
+            entry.counters[i]);
+    }
+
+    const std::string name = TOPIC_LATENCY_FAMILY_.name;
+    const LatencyHistogram& latency = total.latency;
+
+    entry.latency_lines.clear();
+    append_sample_(entry.latency_lines, name, "{" + labels + ",quantile=\"0.5\"}",
+            std::chrono::duration<double>(latency.percentile(0.5)).count());
+    append_sample_(entry.latency_lines, name, "{" + labels + ",quantile=\"0.99\"}",
+            std::chrono::duration<double>(latency.percentile(0.99)).count());
+    append_sample_(entry.latency_lines, name + "_sum", braced_labels,
+            std::chrono::duration<double>(latency.total).count());
+    append_sample_(entry.latency_lines, name + "_count", braced_labels, latency.count);
+}
+
+void OpenMetricsRenderer::render_participant_(
+        const ParticipantId& participant,
+        ParticipantEntry& entry)
+{
+    const std::string labels = "{participant=\"" + escape_label_value(participant.id_name()) + "\"}";
+
+    for (std::size_t i = 0; i < PARTICIPANT_COUNTERS_; ++i)
+    {
+        entry.counter_lines[i].clear();
+        append_sample_(
+            entry.counter_lines[i],
+            std::string(PARTICIPANT_COUNTER_FAMILIES_[i].name) + "_total",
+            labels,
+            entry.counters[i]);
+    }
+}
+
+void OpenMetricsRenderer::append_family_header_(
+        std::string& output,
+        const Family& family)
+{
+    output += "# TYPE ";
+    output += family.name;
+    output += ' ';
+    output += family.type;
+    output += "\n# HELP ";
+    output += family.name;
+    output += ' ';
+    output += family.help;
+    output += '\n';
+}
+
+void OpenMetricsRenderer::append_sample_(
+        std::string& output,
+        const std::string& name,
+        const std::string& labels,
+        uint64_t value)
+{
+    output += name;
+    output += labels;
+    output += ' ';
+    output += std::to_string(value);
+    output += '\n';
+}
+
+void OpenMetricsRenderer::append_sample_(
+        std::string& output,
+        const std::string& name,
+        const std::string& labels,
+        double value)
+{
+    char buffer[32];
+    std::snprintf(buffer, sizeof(buffer), "%.9g", value);
+
+    output += name;
+    output += labels;
+    output += ' ';
+    output += buffer;
+    output += '\n';
+}
+
+} /* namespace metrics */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,154 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file OpenMetricsRenderer.hpp
+ *
+ */
+
+#ifndef EPROSIMA_DDSROUTER_METRICS_OPENMETRICSRENDERER_HPP
+#define EPROSIMA_DDSROUTER_METRICS_OPENMETRICSRENDERER_HPP
+
+#include <array>
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace metrics {
+
+/**
+ * Renders the statistics of a DDS Router in OpenMetrics text format (also understood by Prometheus).
+ *
+ * Rendering is incremental: the lines of each topic and participant are kept from one call to the next, and only
+ * those whose counters have changed are formatted again. Routers with many idle topics are rendered by
+ * concatenating already formatted text.
+ *
+ * Not thread safe.
+ */
+class OpenMetricsRenderer
+{
+public:
+
+    /**
+     * @brief Render \c statistics as an OpenMetrics exposition, finished with \c # \c EOF .
+     *
+     * Topics and participants not present in \c statistics are forgotten.
+     */
+    std::string render(
+            const core::types::RouterStatistics& statistics);
+
+    //! Escape a label value: backslash, double quote and line feed
+    static std::string escape_label_value(
+            const std::string& value);
+
+protected:
+
+    //! Number of counter families of each topic
+    static constexpr std::size_t TOPIC_COUNTERS_ = 12;
+
+    //! First of the families of \c TOPIC_COUNTER_FAMILIES_ from profiling, only rendered for topics profiled
+    static constexpr std::size_t TOPIC_PROFILING_COUNTERS_BEGIN_ = 7;
+
+    //! Number of counter families of each participant
+    static constexpr std::size_t PARTICIPANT_COUNTERS_ = 5;
+
+    //! Name, type and help of a family of metrics with one value per topic or participant
+    struct Family
+    {
+        const char* name;
+        const char* type;
+        const char* help;
+    };
+
+    //! Counters of a topic, in the order of \c TOPIC_COUNTER_FAMILIES_
+    using TopicCounters = std::array<uint64_t, TOPIC_COUNTERS_>;
+
+    //! Counters of a participant, in the order of \c PARTICIPANT_COUNTER_FAMILIES_
+    using ParticipantCounters = std::array<uint64_t, PARTICIPANT_COUNTERS_>;
+
+    //! Lines already formatted for a topic
+    struct TopicEntry
+    {
+        TopicCounters counters;
+        std::array<std::string, TOPIC_COUNTERS_> counter_lines;
+        std::string latency_lines;
+    };
+
+    //! Lines already formatted for a participant
+    struct ParticipantEntry
+    {
+        ParticipantCounters counters;
+        std::array<std::string, PARTICIPANT_COUNTERS_> counter_lines;
+    };
+
+    //! Format every line of a topic
+    static void render_topic_(
+            const core::types::DdsTopic& topic,
+            const core::types::TrackStatistics& total,
+            TopicEntry& entry);
+
+    //! Format every line of a participant
+    static void render_participant_(
+            const core::types::ParticipantId& participant,
+            ParticipantEntry& entry);
+
+    //! Append the \c # \c TYPE and \c # \c HELP lines of \c family
+    static void append_family_header_(
+            std::string& output,
+            const Family& family);
+
+    //! Append a line with a single unsigned value
+    static void append_sample_(
+            std::string& output,
+            const std::string& name,
+            const std::string& labels,
+            uint64_t value);
+
+    //! Append a line with a value in seconds
+    static void append_sample_(
+            std::string& output,
+            const std::string& name,
+            const std::string& labels,
+            double value);
+
+    //! Counter families of each topic
+    static const std::array<Family, TOPIC_COUNTERS_> TOPIC_COUNTER_FAMILIES_;
+
+    //! Latency summary family of each topic
+    static const Family TOPIC_LATENCY_FAMILY_;
+
+    //! Counter families of each participant
+    static const std::array<Family, PARTICIPANT_COUNTERS_> PARTICIPANT_COUNTER_FAMILIES_;
+
+    //! Lines of every topic rendered in the previous call
+    std::map<core::types::DdsTopic, TopicEntry> topics_;
+
+    //! Lines of every participant rendered in the previous call
+    std::map<core::types::ParticipantId, ParticipantEntry> participants_;
+
+    //! Size of the previous exposition, to reserve the next one at once
+    std::size_t previous_size_ = 0;
+};
+
+} /* namespace metrics */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_METRICS_OPENMETRICSRENDERER_HPP */
@@ -0,0 +1,66 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MemoryReport.cpp
+ *
+ */
+
+#include <sstream>
+
+#include "MemoryReport.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace ui {
+
+using namespace eprosima::ddsrouter::core::types;
+
+std::string memory_report(
+        const RouterStatistics& statistics,
+        std::size_t topics)
+{
+    MemoryStatistics total;
+    for (const auto& topic_it : statistics.topics)
+    {
+        total.merge(topic_it.second.memory);
+    }
+
+    std::vector<std::pair<DdsTopic, MemoryStatistics>> top = statistics.top_memory_topics(topics);
+
+    std::stringstream report;
+    report << "Memory held by " << statistics.topics.size() << " topics: " << total.bytes() << " bytes ("
+           << statistics.payload_pool.in_use() << " payloads in use in the payload pool). "
+           << "Top " << top.size() << " topics:";
+
+    for (std::size_t i = 0; i < top.size(); ++i)
+    {
+        const MemoryStatistics& memory = top[i].second;
+        report << "\n  " << (i + 1) << ". " << top[i].first.topic_name << " [" << top[i].first.type_name << "]: "
+               << memory.bytes() << " bytes"
+               << " (payloads: " << memory.payloads << ", " << memory.payload_bytes << " bytes"
+               << "; reader histories: " << memory.reader_history_changes << " changes, "
+               << memory.reader_history_bytes << " bytes referenced"
+               << "; writer histories: " << memory.writer_history_changes << " changes, "
+               << memory.writer_history_bytes << " bytes referenced"
+               << "; cache changes: " << memory.cache_change_bytes << " bytes"
+               << ", " << memory.cache_change_pool_elements << " in pools)";
+    }
+
+    return report.str();
+}
+
+} /* namespace ui */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
@@ -0,0 +1,48 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file MemoryReport.hpp
+ *
+ */
+
+#ifndef EPROSIMA_DDSROUTER_USERINTERFACE_MEMORYREPORT_HPP
+#define EPROSIMA_DDSROUTER_USERINTERFACE_MEMORYREPORT_HPP
+
+#include <cstddef>
+#include <string>
+
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace ui {
+
+//! Number of topics in the memory report requested with SIGUSR1
+constexpr std::size_t MEMORY_REPORT_TOPICS = 10;
+
+/**
+ * @brief Format the \c topics topics of \c statistics that hold more memory, one per line and in decreasing order.
+ *
+ * The first line is a summary with the memory held by every topic.
+ */
+std::string memory_report(
+        const core::types::RouterStatistics& statistics,
+        std::size_t topics);
+
+} /* namespace ui */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_USERINTERFACE_MEMORYREPORT_HPP */
@@ -0,0 +1,87 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UserSignalHandler.cpp
+ *
+ */
+
+#include <chrono>
+#include <csignal>
+
+#include <cpp_utils/Log.hpp>
+
+#include "UserSignalHandler.hpp"
+
+namespace eprosima {
+namespace ddsrouter {
+namespace ui {
+
+std::atomic<unsigned int> UserSignalHandler::signals_received_(0);
+const unsigned int UserSignalHandler::CHECK_PERIOD_ = 100;
+
+UserSignalHandler::UserSignalHandler(
+        std::function<void()> callback)
+    : callback_(callback)
+    , stop_(false)
+{
+#if defined(_WIN32)
+    logWarning(DDSROUTER_EXECUTION, "Signal SIGUSR1 does not exist in this platform.");
+#else
+    std::signal(SIGUSR1, &UserSignalHandler::signal_handler_);
+    thread_ = std::thread(&UserSignalHandler::routine_, this);
+#endif // if defined(_WIN32)
+}
+
+UserSignalHandler::~UserSignalHandler()
+{
+#if !defined(_WIN32)
+    std::signal(SIGUSR1, SIG_DFL);
+#endif // if !defined(_WIN32)
+
+    stop_.store(true);
+    if (thread_.joinable())
+    {
+        thread_.join();
+    }
+}
+
+void UserSignalHandler::signal_handler_(
+        int)
+{
+    // Only lock free operations are allowed in a signal handler
+    signals_received_.fetch_add(1);
+}
+
+void UserSignalHandler::routine_() noexcept
+{
+    unsigned int signals_handled = signals_received_.load();
+
+    while (!stop_.load())
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(CHECK_PERIOD_));
+
+        // Signals received together are handled once
+        unsigned int signals_received = signals_received_.load();
+        if (signals_received != signals_handled)
+        {
+            signals_handled = signals_received;
+            callback_();
+        }
+    }
+}
+
+} /* namespace ui */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
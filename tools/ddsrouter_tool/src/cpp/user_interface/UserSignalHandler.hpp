@@ -0,0 +1,73 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file UserSignalHandler.hpp
+ *
+ */
+
+#ifndef EPROSIMA_DDSROUTER_USERINTERFACE_USERSIGNALHANDLER_HPP
+#define EPROSIMA_DDSROUTER_USERINTERFACE_USERSIGNALHANDLER_HPP
+
+#include <atomic>
+#include <functional>
+#include <thread>
+
+namespace eprosima {
+namespace ddsrouter {
+namespace ui {
+
+/**
+ * Calls a callback every time the process receives signal SIGUSR1 (e.g. \c kill \c -USR1 \c <pid> ).
+ *
+ * The callback is called from an internal thread and not from the signal handler, so it can do anything.
+ * Only one instance must exist at a time. Signal SIGUSR1 does not exist in Windows, where it does nothing.
+ */
+class UserSignalHandler
+{
+public:
+
+    UserSignalHandler(
+            std::function<void()> callback);
+
+    //! Restore the default handling of SIGUSR1 and stop the internal thread
+    ~UserSignalHandler();
+
+protected:
+
+    //! Handler of the signal, that only counts it
+    static void signal_handler_(
+            int signal);
+
+    //! Routine of the internal thread
+    void routine_() noexcept;
+
+    //! Number of signals received, only modified from the signal handler
+    static std::atomic<unsigned int> signals_received_;
+
+    std::function<void()> callback_;
+
+    std::atomic<bool> stop_;
+
+    std::thread thread_;
+
+    //! Time in milliseconds between checks of the signals received
+    static const unsigned int CHECK_PERIOD_;
+};
+
+} /* namespace ui */
+} /* namespace ddsrouter */
+} /* namespace eprosima */
+
+#endif /* EPROSIMA_DDSROUTER_USERINTERFACE_USERSIGNALHANDLER_HPP */
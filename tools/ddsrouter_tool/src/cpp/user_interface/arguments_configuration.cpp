@@ -154,6 +154,47 @@ const option::Descriptor usage[] = {
         "[Default = \"warning\"]. "
     },
 
+    ////////////////////
+    // Metrics options
+    {
+        optionIndex::UNKNOWN_OPT, 0, "", "", Arg::None,
+        "\nMetrics parameters"
+    },
+
+    {
+        optionIndex::METRICS_PORT,
+        0,
+        "",
+        "metrics-port",
+        Arg::Numeric,
+        "  \t--metrics-port\t  \t" \
+        "Serve the router statistics in OpenMetrics (Prometheus) text format in http://<address>:<port>/metrics . " \
+        "Value 0 does not serve them. [Default: 0]."
+    },
+
+    {
+        optionIndex::METRICS_ADDRESS,
+        0,
+        "",
+        "metrics-address",
+        Arg::String,
+        "  \t--metrics-address\t  \t" \
+        "IPv4 address where the metrics endpoint listens. " \
+        "Use 0.0.0.0 to make it accessible from other hosts. [Default: 127.0.0.1]."
+    },
+
+    {
+        optionIndex::TRACE_FILE,
+        0,
+        "",
+        "trace-file",
+        Arg::String,
+        "  \t--trace-file\t  \t" \
+        "File where the stages of the latest samples forwarded are dumped in Chrome trace format, " \
+        "when receiving signal SIGUSR1 and when closing. " \
+        "Requires DDS Router compiled with CMake option DDSROUTER_TRACE."
+    },
+
     {
         optionIndex::UNKNOWN_OPT, 0, "", "", Arg::None,
         "\n"
@@ -175,7 +216,10 @@ ProcessReturnCode parse_arguments(
         utils::Duration_ms& reload_time,
         utils::Duration_ms& timeout,
         std::string& log_filter,
-        eprosima::fastdds::dds::Log::Kind& log_verbosity)
+        eprosima::fastdds::dds::Log::Kind& log_verbosity,
+        uint16_t& metrics_port,
+        std::string& metrics_address,
+        std::string& trace_file)
 {
     // Variable to pretty print usage help
     int columns;
@@ -265,6 +309,26 @@ ProcessReturnCode parse_arguments(
                     log_verbosity = eprosima::fastdds::dds::Log::Kind(static_cast<int>(from_string_LogKind(opt.arg)));
                     break;
 
+                case optionIndex::METRICS_PORT:
+                {
+                    long port = std::stol(opt.arg);
+                    if (port < 0 || port > 65535)
+                    {
+                        logError(DDSROUTER_ARGS, "Option '" << opt << "' requires a port between 0 and 65535.");
+                        return ProcessReturnCode::incorrect_argument;
+                    }
+                    metrics_port = static_cast<uint16_t>(port);
+                    break;
+                }
+
+                case optionIndex::METRICS_ADDRESS:
+                    metrics_address = opt.arg;
+                    break;
+
+                case optionIndex::TRACE_FILE:
+                    trace_file = opt.arg;
+                    break;
+
                 case optionIndex::UNKNOWN_OPT:
                     logError(DDSROUTER_ARGS, opt << " is not a valid argument.");
                     option::printUsage(fwrite, stdout, usage, columns);
@@ -20,6 +20,7 @@
 #ifndef EPROSIMA_DDSROUTER_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP
 #define EPROSIMA_DDSROUTER_USERINTERFACE_ARGUMENTSCONFIGURATION_HPP
 
+#include <cstdint>
 #include <string>
 
 #include <optionparser.h>
@@ -99,6 +100,9 @@ enum optionIndex
     TIMEOUT,
     LOG_FILTER,
     LOG_VERBOSITY,
+    METRICS_PORT,
+    METRICS_ADDRESS,
+    TRACE_FILE,
 };
 
 /**
@@ -119,6 +123,11 @@ extern const option::Descriptor usage[];
  * @param [out] reload_time time in milliseconds to reload the configuration file
  * @param [out] activate_debug activate log info
  * @param [out] timeout time in milliseconds to maximum router execution time
+ * @param [out] log_filter regex to filter log entries by category
+ * @param [out] log_verbosity minimum kind of log entries shown
+ * @param [out] metrics_port port of the metrics HTTP endpoint (0 to disable it)
+ * @param [out] metrics_address IPv4 address where the metrics HTTP endpoint listens
+ * @param [out] trace_file file where the traced stages of samples are dumped (empty to not dump them)
  *
  * @return \c SUCCESS if everything OK
  * @return \c INCORRECT_ARGUMENT if arguments were incorrect (unknown or incorrect value)
@@ -132,7 +141,10 @@ ProcessReturnCode parse_arguments(
         utils::Duration_ms& reload_time,
         utils::Duration_ms& timeout,
         std::string& log_filter,
-        eprosima::fastdds::dds::Log::Kind& log_verbosity);
+        eprosima::fastdds::dds::Log::Kind& log_verbosity,
+        uint16_t& metrics_port,
+        std::string& metrics_address,
+        std::string& trace_file);
 
 //! \c Option to stream serializator
 std::ostream& operator <<(
@@ -27,6 +27,8 @@ Arguments:
     Run test in Debug mode          : -d | --debug
 
     Use SIGINT or SIGTERM           : -s | --signal sigint|sigterm
+
+    Scrape metrics in this port     : -m | --metrics-port <port>
 """
 
 import argparse
@@ -36,11 +38,12 @@ import signal
 import subprocess
 import sys
 import time
+import urllib.request
 from enum import Enum
 
 DESCRIPTION = """Script to execute DDS Router executable test"""
 USAGE = ('python3 tests.py -e <path/to/ddsrouter-executable>'
-         ' -c config_file_path --signal sigint [-d]')
+         ' -c config_file_path --signal sigint [-d] [-m metrics_port]')
 
 # Sleep time to let process init and finish
 SLEEP_TIME = 1
@@ -141,10 +144,59 @@ def parse_options():
         required=True,
         help='<sigint>|<sigterm>: Use SIGINT or SIGTERM to kill process.'
     )
+    parser.add_argument(
+        '-m',
+        '--metrics-port',
+        type=int,
+        default=None,
+        help='Serve metrics in this port and check them before the signal.'
+    )
     return parser.parse_args()
 
 
-def test_ddsrouter_closure(ddsrouter, configuration_file, killing_signal):
+def check_metrics(metrics_port):
+    """
+    Scrape the metrics endpoint of a running ddsrouter.
+
+    Parameters:
+    metrics_port (int): Port where the ddsrouter serves the metrics
+
+    Returns:
+    True if the exposition is served with the OpenMetrics content type and
+    is complete, False otherwise
+    """
+    url = f'http://127.0.0.1:{metrics_port}/metrics'
+    logger.info('Scraping metrics in ' + url)
+
+    try:
+        with urllib.request.urlopen(url, timeout=SLEEP_TIME) as response:
+            status = response.status
+            content_type = response.headers.get('Content-Type', '')
+            body = response.read().decode('utf-8')
+    except OSError as error:
+        logger.error('Metrics could not be scraped: ' + str(error))
+        return False
+
+    logger.debug('Metrics exposition: \n' + body)
+
+    if status != 200:
+        logger.error('Metrics answered with status ' + str(status))
+        return False
+
+    if not content_type.startswith('application/openmetrics-text'):
+        logger.error('Metrics served with content type ' + content_type)
+        return False
+
+    if ('# TYPE ddsrouter_thread_pool_threads gauge\n' not in body
+            or not body.endswith('# EOF\n')):
+        logger.error('Metrics exposition is not complete')
+        return False
+
+    return True
+
+
+def test_ddsrouter_closure(
+        ddsrouter, configuration_file, killing_signal, metrics_port=None):
     """
     Test that ddsrouter command closes correctly.
 
@@ -153,16 +205,21 @@ def test_ddsrouter_closure(ddsrouter, configuration_file, killing_signal):
     If the process has finished before the signal, test fails.
     If the process does not end after sending MAX_SIGNALS_SEND_ITERATIONS
     it is hard killed and the test fails.
+    If a metrics port is given, the metrics are scraped before the signal
+    and the test fails if they are not served correctly.
 
     Parameters:
     ddsrouter (path): Path to ddsrouter binary executable
     configuration_file (path): Path to ddsrouter yaml configuration file
     use_sigint (KillingSignalType): Signal to kill subprocesses
+    metrics_port (int): Port where the metrics are served, None to not serve
 
     Returns:
     0 if okay, otherwise the return code of the command executed
     """
     command = [ddsrouter, '-c', configuration_file]
+    if metrics_port is not None:
+        command += ['--metrics-port', str(metrics_port)]
 
     logger.info('Executing command: ' + str(command))
 
@@ -189,6 +246,18 @@ def test_ddsrouter_closure(ddsrouter, configuration_file, killing_signal):
         logger.debug('-----------------------------------------------------')
         return 1
 
+    # Check the metrics while the process is running
+    if metrics_port is not None and not check_metrics(metrics_port):
+        proc.kill()
+        output, err = proc.communicate()
+        logger.debug('-----------------------------------------------------')
+        logger.error('Command ' + str(command) + ' did not serve metrics.')
+        logger.debug('Command output:')
+        logger.debug('Stdout: \n' + str(output))
+        logger.debug('Stderr: \n' + str(err))
+        logger.debug('-----------------------------------------------------')
+        return 1
+
     # direct this script to ignore SIGINT in case of windows
     if is_windows():
         signal.signal(signal.SIGINT, signal_handler)
@@ -280,4 +349,5 @@ if __name__ == '__main__':
         test_ddsrouter_closure(
             args.exe,           # Path to executable
             args.config_file,   # Configuration file
-            args.signal))       # Signal to kill subprocess
+            args.signal,        # Signal to kill subprocess
+            args.metrics_port))  # Port to scrape metrics
@@ -0,0 +1,211 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstring>
+#include <string>
+#include <thread>
+
+#include <cpp_utils/exception/InitializationException.hpp>
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+
+#include <metrics/MetricsExporter.hpp>
+#include <metrics/OpenMetricsRenderer.hpp>
+
+using namespace eprosima;
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::core::types;
+using namespace eprosima::ddsrouter::metrics;
+
+namespace test {
+
+constexpr const char* ADDRESS = "127.0.0.1";
+constexpr uint16_t PORT = 19464;
+
+//! Response to an HTTP request
+struct Response
+{
+    std::string status_line;
+    std::string headers;
+    std::string body;
+};
+
+//! Send \c request to the exporter and read the whole response, until the exporter closes the connection
+Response request(
+        const std::string& request)
+{
+    int connection = socket(AF_INET, SOCK_STREAM, 0);
+
+    sockaddr_in address;
+    std::memset(&address, 0, sizeof(address));
+    address.sin_family = AF_INET;
+    address.sin_port = htons(PORT);
+    inet_pton(AF_INET, ADDRESS, &address.sin_addr);
+
+    std::string response;
+    if (connect(connection, reinterpret_cast<sockaddr*>(&address), sizeof(address)) == 0 &&
+            send(connection, request.data(), request.size(), 0) == static_cast<ssize_t>(request.size()))
+    {
+        char buffer[1024];
+        ssize_t received;
+        while ((received = recv(connection, buffer, sizeof(buffer), 0)) > 0)
+        {
+            response.append(buffer, static_cast<std::size_t>(received));
+        }
+    }
+    close(connection);
+
+    Response result;
+    std::size_t status_end = response.find("\r\n");
+    std::size_t headers_end = response.find("\r\n\r\n");
+    if (status_end == std::string::npos || headers_end == std::string::npos)
+    {
+        return result;
+    }
+    result.status_line = response.substr(0, status_end);
+    result.headers = response.substr(status_end + 2, headers_end - status_end);
+    result.body = response.substr(headers_end + 4);
+    return result;
+}
+
+//! Statistics of a router with one topic with \c samples samples received
+RouterStatistics statistics_with_samples(
+        uint64_t samples)
+{
+    RouterStatistics statistics;
+    statistics.topics[DdsTopic("topic", "type")].tracks[ParticipantId("participant")].samples_in = samples;
+    return statistics;
+}
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Scrape the metrics endpoint
+ *
+ * CASES:
+ *  GET /metrics answers the exposition rendered, with OpenMetrics content type and its length
+ *  Query parameters are ignored
+ *  Exposition is rendered again periodically
+ */
+TEST(MetricsExporterTest, get_metrics)
+{
+    std::atomic<uint64_t> samples(7);
+
+    MetricsExporter exporter(
+        [&samples]()
+        {
+            return statistics_with_samples(samples.load());
+        },
+        ADDRESS, PORT, 50);
+
+    Response response = request("GET /metrics HTTP/1.1\r\nHost: localhost\r\n\r\n");
+    ASSERT_EQ(response.status_line, "HTTP/1.1 200 OK");
+    ASSERT_NE(
+        response.headers.find("Content-Type: application/openmetrics-text; version=1.0.0; charset=utf-8\r\n"),
+        std::string::npos);
+    ASSERT_NE(
+        response.headers.find("Content-Length: " + std::to_string(response.body.size()) + "\r\n"),
+        std::string::npos);
+    ASSERT_EQ(response.body, OpenMetricsRenderer().render(statistics_with_samples(7)));
+
+    response = request("GET /metrics?format=text HTTP/1.1\r\n\r\n");
+    ASSERT_EQ(response.status_line, "HTTP/1.1 200 OK");
+    ASSERT_EQ(response.body, OpenMetricsRenderer().render(statistics_with_samples(7)));
+
+    // Wait until the next renderings collect the new statistics
+    samples.store(9);
+    std::string expected = OpenMetricsRenderer().render(statistics_with_samples(9));
+    for (int i = 0; i < 100 && response.body != expected; ++i)
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        response = request("GET /metrics HTTP/1.1\r\n\r\n");
+    }
+    ASSERT_EQ(response.body, expected);
+}
+
+/**
+ * Requests other than GET /metrics
+ *
+ * CASES:
+ *  HEAD /metrics answers the headers of GET with no body
+ *  Other target is answered with 404
+ *  Other method is answered with 405
+ */
+TEST(MetricsExporterTest, other_requests)
+{
+    MetricsExporter exporter(
+        []()
+        {
+            return statistics_with_samples(1);
+        },
+        ADDRESS, PORT);
+
+    std::string exposition = OpenMetricsRenderer().render(statistics_with_samples(1));
+
+    Response response = request("HEAD /metrics HTTP/1.1\r\n\r\n");
+    ASSERT_EQ(response.status_line, "HTTP/1.1 200 OK");
+    ASSERT_NE(response.headers.find("Content-Length: " + std::to_string(exposition.size()) + "\r\n"),
+            std::string::npos);
+    ASSERT_EQ(response.body, "");
+
+    response = request("GET / HTTP/1.1\r\n\r\n");
+    ASSERT_EQ(response.status_line, "HTTP/1.1 404 Not Found");
+    ASSERT_EQ(response.body, "Metrics are served in /metrics .\n");
+
+    response = request("GET /metrics/other HTTP/1.1\r\n\r\n");
+    ASSERT_EQ(response.status_line, "HTTP/1.1 404 Not Found");
+
+    response = request("POST /metrics HTTP/1.1\r\nContent-Length: 0\r\n\r\n");
+    ASSERT_EQ(response.status_line, "HTTP/1.1 405 Method Not Allowed");
+    ASSERT_EQ(response.body, "Only GET and HEAD are supported.\n");
+}
+
+/**
+ * Endpoint that cannot be opened
+ *
+ * CASES:
+ *  Address that is not IPv4
+ *  Port already in use
+ */
+TEST(MetricsExporterTest, invalid_endpoint)
+{
+    auto source = []()
+            {
+                return RouterStatistics();
+            };
+
+    ASSERT_THROW(MetricsExporter(source, "localhost", PORT), utils::InitializationException);
+
+    MetricsExporter exporter(source, ADDRESS, PORT);
+    ASSERT_THROW(MetricsExporter(source, ADDRESS, PORT), utils::InitializationException);
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}
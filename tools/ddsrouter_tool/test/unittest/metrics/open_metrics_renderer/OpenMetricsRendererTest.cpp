@@ -0,0 +1,315 @@
+// Copyright 2022 Proyectos y Sistemas de Mantenimiento SL (eProsima).
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <chrono>
+#include <string>
+
+#include <cpp_utils/testing/gtest_aux.hpp>
+#include <gtest/gtest.h>
+
+#include <ddsrouter_core/types/participant/ParticipantId.hpp>
+#include <ddsrouter_core/types/statistics/RouterStatistics.hpp>
+#include <ddsrouter_core/types/topic/dds/DdsTopic.hpp>
+
+#include <metrics/OpenMetricsRenderer.hpp>
+
+using namespace eprosima::ddsrouter;
+using namespace eprosima::ddsrouter::core::types;
+using namespace eprosima::ddsrouter::metrics;
+
+namespace test {
+
+//! Add to \c statistics a topic whose samples are received in \c reader and written in \c writer
+void add_topic(
+        RouterStatistics& statistics,
+        const DdsTopic& topic,
+        const std::string& reader,
+        const std::string& writer,
+        uint64_t samples,
+        uint64_t sample_size)
+{
+    TopicStatistics& topic_statistics = statistics.topics[topic];
+
+    TrackStatistics& track = topic_statistics.tracks[ParticipantId(reader)];
+    track.samples_in = samples;
+    track.bytes_in = samples * sample_size;
+    track.samples_out = samples;
+    track.bytes_out = samples * sample_size;
+
+    WriterStatistics& writer_statistics = topic_statistics.writers[ParticipantId(writer)];
+    writer_statistics.samples = samples;
+    writer_statistics.bytes = samples * sample_size;
+}
+
+//! Whether \c text has \c line as a whole line
+bool has_line(
+        const std::string& text,
+        const std::string& line)
+{
+    return text.find("\n" + line + "\n") != std::string::npos;
+}
+
+//! Render \c statistics with a renderer that has not rendered anything before
+std::string render_from_scratch(
+        const RouterStatistics& statistics)
+{
+    OpenMetricsRenderer renderer;
+    return renderer.render(statistics);
+}
+
+} /* namespace test */
+
+using namespace test;
+
+/**
+ * Render the statistics of a router with one topic and check the whole exposition
+ *
+ * CASES:
+ *  Counters end with _total and gauges do not
+ *  Every family has its TYPE and HELP lines, in a fixed order
+ *  Topic not profiled has no profiling lines, but families are kept
+ *  Exposition finishes with # EOF
+ */
+TEST(OpenMetricsRendererTest, render_exposition)
+{
+    RouterStatistics statistics;
+    add_topic(statistics, DdsTopic("topic_a", "type_a"), "participant_1", "participant_2", 3, 10);
+    statistics.payload_pool.reserved = 5;
+    statistics.payload_pool.released = 2;
+    statistics.thread_pool.threads = 2;
+
+    const std::string labels = "{topic=\"topic_a\",type=\"type_a\"}";
+    const std::string expected =
+            "# TYPE ddsrouter_topic_received_samples counter\n"
+            "# HELP ddsrouter_topic_received_samples Samples taken from the Readers of the topic.\n"
+            "ddsrouter_topic_received_samples_total" + labels + " 3\n"
+            "# TYPE ddsrouter_topic_received_bytes counter\n"
+            "# HELP ddsrouter_topic_received_bytes Bytes of payload taken from the Readers of the topic.\n"
+            "ddsrouter_topic_received_bytes_total" + labels + " 30\n"
+            "# TYPE ddsrouter_topic_take_errors counter\n"
+            "# HELP ddsrouter_topic_take_errors Failed attempts to take a sample from the Readers of the topic.\n"
+            "ddsrouter_topic_take_errors_total" + labels + " 0\n"
+            "# TYPE ddsrouter_topic_sent_samples counter\n"
+            "# HELP ddsrouter_topic_sent_samples Samples written in the Writers of the topic.\n"
+            "ddsrouter_topic_sent_samples_total" + labels + " 3\n"
+            "# TYPE ddsrouter_topic_sent_bytes counter\n"
+            "# HELP ddsrouter_topic_sent_bytes Bytes of payload written in the Writers of the topic.\n"
+            "ddsrouter_topic_sent_bytes_total" + labels + " 30\n"
+            "# TYPE ddsrouter_topic_write_errors counter\n"
+            "# HELP ddsrouter_topic_write_errors Failed attempts to write a sample in the Writers of the topic.\n"
+            "ddsrouter_topic_write_errors_total" + labels + " 0\n"
+            "# TYPE ddsrouter_topic_dropped_samples counter\n"
+            "# HELP ddsrouter_topic_dropped_samples Samples taken that could not be written in any Writer.\n"
+            "ddsrouter_topic_dropped_samples_total" + labels + " 0\n"
+            "# TYPE ddsrouter_topic_profiled_transmissions counter\n"
+            "# HELP ddsrouter_topic_profiled_transmissions Transmission tasks of the topic profiled.\n"
+            "# TYPE ddsrouter_topic_cpu_cycles counter\n"
+            "# HELP ddsrouter_topic_cpu_cycles CPU cycles in user space of the transmission tasks profiled.\n"
+            "# TYPE ddsrouter_topic_instructions counter\n"
+            "# HELP ddsrouter_topic_instructions Instructions in user space of the transmission tasks profiled.\n"
+            "# TYPE ddsrouter_topic_cache_misses counter\n"
+            "# HELP ddsrouter_topic_cache_misses "
+            "Last level cache misses in user space of the transmission tasks profiled.\n"
+            "# TYPE ddsrouter_topic_context_switches counter\n"
+            "# HELP ddsrouter_topic_context_switches Context switches during the transmission tasks profiled.\n"
+            "# TYPE ddsrouter_topic_latency_seconds summary\n"
+            "# HELP ddsrouter_topic_latency_seconds "
+            "Time from the source timestamp of each sample until it has been written in every Writer.\n"
+            "ddsrouter_topic_latency_seconds{topic=\"topic_a\",type=\"type_a\",quantile=\"0.5\"} 0\n"
+            "ddsrouter_topic_latency_seconds{topic=\"topic_a\",type=\"type_a\",quantile=\"0.99\"} 0\n"
+            "ddsrouter_topic_latency_seconds_sum" + labels + " 0\n"
+            "ddsrouter_topic_latency_seconds_count" + labels + " 0\n"
+            "# TYPE ddsrouter_participant_received_samples counter\n"
+            "# HELP ddsrouter_participant_received_samples Samples taken from the Readers of the participant.\n"
+            "ddsrouter_participant_received_samples_total{participant=\"participant_1\"} 3\n"
+            "ddsrouter_participant_received_samples_total{participant=\"participant_2\"} 0\n"
+            "# TYPE ddsrouter_participant_received_bytes counter\n"
+            "# HELP ddsrouter_participant_received_bytes Bytes of payload taken from the Readers of the participant.\n"
+            "ddsrouter_participant_received_bytes_total{participant=\"participant_1\"} 30\n"
+            "ddsrouter_participant_received_bytes_total{participant=\"participant_2\"} 0\n"
+            "# TYPE ddsrouter_participant_sent_samples counter\n"
+            "# HELP ddsrouter_participant_sent_samples Samples written in the Writers of the participant.\n"
+            "ddsrouter_participant_sent_samples_total{participant=\"participant_1\"} 0\n"
+            "ddsrouter_participant_sent_samples_total{participant=\"participant_2\"} 3\n"
+            "# TYPE ddsrouter_participant_sent_bytes counter\n"
+            "# HELP ddsrouter_participant_sent_bytes Bytes of payload written in the Writers of the participant.\n"
+            "ddsrouter_participant_sent_bytes_total{participant=\"participant_1\"} 0\n"
+            "ddsrouter_participant_sent_bytes_total{participant=\"participant_2\"} 30\n"
+            "# TYPE ddsrouter_participant_write_errors counter\n"
+            "# HELP ddsrouter_participant_write_errors "
+            "Failed attempts to write a sample in the Writers of the participant.\n"
+            "ddsrouter_participant_write_errors_total{participant=\"participant_1\"} 0\n"
+            "ddsrouter_participant_write_errors_total{participant=\"participant_2\"} 0\n"
+            "# TYPE ddsrouter_payload_pool_reserved_payloads counter\n"
+            "# HELP ddsrouter_payload_pool_reserved_payloads Payloads reserved since the router started.\n"
+            "ddsrouter_payload_pool_reserved_payloads_total 5\n"
+            "# TYPE ddsrouter_payload_pool_released_payloads counter\n"
+            "# HELP ddsrouter_payload_pool_released_payloads Payloads released since the router started.\n"
+            "ddsrouter_payload_pool_released_payloads_total 2\n"
+            "# TYPE ddsrouter_payload_pool_payloads_in_use gauge\n"
+            "# HELP ddsrouter_payload_pool_payloads_in_use Payloads currently reserved and not released.\n"
+            "ddsrouter_payload_pool_payloads_in_use 3\n"
+            "# TYPE ddsrouter_thread_pool_threads gauge\n"
+            "# HELP ddsrouter_thread_pool_threads Threads that transmit the data of the Tracks.\n"
+            "ddsrouter_thread_pool_threads 2\n"
+            "# TYPE ddsrouter_thread_pool_busy_tracks gauge\n"
+            "# HELP ddsrouter_thread_pool_busy_tracks Tracks transmitting or waiting for a thread to transmit.\n"
+            "ddsrouter_thread_pool_busy_tracks 0\n"
+            "# EOF\n";
+
+    OpenMetricsRenderer renderer;
+    ASSERT_EQ(renderer.render(statistics), expected);
+
+    // Rendering the same statistics again reuses every line
+    ASSERT_EQ(renderer.render(statistics), expected);
+}
+
+/**
+ * Render consecutive statistics of a router with the same renderer
+ *
+ * CASES:
+ *  Topic whose counters have not changed keeps its lines
+ *  Topic whose counters have changed has its lines formatted again
+ *  New topic is added
+ *  Topic and participant that disappear are not rendered anymore
+ *  Each exposition is the same as the one of a renderer without previous renderings
+ */
+TEST(OpenMetricsRendererTest, incremental_render)
+{
+    DdsTopic topic_a("topic_a", "type_a");
+    DdsTopic topic_b("topic_b", "type_b");
+    DdsTopic topic_c("topic_c", "type_c");
+
+    OpenMetricsRenderer renderer;
+
+    RouterStatistics first;
+    add_topic(first, topic_a, "participant_1", "participant_2", 3, 10);
+    add_topic(first, topic_b, "participant_1", "participant_3", 5, 10);
+    std::string first_exposition = renderer.render(first);
+    ASSERT_EQ(first_exposition, render_from_scratch(first));
+
+    // Topic b receives samples and topic c appears
+    RouterStatistics second;
+    add_topic(second, topic_a, "participant_1", "participant_2", 3, 10);
+    add_topic(second, topic_b, "participant_1", "participant_3", 8, 10);
+    add_topic(second, topic_c, "participant_2", "participant_1", 1, 100);
+    second.topics[topic_b].tracks[ParticipantId("participant_1")].dropped = 2;
+    second.topics[topic_b].tracks[ParticipantId("participant_1")].latency.add(std::chrono::milliseconds(1));
+    std::string second_exposition = renderer.render(second);
+    ASSERT_EQ(second_exposition, render_from_scratch(second));
+
+    ASSERT_TRUE(has_line(second_exposition,
+            "ddsrouter_topic_received_samples_total{topic=\"topic_a\",type=\"type_a\"} 3"));
+    ASSERT_TRUE(has_line(second_exposition,
+            "ddsrouter_topic_received_samples_total{topic=\"topic_b\",type=\"type_b\"} 8"));
+    ASSERT_TRUE(has_line(second_exposition,
+            "ddsrouter_topic_dropped_samples_total{topic=\"topic_b\",type=\"type_b\"} 2"));
+    ASSERT_TRUE(has_line(second_exposition,
+            "ddsrouter_topic_latency_seconds_count{topic=\"topic_b\",type=\"type_b\"} 1"));
+    ASSERT_TRUE(has_line(second_exposition,
+            "ddsrouter_topic_received_bytes_total{topic=\"topic_c\",type=\"type_c\"} 100"));
+    ASSERT_TRUE(has_line(second_exposition,
+            "ddsrouter_participant_received_samples_total{participant=\"participant_1\"} 11"));
+
+    // Topic b and its only writer participant disappear
+    RouterStatistics third;
+    add_topic(third, topic_a, "participant_1", "participant_2", 4, 10);
+    add_topic(third, topic_c, "participant_2", "participant_1", 1, 100);
+    std::string third_exposition = renderer.render(third);
+    ASSERT_EQ(third_exposition, render_from_scratch(third));
+
+    ASSERT_EQ(third_exposition.find("topic_b"), std::string::npos);
+    ASSERT_EQ(third_exposition.find("participant_3"), std::string::npos);
+    ASSERT_TRUE(has_line(third_exposition,
+            "ddsrouter_topic_received_samples_total{topic=\"topic_a\",type=\"type_a\"} 4"));
+    ASSERT_EQ(third_exposition.substr(third_exposition.size() - 6), "# EOF\n");
+}
+
+/**
+ * Lines of profiling counters are only rendered for topics profiled
+ *
+ * CASES:
+ *  Topic profiled has a line in each profiling family
+ *  Topic not profiled in the same exposition has none
+ *  Topic stops having lines when it is rendered again without profiling
+ */
+TEST(OpenMetricsRendererTest, profiling_families)
+{
+    DdsTopic profiled("profiled", "type");
+    DdsTopic not_profiled("not_profiled", "type");
+
+    RouterStatistics statistics;
+    add_topic(statistics, profiled, "participant_1", "participant_2", 3, 10);
+    add_topic(statistics, not_profiled, "participant_1", "participant_2", 3, 10);
+
+    TrackStatistics& track = statistics.topics[profiled].tracks[ParticipantId("participant_1")];
+    track.profiled_transmissions = 2;
+    track.cycles = 1000;
+    track.instructions = 2000;
+    track.cache_misses = 30;
+    track.context_switches = 1;
+
+    OpenMetricsRenderer renderer;
+    std::string exposition = renderer.render(statistics);
+
+    const std::string labels = "{topic=\"profiled\",type=\"type\"}";
+    ASSERT_TRUE(has_line(exposition, "ddsrouter_topic_profiled_transmissions_total" + labels + " 2"));
+    ASSERT_TRUE(has_line(exposition, "ddsrouter_topic_cpu_cycles_total" + labels + " 1000"));
+    ASSERT_TRUE(has_line(exposition, "ddsrouter_topic_instructions_total" + labels + " 2000"));
+    ASSERT_TRUE(has_line(exposition, "ddsrouter_topic_cache_misses_total" + labels + " 30"));
+    ASSERT_TRUE(has_line(exposition, "ddsrouter_topic_context_switches_total" + labels + " 1"));
+
+    ASSERT_EQ(exposition.find("ddsrouter_topic_cpu_cycles_total{topic=\"not_profiled\""), std::string::npos);
+    ASSERT_TRUE(has_line(exposition,
+            "ddsrouter_topic_received_samples_total{topic=\"not_profiled\",type=\"type\"} 3"));
+
+    track = TrackStatistics();
+    track.samples_in = 3;
+    exposition = renderer.render(statistics);
+    ASSERT_EQ(exposition.find("ddsrouter_topic_cpu_cycles_total{"), std::string::npos);
+    ASSERT_NE(exposition.find("# TYPE ddsrouter_topic_cpu_cycles counter\n"), std::string::npos);
+}
+
+/**
+ * Escape label values
+ *
+ * CASES:
+ *  Backslash, double quote and line feed are escaped
+ *  Rest of characters are kept
+ *  Topic and type names are escaped in the exposition
+ */
+TEST(OpenMetricsRendererTest, escape_label_value)
+{
+    ASSERT_EQ(OpenMetricsRenderer::escape_label_value(""), "");
+    ASSERT_EQ(OpenMetricsRenderer::escape_label_value("rt/chatter"), "rt/chatter");
+    ASSERT_EQ(OpenMetricsRenderer::escape_label_value("a\\b"), "a\\\\b");
+    ASSERT_EQ(OpenMetricsRenderer::escape_label_value("a\"b\""), "a\\\"b\\\"");
+    ASSERT_EQ(OpenMetricsRenderer::escape_label_value("a\nb"), "a\\nb");
+    ASSERT_EQ(OpenMetricsRenderer::escape_label_value("\\\"\n"), "\\\\\\\"\\n");
+
+    RouterStatistics statistics;
+    add_topic(statistics, DdsTopic("topic \"a\"", "type\\a"), "participant_1", "participant_2", 1, 10);
+
+    OpenMetricsRenderer renderer;
+    ASSERT_TRUE(has_line(renderer.render(statistics),
+            "ddsrouter_topic_received_samples_total{topic=\"topic \\\"a\\\"\",type=\"type\\\\a\"} 1"));
+}
+
+int main(
+        int argc,
+        char** argv)
+{
+    ::testing::InitGoogleTest(&argc, argv);
+    return RUN_ALL_TESTS();
+}